@@ -0,0 +1,142 @@
+#!/bin/bash
+# Reference counting: biased (owner-local) counts vs one atomic count.
+#
+# WHY THIS EXISTS: every retain/release was an atomic read-modify-write, even
+# though almost every string is only ever touched by the thread that built it.
+# Slab blocks now carry an owner id and a plain local count next to the atomic
+# shared count; the owner bumps the local count with an ordinary load/store,
+# other threads use the shared count, and strings handed across spawn or a
+# channel are promoted to the shared count once (wyn_rc_share). WYN_RC_BIAS=0
+# makes every block start out shared, i.e. the old single-atomic-count
+# behaviour, so one binary times both. This links src/wyn_rc.c into a C driver
+# and times:
+#   local      N retain/release pairs on one string by its owner
+#   churn      N/10 short-lived strings: alloc, retain, release, release
+#   shared     N retain/release pairs on a string after wyn_rc_share
+#   handoff    N/10 strings allocated by one thread, promoted and passed
+#              through a ring to a second thread that retains and frees them
+#   unshared   the same without the promotion (frees go through the owner's
+#              queue of deferred releases)
+# and prints ms for each with biasing on and off. Best of 3.
+#
+# Run from the wyn/ directory:
+#   ./benchmarks/biasedrc.sh
+set -uo pipefail
+cd "$(dirname "$0")/.."
+
+N="${N:-50000000}"
+
+TMP=$(mktemp -d)
+trap 'rm -rf "$TMP"' EXIT
+
+cat > "$TMP/bench.c" <<'EOF'
+#include <pthread.h>
+#include <sched.h>
+#include <stdatomic.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "wyn_rc.h"
+
+static long n;
+static double now_ms(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e3 + ts.tv_nsec / 1e6;
+}
+
+// The compiler must not fold retain/release pairs on the same pointer.
+static void* volatile sink;
+
+static double local_pairs(int shared) {
+    void* s = wyn_rc_alloc(32);
+    if (shared) wyn_rc_share(s);
+    double t0 = now_ms();
+    for (long i = 0; i < n; i++) {
+        void* p = sink = s;
+        wyn_rc_retain(p);
+        wyn_rc_release(sink);
+    }
+    double ms = now_ms() - t0;
+    wyn_rc_release(s);
+    return ms;
+}
+
+static double churn(void) {
+    double t0 = now_ms();
+    for (long i = 0; i < n / 10; i++) {
+        void* p = sink = wyn_rc_alloc(16 + (i & 63));
+        wyn_rc_retain(p);
+        wyn_rc_release(sink);
+        wyn_rc_release(sink);
+    }
+    return now_ms() - t0;
+}
+
+// Single-producer/single-consumer ring: the producer allocates, the consumer
+// holds each string briefly (retain + release) and drops the last reference.
+#define RING 1024
+static void* _Atomic ring[RING];
+static int promote;
+static void* consumer(void* arg) {
+    (void)arg;
+    for (long i = 0; i < n / 10; i++) {
+        void* p;
+        while (!(p = atomic_exchange_explicit(&ring[i % RING], NULL, memory_order_acquire))) sched_yield();
+        wyn_rc_retain(p);
+        wyn_rc_release(p);
+        wyn_rc_release(p);
+    }
+    return NULL;
+}
+static double handoff(int share) {
+    promote = share;
+    pthread_t t;
+    double t0 = now_ms();
+    pthread_create(&t, NULL, consumer, NULL);
+    for (long i = 0; i < n / 10; i++) {
+        void* p = wyn_rc_alloc(24);
+        if (promote) wyn_rc_share(p);
+        while (atomic_load_explicit(&ring[i % RING], memory_order_relaxed)) sched_yield();
+        atomic_store_explicit(&ring[i % RING], p, memory_order_release);
+        // The producer's allocations drain what the consumer queued.
+    }
+    pthread_join(t, NULL);
+    wyn_rc_drain();
+    return now_ms() - t0;
+}
+
+int main(int argc, char** argv) {
+    n = argc > 1 ? atol(argv[1]) : 50000000;
+    printf("%.0f %.0f %.0f %.0f %.0f\n", local_pairs(0), churn(), local_pairs(1),
+           handoff(1), handoff(0));
+    return 0;
+}
+EOF
+
+if ! cc -O2 -std=c11 -D_GNU_SOURCE -I src "$TMP/bench.c" src/wyn_rc.c -o "$TMP/bench" -lpthread 2> "$TMP/cc.log"; then
+    echo "BUILD FAILED"; sed -n '1,25p' "$TMP/cc.log"; exit 1
+fi
+
+run() {
+    local best=(0 0 0 0 0) out t
+    for _ in 1 2 3; do
+        out=$(env "$@" perl -e 'alarm(600); exec @ARGV' -- "$TMP/bench" "$N" 2>/dev/null)
+        read -r -a t <<< "$out"
+        [ "${#t[@]}" -eq 5 ] || { echo "FAILED: out=[$out]" >&2; exit 1; }
+        for k in 0 1 2 3 4; do
+            if [ "${best[$k]}" -eq 0 ] || [ "${t[$k]}" -lt "${best[$k]}" ]; then best[$k]=${t[$k]}; fi
+        done
+    done
+    echo "${best[*]}"
+}
+
+read -r -a biased <<< "$(run WYN_RC_BIAS=1)" || exit 1
+read -r -a atomic <<< "$(run WYN_RC_BIAS=0)" || exit 1
+
+echo "=== Reference counting, N=$N ==="
+printf "  %-9s %-10s %-10s\n" "workload" "biased" "atomic"
+names=(local churn shared handoff unshared)
+for k in 0 1 2 3 4; do
+    printf "  %-9s %-10s %-10s\n" "${names[$k]}" "${biased[$k]}ms" "${atomic[$k]}ms"
+done
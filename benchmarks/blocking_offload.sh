@@ -0,0 +1,81 @@
+#!/bin/bash
+# Coroutines making blocking calls, with and without the blocking-task pool.
+#
+# WHY THIS EXISTS: File/Process/Db/Log calls and Task.blocking used to run on
+# the scheduler worker that called them, so each one held a whole Processor
+# for its duration. wyn_blocking_run (src/spawn_fast.c) now runs them on a
+# separate bounded thread pool while the coroutine parks. This measures C
+# spawned coroutines each making R calls that block for MS milliseconds (a
+# popen of `sleep`, standing in for a slow disk or query) against the same
+# binary with WYN_BLOCKING_THREADS=0, which runs every call inline - the old
+# behaviour.
+#
+# The blocking time is wall clock, not CPU, so the gap grows as the core count
+# shrinks: with one worker per core, inline calls serialize per core. Times are
+# wall clock of the built program, best of 3.
+#
+# Run from the wyn/ directory:
+#   ./benchmarks/blocking_offload.sh
+set -uo pipefail
+cd "$(dirname "$0")/.."
+
+WYN="${WYN:-./wyn}"
+case "$WYN" in /*) ;; *) WYN="$(pwd)/$WYN" ;; esac
+C="${C:-32}"
+R="${R:-4}"
+MS="${MS:-50}"
+
+TMP=$(mktemp -d)
+trap 'rm -rf "$TMP"' EXIT
+
+SECS=$(python3 -c "print($MS / 1000)")
+cat > "$TMP/offload.wyn" <<WYN
+fn worker(k: int) -> int {
+    var ok = 0
+    var i = 0
+    while i < $R {
+        if Process.exec_capture("sleep $SECS; echo ok").trim() == "ok" { ok = ok + 1 }
+        i = i + 1
+    }
+    return ok
+}
+
+fn main() {
+    var fs = []
+    var i = 0
+    while i < $C {
+        fs.push(spawn worker(i))
+        i = i + 1
+    }
+    var ok = 0
+    for n in await_all(fs) {
+        ok = ok + n
+    }
+    println(ok)
+}
+WYN
+
+if ! "$WYN" build "$TMP/offload.wyn" -o "$TMP/offload.out" --release > "$TMP/build.log" 2>&1; then
+    echo "BUILD FAILED"; sed -n '1,25p' "$TMP/build.log"; exit 1
+fi
+
+# best_ms <threads>
+best_ms() {
+    local threads="$1" best="" start end ms got
+    for _ in 1 2 3; do
+        start=$(python3 -c 'import time; print(time.perf_counter_ns())')
+        got=$(WYN_BLOCKING_THREADS="$threads" perl -e 'alarm(300); exec @ARGV' -- "$TMP/offload.out" 2>/dev/null)
+        end=$(python3 -c 'import time; print(time.perf_counter_ns())')
+        [ "$got" = "$((C * R))" ] || { echo "FAILED: threads=$threads ok=$got" >&2; return 1; }
+        ms=$(( (end - start) / 1000000 ))
+        if [ -z "$best" ] || [ "$ms" -lt "$best" ]; then best=$ms; fi
+    done
+    echo "$best"
+}
+
+echo "=== ${C} coroutines x ${R} blocking calls of ${MS}ms ($(nproc 2>/dev/null || sysctl -n hw.ncpu) cores) ==="
+inline=$(best_ms 0) || exit 1
+pooled=$(best_ms 64) || exit 1
+ratio=$(python3 -c "print(f'{$inline / max($pooled, 1):.2f}x')")
+printf "  %-12s %-12s %s\n" "inline" "pooled" "speedup"
+printf "  %-12s %-12s %s\n" "${inline}ms" "${pooled}ms" "$ratio"
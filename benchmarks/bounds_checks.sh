@@ -0,0 +1,92 @@
+#!/bin/bash
+# Bounds-check elimination payoff (see the BCE block in codegen_lambda.c).
+#
+# WHY THIS EXISTS: `xs[i]` normally goes through a checked getter - negative-
+# index adjust, range compare, panic path - and inside a hot loop that call is
+# most of the work. In `for i in 0..xs.len()` the index is in range by
+# construction and codegen reads the element directly. This times the same
+# reduction written both ways: the `for` shape BCE recognises, and the
+# equivalent `while` loop, which it does not model and so keeps every check.
+# The arrays are identical (same layout, same fill), so the difference is the
+# checks alone.
+#
+# Both variants are built with `wyn build` (system cc, -O2). Times are wall
+# clock of the built binary, best of 3.
+#
+# Run from the wyn/ directory:
+#   ./benchmarks/bounds_checks.sh
+set -uo pipefail
+cd "$(dirname "$0")/.."
+
+WYN="${WYN:-./wyn}"
+case "$WYN" in /*) ;; *) WYN="$(pwd)/$WYN" ;; esac
+TMP=$(mktemp -d); trap 'rm -rf "$TMP"' EXIT
+N="${N:-2000000}"
+R="${R:-50}"
+
+# $1 = element type, $2 = element expression of i, $3 = loop shape (for|while)
+write_prog() {
+    local loop
+    if [ "$3" = "for" ]; then
+        loop="for j in 0..xs.len() {
+            acc = acc + xs[j]
+        }"
+    else
+        loop="var j = 0
+        while j < xs.len() {
+            acc = acc + xs[j]
+            j = j + 1
+        }"
+    fi
+    cat <<EOF
+fn main() {
+    var xs: [$1] = []
+    var i = 0
+    while i < $N {
+        xs.push($2)
+        i = i + 1
+    }
+    var acc: $1 = xs[0]
+    var r = 0
+    while r < $R {
+        $loop
+        r = r + 1
+    }
+    println(acc)
+}
+EOF
+}
+
+best_ms() {
+    local bin="$1" best="" start end ms
+    for _ in 1 2 3; do
+        start=$(python3 -c 'import time; print(time.perf_counter_ns())')
+        "$bin" >/dev/null || { echo "FAILED: $bin" >&2; return 1; }
+        end=$(python3 -c 'import time; print(time.perf_counter_ns())')
+        ms=$(( (end - start) / 1000000 ))
+        if [ -z "$best" ] || [ "$ms" -lt "$best" ]; then best=$ms; fi
+    done
+    echo "$best"
+}
+
+build() {
+    ( cd "$TMP" && "$WYN" build "$1.wyn" >/dev/null 2>&1 ) || { echo "build failed: $1" >&2; return 1; }
+    for c in "$TMP/$1" "$TMP/$1.out" "$TMP/$1.wyn.out"; do
+        [ -x "$c" ] && { echo "$c"; return 0; }
+    done
+    echo "no binary for $1" >&2; return 1
+}
+
+echo "=== checked vs unchecked array loops (N=$N x $R, wyn build) ==="
+printf "  %-10s %-10s %-10s %s\n" "element" "checked" "unchecked" "speedup"
+for spec in "int|(i * 7919) % 1000003" "float|((i * 7919) % 1000003) * 0.5"; do
+    ty="${spec%%|*}"; el="${spec#*|}"
+    write_prog "$ty" "$el" for > "$TMP/for_$ty.wyn"
+    write_prog "$ty" "$el" while > "$TMP/while_$ty.wyn"
+    fb=$(build "for_$ty") || exit 1
+    wb=$(build "while_$ty") || exit 1
+    f=$(best_ms "$fb") || exit 1
+    w=$(best_ms "$wb") || exit 1
+    ratio=$(python3 -c "print(f'{$w / max($f, 1):.2f}x')")
+    printf "  %-10s %-10s %-10s %s\n" "[$ty]" "${w}ms" "${f}ms" "$ratio"
+done
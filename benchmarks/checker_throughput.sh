@@ -0,0 +1,92 @@
+#!/bin/bash
+# Type-checker throughput on a synthetic large program.
+#
+# WHY THIS EXISTS: definition lookups (find_struct_definition & co.) used to scan
+# every top-level statement and are called from inside check_expr, so `wyn check`
+# was O(statements x expressions). Generated-code modules of 50K+ lines took tens
+# of seconds to check. The checker now builds a per-program hash index; this
+# script is the regression guard - if checking time stops scaling roughly
+# linearly with N, something reintroduced a per-expression scan.
+#
+# The generated program has N structs, N payload enums and N functions, each of
+# which builds a struct literal, a BARE enum constructor and a match - the three
+# lookup paths the index serves (struct, enum, variant).
+#
+# The first row is startup: `wyn check` on an empty program, i.e. process start +
+# init_checker(). The ~700 builtin names used to be registered symbol by symbol
+# on every run; they are now a static table generated at build time
+# (src/checker_builtins_table.h), so this should stay around a millisecond.
+# Median of 50 runs - it is too short for best-of-3 to mean much.
+#
+# Run from the wyn/ directory:
+#   ./benchmarks/checker_throughput.sh              # N = 1000 2000 5000
+#   ./benchmarks/checker_throughput.sh 10000        # custom sizes
+set -uo pipefail
+cd "$(dirname "$0")/.."
+
+WYN="${WYN:-./wyn}"
+case "$WYN" in /*) ;; *) WYN="$(pwd)/$WYN" ;; esac
+SIZES="${*:-1000 2000 5000}"
+TMP=$(mktemp -d); trap 'rm -rf "$TMP"' EXIT
+
+gen() {
+    local n="$1" out="$2"
+    python3 - "$n" > "$out" <<'EOF'
+import sys
+n = int(sys.argv[1])
+for i in range(n):
+    print(f"struct S{i} {{ a: int, b: int, name: string }}")
+    print(f"enum E{i} {{ V{i}A(int), V{i}B(int, int) }}")
+for i in range(n):
+    print(f"""fn f{i}(x: int) -> int {{
+    var s = S{i} {{ a: x, b: x + 1, name: "n" }}
+    var e = V{i}A(s.a)
+    var r = match e {{
+        V{i}A(v) => v + s.b,
+        V{i}B(p, q) => p * q
+    }}
+    return r
+}}""")
+print("fn main() {")
+print("    var t = 0")
+for i in range(0, n, 50):
+    print(f"    t = t + f{i}({i})")
+print("    println(t)")
+print("}")
+EOF
+}
+
+echo "=== wyn check startup (empty program) ==="
+echo 'fn main() {}' > "$TMP/empty.wyn"
+python3 - "$WYN" "$TMP/empty.wyn" <<'EOF'
+import statistics, subprocess, sys, time
+wyn, src = sys.argv[1], sys.argv[2]
+runs = []
+for _ in range(50):
+    t = time.perf_counter()
+    subprocess.run([wyn, "check", src], stdout=subprocess.DEVNULL, stderr=subprocess.DEVNULL)
+    runs.append(time.perf_counter() - t)
+print(f"  median {statistics.median(runs) * 1e3:.2f}ms  min {min(runs) * 1e3:.2f}ms  (50 runs)")
+EOF
+echo
+
+echo "=== wyn check throughput (synthetic program) ==="
+printf "  %-8s %-8s %-10s %s\n" "N" "lines" "time" "lines/s"
+for n in $SIZES; do
+    f="$TMP/big_$n.wyn"
+    gen "$n" "$f"
+    lines=$(wc -l < "$f" | tr -d ' ')
+    # Best of 3: the first run also pays page-cache and dynamic-linker costs.
+    best=""
+    for _ in 1 2 3; do
+        start=$(python3 -c 'import time; print(time.perf_counter_ns())')
+        if ! "$WYN" check "$f" > "$TMP/out.log" 2>&1; then
+            echo "  N=$n: wyn check FAILED"; sed 's/^/    /' "$TMP/out.log" | head -10; exit 1
+        fi
+        end=$(python3 -c 'import time; print(time.perf_counter_ns())')
+        ms=$(( (end - start) / 1000000 ))
+        if [ -z "$best" ] || [ "$ms" -lt "$best" ]; then best=$ms; fi
+    done
+    rate=$(( best > 0 ? lines * 1000 / best : 0 ))
+    printf "  %-8s %-8s %-10s %s\n" "$n" "$lines" "${best}ms" "$rate"
+done
@@ -0,0 +1,147 @@
+#!/bin/bash
+# Collection throughput: Queue as a BFS frontier and PriorityQueue as a
+# Dijkstra-style work list.
+#
+# WHY THIS EXISTS: Queue used to be a WynArray whose pop shifted every
+# remaining element down one slot, so draining N items was O(N^2) and a BFS
+# over a large graph stalled; there was no heap at all, so "pop the smallest"
+# meant re-sorting or a linear scan. Queue, Stack and Deque are now one
+# power-of-two ring buffer of 64-bit values, and PriorityQueue is a binary
+# min-heap monomorphized per element type. This times:
+#   bfs         breadth-first search over a SIDE x SIDE grid (default 1000,
+#               so 1M nodes) with Queue as the frontier
+#   heap        N random ints pushed into PriorityQueue::new() and popped
+#   heap_cmp    the same through PriorityQueue::new_by(cmp), which calls the
+#               comparator through a function pointer
+#   sort        the same N ints through [int].sort(), for reference
+# Best of 3.
+#
+# Run from the wyn/ directory:
+#   ./benchmarks/collections.sh
+set -uo pipefail
+cd "$(dirname "$0")/.."
+
+WYN="${WYN:-./wyn}"
+case "$WYN" in /*) ;; *) WYN="$(pwd)/$WYN" ;; esac
+SIDE="${SIDE:-1000}"
+N="${N:-1000000}"
+
+TMP=$(mktemp -d)
+trap 'rm -rf "$TMP"' EXIT
+
+cat > "$TMP/bench.wyn" <<WYN
+fn desc(a: int, b: int) -> bool {
+    return a > b
+}
+
+fn main() {
+    var side = $SIDE
+    var seen = []
+    var i = 0
+    while i < side * side {
+        seen.push(0)
+        i = i + 1
+    }
+    var t0 = Time.now_millis()
+    var q = Queue::new()
+    Queue::push(q, 0)
+    seen[0] = 1
+    var visited = 0
+    while not Queue::is_empty(q) {
+        var v = Queue::pop(q)
+        visited = visited + 1
+        var r = v / side
+        var c = v % side
+        if c + 1 < side and seen[v + 1] == 0 {
+            seen[v + 1] = 1
+            Queue::push(q, v + 1)
+        }
+        if r + 1 < side and seen[v + side] == 0 {
+            seen[v + side] = 1
+            Queue::push(q, v + side)
+        }
+        if c > 0 and seen[v - 1] == 0 {
+            seen[v - 1] = 1
+            Queue::push(q, v - 1)
+        }
+        if r > 0 and seen[v - side] == 0 {
+            seen[v - side] = 1
+            Queue::push(q, v - side)
+        }
+    }
+    var bfs_ms = Time.now_millis() - t0
+
+    var xs = []
+    var seed = 42
+    i = 0
+    while i < $N {
+        seed = (seed * 1103515245 + 12345) % 2147483648
+        xs.push(seed)
+        i = i + 1
+    }
+
+    t0 = Time.now_millis()
+    var h = PriorityQueue::new()
+    for x in xs {
+        PriorityQueue::push(h, x)
+    }
+    var last = 0
+    var bad = 0
+    while not PriorityQueue::is_empty(h) {
+        var x = PriorityQueue::pop(h)
+        if x < last {
+            bad = bad + 1
+        }
+        last = x
+    }
+    var heap_ms = Time.now_millis() - t0
+
+    t0 = Time.now_millis()
+    var g = PriorityQueue::new_by(desc)
+    for x in xs {
+        PriorityQueue::push(g, x)
+    }
+    last = 2147483648
+    while not PriorityQueue::is_empty(g) {
+        var x = PriorityQueue::pop(g)
+        if x > last {
+            bad = bad + 1
+        }
+        last = x
+    }
+    var cmp_ms = Time.now_millis() - t0
+
+    t0 = Time.now_millis()
+    var sorted = xs.sort()
+    var sort_ms = Time.now_millis() - t0
+
+    if visited != side * side or bad != 0 or sorted.len() != $N {
+        println("FAILED")
+    }
+    println("\${bfs_ms} \${heap_ms} \${cmp_ms} \${sort_ms}")
+}
+WYN
+
+if ! "$WYN" build "$TMP/bench.wyn" -o "$TMP/bench.out" --release > "$TMP/build.log" 2>&1; then
+    echo "BUILD FAILED"; sed -n '1,25p' "$TMP/build.log"; exit 1
+fi
+
+best=(0 0 0 0)
+for _ in 1 2 3; do
+    out=$(perl -e 'alarm(900); exec @ARGV' -- "$TMP/bench.out" 2>/dev/null)
+    read -r -a t <<< "$out"
+    [ "${#t[@]}" -eq 4 ] || { echo "FAILED: out=[$out]"; exit 1; }
+    for k in 0 1 2 3; do
+        if [ "${best[$k]}" -eq 0 ] || [ "${t[$k]}" -lt "${best[$k]}" ]; then best[$k]=${t[$k]}; fi
+    done
+done
+
+rate() { python3 -c "print(f'{$1 * 1000 / max($2, 1):,.0f}')"; }
+echo "=== BFS over a ${SIDE}x${SIDE} grid ==="
+printf "  %-10s %-10s %s\n" "mode" "time" "nodes/s"
+printf "  %-10s %-10s %s\n" "bfs" "${best[0]}ms" "$(rate "$((SIDE * SIDE))" "${best[0]}")"
+echo "=== ${N} ints, push all then pop all ==="
+printf "  %-10s %-10s %s\n" "mode" "time" "items/s"
+printf "  %-10s %-10s %s\n" "heap" "${best[1]}ms" "$(rate "$N" "${best[1]}")"
+printf "  %-10s %-10s %s\n" "heap_cmp" "${best[2]}ms" "$(rate "$N" "${best[2]}")"
+printf "  %-10s %-10s %s\n" "sort" "${best[3]}ms" "$(rate "$N" "${best[3]}")"
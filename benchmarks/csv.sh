@@ -0,0 +1,155 @@
+#!/bin/bash
+# CSV throughput: the streaming reader (Csv.open / Csv.open_part) on a large
+# file, and the in-memory Csv.parse on a smaller one.
+#
+# WHY THIS EXISTS: Csv.parse needs the whole file as one string plus a copy of
+# every field, so a multi-GB export could not be read at all. Csv.open streams
+# the file through a fixed window with an SSE2 row scanner and hands out
+# fields as slices of that window; Csv.get_int/get_float parse in place, and
+# Csv.open_part splits the file into byte ranges for spawned workers. This
+# generates a GB-sized CSV (id,qty,price,name; default 5GB, GB=... to change)
+# and times, summing qty and price over every row:
+#   stream      one Csv.open reader
+#   parts       Csv.open_part across PARTS spawned workers (default: nproc)
+#   parse       File.read + Csv.parse + Csv.get on the first SMALL_MB of rows
+# and prints MB/s for each. Best of 3 (the big file: best of RUNS, default 1).
+#
+# Run from the wyn/ directory:
+#   ./benchmarks/csv.sh
+set -uo pipefail
+cd "$(dirname "$0")/.."
+
+WYN="${WYN:-./wyn}"
+case "$WYN" in /*) ;; *) WYN="$(pwd)/$WYN" ;; esac
+GB="${GB:-5}"
+SMALL_MB="${SMALL_MB:-100}"
+PARTS="${PARTS:-$(nproc 2>/dev/null || echo 4)}"
+RUNS="${RUNS:-1}"
+
+TMP=$(mktemp -d "${TMPDIR:-/tmp}/wyncsv.XXXXXX")
+trap 'rm -rf "$TMP"' EXIT
+
+cat > "$TMP/gen.c" <<'C'
+#include <stdio.h>
+#include <stdlib.h>
+int main(int argc, char** argv) {
+    long long limit = (long long)(atof(argv[2]) * 1024 * 1024);
+    FILE* f = fopen(argv[1], "w");
+    static char buf[1 << 20];
+    setvbuf(f, buf, _IOFBF, sizeof buf);
+    long long n = fprintf(f, "id,qty,price,name\n");
+    for (long long i = 1; n < limit; i++) {
+        if (i % 10 == 0) n += fprintf(f, "%lld,%lld,%lld.%02lld,\"item, %lld \"\"x\"\"\"\n", i, i % 13, i % 1000, i % 100, i);
+        else n += fprintf(f, "%lld,%lld,%lld.%02lld,item%lld\n", i, i % 13, i % 1000, i % 100, i);
+    }
+    fclose(f);
+    return 0;
+}
+C
+cc -O2 "$TMP/gen.c" -o "$TMP/gen" || exit 1
+"$TMP/gen" "$TMP/big.csv" "$((GB * 1024))"
+"$TMP/gen" "$TMP/small.csv" "$SMALL_MB"
+BIG_MB=$(( $(stat -c %s "$TMP/big.csv") / 1048576 ))
+
+cat > "$TMP/stream.wyn" <<WYN
+fn scan(path: string, part: int, parts: int) -> int {
+    var r = Csv.open_part(path, part, parts)
+    var q = Csv.column(r, "qty")
+    var p = Csv.column(r, "price")
+    var qty = 0
+    var cents = 0
+    if part == 0 {
+        Csv.next(r)
+    }
+    while Csv.next(r) {
+        qty = qty + Csv.get_int(r, q)
+        cents = cents + (Csv.get_float(r, p) * 100.0 + 0.5).to_int()
+    }
+    Csv.close(r)
+    return qty + cents
+}
+
+fn main() {
+    var path = "$TMP/big.csv"
+    var t0 = Time.now_millis()
+    var one = scan(path, 0, 1)
+    var stream_ms = Time.now_millis() - t0
+
+    t0 = Time.now_millis()
+    var fs = []
+    var k = 0
+    while k < $PARTS {
+        fs.push(spawn scan(path, k, $PARTS))
+        k = k + 1
+    }
+    var many = 0
+    for s in await_all(fs) {
+        many = many + s
+    }
+    var parts_ms = Time.now_millis() - t0
+
+    if one != many {
+        println("FAILED")
+    }
+    println(stream_ms.to_string() + " " + parts_ms.to_string())
+}
+WYN
+
+cat > "$TMP/parse.wyn" <<WYN
+fn main() {
+    var t0 = Time.now_millis()
+    var d = Csv.parse(File.read("$TMP/small.csv"))
+    var n = Csv.row_count(d)
+    var qty = 0
+    var i = 1
+    while i < n {
+        qty = qty + Csv.get(d, i, 1).to_int()
+        i = i + 1
+    }
+    var parse_ms = Time.now_millis() - t0
+
+    var r = Csv.open("$TMP/small.csv")
+    Csv.next(r)
+    t0 = Time.now_millis()
+    var qty2 = 0
+    while Csv.next(r) {
+        qty2 = qty2 + Csv.get_int(r, 1)
+    }
+    var stream_ms = Time.now_millis() - t0
+    if qty != qty2 {
+        println("FAILED")
+    }
+    println(parse_ms.to_string() + " " + stream_ms.to_string())
+}
+WYN
+
+for prog in stream parse; do
+    if ! "$WYN" build "$TMP/$prog.wyn" -o "$TMP/$prog.out" --release > "$TMP/build.log" 2>&1; then
+        echo "BUILD FAILED ($prog)"; sed -n '1,25p' "$TMP/build.log"; exit 1
+    fi
+done
+
+best() { if [ "$1" -eq 0 ] || [ "$2" -lt "$1" ]; then echo "$2"; else echo "$1"; fi; }
+bs=0; bp=0
+for _ in $(seq "$RUNS"); do
+    out=$(perl -e 'alarm(3600); exec @ARGV' -- "$TMP/stream.out" 2>/dev/null)
+    read -r -a t <<< "$out"
+    [ "${#t[@]}" -eq 2 ] || { echo "FAILED: out=[$out]"; exit 1; }
+    bs=$(best "$bs" "${t[0]}"); bp=$(best "$bp" "${t[1]}")
+done
+sp=0; ss=0
+for _ in 1 2 3; do
+    out=$(perl -e 'alarm(900); exec @ARGV' -- "$TMP/parse.out" 2>/dev/null)
+    read -r -a t <<< "$out"
+    [ "${#t[@]}" -eq 2 ] || { echo "FAILED: out=[$out]"; exit 1; }
+    sp=$(best "$sp" "${t[0]}"); ss=$(best "$ss" "${t[1]}")
+done
+
+rate() { python3 -c "print(f'{$1 * 1000 / max($2, 1):,.0f}')"; }
+echo "=== ${BIG_MB}MB CSV, sum of two typed columns ==="
+printf "  %-22s %-10s %s\n" "mode" "time" "MB/s"
+printf "  %-22s %-10s %s\n" "stream" "${bs}ms" "$(rate "$BIG_MB" "$bs")"
+printf "  %-22s %-10s %s\n" "parts x${PARTS}" "${bp}ms" "$(rate "$BIG_MB" "$bp")"
+echo "=== ${SMALL_MB}MB CSV, sum of one column ==="
+printf "  %-22s %-10s %s\n" "File.read + Csv.parse" "${sp}ms" "$(rate "$SMALL_MB" "$sp")"
+printf "  %-22s %-10s %s\n" "stream" "${ss}ms" "$(rate "$SMALL_MB" "$ss")"
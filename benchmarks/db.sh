@@ -0,0 +1,91 @@
+#!/bin/bash
+# SQLite inserts and reads through the Db module: statement cache and cursors.
+#
+# WHY THIS EXISTS: every Db.exec_p / Db.query_p used to sqlite3_prepare_v2 its
+# SQL, run it once and finalize, and every read came back as one '|'/'\n'
+# joined string the caller had to split and re-parse. Connections now keep an
+# LRU of prepared statements keyed by SQL text (WYN_DB_STMT_CACHE, 0 = off),
+# and Db.cursor / Db.next / Db.get_* step rows with typed column reads. This
+# inserts N rows one Db.exec_p at a time inside one transaction, then sums a
+# column two ways: a cursor with Db.get_int, and Db.query plus split/to_int.
+# Both phases run with the cache on and with WYN_DB_STMT_CACHE=0 (the old
+# prepare-per-call behaviour). Times are measured inside the program with
+# Time.now_millis, best of 3.
+#
+# Run from the wyn/ directory:
+#   ./benchmarks/db.sh
+set -uo pipefail
+cd "$(dirname "$0")/.."
+
+WYN="${WYN:-./wyn}"
+case "$WYN" in /*) ;; *) WYN="$(pwd)/$WYN" ;; esac
+N="${N:-1000000}"
+
+TMP=$(mktemp -d)
+trap 'rm -rf "$TMP"' EXIT
+
+cat > "$TMP/db.wyn" <<WYN
+fn main() {
+    var db = Db.open(":memory:")
+    Db.exec(db, "CREATE TABLE t(id INTEGER, name TEXT, v INTEGER)")
+    var t0 = Time.now_millis()
+    Db.exec(db, "BEGIN")
+    var i = 0
+    while i < $N {
+        Db.exec_p(db, "INSERT INTO t VALUES (?, ?, ?)", [i.to_string(), "row", (i % 100).to_string()])
+        i = i + 1
+    }
+    Db.exec(db, "COMMIT")
+    var t1 = Time.now_millis()
+    var a = 0
+    var cur = Db.cursor(db, "SELECT id, v FROM t")
+    while Db.next(cur) {
+        a = a + Db.get_int(cur, 1)
+    }
+    Db.close_cursor(cur)
+    var t2 = Time.now_millis()
+    var b = 0
+    for line in Db.query(db, "SELECT id, v FROM t").split("\n") {
+        var cols = line.split("|")
+        if cols.len() == 2 {
+            b = b + cols[1].to_int()
+        }
+    }
+    var t3 = Time.now_millis()
+    if a != b {
+        println("MISMATCH")
+    }
+    var ins = t1 - t0
+    var cms = t2 - t1
+    var qms = t3 - t2
+    println(ins.to_string() + " " + cms.to_string() + " " + qms.to_string())
+}
+WYN
+
+if ! "$WYN" build "$TMP/db.wyn" -o "$TMP/db.out" --release > "$TMP/build.log" 2>&1; then
+    echo "BUILD FAILED"; sed -n '1,25p' "$TMP/build.log"; exit 1
+fi
+
+# best <cache>: prints "insert cursor query" ms, each the best of 3 runs
+best() {
+    local cache="$1" bi="" bc="" bq="" out i c q
+    for _ in 1 2 3; do
+        out=$(WYN_DB_STMT_CACHE="$cache" perl -e 'alarm(600); exec @ARGV' -- "$TMP/db.out" 2>/dev/null)
+        read -r i c q <<< "$out"
+        [ -n "$q" ] || { echo "FAILED: cache=$cache out=[$out]" >&2; return 1; }
+        if [ -z "$bi" ] || [ "$i" -lt "$bi" ]; then bi=$i; fi
+        if [ -z "$bc" ] || [ "$c" -lt "$bc" ]; then bc=$c; fi
+        if [ -z "$bq" ] || [ "$q" -lt "$bq" ]; then bq=$q; fi
+    done
+    echo "$bi $bc $bq"
+}
+
+echo "=== ${N} rows, :memory: database ==="
+read -r i0 c0 q0 <<< "$(best 0)" || exit 1
+read -r i1 c1 q1 <<< "$(best 64)" || exit 1
+[ -n "$q0" ] && [ -n "$q1" ] || exit 1
+printf "  %-26s %-12s %-12s %s\n" "" "cache off" "cache on" "speedup"
+printf "  %-26s %-12s %-12s %s\n" "insert (Db.exec_p)" "${i0}ms" "${i1}ms" "$(python3 -c "print(f'{$i0 / max($i1, 1):.2f}x')")"
+printf "  %-26s %-12s %-12s\n" "sum via Db.cursor" "${c0}ms" "${c1}ms"
+printf "  %-26s %-12s %-12s\n" "sum via Db.query + split" "${q0}ms" "${q1}ms"
+printf "  cursor vs query+split: %s\n" "$(python3 -c "print(f'{$q1 / max($c1, 1):.2f}x')")"
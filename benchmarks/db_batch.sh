@@ -0,0 +1,111 @@
+#!/bin/bash
+# Bulk inserts into an on-disk SQLite database: Db.batch vs one Db.exec_p per row.
+#
+# WHY THIS EXISTS: loading rows through Db.exec_p means one statement call per
+# row, and outside an explicit transaction each row is its own autocommit
+# transaction - one fsync per row. Db.batch (src/wyn_runtime.h) runs one cached
+# statement over a whole array of rows in a single blocking-pool job and
+# commits every Db.set_batch_size rows (default 50000); Db.set_import_mode
+# adds WAL + synchronous=NORMAL. This times, on a file database:
+#   autocommit   Db.exec_p per row, no transaction (A rows - it is slow)
+#   tx+exec_p    Db.exec_p per row inside one Db.transaction block
+#   batch        Db.batch over the same rows
+#   batch+import Db.batch with Db.set_import_mode(db, true)
+# and prints rows/second for each. Best of 3, measured inside the program.
+#
+# Run from the wyn/ directory:
+#   ./benchmarks/db_batch.sh
+set -uo pipefail
+cd "$(dirname "$0")/.."
+
+WYN="${WYN:-./wyn}"
+case "$WYN" in /*) ;; *) WYN="$(pwd)/$WYN" ;; esac
+N="${N:-1000000}"
+A="${A:-2000}"
+
+TMP=$(mktemp -d)
+trap 'rm -rf "$TMP"' EXIT
+
+cat > "$TMP/bulk.wyn" <<WYN
+fn fresh(path: string) -> int {
+    File.delete(path)
+    File.delete(path + "-wal")
+    File.delete(path + "-shm")
+    var db = Db.open(path)
+    Db.exec(db, "CREATE TABLE t(id INTEGER, v INTEGER)")
+    return db
+}
+
+fn main() {
+    var path = "$TMP/bulk.db"
+    var rows = []
+    var i = 0
+    while i < $N {
+        rows.push(i)
+        rows.push(i % 100)
+        i = i + 1
+    }
+
+    var db = fresh(path)
+    var t0 = Time.now_millis()
+    i = 0
+    while i < $A {
+        Db.exec_p(db, "INSERT INTO t VALUES (?, ?)", [i.to_string(), (i % 100).to_string()])
+        i = i + 1
+    }
+    var auto_ms = Time.now_millis() - t0
+    Db.close(db)
+
+    db = fresh(path)
+    t0 = Time.now_millis()
+    Db.transaction(db) {
+        i = 0
+        while i < $N {
+            Db.exec_p(db, "INSERT INTO t VALUES (?, ?)", [i.to_string(), (i % 100).to_string()])
+            i = i + 1
+        }
+    }
+    var tx_ms = Time.now_millis() - t0
+    Db.close(db)
+
+    db = fresh(path)
+    t0 = Time.now_millis()
+    var n1 = Db.batch(db, "INSERT INTO t VALUES (?, ?)", rows)
+    var batch_ms = Time.now_millis() - t0
+    Db.close(db)
+
+    db = fresh(path)
+    Db.set_import_mode(db, true)
+    t0 = Time.now_millis()
+    var n2 = Db.batch(db, "INSERT INTO t VALUES (?, ?)", rows)
+    var import_ms = Time.now_millis() - t0
+    Db.close(db)
+
+    if n1 != $N or n2 != $N {
+        println("FAILED")
+    }
+    println(auto_ms.to_string() + " " + tx_ms.to_string() + " " + batch_ms.to_string() + " " + import_ms.to_string())
+}
+WYN
+
+if ! "$WYN" build "$TMP/bulk.wyn" -o "$TMP/bulk.out" --release > "$TMP/build.log" 2>&1; then
+    echo "BUILD FAILED"; sed -n '1,25p' "$TMP/build.log"; exit 1
+fi
+
+best=(0 0 0 0)
+for _ in 1 2 3; do
+    out=$(perl -e 'alarm(900); exec @ARGV' -- "$TMP/bulk.out" 2>/dev/null)
+    read -r -a t <<< "$out"
+    [ "${#t[@]}" -eq 4 ] || { echo "FAILED: out=[$out]"; exit 1; }
+    for k in 0 1 2 3; do
+        if [ "${best[$k]}" -eq 0 ] || [ "${t[$k]}" -lt "${best[$k]}" ]; then best[$k]=${t[$k]}; fi
+    done
+done
+
+rate() { python3 -c "print(f'{$1 * 1000 / max($2, 1):,.0f}')"; }
+echo "=== on-disk database, ${N} rows (autocommit: ${A} rows) ==="
+printf "  %-14s %-10s %s\n" "mode" "time" "rows/s"
+printf "  %-14s %-10s %s\n" "autocommit" "${best[0]}ms" "$(rate "$A" "${best[0]}")"
+printf "  %-14s %-10s %s\n" "tx+exec_p" "${best[1]}ms" "$(rate "$N" "${best[1]}")"
+printf "  %-14s %-10s %s\n" "batch" "${best[2]}ms" "$(rate "$N" "${best[2]}")"
+printf "  %-14s %-10s %s\n" "batch+import" "${best[3]}ms" "$(rate "$N" "${best[3]}")"
@@ -0,0 +1,109 @@
+#!/bin/bash
+# HashSet throughput: dedup of a large id list and bulk set algebra.
+#
+# WHY THIS EXISTS: HashSet was a fixed 128-bucket chained table that never
+# grew, so membership turned into a linear chain walk past ~10K elements and
+# every add paid a malloc plus a strdup. src/hashset.c is now an open-addressing
+# table probed 16 control bytes at a time with SSE2/NEON, specialized for int
+# and string keys, with union/intersection/difference done in bulk. This times,
+# over N ids (default 1M) of which about half are distinct:
+#   dedup_int   s.add(id) for every int id, then s.len()
+#   dedup_str   the same with "id-<n>" strings
+#   lookup      N s.contains(id) probes, half of them misses
+#   algebra     union + intersection + difference of two N/2-element int sets
+# and prints ops/s for each. Best of 3.
+#
+# Run from the wyn/ directory:
+#   ./benchmarks/hashset.sh
+set -uo pipefail
+cd "$(dirname "$0")/.."
+
+WYN="${WYN:-./wyn}"
+case "$WYN" in /*) ;; *) WYN="$(pwd)/$WYN" ;; esac
+N="${N:-1000000}"
+
+TMP=$(mktemp -d)
+trap 'rm -rf "$TMP"' EXIT
+
+cat > "$TMP/bench.wyn" <<WYN
+fn main() {
+    var n = $N
+    var ids = []
+    var strs = []
+    var seed = 7
+    var i = 0
+    while i < n {
+        seed = (seed * 1103515245 + 12345) % 2147483648
+        ids.push(seed % (n / 2))
+        strs.push("id-" + (seed % (n / 2)).to_string())
+        i = i + 1
+    }
+
+    var t0 = Time.now_millis()
+    var s = HashSet::new()
+    for id in ids {
+        s.add(id)
+    }
+    var distinct = s.len()
+    var int_ms = Time.now_millis() - t0
+
+    t0 = Time.now_millis()
+    var ss = HashSet::new()
+    for k in strs {
+        ss.add(k)
+    }
+    var str_ms = Time.now_millis() - t0
+
+    t0 = Time.now_millis()
+    var hits = 0
+    i = 0
+    while i < n {
+        if s.contains(i) {
+            hits = hits + 1
+        }
+        i = i + 1
+    }
+    var lookup_ms = Time.now_millis() - t0
+
+    var a = HashSet::new()
+    var b = HashSet::new()
+    i = 0
+    while i < n / 2 {
+        a.add(i)
+        b.add(i + n / 4)
+        i = i + 1
+    }
+    t0 = Time.now_millis()
+    var u = a.union(b)
+    var x = a.intersection(b)
+    var d = a.difference(b)
+    var alg_ms = Time.now_millis() - t0
+
+    if distinct != ss.len() or hits != distinct or u.len() != n * 3 / 4 or x.len() != n / 4 or d.len() != n / 4 {
+        println("FAILED")
+    }
+    println("\${int_ms} \${str_ms} \${lookup_ms} \${alg_ms}")
+}
+WYN
+
+if ! "$WYN" build "$TMP/bench.wyn" -o "$TMP/bench.out" --release > "$TMP/build.log" 2>&1; then
+    echo "BUILD FAILED"; sed -n '1,25p' "$TMP/build.log"; exit 1
+fi
+
+best=(0 0 0 0)
+for _ in 1 2 3; do
+    out=$(perl -e 'alarm(900); exec @ARGV' -- "$TMP/bench.out" 2>/dev/null)
+    read -r -a t <<< "$out"
+    [ "${#t[@]}" -eq 4 ] || { echo "FAILED: out=[$out]"; exit 1; }
+    for k in 0 1 2 3; do
+        if [ "${best[$k]}" -eq 0 ] || [ "${t[$k]}" -lt "${best[$k]}" ]; then best[$k]=${t[$k]}; fi
+    done
+done
+
+rate() { python3 -c "print(f'{$1 * 1000 / max($2, 1):,.0f}')"; }
+echo "=== HashSet over ${N} ids ==="
+printf "  %-10s %-10s %s\n" "mode" "time" "ops/s"
+printf "  %-10s %-10s %s\n" "dedup_int" "${best[0]}ms" "$(rate "$N" "${best[0]}")"
+printf "  %-10s %-10s %s\n" "dedup_str" "${best[1]}ms" "$(rate "$N" "${best[1]}")"
+printf "  %-10s %-10s %s\n" "lookup" "${best[2]}ms" "$(rate "$N" "${best[2]}")"
+printf "  %-10s %-10s %s\n" "algebra" "${best[3]}ms" "$(rate "$((N * 3 / 2))" "${best[3]}")"
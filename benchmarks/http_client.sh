@@ -0,0 +1,154 @@
+#!/bin/bash
+# HTTP client throughput against a local loopback server.
+#
+# WHY THIS EXISTS: the client (wyn_http_fetch in src/net_advanced.c) keeps a
+# keep-alive pool per host:port and parks coroutines on the io_loop reactor
+# instead of blocking a worker in recv(). This measures both halves against the
+# loopback server below:
+#   * sequential  - one caller, back-to-back GETs: what connection reuse buys
+#                   (no connect/accept/close per request).
+#   * concurrent  - C spawned coroutines each issuing R GETs: a blocked worker
+#                   would serialize these; parked coroutines overlap them.
+# Each row runs the same client binary twice: pooled (the default) and with
+# WYN_HTTP_POOL_MAX=0, which disables the pool and sends Connection: close -
+# the old one-socket-per-request behaviour.
+#
+# Loopback only, so this is a runtime number, not a network one. Times are wall
+# clock of the built client, best of 3. The machine should be idle.
+#
+# The server is a small asyncio responder, not a Wyn program: the client is
+# what is under test, and a server written in the same runtime would fold its
+# own scheduling into both columns.
+#
+# Run from the wyn/ directory:
+#   ./benchmarks/http_client.sh
+set -uo pipefail
+set +m 2>/dev/null
+cd "$(dirname "$0")/.."
+
+WYN="${WYN:-./wyn}"
+case "$WYN" in /*) ;; *) WYN="$(pwd)/$WYN" ;; esac
+PORT="${PORT:-18097}"
+N="${N:-5000}"
+C="${C:-200}"
+R="${R:-25}"
+
+TMP=$(mktemp -d)
+SRV_PID=""
+cleanup() {
+    [ -n "$SRV_PID" ] && kill -9 "$SRV_PID" 2>/dev/null
+    rm -rf "$TMP"
+}
+trap cleanup EXIT INT TERM
+ulimit -n 8192 2>/dev/null
+
+cat > "$TMP/srv.py" <<'PY'
+import asyncio, sys
+
+async def handle(reader, writer):
+    try:
+        while True:
+            head = await reader.readuntil(b"\r\n\r\n")
+            close = b"connection: close" in head.lower()
+            writer.write(b"HTTP/1.1 200 OK\r\nContent-Length: 5\r\n"
+                         + (b"Connection: close\r\n" if close else b"") + b"\r\nhello")
+            await writer.drain()
+            if close:
+                break
+    except (asyncio.IncompleteReadError, ConnectionError):
+        pass
+    writer.close()
+
+async def main():
+    srv = await asyncio.start_server(handle, "127.0.0.1", int(sys.argv[1]), backlog=4096)
+    async with srv:
+        await srv.serve_forever()
+
+asyncio.run(main())
+PY
+
+cat > "$TMP/seq.wyn" <<WYN
+fn main() {
+    var ok = 0
+    var i = 0
+    while i < $N {
+        if Http.get("http://127.0.0.1:$PORT/") == "hello" { ok = ok + 1 }
+        i = i + 1
+    }
+    println(ok)
+}
+WYN
+
+cat > "$TMP/conc.wyn" <<WYN
+fn worker(k: int) -> int {
+    var ok = 0
+    var i = 0
+    while i < $R {
+        if Http.get("http://127.0.0.1:$PORT/") == "hello" { ok = ok + 1 }
+        i = i + 1
+    }
+    return ok
+}
+
+fn main() {
+    var fs = []
+    var i = 0
+    while i < $C {
+        fs.push(spawn worker(i))
+        i = i + 1
+    }
+    var ok = 0
+    for n in await_all(fs) {
+        ok = ok + n
+    }
+    println(ok)
+}
+WYN
+
+for f in seq conc; do
+    if ! "$WYN" build "$TMP/$f.wyn" -o "$TMP/$f.out" --release > "$TMP/build_$f.log" 2>&1; then
+        echo "BUILD FAILED: $f"; sed -n '1,25p' "$TMP/build_$f.log"; exit 1
+    fi
+done
+
+python3 "$TMP/srv.py" "$PORT" > "$TMP/srv.log" 2>&1 &
+SRV_PID=$!
+disown "$SRV_PID" 2>/dev/null
+if ! python3 - "$PORT" <<'PY'
+import socket, sys, time
+port = int(sys.argv[1])
+deadline = time.time() + 30
+while time.time() < deadline:
+    s = socket.socket(); s.settimeout(0.3)
+    if s.connect_ex(("127.0.0.1", port)) == 0:
+        s.close(); sys.exit(0)
+    s.close(); time.sleep(0.1)
+sys.exit(1)
+PY
+then
+    echo "SERVER DID NOT START:"; sed -n '1,25p' "$TMP/srv.log"; exit 1
+fi
+
+# best_ms <pool_max> <binary> <expected ok count>
+best_ms() {
+    local pool="$1" bin="$2" want="$3" best="" start end ms got
+    for _ in 1 2 3; do
+        start=$(python3 -c 'import time; print(time.perf_counter_ns())')
+        got=$(WYN_HTTP_POOL_MAX="$pool" perl -e 'alarm(300); exec @ARGV' -- "$bin" 2>/dev/null)
+        end=$(python3 -c 'import time; print(time.perf_counter_ns())')
+        [ "$got" = "$want" ] || { echo "FAILED: $bin pool=$pool ok=$got want=$want" >&2; return 1; }
+        ms=$(( (end - start) / 1000000 ))
+        if [ -z "$best" ] || [ "$ms" -lt "$best" ]; then best=$ms; fi
+    done
+    echo "$best"
+}
+
+echo "=== Wyn HTTP client vs local server (port $PORT) ==="
+printf "  %-28s %-12s %-12s %s\n" "workload" "no pool" "pooled" "speedup"
+for spec in "seq|sequential x$N|$N" "conc|concurrent ${C}x$R|$((C * R))"; do
+    IFS='|' read -r f label want <<< "$spec"
+    np=$(best_ms 0 "$TMP/$f.out" "$want") || exit 1
+    p=$(best_ms 64 "$TMP/$f.out" "$want") || exit 1
+    ratio=$(python3 -c "print(f'{$np / max($p, 1):.2f}x')")
+    printf "  %-28s %-12s %-12s %s\n" "$label" "${np}ms" "${p}ms" "$ratio"
+done
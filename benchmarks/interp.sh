@@ -0,0 +1,104 @@
+#!/bin/bash
+# String interpolation throughput by piece type.
+#
+# WHY THIS EXISTS: "id=${i} name=${n}" used to call to_string() per embedded
+# value (one heap string each), then snprintf(NULL, 0, ...) to size the result
+# and a second snprintf to fill it - the format string parsed twice per
+# interpolation. Codegen now formats each value straight into a stack buffer
+# by type (digit-pair table for ints, a shortest-round-trip fast path for
+# floats, memcpy for strings) and makes one exact-size allocation. This times
+# N interpolations (default 2M) of:
+#   int     "id=${i} next=${i + 1}"
+#   float   "x=${f} y=${f * 0.25}"
+#   string  "name=${s} tag=${t}"
+#   mixed   "user ${s} #${i} scored ${f} ok=${b}"
+# summing the result lengths so no string is dead. Best of 3.
+#
+# Run from the wyn/ directory:
+#   ./benchmarks/interp.sh
+set -uo pipefail
+cd "$(dirname "$0")/.."
+
+WYN="${WYN:-./wyn}"
+case "$WYN" in /*) ;; *) WYN="$(pwd)/$WYN" ;; esac
+N="${N:-2000000}"
+
+TMP=$(mktemp -d)
+trap 'rm -rf "$TMP"' EXIT
+
+cat > "$TMP/bench.wyn" <<WYN
+fn main() {
+    var n = $N
+    var s = "alice"
+    var t = "admin"
+    var total = 0
+
+    var t0 = Time.now_millis()
+    var i = 0
+    while i < n {
+        var r = "id=\${i} next=\${i + 1}"
+        total = total + r.len()
+        i = i + 1
+    }
+    var int_ms = Time.now_millis() - t0
+
+    t0 = Time.now_millis()
+    i = 0
+    var f = 0.5
+    while i < n {
+        var r = "x=\${f} y=\${f * 0.25}"
+        total = total + r.len()
+        f = f + 1.5
+        i = i + 1
+    }
+    var float_ms = Time.now_millis() - t0
+
+    t0 = Time.now_millis()
+    i = 0
+    while i < n {
+        var r = "name=\${s} tag=\${t}"
+        total = total + r.len()
+        i = i + 1
+    }
+    var str_ms = Time.now_millis() - t0
+
+    t0 = Time.now_millis()
+    i = 0
+    f = 0.5
+    while i < n {
+        var b = i % 2 == 0
+        var r = "user \${s} #\${i} scored \${f} ok=\${b}"
+        total = total + r.len()
+        f = f + 0.125
+        i = i + 1
+    }
+    var mixed_ms = Time.now_millis() - t0
+
+    if total <= 0 {
+        println("FAILED")
+    }
+    println("\${int_ms} \${float_ms} \${str_ms} \${mixed_ms}")
+}
+WYN
+
+if ! "$WYN" build "$TMP/bench.wyn" -o "$TMP/bench.out" --release > "$TMP/build.log" 2>&1; then
+    echo "BUILD FAILED"; sed -n '1,25p' "$TMP/build.log"; exit 1
+fi
+
+best=(0 0 0 0)
+for _ in 1 2 3; do
+    out=$(perl -e 'alarm(900); exec @ARGV' -- "$TMP/bench.out" 2>/dev/null)
+    read -r -a t <<< "$out"
+    [ "${#t[@]}" -eq 4 ] || { echo "FAILED: out=[$out]"; exit 1; }
+    for k in 0 1 2 3; do
+        if [ "${best[$k]}" -eq 0 ] || [ "${t[$k]}" -lt "${best[$k]}" ]; then best[$k]=${t[$k]}; fi
+    done
+done
+
+rate() { python3 -c "print(f'{$1 * 1000 / max($2, 1):,.0f}')"; }
+echo "=== ${N} interpolations per shape ==="
+printf "  %-8s %-10s %s\n" "shape" "time" "interps/s"
+printf "  %-8s %-10s %s\n" "int" "${best[0]}ms" "$(rate "$N" "${best[0]}")"
+printf "  %-8s %-10s %s\n" "float" "${best[1]}ms" "$(rate "$N" "${best[1]}")"
+printf "  %-8s %-10s %s\n" "string" "${best[2]}ms" "$(rate "$N" "${best[2]}")"
+printf "  %-8s %-10s %s\n" "mixed" "${best[3]}ms" "$(rate "$N" "${best[3]}")"
@@ -0,0 +1,74 @@
+#!/bin/bash
+# AST optimizer (src/optimize.c) payoff under `wyn run`.
+#
+# WHY THIS EXISTS: `wyn run` compiles at C -O0 (system cc against the prebuilt
+# runtime, or TCC when that is missing), which emits code exactly as written -
+# no constant folding across statements, no inlining, no hoisting. The AST
+# passes are the only optimizer that path has, so this compares `wyn run -O0`
+# (passes off) with `-O1` (the default) and `-O2` on workloads shaped like the
+# code the passes target: a small pure helper called in a hot loop, a per-
+# iteration value that never changes, and constants threaded through arithmetic.
+# `wyn build` goes through the system cc at -O2 and gets most of this anyway, so
+# it is not measured here.
+#
+# Times are `wyn run` wall clock, best of 3. Each level has its own cached
+# binary (<file>.O0.out / .out / .O2.out), so runs 2 and 3 skip the compile and
+# the best time is essentially execution. fib35 is a control: plain recursion
+# with nothing for the passes to do, so its column is run-to-run noise.
+#
+# Run from the wyn/ directory:
+#   ./benchmarks/opt_levels.sh
+set -uo pipefail
+cd "$(dirname "$0")/.."
+
+WYN="${WYN:-./wyn}"
+case "$WYN" in /*) ;; *) WYN="$(pwd)/$WYN" ;; esac
+TMP=$(mktemp -d); trap 'rm -rf "$TMP"' EXIT
+
+cat > "$TMP/hot_loop.wyn" <<'EOF'
+const SCALE = 3
+fn sq(x: int) -> int => x * x
+fn mix(a: int, b: int) -> int => a * SCALE + b
+
+fn run(n: int, seed: int) -> int {
+    var acc = 0
+    var i = 0
+    while i < n {
+        var bias = seed * SCALE + n % 7
+        var limit = sq(seed) + 1
+        acc = (acc + mix(i, bias) + limit) % 1000000007
+        i = i + 1
+    }
+    return acc
+}
+
+fn main() {
+    println(run(30000000, 5))
+}
+EOF
+
+best_ms() {
+    local lvl="$1" file="$2" best="" start end ms out
+    for _ in 1 2 3; do
+        start=$(python3 -c 'import time; print(time.perf_counter_ns())')
+        if ! out=$("$WYN" run "$file" "$lvl" 2>&1); then
+            echo "FAILED: $out" >&2; return 1
+        fi
+        end=$(python3 -c 'import time; print(time.perf_counter_ns())')
+        ms=$(( (end - start) / 1000000 ))
+        if [ -z "$best" ] || [ "$ms" -lt "$best" ]; then best=$ms; fi
+    done
+    echo "$best"
+}
+
+echo "=== wyn run by AST optimizer level ==="
+printf "  %-16s %-10s %-10s %-10s %s\n" "program" "-O0" "-O1" "-O2" "-O2 vs -O0"
+# Copies, so the per-level cached binaries land in $TMP and not in benchmarks/.
+cp benchmarks/fib35.wyn benchmarks/strings.wyn "$TMP/"
+for f in "$TMP/hot_loop.wyn" "$TMP/fib35.wyn" "$TMP/strings.wyn"; do
+    o0=$(best_ms -O0 "$f") || exit 1
+    o1=$(best_ms -O1 "$f") || exit 1
+    o2=$(best_ms -O2 "$f") || exit 1
+    ratio=$(python3 -c "print(f'{$o0 / max($o2, 1):.2f}x')")
+    printf "  %-16s %-10s %-10s %-10s %s\n" "$(basename "$f" .wyn)" "${o0}ms" "${o1}ms" "${o2}ms" "$ratio"
+done
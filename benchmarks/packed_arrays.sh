@@ -0,0 +1,89 @@
+#!/bin/bash
+# Packed (unboxed) arrays vs the boxed WynArray.
+#
+# WHY THIS EXISTS: an [int] or [float] local whose uses all have a packed
+# lowering is emitted as a contiguous long long* / double* buffer instead of
+# WynArray's 16-byte tagged WynValues. This measures what that buys on the
+# shapes it was built for - fill with push, read back by index, iterate, sort -
+# against the SAME program with the array forced boxed. The boxed variant adds
+# one call that hands the array to a fn, which the veto pre-pass cannot prove
+# packed-safe, so the only difference between the two binaries is the layout.
+#
+# Both variants are built with `wyn build` (system cc, -O2). Times are wall
+# clock of the built binary, best of 3.
+#
+# Run from the wyn/ directory:
+#   ./benchmarks/packed_arrays.sh
+set -uo pipefail
+cd "$(dirname "$0")/.."
+
+WYN="${WYN:-./wyn}"
+case "$WYN" in /*) ;; *) WYN="$(pwd)/$WYN" ;; esac
+TMP=$(mktemp -d); trap 'rm -rf "$TMP"' EXIT
+N="${N:-10000000}"
+
+# $1 = element type, $2 = element expression of i, $3 = extra line for main
+write_prog() {
+    cat <<EOF
+fn keep(v: [$1]) -> int => v.len()
+
+fn main() {
+    var xs: [$1] = []
+    var i = 0
+    while i < $N {
+        xs.push($2)
+        i = i + 1
+    }
+    var acc: $1 = xs[0]
+    var j = 1
+    while j < $N {
+        acc = acc + xs[j]
+        j = j + 1
+    }
+    for v in xs {
+        acc = acc + v
+    }
+    xs.sort()
+    println(acc + xs[$N - 1])
+    $3
+}
+EOF
+}
+
+best_ms() {
+    local bin="$1" best="" start end ms
+    for _ in 1 2 3; do
+        start=$(python3 -c 'import time; print(time.perf_counter_ns())')
+        "$bin" >/dev/null || { echo "FAILED: $bin" >&2; return 1; }
+        end=$(python3 -c 'import time; print(time.perf_counter_ns())')
+        ms=$(( (end - start) / 1000000 ))
+        if [ -z "$best" ] || [ "$ms" -lt "$best" ]; then best=$ms; fi
+    done
+    echo "$best"
+}
+
+build() {
+    ( cd "$TMP" && "$WYN" build "$1.wyn" >/dev/null 2>&1 ) || { echo "build failed: $1" >&2; return 1; }
+    # `wyn build` names the binary after the source; find whatever it produced.
+    for c in "$TMP/$1" "$TMP/$1.out" "$TMP/$1.wyn.out"; do
+        [ -x "$c" ] && { echo "$c"; return 0; }
+    done
+    echo "no binary for $1" >&2; return 1
+}
+
+echo "=== packed vs boxed arrays (N=$N, wyn build) ==="
+printf "  %-10s %-10s %-10s %s\n" "element" "boxed" "packed" "speedup"
+for spec in "int|(i * 7919) % 1000003" "float|((i * 7919) % 1000003) * 0.5"; do
+    ty="${spec%%|*}"; el="${spec#*|}"
+    write_prog "$ty" "$el" "" > "$TMP/packed_$ty.wyn"
+    write_prog "$ty" "$el" "println(keep(xs))" > "$TMP/boxed_$ty.wyn"
+    pb=$(build "packed_$ty") || exit 1
+    bb=$(build "boxed_$ty") || exit 1
+    if ! grep -q "Wyn[A-Z][a-z]*Array xs" "$TMP/packed_$ty.wyn.c" 2>/dev/null; then
+        echo "  note: packed_$ty did not get a packed layout" >&2
+    fi
+    p=$(best_ms "$pb") || exit 1
+    b=$(best_ms "$bb") || exit 1
+    ratio=$(python3 -c "print(f'{$b / max($p, 1):.2f}x')")
+    printf "  %-10s %-10s %-10s %s\n" "[$ty]" "${b}ms" "${p}ms" "$ratio"
+done
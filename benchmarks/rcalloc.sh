@@ -0,0 +1,101 @@
+#!/bin/bash
+# RC block allocation: the slab allocator in wyn_rc.c vs plain malloc.
+#
+# WHY THIS EXISTS: every Wyn string is an RC block. wyn_rc_alloc used to be a
+# malloc plus two CAS loops widening the global heap range, and every
+# retain/release range-checked that window and read two magic words first.
+# Blocks up to 4KB (header included) now come from per-thread size-class slab
+# pages: alloc/free are free-list pops/pushes and heap membership is a page
+# header lookup. WYN_RC_SLAB=0 sends every block back to malloc, so the same
+# binary times both. This runs N iterations (default 2M) of:
+#   churn    short-lived strings: a to_string, a concat and a substring per
+#            iteration, all released within the iteration
+#   retain   the same strings pushed into an array that is dropped every 1000
+#            elements (a live set of mixed sizes, freed in bulk)
+#   sizes    strings from 10 to 3000 bytes in rotation (every size class)
+# and prints ms for each with the slab on and off. Best of 3.
+#
+# Run from the wyn/ directory:
+#   ./benchmarks/rcalloc.sh
+set -uo pipefail
+cd "$(dirname "$0")/.."
+
+WYN="${WYN:-./wyn}"
+case "$WYN" in /*) ;; *) WYN="$(pwd)/$WYN" ;; esac
+N="${N:-2000000}"
+
+TMP=$(mktemp -d)
+trap 'rm -rf "$TMP"' EXIT
+
+cat > "$TMP/bench.wyn" <<WYN
+fn main() {
+    var n = $N
+    var total = 0
+
+    var t0 = Time.now_millis()
+    var i = 0
+    while i < n {
+        var a = i.to_string()
+        var b = a + "-item"
+        var c = b.substring(1, 4)
+        total = total + b.len() + c.len()
+        i = i + 1
+    }
+    var churn_ms = Time.now_millis() - t0
+
+    t0 = Time.now_millis()
+    i = 0
+    var keep = []
+    while i < n {
+        keep.push("k" + i.to_string())
+        if keep.len() == 1000 {
+            total = total + keep.len()
+            keep = []
+        }
+        i = i + 1
+    }
+    var retain_ms = Time.now_millis() - t0
+
+    var pad = "x".repeat(3000)
+    t0 = Time.now_millis()
+    i = 0
+    while i < n {
+        var s = pad.substring(0, 10 + (i * 37) % 2990)
+        total = total + s.len()
+        i = i + 1
+    }
+    var sizes_ms = Time.now_millis() - t0
+
+    if total == 0 {
+        println("FAILED")
+    }
+    println("\${churn_ms} \${retain_ms} \${sizes_ms}")
+}
+WYN
+
+if ! "$WYN" build "$TMP/bench.wyn" -o "$TMP/bench.out" --release > "$TMP/build.log" 2>&1; then
+    echo "BUILD FAILED"; sed -n '1,25p' "$TMP/build.log"; exit 1
+fi
+
+run() {
+    local best=(0 0 0) out t
+    for _ in 1 2 3; do
+        out=$(env "$@" perl -e 'alarm(600); exec @ARGV' -- "$TMP/bench.out" 2>/dev/null)
+        read -r -a t <<< "$out"
+        [ "${#t[@]}" -eq 3 ] || { echo "FAILED: out=[$out]" >&2; exit 1; }
+        for k in 0 1 2; do
+            if [ "${best[$k]}" -eq 0 ] || [ "${t[$k]}" -lt "${best[$k]}" ]; then best[$k]=${t[$k]}; fi
+        done
+    done
+    echo "${best[*]}"
+}
+
+read -r -a slab <<< "$(run WYN_RC_SLAB=1)" || exit 1
+read -r -a mall <<< "$(run WYN_RC_SLAB=0)" || exit 1
+
+echo "=== RC allocation, $N iterations per workload ==="
+printf "  %-8s %-10s %-10s\n" "workload" "slab" "malloc"
+names=(churn retain sizes)
+for k in 0 1 2; do
+    printf "  %-8s %-10s %-10s\n" "${names[$k]}" "${slab[$k]}ms" "${mall[$k]}ms"
+done
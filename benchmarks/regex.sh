@@ -0,0 +1,162 @@
+#!/bin/bash
+# Regex throughput: the pattern cache, Regex.compile handles, and the lazy-DFA
+# engine against glibc regcomp/regexec.
+#
+# WHY THIS EXISTS: the Regex functions used to regcomp + regfree on every call,
+# so a log-parsing loop calling Regex.match(line, pat) per line spent most of
+# its time compiling. The string API now looks the pattern up in an LRU cache
+# (WYN_REGEX_CACHE entries, default 64, 0 turns it off) and Regex.compile hands
+# out a reusable handle; matching runs on the lazily-built DFA in
+# src/wyn_regex.h with a SIMD literal-prefix prefilter. This times:
+#   uncached    Regex.match per line with WYN_REGEX_CACHE=0 (compile every call)
+#   cached      Regex.match per line, pattern found in the cache
+#   handle      Regex.is_match on one Regex.compile handle
+# and then, in C on one large buffer, wre_search vs regexec for a few pattern
+# shapes (literal with prefilter, class loop, bounded repeat, and a pattern
+# whose DFA overflows into NFA simulation). Best of 3.
+#
+# Run from the wyn/ directory:
+#   ./benchmarks/regex.sh
+set -uo pipefail
+cd "$(dirname "$0")/.."
+
+WYN="${WYN:-./wyn}"
+case "$WYN" in /*) ;; *) WYN="$(pwd)/$WYN" ;; esac
+N="${N:-300000}"
+MB="${MB:-2}"
+
+TMP=$(mktemp -d)
+trap 'rm -rf "$TMP"' EXIT
+
+cat > "$TMP/lines.wyn" <<WYN
+fn main() {
+    var pat = "^(GET|POST) /api/[a-z]+/[0-9]+ HTTP/1\\\\.[01]\$"
+    var lines = []
+    var i = 0
+    while i < 64 {
+        if i % 3 == 0 {
+            lines.push("POST /api/users/" + i.to_string() + " HTTP/1.1")
+        } else {
+            lines.push("GET /static/app" + i.to_string() + ".js HTTP/1.0")
+        }
+        i = i + 1
+    }
+
+    var t0 = Time.now_millis()
+    var a = 0
+    i = 0
+    while i < $N {
+        if Regex.match(lines[i % 64], pat) {
+            a = a + 1
+        }
+        i = i + 1
+    }
+    var str_ms = Time.now_millis() - t0
+
+    var re = Regex.compile(pat)
+    t0 = Time.now_millis()
+    var b = 0
+    i = 0
+    while i < $N {
+        if Regex.is_match(re, lines[i % 64]) {
+            b = b + 1
+        }
+        i = i + 1
+    }
+    var handle_ms = Time.now_millis() - t0
+    Regex.free(re)
+
+    if a != b {
+        println("FAILED")
+    }
+    println(str_ms.to_string() + " " + handle_ms.to_string())
+}
+WYN
+
+if ! "$WYN" build "$TMP/lines.wyn" -o "$TMP/lines.out" --release > "$TMP/build.log" 2>&1; then
+    echo "BUILD FAILED"; sed -n '1,25p' "$TMP/build.log"; exit 1
+fi
+
+best=(0 0 0)
+for _ in 1 2 3; do
+    out0=$(WYN_REGEX_CACHE=0 perl -e 'alarm(600); exec @ARGV' -- "$TMP/lines.out" 2>/dev/null)
+    out1=$(perl -e 'alarm(600); exec @ARGV' -- "$TMP/lines.out" 2>/dev/null)
+    read -r -a u <<< "$out0"
+    read -r -a c <<< "$out1"
+    [ "${#u[@]}" -eq 2 ] && [ "${#c[@]}" -eq 2 ] || { echo "FAILED: out=[$out0] [$out1]"; exit 1; }
+    t=("${u[0]}" "${c[0]}" "${c[1]}")
+    for k in 0 1 2; do
+        if [ "${best[$k]}" -eq 0 ] || [ "${t[$k]}" -lt "${best[$k]}" ]; then best[$k]=${t[$k]}; fi
+    done
+done
+
+rate() { python3 -c "print(f'{$1 * 1000 / max($2, 1):,.0f}')"; }
+echo "=== Regex.match over ${N} request lines ==="
+printf "  %-10s %-10s %s\n" "mode" "time" "lines/s"
+printf "  %-10s %-10s %s\n" "uncached" "${best[0]}ms" "$(rate "$N" "${best[0]}")"
+printf "  %-10s %-10s %s\n" "cached" "${best[1]}ms" "$(rate "$N" "${best[1]}")"
+printf "  %-10s %-10s %s\n" "handle" "${best[2]}ms" "$(rate "$N" "${best[2]}")"
+
+cat > "$TMP/engine.c" <<'C'
+#include <regex.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "wyn_regex.h"
+
+static double now(void) {
+    struct timespec ts; clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+/* Count non-overlapping matches so both engines do the same work. */
+static int count_wre(struct wre_prog* p, const char* s, long n) {
+    int c = 0; long from = 0, ms, me;
+    while (from <= n && wre_search(p, s, n, from, &ms, &me)) {
+        c++; from = me > ms ? me : me + 1;
+    }
+    return c;
+}
+static int count_posix(regex_t* r, const char* s, size_t n) {
+    int c = 0; size_t from = 0; regmatch_t m;
+    while (from <= n) {
+        m.rm_so = 0; m.rm_eo = (regoff_t)(n - from);
+        if (regexec(r, s + from, 1, &m, REG_STARTEND | (from ? REG_NOTBOL : 0)) != 0) break;
+        c++; from += m.rm_eo > m.rm_so ? (size_t)m.rm_eo : (size_t)m.rm_eo + 1;
+    }
+    return c;
+}
+
+int main(int argc, char** argv) {
+    size_t n = (size_t)atoi(argv[1]) << 20;
+    char* s = malloc(n + 1);
+    unsigned x = 12345;
+    for (size_t i = 0; i < n; i++) { x = x * 1103515245u + 12345u; s[i] = "ab abc xyz 0123"[(x >> 16) % 15]; }
+    s[n] = 0;
+    const char* pats[] = { "abbabba", "[a-z]+[0-9]", "a{5}b{5}", "(a|b)*a(a|b){12}" };
+    for (int k = 0; k < 4; k++) {
+        struct wre_prog* p = wre_compile(pats[k], WRE_STRICT);
+        regex_t r;
+        if (!p || regcomp(&r, pats[k], REG_EXTENDED) != 0) { printf("FAILED %s\n", pats[k]); return 1; }
+        double bw = 1e9, bp = 1e9; int cw = 0, cp = 0;
+        for (int rep = 0; rep < 3; rep++) {
+            double t0 = now(); cw = count_wre(p, s, (long)n); double t1 = now();
+            cp = count_posix(&r, s, n); double t2 = now();
+            if (t1 - t0 < bw) bw = t1 - t0;
+            if (t2 - t1 < bp) bp = t2 - t1;
+        }
+        if (cw != cp) { printf("FAILED %s: %d vs %d matches\n", pats[k], cw, cp); return 1; }
+        printf("  %-20s %-10d %-10.0f %-10.0f %.1fx\n", pats[k], cw, bw * 1000, bp * 1000, bp / (bw > 1e-6 ? bw : 1e-6));
+        wre_free(p); regfree(&r);
+    }
+    return 0;
+}
+C
+
+if ! cc -O2 -I src "$TMP/engine.c" -o "$TMP/engine" -lpthread 2> "$TMP/cc.log"; then
+    echo "ENGINE BUILD FAILED"; sed -n '1,25p' "$TMP/cc.log"; exit 1
+fi
+echo "=== wre_search vs regexec over ${MB}MB ==="
+printf "  %-20s %-10s %-10s %-10s %s\n" "pattern" "matches" "wre ms" "posix ms" "speedup"
+perl -e 'alarm(900); exec @ARGV' -- "$TMP/engine" "$MB"
@@ -0,0 +1,93 @@
+#!/bin/bash
+# String build-up: `s = s + line` / `s += line` accumulating a large string.
+#
+# WHY THIS EXISTS: every `s = s + x` went through wyn_string_concat_safe, which
+# always allocates a fresh buffer and copies both operands, so accumulating a
+# string in a loop copied the whole prefix on every iteration - O(n^2) bytes
+# for an n-byte result, even though the RC header already records capacity,
+# length and refcount. Codegen now recognises the self-assignment concat on a
+# string the function owns and calls wyn_string_append_owned, which writes into
+# the spare capacity when the refcount is 1 and grows geometrically otherwise.
+# This times:
+#   append      `s = s + line` until s is MB megabytes (default 100)
+#   append_eq   the same with `s += line` and an int piece per line
+#   copy        `var t = s + line; s = t` - the same bytes through the
+#               always-copying concat, at COPY_MB megabytes (default 2)
+# and prints MB/s for each. Best of 3.
+#
+# Run from the wyn/ directory:
+#   ./benchmarks/strappend.sh
+set -uo pipefail
+cd "$(dirname "$0")/.."
+
+WYN="${WYN:-./wyn}"
+case "$WYN" in /*) ;; *) WYN="$(pwd)/$WYN" ;; esac
+MB="${MB:-100}"
+COPY_MB="${COPY_MB:-2}"
+
+TMP=$(mktemp -d)
+trap 'rm -rf "$TMP"' EXIT
+
+# 100-byte line, so MB megabytes is MB * 10000 lines.
+cat > "$TMP/bench.wyn" <<WYN
+fn main() {
+    var line = "0123456789abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789abcdefghijklmnopqrstuvwxyz!\n"
+    var n = $MB * 10000
+    var t0 = Time.now_millis()
+    var s = ""
+    var i = 0
+    while i < n {
+        s = s + line
+        i = i + 1
+    }
+    var app_ms = Time.now_millis() - t0
+
+    t0 = Time.now_millis()
+    var e = ""
+    i = 0
+    while i < n {
+        e += "row "
+        e += i % 10
+        e += line
+        i = i + 1
+    }
+    var eq_ms = Time.now_millis() - t0
+
+    var m = $COPY_MB * 10000
+    t0 = Time.now_millis()
+    var c = ""
+    i = 0
+    while i < m {
+        var t = c + line
+        c = t
+        i = i + 1
+    }
+    var copy_ms = Time.now_millis() - t0
+
+    if s.len() != n * 100 or e.len() != n * 105 or c.len() != m * 100 {
+        println("FAILED")
+    }
+    println("\${app_ms} \${eq_ms} \${copy_ms}")
+}
+WYN
+
+if ! "$WYN" build "$TMP/bench.wyn" -o "$TMP/bench.out" --release > "$TMP/build.log" 2>&1; then
+    echo "BUILD FAILED"; sed -n '1,25p' "$TMP/build.log"; exit 1
+fi
+
+best=(0 0 0)
+for _ in 1 2 3; do
+    out=$(perl -e 'alarm(900); exec @ARGV' -- "$TMP/bench.out" 2>/dev/null)
+    read -r -a t <<< "$out"
+    [ "${#t[@]}" -eq 3 ] || { echo "FAILED: out=[$out]"; exit 1; }
+    for k in 0 1 2; do
+        if [ "${best[$k]}" -eq 0 ] || [ "${t[$k]}" -lt "${best[$k]}" ]; then best[$k]=${t[$k]}; fi
+    done
+done
+
+rate() { python3 -c "print(f'{$1 * 1000 / max($2, 1):,.0f}')"; }
+echo "=== Accumulating a string line by line ==="
+printf "  %-10s %-8s %-10s %s\n" "mode" "size" "time" "MB/s"
+printf "  %-10s %-8s %-10s %s\n" "append" "${MB}MB" "${best[0]}ms" "$(rate "$MB" "${best[0]}")"
+printf "  %-10s %-8s %-10s %s\n" "append_eq" "$((MB * 105 / 100))MB" "${best[1]}ms" "$(rate "$((MB * 105 / 100))" "${best[1]}")"
+printf "  %-10s %-8s %-10s %s\n" "copy" "${COPY_MB}MB" "${best[2]}ms" "$(rate "$COPY_MB" "${best[2]}")"
@@ -426,6 +426,7 @@ typedef struct {
     Stmt** stmts;
     int count;
     Expr* timeout;   // optional timeout (ms) for `parallel(timeout: N) { }`; NULL otherwise
+    Expr* tx_end;    // `Db.transaction(db) { }`: the closing Db.end call, also run on return; NULL otherwise
 } BlockStmt;
 
 typedef struct {
@@ -49,6 +49,168 @@ static int lambda_param_is_float(const char* pname, Expr* e, SymbolTable* scope)
 static int lambda_param_is_bool(const char* pname, Expr* e, SymbolTable* scope);
 void analyze_expr_captures(Expr* expr, LambdaExpr* lambda, SymbolTable* scope);
 
+// FNV-1a hash for token bytes
+static inline uint32_t sym_hash(const char* s, int len) {
+    if (!s || len <= 0) return 0;
+    uint32_t h = 2166136261u;
+    for (int i = 0; i < len; i++) {
+        h ^= (unsigned char)s[i];
+        h *= 16777619u;
+    }
+    return h;
+}
+
+// Per-program definition index.
+//
+// find_struct_definition / find_enum_definition / find_enum_for_bare_variant
+// used to walk prog->stmts on every call, and they are called from inside
+// check_expr, so checking was O(statements x expressions): on a 50K-line
+// generated module those scans were ~80% of `wyn check` (gprof). Each Program
+// now gets one open-addressing table, built on its first lookup, mapping
+// (kind, owner, name) -> definition. Staleness is keyed on prog->count: module
+// merges (merge_module_exports) and DCE only ever change the statement COUNT,
+// so a different count means rebuild. On duplicate names the FIRST definition
+// wins, exactly like the linear scans this replaces - callers rely on that for
+// the "first enum declaring a bare variant" rule.
+typedef enum {
+    DEF_STRUCT,       // top-level `struct` (NOT through `export`, as before)
+    DEF_ENUM,         // `enum`, export unwrapped
+    DEF_VARIANT,      // enum variant name -> its enum; aux = variant index
+    DEF_FN,           // top-level `fn`, export unwrapped; aux = any overload public
+    DEF_IMPORT_ITEM,  // name brought in by a selective `import { name } from m`
+    DEF_METHOD        // struct-body method; owner = struct name
+} DefKind;
+
+typedef struct {
+    Stmt* stmt;       // NULL = empty slot
+    DefKind kind;
+    Token owner;
+    Token name;
+    int aux;
+} DefEntry;
+
+typedef struct {
+    Program* prog;
+    int indexed_count;
+    DefEntry* slots;
+    int cap;          // power of 2
+    int used;
+} DefIndex;
+
+static DefIndex* def_indexes = NULL;
+static int def_index_count = 0;
+static int def_index_cap = 0;
+
+static uint32_t def_hash(DefKind kind, Token owner, Token name) {
+    uint32_t h = sym_hash(name.start, name.length) ^ ((uint32_t)kind * 0x9e3779b9u);
+    if (owner.length > 0) h ^= sym_hash(owner.start, owner.length) * 31u;
+    return h;
+}
+
+static bool def_key_eq(const DefEntry* e, DefKind kind, Token owner, Token name) {
+    return e->kind == kind &&
+           e->name.length == name.length &&
+           memcmp(e->name.start, name.start, name.length) == 0 &&
+           e->owner.length == owner.length &&
+           (owner.length == 0 || memcmp(e->owner.start, owner.start, owner.length) == 0);
+}
+
+static DefEntry* def_probe(DefIndex* ix, DefKind kind, Token owner, Token name) {
+    int mask = ix->cap - 1;
+    int slot = def_hash(kind, owner, name) & mask;
+    while (ix->slots[slot].stmt && !def_key_eq(&ix->slots[slot], kind, owner, name))
+        slot = (slot + 1) & mask;
+    return &ix->slots[slot];
+}
+
+static void def_grow(DefIndex* ix) {
+    DefEntry* old = ix->slots;
+    int old_cap = ix->cap;
+    ix->cap = old_cap ? old_cap * 2 : 64;
+    ix->slots = calloc((size_t)ix->cap, sizeof(DefEntry));
+    for (int i = 0; i < old_cap; i++) {
+        if (!old[i].stmt) continue;
+        *def_probe(ix, old[i].kind, old[i].owner, old[i].name) = old[i];
+    }
+    free(old);
+}
+
+// Insert unless the key is already present (first definition wins). Returns
+// the entry for the key either way so DEF_FN can OR in later overloads' flags.
+static DefEntry* def_insert(DefIndex* ix, DefKind kind, Token owner, Token name,
+                            Stmt* stmt, int aux) {
+    if (!name.start || name.length <= 0) return NULL;
+    if ((ix->used + 1) * 2 > ix->cap) def_grow(ix);
+    DefEntry* e = def_probe(ix, kind, owner, name);
+    if (e->stmt) return e;
+    e->stmt = stmt; e->kind = kind; e->owner = owner; e->name = name; e->aux = aux;
+    ix->used++;
+    return e;
+}
+
+static void def_index_build(DefIndex* ix, Program* prog) {
+    if (ix->slots) memset(ix->slots, 0, sizeof(DefEntry) * (size_t)ix->cap);
+    ix->used = 0;
+    ix->indexed_count = prog->count;
+    Token none = {0};
+    for (int i = 0; i < prog->count; i++) {
+        Stmt* s = prog->stmts[i];
+        if (!s) continue;
+        bool exported = false;
+        if (s->type == STMT_EXPORT && s->export.stmt) { s = s->export.stmt; exported = true; }
+        switch (s->type) {
+            case STMT_STRUCT:
+                if (exported) break;
+                def_insert(ix, DEF_STRUCT, none, s->struct_decl.name, s, 0);
+                for (int m = 0; m < s->struct_decl.method_count; m++)
+                    def_insert(ix, DEF_METHOD, s->struct_decl.name,
+                               s->struct_decl.methods[m]->name, s, m);
+                break;
+            case STMT_ENUM:
+                def_insert(ix, DEF_ENUM, none, s->enum_decl.name, s, 0);
+                for (int v = 0; v < s->enum_decl.variant_count; v++)
+                    def_insert(ix, DEF_VARIANT, none, s->enum_decl.variants[v], s, v);
+                break;
+            case STMT_FN: {
+                DefEntry* e = def_insert(ix, DEF_FN, none, s->fn.name, s, 0);
+                if (e && (exported || s->fn.is_public)) e->aux = 1;
+                break;
+            }
+            case STMT_IMPORT:
+                for (int j = 0; j < s->import.item_count; j++)
+                    def_insert(ix, DEF_IMPORT_ITEM, none, s->import.items[j], s, 0);
+                break;
+            default: break;
+        }
+    }
+}
+
+static DefEntry* def_lookup(Program* prog, DefKind kind, Token owner, Token name) {
+    if (!prog || !name.start || name.length <= 0) return NULL;
+    DefIndex* ix = NULL;
+    for (int i = 0; i < def_index_count; i++)
+        if (def_indexes[i].prog == prog) { ix = &def_indexes[i]; break; }
+    if (!ix) {
+        WYN_ENSURE_CAP(def_indexes, def_index_count, def_index_cap);
+        ix = &def_indexes[def_index_count++];
+        memset(ix, 0, sizeof(*ix));
+        ix->prog = prog;
+        ix->indexed_count = -1;
+    }
+    if (ix->indexed_count != prog->count) def_index_build(ix, prog);
+    if (!ix->slots) return NULL;
+    DefEntry* e = def_probe(ix, kind, owner, name);
+    return e->stmt ? e : NULL;
+}
+
+// Programs are not stable across check_program calls (the LSP re-parses on
+// every edit, and a freed Program's address can be reused with the same count),
+// so every index is dropped when a new program starts checking.
+static void def_indexes_reset(void) {
+    for (int i = 0; i < def_index_count; i++) free(def_indexes[i].slots);
+    def_index_count = 0;
+}
+
 // S3: element type of the receiver array while checking a map/filter lambda
 // argument - unannotated lambda params default to this instead of int.
 static Type* lambda_ctx_param_seed = NULL;
@@ -254,25 +416,13 @@ typedef enum {
 static FnVisibility module_fn_visibility(const char* module_name, const char* fn_name) {
     Program* m = find_module_ast(module_name);
     if (!m) return VIS_MODULE_UNKNOWN;
-    bool found = false;
-    size_t fn_len = strlen(fn_name);
-    for (int i = 0; i < m->count; i++) {
-        Stmt* s = m->stmts[i];
-        if (!s) continue;
-        bool exported = false;
-        if (s->type == STMT_EXPORT && s->export.stmt) {
-            exported = true;  // `export fn` exports, same as `pub fn`
-            s = s->export.stmt;
-        }
-        if (s->type != STMT_FN) continue;
-        if ((size_t)s->fn.name.length == fn_len &&
-            memcmp(s->fn.name.start, fn_name, fn_len) == 0) {
-            found = true;
-            // Overloads: if any definition is exported, the name is callable.
-            if (exported || s->fn.is_public) return VIS_PUBLIC;
-        }
-    }
-    return found ? VIS_PRIVATE : VIS_FN_UNKNOWN;
+    // DEF_FN's aux is set when ANY overload is `pub fn` or `export fn` - if any
+    // definition is exported, the name is callable.
+    Token none = {0};
+    Token t = {TOKEN_IDENT, fn_name, (int)strlen(fn_name), 0};
+    DefEntry* e = def_lookup(m, DEF_FN, none, t);
+    if (!e) return VIS_FN_UNKNOWN;
+    return e->aux ? VIS_PUBLIC : VIS_PRIVATE;
 }
 
 // Is the checker currently inside `target` (module calling its own fns)?
@@ -474,19 +624,15 @@ typedef enum {
 
 // Helper function to find struct definition by name
 static StructStmt* find_struct_definition(Token struct_name) {
-    if (!current_program) return NULL;
-    
-    for (int i = 0; i < current_program->count; i++) {
-        Stmt* stmt = current_program->stmts[i];
-        if (stmt->type == STMT_STRUCT) {
-            Token name = stmt->struct_decl.name;
-            if (name.length == struct_name.length &&
-                memcmp(name.start, struct_name.start, name.length) == 0) {
-                return &stmt->struct_decl;
-            }
-        }
-    }
-    return NULL;
+    Token none = {0};
+    DefEntry* e = def_lookup(current_program, DEF_STRUCT, none, struct_name);
+    return e ? &e->stmt->struct_decl : NULL;
+}
+
+// Struct-body method `name` of struct `struct_name`, or NULL.
+static FnStmt* find_struct_method(Token struct_name, Token name) {
+    DefEntry* e = def_lookup(current_program, DEF_METHOD, struct_name, name);
+    return e ? e->stmt->struct_decl.methods[e->aux] : NULL;
 }
 
 // Cycle detection for by-value struct fields: returns true when struct `from`
@@ -538,14 +684,10 @@ static bool struct_fields_comparable(Token struct_name, Token* bad_field, int de
             } else if (find_struct_definition(t)) {
                 if (!struct_fields_comparable(t, bad_field, depth + 1)) return false;
                 ok = true;
-            } else if (current_program) {
+            } else {
                 // Enum fields compare as ints in C.
-                for (int j = 0; j < current_program->count && !ok; j++) {
-                    Stmt* es = current_program->stmts[j];
-                    if (es->type == STMT_EXPORT && es->export.stmt) es = es->export.stmt;
-                    if (es->type == STMT_ENUM && es->enum_decl.name.length == t.length &&
-                        memcmp(es->enum_decl.name.start, t.start, t.length) == 0) ok = true;
-                }
+                Token none = {0};
+                ok = def_lookup(current_program, DEF_ENUM, none, t) != NULL;
             }
         }
         if (!ok) {
@@ -573,13 +715,7 @@ static bool is_field_of_struct(Token struct_name, Token field) {
 // block / extension method registered as `S_name` in global scope. Struct-body
 // methods are NOT added to the symbol table, so both sources must be consulted.
 static bool struct_has_method(SymbolTable* global, Token struct_name, Token name) {
-    StructStmt* s = find_struct_definition(struct_name);
-    if (s) {
-        for (int i = 0; i < s->method_count; i++) {
-            if (s->methods[i]->name.length == name.length &&
-                memcmp(s->methods[i]->name.start, name.start, name.length) == 0) return true;
-        }
-    }
+    if (find_struct_method(struct_name, name)) return true;
     char ext[256];
     snprintf(ext, sizeof(ext), "%.*s_%.*s",
              struct_name.length, struct_name.start, name.length, name.start);
@@ -590,41 +726,16 @@ static bool struct_has_method(SymbolTable* global, Token struct_name, Token name
 
 static EnumStmt* find_enum_definition(Token enum_name) {
     if (!current_program) return NULL;
-    
-    for (int i = 0; i < current_program->count; i++) {
-        Stmt* stmt = current_program->stmts[i];
-        // Unwrap export
-        if (stmt->type == STMT_EXPORT && stmt->export.stmt && stmt->export.stmt->type == STMT_ENUM) {
-            stmt = stmt->export.stmt;
-        }
-        if (stmt->type == STMT_ENUM) {
-            Token name = stmt->enum_decl.name;
-            if (name.length == enum_name.length &&
-                memcmp(name.start, enum_name.start, name.length) == 0) {
-                return &stmt->enum_decl;
-            }
-        }
-    }
+    Token none = {0};
+    DefEntry* e = def_lookup(current_program, DEF_ENUM, none, enum_name);
+    if (e) return &e->stmt->enum_decl;
     // Also search all loaded modules
     extern int get_module_count(void);
     extern Program* get_module_at(int index);
     int mc = get_module_count();
     for (int m = 0; m < mc; m++) {
-        Program* mod = get_module_at(m);
-        if (!mod) continue;
-        for (int i = 0; i < mod->count; i++) {
-            Stmt* stmt = mod->stmts[i];
-            if (stmt->type == STMT_EXPORT && stmt->export.stmt && stmt->export.stmt->type == STMT_ENUM) {
-                stmt = stmt->export.stmt;
-            }
-            if (stmt->type == STMT_ENUM) {
-                Token name = stmt->enum_decl.name;
-                if (name.length == enum_name.length &&
-                    memcmp(name.start, enum_name.start, name.length) == 0) {
-                    return &stmt->enum_decl;
-                }
-            }
-        }
+        e = def_lookup(get_module_at(m), DEF_ENUM, none, enum_name);
+        if (e) return &e->stmt->enum_decl;
     }
     return NULL;
 }
@@ -648,22 +759,12 @@ static EnumStmt* find_enum_for_bare_variant(Token variant, int* out_vi) {
         Program* mod = get_module_at(m);
         if (mod) progs[np++] = mod;
     }
+    Token none = {0};
     for (int p = 0; p < np; p++) {
-        Program* prog = progs[p];
-        for (int i = 0; i < prog->count; i++) {
-            Stmt* stmt = prog->stmts[i];
-            if (stmt->type == STMT_EXPORT && stmt->export.stmt &&
-                stmt->export.stmt->type == STMT_ENUM)
-                stmt = stmt->export.stmt;
-            if (stmt->type != STMT_ENUM) continue;
-            for (int vi = 0; vi < stmt->enum_decl.variant_count; vi++) {
-                Token v = stmt->enum_decl.variants[vi];
-                if (v.length == variant.length &&
-                    memcmp(v.start, variant.start, v.length) == 0) {
-                    if (out_vi) *out_vi = vi;
-                    return &stmt->enum_decl;
-                }
-            }
+        DefEntry* e = def_lookup(progs[p], DEF_VARIANT, none, variant);
+        if (e) {
+            if (out_vi) *out_vi = e->aux;
+            return &e->stmt->enum_decl;
         }
     }
     return NULL;
@@ -963,17 +1064,6 @@ static Type* get_inner_type(Type* optional_type) {
     return optional_type->optional_type.inner_type;
 }
 
-// FNV-1a hash for token bytes
-static inline uint32_t sym_hash(const char* s, int len) {
-    if (!s || len <= 0) return 0;
-    uint32_t h = 2166136261u;
-    for (int i = 0; i < len; i++) {
-        h ^= (unsigned char)s[i];
-        h *= 16777619u;
-    }
-    return h;
-}
-
 static void sym_table_rehash(SymbolTable* scope) {
     int new_cap = scope->hash_capacity == 0 ? 16 : scope->hash_capacity * 2;
     int* new_indices = malloc(new_cap * sizeof(int));
@@ -1198,15 +1288,13 @@ static Type* register_result_struct_family(Type* struct_type) {
     return register_result_struct_family_e(struct_type, NULL);
 }
 
-void init_checker() {
-    global_scope = calloc(1, sizeof(SymbolTable));
-    global_scope->capacity = 128;
-    global_scope->symbols = calloc(128, sizeof(Symbol));
-    had_error = false;
-    
-    // Initialize trait system
-    wyn_traits_init();
-    
+// The builtin catalogue: every stdlib name the checker knows before it sees a
+// line of user code. This is the source of truth, but it is NOT run on every
+// init_checker() - `wyn __builtin-table` evaluates it once at build time into
+// src/checker_builtins_table.h (see "Static builtin symbol table" below). Keep
+// it a pure function of this file: no program state, no environment, no
+// ENUM/UNION/GENERIC types or structs with fields (the emitter rejects them).
+static void register_builtin_catalogue(void) {
     builtin_int = make_type(TYPE_INT);
     builtin_float = make_type(TYPE_FLOAT);
     builtin_string = make_type(TYPE_STRING);
@@ -1274,6 +1362,7 @@ void init_checker() {
         "hashmap_get_int", "hashmap_get_float", "hashmap_get_string", "hashmap_get_bool",
         "wyn_hashmap_new", "wyn_hashmap_insert_int", "wyn_hashmap_get_int", "wyn_hashmap_has", "wyn_hashmap_len", "wyn_hashmap_free",
         "hashset_new", "hashset_add", "hashset_contains", "hashset_remove", "hashset_free",
+        "hashset_add_int", "hashset_contains_int", "hashset_remove_int", "hashset_reserve",
         "set_len", "set_is_empty", "set_clear", "set_union", "set_intersection", "set_difference", "set_is_subset", "set_is_superset",
         "json_parse", "json_get_string", "json_get_int", "json_free",
         "json_get_str", "json_get_int", "json_get_bool", "json_has_key", "json_stringify_int", "json_stringify_str", "json_stringify_bool", "json_array_stringify", "json_array_length", "json_array_get",
@@ -2152,24 +2241,6 @@ void init_checker() {
         }
     }
     
-    // Register loaded user modules as namespace symbols
-    {
-        extern int get_module_count(void);
-        extern void* get_module_entry_at(int index);
-        int mc = get_module_count();
-        for (int mi = 0; mi < mc; mi++) {
-            typedef struct { char* name; void* ast; } ME;
-            ME* mod = (ME*)get_module_entry_at(mi);
-            // Register short name (last segment after /)
-            char* slash = strrchr(mod->name, '/');
-            const char* short_name = slash ? slash + 1 : mod->name;
-            Token ns_tok = {TOKEN_IDENT, short_name, (int)strlen(short_name), 0};
-            if (!find_symbol(global_scope, ns_tok)) {
-                add_symbol(global_scope, ns_tok, builtin_int, false);
-            }
-        }
-    }
-
     // File namespace methods
     struct { const char* name; int nlen; int pc; Type* p1; Type* p2; Type* ret; } file_ns_fns[] = {
         {"File_read", 9, 1, builtin_string, NULL, builtin_string},
@@ -2592,6 +2663,10 @@ void init_checker() {
     }
 
     // Task namespace
+    // Task.blocking(f) takes the function to offload: `fn() -> int`.
+    Type* task_blocking_fn = make_type(TYPE_FUNCTION);
+    task_blocking_fn->fn_type.param_count = 0;
+    task_blocking_fn->fn_type.return_type = builtin_int;
     struct { const char* name; int nlen; Type* ret; int pc; Type* p1; } reg_task_fns[] = {
         {"Task_value", 10, builtin_int, 1, builtin_int},
         {"Task_get", 8, builtin_int, 1, builtin_int},
@@ -2610,13 +2685,16 @@ void init_checker() {
         // was cancelled (0 args - reads the current coroutine).
         {"Task_cancel", 11, builtin_void, 1, builtin_int},
         {"Task_is_cancelled", 17, builtin_bool, 0, builtin_int},
+        {"Task_blocking", 13, builtin_int, 1, task_blocking_fn},
     };
     for (int i = 0; i < (int)(sizeof(reg_task_fns)/sizeof(reg_task_fns[0])); i++) {
         Type* ft = make_type(TYPE_FUNCTION);
         ft->fn_type.param_count = reg_task_fns[i].pc;
-        ft->fn_type.param_types = malloc(sizeof(Type*) * 2);
+        // 3 = Task_select_3, the widest entry (this was sized 2).
+        ft->fn_type.param_types = malloc(sizeof(Type*) * 3);
         ft->fn_type.param_types[0] = reg_task_fns[i].p1;
         ft->fn_type.param_types[1] = builtin_int;
+        ft->fn_type.param_types[2] = builtin_int;
         ft->fn_type.return_type = reg_task_fns[i].ret;
         Token tok = {TOKEN_IDENT, reg_task_fns[i].name, reg_task_fns[i].nlen, 0};
         add_symbol(global_scope, tok, ft, false);
@@ -2660,6 +2738,16 @@ void init_checker() {
         ft->fn_type.param_types = malloc(sizeof(Type*) * 2);
         ft->fn_type.param_types[0] = reg_db_fns[i].p1;
 
+    // PriorityQueue instances (WYN_HEAP_DEFINE in wyn_runtime.h). Opaque
+    // pointer types like builtin_ptr; the name is the C type, and the checker
+    // reads the element type back off it (see pq_instance).
+    Type* pq_int_type = make_type(TYPE_STRUCT);
+    pq_int_type->struct_type.name = (Token){TOKEN_IDENT, "PriorityQueue_int*", 18, 0};
+    Type* pq_float_type = make_type(TYPE_STRUCT);
+    pq_float_type->struct_type.name = (Token){TOKEN_IDENT, "PriorityQueue_float*", 20, 0};
+    Type* pq_string_type = make_type(TYPE_STRUCT);
+    pq_string_type->struct_type.name = (Token){TOKEN_IDENT, "PriorityQueue_string*", 21, 0};
+
     // New module registrations
     struct { const char* name; int nlen; int nparams; Type* ret; } new_fns[] = {
         {"Json_parse", 10, 1, builtin_int},
@@ -2740,6 +2828,16 @@ void init_checker() {
         {"Csv_col_count", 13, 1, builtin_int},
         {"Csv_header", 10, 1, builtin_string},
         {"Csv_header_count", 16, 1, builtin_int},
+        // Streaming reader (Csv.open / Csv.open_part): see the CSV section of wyn_runtime.h.
+        {"Csv_open", 8, 1, builtin_int},
+        {"Csv_open_part", 13, 3, builtin_int},
+        {"Csv_next", 8, 1, builtin_bool},
+        {"Csv_columns", 11, 1, builtin_int},
+        {"Csv_column", 10, 2, builtin_int},
+        {"Csv_get_text", 12, 2, builtin_string},
+        {"Csv_get_int", 11, 2, builtin_int},
+        {"Csv_get_float", 13, 2, builtin_float},
+        {"Csv_close", 9, 1, builtin_void},
         {"Http_get_json", 13, 1, builtin_int},
         {"Http_post_json", 14, 2, builtin_int},
         {"Json_get_float", 14, 2, builtin_float},
@@ -2761,6 +2859,15 @@ void init_checker() {
         {"Regex_split", 11, 2, builtin_string},
         {"Regex_find", 10, 2, builtin_int},
         {"Regex_find_all", 14, 2, builtin_string},
+        // Compiled patterns: Regex.compile(pat) -> handle (-1 if invalid), then
+        // the *_in / is_match calls take the handle first; Regex.free releases it.
+        {"Regex_compile", 13, 1, builtin_int},
+        {"Regex_is_match", 14, 2, builtin_bool},
+        {"Regex_find_in", 13, 2, builtin_int},
+        {"Regex_replace_in", 16, 3, builtin_string},
+        {"Regex_find_all_in", 17, 2, builtin_string},
+        {"Regex_split_in", 14, 2, builtin_string},
+        {"Regex_free", 10, 1, builtin_void},
         {"Encoding_hex_decode", 19, 1, builtin_string},
         {"Encoding_csv_parse", 18, 1, builtin_string},
         // Missing functions from audit
@@ -2776,6 +2883,27 @@ void init_checker() {
         {"Db_query_p", 10, 3, builtin_string},
         {"Db_error", 8, 1, builtin_string},
         {"Db_last_insert_id", 17, 1, builtin_int},
+        // Row cursors: Db.cursor(db, sql) / Db.cursor_p(db, sql, params) -> cursor,
+        // Db.next(cur) -> bool, typed column reads by index.
+        {"Db_cursor", 9, 2, builtin_int},
+        {"Db_cursor_p", 11, 3, builtin_int},
+        {"Db_next", 7, 1, builtin_bool},
+        {"Db_get_int", 10, 2, builtin_int},
+        {"Db_get_float", 12, 2, builtin_float},
+        {"Db_get_text", 11, 2, builtin_string},
+        {"Db_is_null", 10, 2, builtin_bool},
+        {"Db_columns", 10, 1, builtin_int},
+        {"Db_column_name", 14, 2, builtin_string},
+        {"Db_close_cursor", 15, 1, builtin_void},
+        // Bulk load and transactions: Db.batch(db, sql, rows) -> rows inserted,
+        // Db.begin(db) -> tx, Db.end(tx) -> committed. `Db.transaction(db) { }`
+        // is lowered onto begin/end by the parser.
+        {"Db_batch", 8, 3, builtin_int},
+        {"Db_set_batch_size", 17, 2, builtin_void},
+        {"Db_set_import_mode", 18, 2, builtin_bool},
+        {"Db_begin", 8, 1, builtin_int},
+        {"Db_end", 6, 1, builtin_bool},
+        {"Db_rollback", 11, 1, builtin_void},
         {"Http_body", 9, 1, builtin_string},
         {"Http_header", 11, 2, builtin_string},
         {"Http_status", 11, 1, builtin_int},
@@ -2821,6 +2949,39 @@ void init_checker() {
         {"Stack_peek", 10, 1, builtin_int},
         {"Stack_len", 9, 1, builtin_int},
         {"Stack_is_empty", 14, 1, builtin_int},
+        {"Deque_new", 9, 0, builtin_ptr},
+        {"Deque_push_back", 15, 2, builtin_void},
+        {"Deque_push_front", 16, 2, builtin_void},
+        {"Deque_pop_front", 15, 1, builtin_int},
+        {"Deque_pop_back", 14, 1, builtin_int},
+        {"Deque_front", 11, 1, builtin_int},
+        {"Deque_back", 10, 1, builtin_int},
+        {"Deque_get", 9, 2, builtin_int},
+        {"Deque_set", 9, 3, builtin_void},
+        {"Deque_len", 9, 1, builtin_int},
+        {"Deque_is_empty", 14, 1, builtin_bool},
+        {"Deque_clear", 11, 1, builtin_void},
+        // PriorityQueue::op is rewritten to the instance's PriorityQueue_T::op
+        // by the qualified-call path in check_expr; these give the results.
+        {"PriorityQueue_new", 17, 0, pq_int_type},
+        {"PriorityQueue_int_new", 21, 1, pq_int_type},
+        {"PriorityQueue_int_push", 22, 2, builtin_void},
+        {"PriorityQueue_int_pop", 21, 1, builtin_int},
+        {"PriorityQueue_int_peek", 22, 1, builtin_int},
+        {"PriorityQueue_int_len", 21, 1, builtin_int},
+        {"PriorityQueue_int_is_empty", 26, 1, builtin_bool},
+        {"PriorityQueue_float_new", 23, 1, pq_float_type},
+        {"PriorityQueue_float_push", 24, 2, builtin_void},
+        {"PriorityQueue_float_pop", 23, 1, builtin_float},
+        {"PriorityQueue_float_peek", 24, 1, builtin_float},
+        {"PriorityQueue_float_len", 23, 1, builtin_int},
+        {"PriorityQueue_float_is_empty", 28, 1, builtin_bool},
+        {"PriorityQueue_string_new", 24, 1, pq_string_type},
+        {"PriorityQueue_string_push", 25, 2, builtin_void},
+        {"PriorityQueue_string_pop", 24, 1, builtin_string},
+        {"PriorityQueue_string_peek", 25, 1, builtin_string},
+        {"PriorityQueue_string_len", 24, 1, builtin_int},
+        {"PriorityQueue_string_is_empty", 29, 1, builtin_bool},
         {"Terminal_color", 14, 1, builtin_void},
         {"Terminal_bg", 11, 1, builtin_void},
         {"Terminal_bold", 12, 1, builtin_void},
@@ -2893,8 +3054,10 @@ void init_checker() {
     for (int i = 0; i < (int)(sizeof(reg_gui_fns)/sizeof(reg_gui_fns[0])); i++) {
         Type* ft = make_type(TYPE_FUNCTION);
         ft->fn_type.param_count = reg_gui_fns[i].pc;
-        ft->fn_type.param_types = malloc(sizeof(Type*) * 4);
-        for (int j = 0; j < 4; j++) ft->fn_type.param_types[j] = builtin_int;
+        // 6 = the widest entry (button_clicked); sized to 4 this read past the
+        // allocation for button/progress/draw_sprite_scaled.
+        ft->fn_type.param_types = malloc(sizeof(Type*) * 6);
+        for (int j = 0; j < 6; j++) ft->fn_type.param_types[j] = builtin_int;
         if (i == 0) ft->fn_type.param_types[0] = builtin_string; // create(title, w, h)
         if (i == 7) ft->fn_type.param_types[0] = NULL; // poll()
         if (i == 13) { ft->fn_type.param_types[2] = builtin_string; } // text(x, y, str, scale)
@@ -2905,11 +3068,372 @@ void init_checker() {
     }
 }
 
+// ---------------------------------------------------------------------------
+// Static builtin symbol table
+//
+// Running register_builtin_catalogue() costs ~2000 add_symbol calls, ~300 Type
+// callocs, ~110 param-array mallocs and five rehashes of the global table - and
+// it used to run on EVERY init_checker(): each `wyn check`, each `wyn run`,
+// each LSP diagnostics pass, before one line of user code was looked at. None
+// of it depends on the program, so it is evaluated at build time instead:
+// `wyn __builtin-table` runs the catalogue and prints
+// src/checker_builtins_table.h - statically initialised Types plus a
+// hash-and-displace perfect hash over the names - and `make` regenerates that
+// header (and relinks) whenever its output changes, like a committed gperf
+// table.
+//
+// At run time global_scope holds only per-program names (module namespaces,
+// user declarations). find_symbol answers builtins from the static table
+// FIRST, which keeps the old "first registration wins" rule: builtins were
+// always registered before any user symbol.
+//
+// Callers mutate what find_symbol returns (is_used, next_overload,
+// mangled_name), and a few inference paths patch builtin array types in place,
+// so each init_checker() hands out fresh Symbol copies (materialised on first
+// lookup) and restores the Types from a pristine snapshot. Both are a flat
+// allocation + memcpy - no hashing, no per-symbol work.
+// ---------------------------------------------------------------------------
+typedef struct {
+    const char* name;
+    int len;
+    int type;         // index into wyn_builtin_types
+    bool is_mutable;
+} BuiltinSym;
+
+#include "checker_builtins_table.h"
+
+static bool builtin_table_active = false;   // off while the generator runs the catalogue
+static Symbol* builtin_live = NULL;          // per-run copies, indexed like wyn_builtin_syms
+static Type* builtin_types_pristine = NULL;  // wyn_builtin_types before any run touched it
+
+// Second-level hash of the perfect hash: bucket = h & (DISP_COUNT-1) picks a
+// displacement d, slot = builtin_slot_hash(h, d) & (SLOT_COUNT-1). The
+// generator searches d per bucket until every name lands in its own slot.
+static inline uint32_t builtin_slot_hash(uint32_t h, uint32_t d) {
+    h ^= d * 0x9e3779b9u;
+    h ^= h >> 16;
+    h *= 0x85ebca6bu;
+    h ^= h >> 13;
+    return h;
+}
+
+static int builtin_index(const char* s, int len) {
+    uint32_t h = sym_hash(s, len);
+    uint32_t d = wyn_builtin_disp[h & (WYN_BUILTIN_DISP_COUNT - 1)];
+    int idx = wyn_builtin_slot[builtin_slot_hash(h, d) & (WYN_BUILTIN_SLOT_COUNT - 1)];
+    if (idx < 0) return -1;
+    const BuiltinSym* b = &wyn_builtin_syms[idx];
+    return (b->len == len && memcmp(b->name, s, len) == 0) ? idx : -1;
+}
+
+static Symbol* builtin_symbol(int idx) {
+    Symbol* sym = &builtin_live[idx];
+    if (!sym->name.start) {
+        const BuiltinSym* b = &wyn_builtin_syms[idx];
+        sym->name = (Token){TOKEN_IDENT, b->name, b->len, 0};
+        sym->type = &wyn_builtin_types[b->type];
+        sym->is_mutable = b->is_mutable;
+    }
+    return sym;
+}
+
+// For the "did you mean" scans, which walk global_scope->symbols by index:
+// builtins come first, in catalogue order, as they used to.
+static int builtin_symbol_count(void) {
+    return builtin_table_active ? WYN_BUILTIN_SYM_COUNT : 0;
+}
+static Token builtin_symbol_name(int idx) {
+    return (Token){TOKEN_IDENT, wyn_builtin_syms[idx].name, wyn_builtin_syms[idx].len, 0};
+}
+
+void init_checker() {
+    global_scope = calloc(1, sizeof(SymbolTable));
+    global_scope->capacity = 128;
+    global_scope->symbols = calloc(128, sizeof(Symbol));
+    had_error = false;
+
+    // Initialize trait system
+    wyn_traits_init();
+
+    if (!builtin_types_pristine) {
+        builtin_types_pristine = malloc(sizeof(wyn_builtin_types));
+        memcpy(builtin_types_pristine, wyn_builtin_types, sizeof(wyn_builtin_types));
+    } else {
+        memcpy(wyn_builtin_types, builtin_types_pristine, sizeof(wyn_builtin_types));
+    }
+    // Not freed: Symbol* from a previous run may still be held by its AST,
+    // same as the global_scope allocations before it.
+    builtin_live = calloc(WYN_BUILTIN_SYM_COUNT, sizeof(Symbol));
+    builtin_table_active = true;
+
+    builtin_int = &wyn_builtin_types[WYN_BUILTIN_T_INT];
+    builtin_float = &wyn_builtin_types[WYN_BUILTIN_T_FLOAT];
+    builtin_string = &wyn_builtin_types[WYN_BUILTIN_T_STRING];
+    builtin_bool = &wyn_builtin_types[WYN_BUILTIN_T_BOOL];
+    builtin_void = &wyn_builtin_types[WYN_BUILTIN_T_VOID];
+    builtin_ptr = &wyn_builtin_types[WYN_BUILTIN_T_PTR];
+    builtin_array = &wyn_builtin_types[WYN_BUILTIN_T_ARRAY];
+    builtin_int_opt = &wyn_builtin_types[WYN_BUILTIN_T_INT_OPT];
+
+    // Register loaded user modules as namespace symbols
+    {
+        extern int get_module_count(void);
+        extern void* get_module_entry_at(int index);
+        int mc = get_module_count();
+        for (int mi = 0; mi < mc; mi++) {
+            typedef struct { char* name; void* ast; } ME;
+            ME* mod = (ME*)get_module_entry_at(mi);
+            // Register short name (last segment after /)
+            char* slash = strrchr(mod->name, '/');
+            const char* short_name = slash ? slash + 1 : mod->name;
+            Token ns_tok = {TOKEN_IDENT, short_name, (int)strlen(short_name), 0};
+            if (!find_symbol(global_scope, ns_tok)) {
+                add_symbol(global_scope, ns_tok, builtin_int, false);
+            }
+        }
+    }
+}
+
+// `wyn __builtin-table`: run the catalogue into a scratch global scope and print
+// it as the C header described above. Fails (non-zero, nothing usable on
+// stdout) on any Type it cannot express as a static initialiser.
+typedef struct { Type** items; int count; int cap; } BuiltinTypeList;
+
+static int builtin_type_slot(BuiltinTypeList* l, Type* t) {
+    for (int i = 0; i < l->count; i++) if (l->items[i] == t) return i;
+    return -1;
+}
+
+static bool builtin_collect_type(BuiltinTypeList* l, Type* t) {
+    if (!t || builtin_type_slot(l, t) >= 0) return true;
+    WYN_ENSURE_CAP(l->items, l->count, l->cap);
+    l->items[l->count++] = t;
+    switch (t->kind) {
+        case TYPE_INT: case TYPE_FLOAT: case TYPE_STRING: case TYPE_BOOL:
+        case TYPE_VOID: case TYPE_JSON: case TYPE_CHANNEL:
+            return true;
+        case TYPE_STRUCT:
+            return t->struct_type.field_count == 0;
+        case TYPE_FUNCTION:
+            for (int i = 0; i < t->fn_type.param_count; i++)
+                if (!builtin_collect_type(l, t->fn_type.param_types[i])) return false;
+            return builtin_collect_type(l, t->fn_type.return_type);
+        case TYPE_ARRAY:
+            return builtin_collect_type(l, t->array_type.element_type);
+        case TYPE_MAP: case TYPE_SET:
+            return builtin_collect_type(l, t->map_type.key_type) &&
+                   builtin_collect_type(l, t->map_type.value_type);
+        case TYPE_OPTIONAL:
+            return builtin_collect_type(l, t->optional_type.inner_type);
+        case TYPE_RESULT:
+            return builtin_collect_type(l, t->result_type.ok_type) &&
+                   builtin_collect_type(l, t->result_type.err_type);
+        default:
+            return false;  // ENUM / UNION / GENERIC carry heap arrays of their own
+    }
+}
+
+static void builtin_emit_token(FILE* out, Token t) {
+    fprintf(out, "{(WynTokenType)%d, \"", (int)t.type);
+    for (int i = 0; i < t.length; i++) {
+        if (t.start[i] == '"' || t.start[i] == '\\') fputc('\\', out);
+        fputc(t.start[i], out);
+    }
+    fprintf(out, "\", %d, 0}", t.length);
+}
+
+static void builtin_emit_ref(FILE* out, BuiltinTypeList* l, Type* t) {
+    if (t) fprintf(out, "&wyn_builtin_types[%d]", builtin_type_slot(l, t));
+    else fprintf(out, "NULL");
+}
+
+int checker_emit_builtin_table(FILE* out) {
+    builtin_table_active = false;
+    global_scope = calloc(1, sizeof(SymbolTable));
+    register_builtin_catalogue();
+
+    // The names find_symbol resolved to: the first registration of each.
+    int* ids = malloc(sizeof(int) * (global_scope->count + 1));
+    int n = 0;
+    for (int i = 0; i < global_scope->count; i++) {
+        Symbol* sym = &global_scope->symbols[i];
+        if (find_symbol(global_scope, sym->name) == sym) ids[n++] = i;
+    }
+
+    BuiltinTypeList types = {0};
+    Type* roots[] = {builtin_int, builtin_float, builtin_string, builtin_bool,
+                     builtin_void, builtin_ptr, builtin_array, builtin_int_opt};
+    const char* root_names[] = {"INT", "FLOAT", "STRING", "BOOL", "VOID", "PTR", "ARRAY", "INT_OPT"};
+    int nroots = (int)(sizeof(roots) / sizeof(roots[0]));
+    for (int i = 0; i < nroots; i++) builtin_collect_type(&types, roots[i]);
+    for (int i = 0; i < n; i++) {
+        Symbol* sym = &global_scope->symbols[ids[i]];
+        if (!sym->type || !builtin_collect_type(&types, sym->type)) {
+            fprintf(stderr, "wyn __builtin-table: builtin '%.*s' has a type that cannot be "
+                    "emitted statically (kind %d)\n", sym->name.length, sym->name.start,
+                    sym->type ? (int)sym->type->kind : -1);
+            return 1;
+        }
+    }
+
+    // Hash-and-displace: ~4 names per bucket, slot table at most 80% full.
+    int nslots = 1, nbuckets = 1;
+    while (nslots < n + n / 4) nslots <<= 1;
+    while (nbuckets * 4 < n) nbuckets <<= 1;
+    uint32_t* hashes = malloc(sizeof(uint32_t) * (n + 1));
+    int* bucket_size = calloc(nbuckets, sizeof(int));
+    int* order = malloc(sizeof(int) * nbuckets);
+    uint16_t* disp = calloc(nbuckets, sizeof(uint16_t));
+    int* slots = malloc(sizeof(int) * nslots);
+    int* trial = malloc(sizeof(int) * (n + 1));
+    for (int i = 0; i < nslots; i++) slots[i] = -1;
+    for (int i = 0; i < n; i++) {
+        Token nm = global_scope->symbols[ids[i]].name;
+        hashes[i] = sym_hash(nm.start, nm.length);
+        bucket_size[hashes[i] & (nbuckets - 1)]++;
+    }
+    for (int b = 0; b < nbuckets; b++) order[b] = b;
+    for (int a = 1; a < nbuckets; a++) {  // largest buckets first
+        int b = order[a], k = a;
+        while (k > 0 && bucket_size[order[k - 1]] < bucket_size[b]) { order[k] = order[k - 1]; k--; }
+        order[k] = b;
+    }
+    for (int oi = 0; oi < nbuckets && bucket_size[order[oi]] > 0; oi++) {
+        int b = order[oi];
+        bool placed = false;
+        for (uint32_t d = 0; d < 65536 && !placed; d++) {
+            int nt = 0;
+            placed = true;
+            for (int i = 0; i < n && placed; i++) {
+                if ((int)(hashes[i] & (nbuckets - 1)) != b) continue;
+                int sl = (int)(builtin_slot_hash(hashes[i], d) & (nslots - 1));
+                if (slots[sl] >= 0) { placed = false; break; }
+                for (int t = 0; t < nt; t++) if (trial[t] == sl) { placed = false; break; }
+                trial[nt++] = sl;
+            }
+            if (!placed) continue;
+            disp[b] = (uint16_t)d;
+            nt = 0;
+            for (int i = 0; i < n; i++)
+                if ((int)(hashes[i] & (nbuckets - 1)) == b) slots[trial[nt++]] = i;
+        }
+        if (!placed) {
+            fprintf(stderr, "wyn __builtin-table: no displacement found for bucket %d\n", b);
+            return 1;
+        }
+    }
+
+    fprintf(out, "// Generated by `wyn __builtin-table` from register_builtin_catalogue() in\n");
+    fprintf(out, "// checker.c - do not edit. `make` regenerates it when the catalogue changes.\n");
+    fprintf(out, "#ifndef WYN_CHECKER_BUILTINS_TABLE_H\n#define WYN_CHECKER_BUILTINS_TABLE_H\n\n");
+    fprintf(out, "#define WYN_BUILTIN_TYPE_COUNT %d\n", types.count);
+    fprintf(out, "#define WYN_BUILTIN_SYM_COUNT %d\n", n);
+    fprintf(out, "#define WYN_BUILTIN_DISP_COUNT %d\n", nbuckets);
+    fprintf(out, "#define WYN_BUILTIN_SLOT_COUNT %d\n\n", nslots);
+    for (int i = 0; i < nroots; i++)
+        fprintf(out, "#define WYN_BUILTIN_T_%s %d\n", root_names[i], builtin_type_slot(&types, roots[i]));
+
+    // Parameter lists, pooled. Entry 0 is a shared NULL so zero-parameter
+    // functions keep a non-NULL param_types, as the malloc'd version had.
+    fprintf(out, "\nstatic Type wyn_builtin_types[WYN_BUILTIN_TYPE_COUNT];\n\n");
+    fprintf(out, "static Type* wyn_builtin_params[] = {\n    NULL,\n");
+    int* param_off = calloc(types.count, sizeof(int));
+    int pool = 1;
+    for (int i = 0; i < types.count; i++) {
+        Type* t = types.items[i];
+        if (t->kind != TYPE_FUNCTION || t->fn_type.param_count == 0) continue;
+        param_off[i] = pool;
+        fprintf(out, "    /* %d */", i);
+        for (int p = 0; p < t->fn_type.param_count; p++) {
+            fputc(' ', out);
+            builtin_emit_ref(out, &types, t->fn_type.param_types[p]);
+            fputc(',', out);
+        }
+        fputc('\n', out);
+        pool += t->fn_type.param_count;
+    }
+    fprintf(out, "};\n\n");
+
+    fprintf(out, "static Type wyn_builtin_types[WYN_BUILTIN_TYPE_COUNT] = {\n");
+    for (int i = 0; i < types.count; i++) {
+        Type* t = types.items[i];
+        fprintf(out, "    /* %3d */ {.kind = (TypeKind)%d", i, (int)t->kind);
+        if (t->name.start) { fprintf(out, ", .name = "); builtin_emit_token(out, t->name); }
+        switch (t->kind) {
+            case TYPE_STRUCT:
+                if (t->struct_type.name.start) {
+                    fprintf(out, ", .struct_type = {.name = ");
+                    builtin_emit_token(out, t->struct_type.name);
+                    fprintf(out, "}");
+                }
+                break;
+            case TYPE_FUNCTION:
+                fprintf(out, ", .fn_type = {.param_types = &wyn_builtin_params[%d], "
+                        ".param_count = %d, .min_param_count = %d, .return_type = ",
+                        param_off[i], t->fn_type.param_count, t->fn_type.min_param_count);
+                builtin_emit_ref(out, &types, t->fn_type.return_type);
+                fprintf(out, ", .is_variadic = %s}", t->fn_type.is_variadic ? "true" : "false");
+                break;
+            case TYPE_ARRAY:
+                fprintf(out, ", .array_type = {.element_type = ");
+                builtin_emit_ref(out, &types, t->array_type.element_type);
+                fprintf(out, "}");
+                break;
+            case TYPE_MAP: case TYPE_SET:
+                fprintf(out, ", .map_type = {.key_type = ");
+                builtin_emit_ref(out, &types, t->map_type.key_type);
+                fprintf(out, ", .value_type = ");
+                builtin_emit_ref(out, &types, t->map_type.value_type);
+                fprintf(out, "}");
+                break;
+            case TYPE_OPTIONAL:
+                fprintf(out, ", .optional_type = {.inner_type = ");
+                builtin_emit_ref(out, &types, t->optional_type.inner_type);
+                fprintf(out, "}");
+                break;
+            case TYPE_RESULT:
+                fprintf(out, ", .result_type = {.ok_type = ");
+                builtin_emit_ref(out, &types, t->result_type.ok_type);
+                fprintf(out, ", .err_type = ");
+                builtin_emit_ref(out, &types, t->result_type.err_type);
+                fprintf(out, "}");
+                break;
+            default:
+                break;
+        }
+        fprintf(out, "},\n");
+    }
+    fprintf(out, "};\n\n");
+
+    fprintf(out, "static const BuiltinSym wyn_builtin_syms[WYN_BUILTIN_SYM_COUNT] = {\n");
+    for (int i = 0; i < n; i++) {
+        Symbol* sym = &global_scope->symbols[ids[i]];
+        fprintf(out, "    {\"%.*s\", %d, %d, %s},\n", sym->name.length, sym->name.start,
+                sym->name.length, builtin_type_slot(&types, sym->type),
+                sym->is_mutable ? "true" : "false");
+    }
+    fprintf(out, "};\n\n");
+
+    fprintf(out, "static const uint16_t wyn_builtin_disp[WYN_BUILTIN_DISP_COUNT] = {");
+    for (int b = 0; b < nbuckets; b++)
+        fprintf(out, "%s%u,", b % 16 ? " " : "\n    ", (unsigned)disp[b]);
+    fprintf(out, "\n};\n\n");
+    fprintf(out, "static const int16_t wyn_builtin_slot[WYN_BUILTIN_SLOT_COUNT] = {");
+    for (int i = 0; i < nslots; i++)
+        fprintf(out, "%s%d,", i % 16 ? " " : "\n    ", slots[i]);
+    fprintf(out, "\n};\n\n#endif // WYN_CHECKER_BUILTINS_TABLE_H\n");
+    return 0;
+}
+
 Symbol* find_symbol(SymbolTable* scope, Token name) {
     if (name.length <= 0 || !name.start) {
         if (scope->parent) return find_symbol(scope->parent, name);
         return NULL;
     }
+    if (scope == global_scope && builtin_table_active) {
+        int bi = builtin_index(name.start, name.length);
+        if (bi >= 0) return builtin_symbol(bi);
+    }
     if (scope->hash_capacity > 0 && scope->hash_indices) {
         int mask = scope->hash_capacity - 1;
         uint32_t h = sym_hash(name.start, name.length);
@@ -3128,6 +3652,58 @@ static int channel_const_capacity(const Expr* cap, long long* out) {
     return 1;
 }
 
+// PriorityQueue is monomorphized per element type (WYN_HEAP_DEFINE in
+// wyn_runtime.h). Pick the instance a PriorityQueue::op call belongs to: the
+// comparator's parameter type for new_by(cmp), the heap's own type for the
+// rest. NULL (after reporting why) when there is none.
+static const char* pq_elem_instance(Type* t) {
+    if (!t) return NULL;
+    if (t->kind == TYPE_INT) return "PriorityQueue_int";
+    if (t->kind == TYPE_FLOAT) return "PriorityQueue_float";
+    if (t->kind == TYPE_STRING) return "PriorityQueue_string";
+    return NULL;
+}
+static const char* pq_instance(const char* op, Expr* call, Type** arg_types, int line) {
+    if (strcmp(op, "new_by") == 0) {
+        Type* f = call->call.arg_count == 1 ? arg_types[0] : NULL;
+        const char* inst = NULL;
+        if (f && f->kind == TYPE_FUNCTION && f->fn_type.param_count == 2 &&
+            f->fn_type.return_type && f->fn_type.return_type->kind == TYPE_BOOL &&
+            f->fn_type.param_types[0] && f->fn_type.param_types[1] &&
+            f->fn_type.param_types[0]->kind == f->fn_type.param_types[1]->kind)
+            inst = pq_elem_instance(f->fn_type.param_types[0]);
+        if (!inst) {
+            fprintf(stderr, "Error at line %d: PriorityQueue::new_by expects a function "
+                    "fn(a: T, b: T) -> bool with T int, float or string\n", line);
+            had_error = true;
+        }
+        return inst;
+    }
+    Type* h = call->call.arg_count >= 1 ? arg_types[0] : NULL;
+    if (h && h->kind == TYPE_STRUCT && h->struct_type.name.length > 15 &&
+        memcmp(h->struct_type.name.start, "PriorityQueue_", 14) == 0) {
+        static char inst[32];
+        snprintf(inst, sizeof(inst), "%.*s", h->struct_type.name.length - 1, h->struct_type.name.start);
+        if (strcmp(op, "push") == 0 && call->call.arg_count == 2) {
+            Type* v = arg_types[1];
+            const char* vi = pq_elem_instance(v);
+            bool ok = vi && (strcmp(vi, inst) == 0 ||
+                             (strcmp(inst, "PriorityQueue_float") == 0 && v->kind == TYPE_INT));
+            if (!ok) {
+                fprintf(stderr, "Error at line %d: PriorityQueue::push value does not match the "
+                        "queue's element type (%s)\n", line, inst + 14);
+                had_error = true;
+                return NULL;
+            }
+        }
+        return inst;
+    }
+    fprintf(stderr, "Error at line %d: PriorityQueue::%s expects a queue from "
+            "PriorityQueue::new() or PriorityQueue::new_by(cmp)\n", line, op);
+    had_error = true;
+    return NULL;
+}
+
 Type* check_expr(Expr* expr, SymbolTable* scope) {
     if (!expr) return NULL;
 
@@ -3364,9 +3940,11 @@ Type* check_expr(Expr* expr, SymbolTable* scope) {
                 }
                 // Also check global scope
                 if (!best_name[0] && global_scope) {
-                    for (int i = 0; i < global_scope->count; i++) {
+                    int nb = builtin_symbol_count();
+                    for (int i = 0; i < nb + global_scope->count; i++) {
                         char sym_name[256];
-                        token_to_cstr(sym_name, sizeof(sym_name), global_scope->symbols[i].name);
+                        token_to_cstr(sym_name, sizeof(sym_name),
+                                      i < nb ? builtin_symbol_name(i) : global_scope->symbols[i - nb].name);
                         int d = levenshtein_distance(var_name, sym_name);
                         if (d < best_dist && d <= 2) { best_dist = d; strncpy(best_name, sym_name, 255); }
                     }
@@ -4234,6 +4812,21 @@ Type* check_expr(Expr* expr, SymbolTable* scope) {
                             return map_type;
                         }
                     }
+                    if (strcmp(qual_module, "PriorityQueue") == 0 && strcmp(qual_func, "new") != 0) {
+                        const char* inst = pq_instance(qual_func, expr, arg_types,
+                                                       expr->call.callee->token.line);
+                        if (!inst) {
+                            free(arg_types);
+                            return builtin_int;
+                        }
+                        // Codegen emits `A::b` as A_b: call the instance directly.
+                        char* q = malloc(strlen(inst) + 2 + strlen(qual_func) + 1);
+                        sprintf(q, "%s::%s", inst, strcmp(qual_func, "new_by") == 0 ? "new" : qual_func);
+                        expr->call.callee->token.start = q;
+                        expr->call.callee->token.length = (int)strlen(q);
+                        snprintf(qual_module, sizeof(qual_module), "%s", inst);
+                        snprintf(qual_func, sizeof(qual_func), "%s", q + strlen(inst) + 2);
+                    }
                     // Stdlib namespaces register their functions under the
                     // `Module_func` underscore name (e.g. Color_green, String_…).
                     // Resolve the qualified `Module::func` callee to that symbol and
@@ -4359,8 +4952,11 @@ Type* check_expr(Expr* expr, SymbolTable* scope) {
                     char closest[256] = {0};
                     SymbolTable* s = scope;
                     while (s) {
-                        for (int si = 0; si < s->count; si++) {
-                            char sn[256]; int sl = token_to_cstr(sn, sizeof(sn), s->symbols[si].name);
+                        int nb = s == global_scope ? builtin_symbol_count() : 0;
+                        for (int si = 0; si < nb + s->count; si++) {
+                            char sn[256];
+                            int sl = token_to_cstr(sn, sizeof(sn),
+                                                   si < nb ? builtin_symbol_name(si) : s->symbols[si - nb].name);
                             // Simple distance: count differing chars
                             int fl = strlen(func_name);
                             int diff = abs(fl - sl);
@@ -5193,6 +5789,10 @@ Type* check_expr(Expr* expr, SymbolTable* scope) {
                         }
                         expr->expr_type = builtin_array;
                         return builtin_array;
+                    } else if (strcmp(return_type_str, "set") == 0) {
+                        // union/intersection/difference hand back a new set
+                        expr->expr_type = make_type(TYPE_SET);
+                        return expr->expr_type;
                     } else if (strcmp(return_type_str, "json") == 0) {
                         Type* json_type = make_type(TYPE_JSON);
                         expr->expr_type = json_type;
@@ -5231,39 +5831,33 @@ Type* check_expr(Expr* expr, SymbolTable* scope) {
                 // int, breaking the documented builder idiom - variable-rooted
                 // chains only worked via codegen-side registries.
                 {
-                    StructStmt* sdef = find_struct_definition(type_name);
-                    if (sdef) {
-                        for (int mi = 0; mi < sdef->method_count; mi++) {
-                            FnStmt* m = sdef->methods[mi];
-                            if (m->name.length != method.length ||
-                                memcmp(m->name.start, method.start, method.length) != 0)
-                                continue;
-                            Expr* rt = m->return_type;
-                            if (rt && rt->type == EXPR_IDENT) {
-                                Token tn = rt->token;
-                                if (tn.length == 3 && memcmp(tn.start, "int", 3) == 0) {
-                                    expr->expr_type = builtin_int; return builtin_int;
-                                }
-                                if (tn.length == 6 && memcmp(tn.start, "string", 6) == 0) {
-                                    expr->expr_type = builtin_string; return builtin_string;
-                                }
-                                if (tn.length == 5 && memcmp(tn.start, "float", 5) == 0) {
-                                    expr->expr_type = builtin_float; return builtin_float;
-                                }
-                                if (tn.length == 4 && memcmp(tn.start, "bool", 4) == 0) {
-                                    expr->expr_type = builtin_bool; return builtin_bool;
-                                }
-                                Symbol* ts = find_symbol(global_scope, tn);
-                                if (ts && ts->type &&
-                                    (ts->type->kind == TYPE_STRUCT || ts->type->kind == TYPE_ENUM)) {
-                                    expr->expr_type = ts->type; return ts->type;
-                                }
+                    FnStmt* m = find_struct_method(type_name, method);
+                    if (m) {
+                        Expr* rt = m->return_type;
+                        if (rt && rt->type == EXPR_IDENT) {
+                            Token tn = rt->token;
+                            if (tn.length == 3 && memcmp(tn.start, "int", 3) == 0) {
+                                expr->expr_type = builtin_int; return builtin_int;
+                            }
+                            if (tn.length == 6 && memcmp(tn.start, "string", 6) == 0) {
+                                expr->expr_type = builtin_string; return builtin_string;
+                            }
+                            if (tn.length == 5 && memcmp(tn.start, "float", 5) == 0) {
+                                expr->expr_type = builtin_float; return builtin_float;
+                            }
+                            if (tn.length == 4 && memcmp(tn.start, "bool", 4) == 0) {
+                                expr->expr_type = builtin_bool; return builtin_bool;
+                            }
+                            Symbol* ts = find_symbol(global_scope, tn);
+                            if (ts && ts->type &&
+                                (ts->type->kind == TYPE_STRUCT || ts->type->kind == TYPE_ENUM)) {
+                                expr->expr_type = ts->type; return ts->type;
                             }
-                            // Declared method with no/unresolvable return type:
-                            // keep the historical int fallback.
-                            expr->expr_type = builtin_int;
-                            return builtin_int;
                         }
+                        // Declared method with no/unresolvable return type:
+                        // keep the historical int fallback.
+                        expr->expr_type = builtin_int;
+                        return builtin_int;
                     }
                 }
 
@@ -7898,20 +8492,9 @@ static Type* imported_type_from_expr(Expr* type_expr) {
 // via a whole-module `import m` does not (and must be qualified `m.name()`).
 static bool flat_callable_in_program(Program* prog, const char* name, int name_len) {
     if (!prog) return false;
-    for (int i = 0; i < prog->count; i++) {
-        Stmt* s = prog->stmts[i];
-        if (s->type == STMT_EXPORT && s->export.stmt) s = s->export.stmt;
-        if (s->type == STMT_FN) {
-            if (s->fn.name.length == name_len &&
-                memcmp(s->fn.name.start, name, name_len) == 0) return true;
-        } else if (s->type == STMT_IMPORT && s->import.item_count > 0) {
-            for (int j = 0; j < s->import.item_count; j++) {
-                if (s->import.items[j].length == name_len &&
-                    memcmp(s->import.items[j].start, name, name_len) == 0) return true;
-            }
-        }
-    }
-    return false;
+    Token none = {0};
+    Token t = {TOKEN_IDENT, name, name_len, 0};
+    return def_lookup(prog, DEF_FN, none, t) || def_lookup(prog, DEF_IMPORT_ITEM, none, t);
 }
 
 // Build a TYPE_FUNCTION for an imported module function from its AST, resolving
@@ -8372,6 +8955,7 @@ static void check_shared_mutable_globals(Program* prog) {
 void check_program(Program* prog) {
     // Set global pointer for struct field type lookup
     current_program = prog;
+    def_indexes_reset();
     
     // Pass -1: Process imports first so module types are available in Pass 0
     for (int i = 0; i < prog->count; i++) {
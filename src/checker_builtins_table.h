@@ -0,0 +1,1754 @@
+// Generated by `wyn __builtin-table` from register_builtin_catalogue() in
+// checker.c - do not edit. `make` regenerates it when the catalogue changes.
+#ifndef WYN_CHECKER_BUILTINS_TABLE_H
+#define WYN_CHECKER_BUILTINS_TABLE_H
+
+#define WYN_BUILTIN_TYPE_COUNT 481
+#define WYN_BUILTIN_SYM_COUNT 761
+#define WYN_BUILTIN_DISP_COUNT 256
+#define WYN_BUILTIN_SLOT_COUNT 1024
+
+#define WYN_BUILTIN_T_INT 0
+#define WYN_BUILTIN_T_FLOAT 1
+#define WYN_BUILTIN_T_STRING 2
+#define WYN_BUILTIN_T_BOOL 3
+#define WYN_BUILTIN_T_VOID 4
+#define WYN_BUILTIN_T_PTR 5
+#define WYN_BUILTIN_T_ARRAY 6
+#define WYN_BUILTIN_T_INT_OPT 7
+
+static Type wyn_builtin_types[WYN_BUILTIN_TYPE_COUNT];
+
+static Type* wyn_builtin_params[] = {
+    NULL,
+    /* 14 */ &wyn_builtin_types[2],
+    /* 15 */ &wyn_builtin_types[2], &wyn_builtin_types[2],
+    /* 16 */ &wyn_builtin_types[2], &wyn_builtin_types[2],
+    /* 17 */ &wyn_builtin_types[2],
+    /* 18 */ &wyn_builtin_types[2],
+    /* 19 */ &wyn_builtin_types[2], &wyn_builtin_types[2],
+    /* 20 */ &wyn_builtin_types[2], &wyn_builtin_types[2],
+    /* 24 */ &wyn_builtin_types[6],
+    /* 27 */ &wyn_builtin_types[0],
+    /* 28 */ &wyn_builtin_types[2],
+    /* 29 */ &wyn_builtin_types[2],
+    /* 30 */ &wyn_builtin_types[2],
+    /* 31 */ &wyn_builtin_types[2],
+    /* 35 */ &wyn_builtin_types[0],
+    /* 37 */ &wyn_builtin_types[0], &wyn_builtin_types[2],
+    /* 38 */ &wyn_builtin_types[2],
+    /* 39 */ &wyn_builtin_types[2], &wyn_builtin_types[2],
+    /* 40 */ &wyn_builtin_types[2],
+    /* 41 */ &wyn_builtin_types[0],
+    /* 42 */ &wyn_builtin_types[2],
+    /* 43 */ &wyn_builtin_types[10],
+    /* 44 */ &wyn_builtin_types[10],
+    /* 45 */ &wyn_builtin_types[2],
+    /* 46 */ &wyn_builtin_types[2],
+    /* 47 */ &wyn_builtin_types[11],
+    /* 48 */ &wyn_builtin_types[11],
+    /* 49 */ &wyn_builtin_types[10],
+    /* 50 */ &wyn_builtin_types[10],
+    /* 51 */ &wyn_builtin_types[11],
+    /* 52 */ &wyn_builtin_types[11],
+    /* 54 */ &wyn_builtin_types[0],
+    /* 56 */ &wyn_builtin_types[53],
+    /* 57 */ &wyn_builtin_types[53],
+    /* 58 */ &wyn_builtin_types[53],
+    /* 59 */ &wyn_builtin_types[53], &wyn_builtin_types[0],
+    /* 61 */ &wyn_builtin_types[2],
+    /* 63 */ &wyn_builtin_types[60],
+    /* 64 */ &wyn_builtin_types[60],
+    /* 65 */ &wyn_builtin_types[60],
+    /* 66 */ &wyn_builtin_types[60], &wyn_builtin_types[2],
+    /* 68 */ &wyn_builtin_types[1],
+    /* 70 */ &wyn_builtin_types[67],
+    /* 71 */ &wyn_builtin_types[67],
+    /* 72 */ &wyn_builtin_types[67],
+    /* 73 */ &wyn_builtin_types[67], &wyn_builtin_types[1],
+    /* 75 */ &wyn_builtin_types[3],
+    /* 77 */ &wyn_builtin_types[74],
+    /* 78 */ &wyn_builtin_types[74],
+    /* 79 */ &wyn_builtin_types[74],
+    /* 80 */ &wyn_builtin_types[74], &wyn_builtin_types[3],
+    /* 82 */ &wyn_builtin_types[1],
+    /* 83 */ &wyn_builtin_types[2],
+    /* 84 */ &wyn_builtin_types[81],
+    /* 85 */ &wyn_builtin_types[81],
+    /* 86 */ &wyn_builtin_types[81],
+    /* 87 */ &wyn_builtin_types[81],
+    /* 88 */ &wyn_builtin_types[81], &wyn_builtin_types[1],
+    /* 90 */ &wyn_builtin_types[3],
+    /* 91 */ &wyn_builtin_types[2],
+    /* 92 */ &wyn_builtin_types[89],
+    /* 93 */ &wyn_builtin_types[89],
+    /* 94 */ &wyn_builtin_types[89],
+    /* 95 */ &wyn_builtin_types[89],
+    /* 96 */ &wyn_builtin_types[89], &wyn_builtin_types[3],
+    /* 97 */ &wyn_builtin_types[2],
+    /* 98 */ &wyn_builtin_types[2],
+    /* 99 */ &wyn_builtin_types[0],
+    /* 100 */ &wyn_builtin_types[2],
+    /* 101 */ &wyn_builtin_types[0],
+    /* 102 */ &wyn_builtin_types[1],
+    /* 103 */ &wyn_builtin_types[1],
+    /* 104 */ &wyn_builtin_types[1], &wyn_builtin_types[1],
+    /* 105 */ &wyn_builtin_types[1], &wyn_builtin_types[1],
+    /* 106 */ &wyn_builtin_types[1], &wyn_builtin_types[1],
+    /* 107 */ &wyn_builtin_types[1],
+    /* 108 */ &wyn_builtin_types[1],
+    /* 109 */ &wyn_builtin_types[1],
+    /* 110 */ &wyn_builtin_types[1],
+    /* 111 */ &wyn_builtin_types[1],
+    /* 112 */ &wyn_builtin_types[1],
+    /* 113 */ &wyn_builtin_types[1],
+    /* 114 */ &wyn_builtin_types[1], &wyn_builtin_types[0],
+    /* 115 */ &wyn_builtin_types[1], &wyn_builtin_types[1],
+    /* 119 */ &wyn_builtin_types[2], &wyn_builtin_types[2],
+    /* 120 */ &wyn_builtin_types[2], &wyn_builtin_types[0], &wyn_builtin_types[0],
+    /* 121 */ &wyn_builtin_types[2],
+    /* 122 */ &wyn_builtin_types[2],
+    /* 123 */ &wyn_builtin_types[2],
+    /* 124 */ &wyn_builtin_types[2], &wyn_builtin_types[2],
+    /* 127 */ &wyn_builtin_types[126], &wyn_builtin_types[2], &wyn_builtin_types[2],
+    /* 128 */ &wyn_builtin_types[126], &wyn_builtin_types[2], &wyn_builtin_types[0],
+    /* 129 */ &wyn_builtin_types[0], &wyn_builtin_types[2],
+    /* 130 */ &wyn_builtin_types[126],
+    /* 131 */ &wyn_builtin_types[2], &wyn_builtin_types[2],
+    /* 132 */ &wyn_builtin_types[2], &wyn_builtin_types[2], &wyn_builtin_types[2],
+    /* 133 */ &wyn_builtin_types[2],
+    /* 134 */ &wyn_builtin_types[2], &wyn_builtin_types[2],
+    /* 135 */ &wyn_builtin_types[2],
+    /* 136 */ &wyn_builtin_types[2],
+    /* 137 */ &wyn_builtin_types[2], &wyn_builtin_types[2],
+    /* 138 */ &wyn_builtin_types[2], &wyn_builtin_types[2],
+    /* 139 */ &wyn_builtin_types[2],
+    /* 140 */ &wyn_builtin_types[2],
+    /* 141 */ &wyn_builtin_types[2],
+    /* 142 */ &wyn_builtin_types[2],
+    /* 143 */ &wyn_builtin_types[2],
+    /* 144 */ &wyn_builtin_types[2], &wyn_builtin_types[2],
+    /* 146 */ &wyn_builtin_types[2], &wyn_builtin_types[2],
+    /* 147 */ &wyn_builtin_types[0],
+    /* 148 */ &wyn_builtin_types[0], &wyn_builtin_types[2],
+    /* 149 */ &wyn_builtin_types[0],
+    /* 150 */ &wyn_builtin_types[0],
+    /* 151 */ &wyn_builtin_types[2],
+    /* 153 */ &wyn_builtin_types[0],
+    /* 161 */ &wyn_builtin_types[160], &wyn_builtin_types[2], &wyn_builtin_types[2],
+    /* 162 */ &wyn_builtin_types[160], &wyn_builtin_types[2], &wyn_builtin_types[0],
+    /* 163 */ &wyn_builtin_types[160], &wyn_builtin_types[2], &wyn_builtin_types[0],
+    /* 164 */ &wyn_builtin_types[160],
+    /* 165 */ &wyn_builtin_types[2],
+    /* 172 */ &wyn_builtin_types[2],
+    /* 173 */ &wyn_builtin_types[0], &wyn_builtin_types[0],
+    /* 174 */ &wyn_builtin_types[2],
+    /* 175 */ &wyn_builtin_types[2],
+    /* 176 */ &wyn_builtin_types[2],
+    /* 177 */ &wyn_builtin_types[2],
+    /* 178 */ &wyn_builtin_types[2],
+    /* 179 */ &wyn_builtin_types[2],
+    /* 180 */ &wyn_builtin_types[2],
+    /* 181 */ &wyn_builtin_types[2],
+    /* 182 */ &wyn_builtin_types[2],
+    /* 183 */ &wyn_builtin_types[2],
+    /* 187 */ &wyn_builtin_types[0], &wyn_builtin_types[2],
+    /* 188 */ &wyn_builtin_types[0],
+    /* 189 */ &wyn_builtin_types[2], &wyn_builtin_types[2],
+    /* 190 */ &wyn_builtin_types[2], &wyn_builtin_types[2],
+    /* 191 */ &wyn_builtin_types[2],
+    /* 192 */ &wyn_builtin_types[0],
+    /* 193 */ &wyn_builtin_types[0],
+    /* 194 */ &wyn_builtin_types[0], &wyn_builtin_types[0], &wyn_builtin_types[2], &wyn_builtin_types[2],
+    /* 195 */ &wyn_builtin_types[0], &wyn_builtin_types[0], &wyn_builtin_types[2],
+    /* 196 */ &wyn_builtin_types[0], &wyn_builtin_types[0], &wyn_builtin_types[2],
+    /* 197 */ &wyn_builtin_types[2], &wyn_builtin_types[2],
+    /* 198 */ &wyn_builtin_types[2],
+    /* 199 */ &wyn_builtin_types[2],
+    /* 200 */ &wyn_builtin_types[0],
+    /* 201 */ &wyn_builtin_types[2], &wyn_builtin_types[0],
+    /* 202 */ &wyn_builtin_types[0], &wyn_builtin_types[2],
+    /* 203 */ &wyn_builtin_types[0],
+    /* 204 */ &wyn_builtin_types[0],
+    /* 205 */ &wyn_builtin_types[0],
+    /* 206 */ &wyn_builtin_types[0],
+    /* 207 */ &wyn_builtin_types[0], &wyn_builtin_types[0],
+    /* 208 */ &wyn_builtin_types[0], &wyn_builtin_types[0],
+    /* 209 */ &wyn_builtin_types[0],
+    /* 210 */ &wyn_builtin_types[0], &wyn_builtin_types[0],
+    /* 211 */ &wyn_builtin_types[0],
+    /* 212 */ &wyn_builtin_types[0],
+    /* 213 */ &wyn_builtin_types[0],
+    /* 214 */ &wyn_builtin_types[0], &wyn_builtin_types[0],
+    /* 215 */ &wyn_builtin_types[0], &wyn_builtin_types[0], &wyn_builtin_types[0],
+    /* 216 */ &wyn_builtin_types[0],
+    /* 218 */ &wyn_builtin_types[219],
+    /* 221 */ &wyn_builtin_types[5],
+    /* 222 */ &wyn_builtin_types[5], &wyn_builtin_types[5],
+    /* 223 */ &wyn_builtin_types[5],
+    /* 224 */ &wyn_builtin_types[0],
+    /* 225 */ &wyn_builtin_types[0], &wyn_builtin_types[0],
+    /* 226 */ &wyn_builtin_types[0], &wyn_builtin_types[0],
+    /* 227 */ &wyn_builtin_types[0], &wyn_builtin_types[0],
+    /* 228 */ &wyn_builtin_types[0], &wyn_builtin_types[0],
+    /* 229 */ &wyn_builtin_types[0],
+    /* 230 */ &wyn_builtin_types[0], &wyn_builtin_types[0],
+    /* 231 */ &wyn_builtin_types[0],
+    /* 232 */ &wyn_builtin_types[0],
+    /* 233 */ &wyn_builtin_types[0],
+    /* 234 */ &wyn_builtin_types[0],
+    /* 235 */ &wyn_builtin_types[0],
+    /* 236 */ &wyn_builtin_types[0],
+    /* 244 */ &wyn_builtin_types[0], &wyn_builtin_types[0], &wyn_builtin_types[0],
+    /* 245 */ &wyn_builtin_types[0],
+    /* 246 */ &wyn_builtin_types[0], &wyn_builtin_types[0],
+    /* 247 */ &wyn_builtin_types[0], &wyn_builtin_types[0],
+    /* 248 */ &wyn_builtin_types[0],
+    /* 249 */ &wyn_builtin_types[0], &wyn_builtin_types[0],
+    /* 250 */ &wyn_builtin_types[0], &wyn_builtin_types[0],
+    /* 251 */ &wyn_builtin_types[0],
+    /* 252 */ &wyn_builtin_types[0],
+    /* 253 */ &wyn_builtin_types[0], &wyn_builtin_types[0],
+    /* 254 */ &wyn_builtin_types[0],
+    /* 255 */ &wyn_builtin_types[0],
+    /* 256 */ &wyn_builtin_types[0],
+    /* 257 */ &wyn_builtin_types[0],
+    /* 258 */ &wyn_builtin_types[0],
+    /* 259 */ &wyn_builtin_types[0],
+    /* 260 */ &wyn_builtin_types[0],
+    /* 261 */ &wyn_builtin_types[0],
+    /* 262 */ &wyn_builtin_types[0],
+    /* 263 */ &wyn_builtin_types[0],
+    /* 264 */ &wyn_builtin_types[0],
+    /* 265 */ &wyn_builtin_types[0],
+    /* 266 */ &wyn_builtin_types[0],
+    /* 267 */ &wyn_builtin_types[0],
+    /* 268 */ &wyn_builtin_types[0],
+    /* 269 */ &wyn_builtin_types[0],
+    /* 270 */ &wyn_builtin_types[0], &wyn_builtin_types[0], &wyn_builtin_types[0], &wyn_builtin_types[0], &wyn_builtin_types[0],
+    /* 271 */ &wyn_builtin_types[0],
+    /* 272 */ &wyn_builtin_types[0], &wyn_builtin_types[0], &wyn_builtin_types[0],
+    /* 273 */ &wyn_builtin_types[0],
+    /* 274 */ &wyn_builtin_types[0], &wyn_builtin_types[0],
+    /* 275 */ &wyn_builtin_types[0],
+    /* 276 */ &wyn_builtin_types[0],
+    /* 277 */ &wyn_builtin_types[0], &wyn_builtin_types[0],
+    /* 278 */ &wyn_builtin_types[0],
+    /* 279 */ &wyn_builtin_types[0],
+    /* 280 */ &wyn_builtin_types[0],
+    /* 281 */ &wyn_builtin_types[0], &wyn_builtin_types[0],
+    /* 282 */ &wyn_builtin_types[0], &wyn_builtin_types[0],
+    /* 283 */ &wyn_builtin_types[0],
+    /* 284 */ &wyn_builtin_types[0],
+    /* 285 */ &wyn_builtin_types[0],
+    /* 286 */ &wyn_builtin_types[0],
+    /* 287 */ &wyn_builtin_types[0], &wyn_builtin_types[0],
+    /* 288 */ &wyn_builtin_types[0], &wyn_builtin_types[0], &wyn_builtin_types[0],
+    /* 289 */ &wyn_builtin_types[0],
+    /* 290 */ &wyn_builtin_types[0],
+    /* 291 */ &wyn_builtin_types[0],
+    /* 292 */ &wyn_builtin_types[0],
+    /* 293 */ &wyn_builtin_types[0], &wyn_builtin_types[0], &wyn_builtin_types[0],
+    /* 294 */ &wyn_builtin_types[0],
+    /* 295 */ &wyn_builtin_types[0],
+    /* 296 */ &wyn_builtin_types[0], &wyn_builtin_types[0],
+    /* 297 */ &wyn_builtin_types[0], &wyn_builtin_types[0],
+    /* 298 */ &wyn_builtin_types[0], &wyn_builtin_types[0],
+    /* 299 */ &wyn_builtin_types[0], &wyn_builtin_types[0],
+    /* 300 */ &wyn_builtin_types[0],
+    /* 301 */ &wyn_builtin_types[0],
+    /* 302 */ &wyn_builtin_types[0], &wyn_builtin_types[0],
+    /* 303 */ &wyn_builtin_types[0], &wyn_builtin_types[0],
+    /* 304 */ &wyn_builtin_types[0], &wyn_builtin_types[0],
+    /* 305 */ &wyn_builtin_types[0], &wyn_builtin_types[0],
+    /* 306 */ &wyn_builtin_types[0], &wyn_builtin_types[0],
+    /* 307 */ &wyn_builtin_types[0],
+    /* 308 */ &wyn_builtin_types[0],
+    /* 309 */ &wyn_builtin_types[0],
+    /* 310 */ &wyn_builtin_types[0],
+    /* 311 */ &wyn_builtin_types[0],
+    /* 312 */ &wyn_builtin_types[0],
+    /* 313 */ &wyn_builtin_types[0],
+    /* 314 */ &wyn_builtin_types[0],
+    /* 315 */ &wyn_builtin_types[0],
+    /* 316 */ &wyn_builtin_types[0],
+    /* 317 */ &wyn_builtin_types[0],
+    /* 318 */ &wyn_builtin_types[0], &wyn_builtin_types[0],
+    /* 319 */ &wyn_builtin_types[0], &wyn_builtin_types[0],
+    /* 320 */ &wyn_builtin_types[0], &wyn_builtin_types[0],
+    /* 321 */ &wyn_builtin_types[0], &wyn_builtin_types[0],
+    /* 322 */ &wyn_builtin_types[0],
+    /* 323 */ &wyn_builtin_types[0], &wyn_builtin_types[0],
+    /* 324 */ &wyn_builtin_types[0], &wyn_builtin_types[0],
+    /* 325 */ &wyn_builtin_types[0], &wyn_builtin_types[0], &wyn_builtin_types[0],
+    /* 326 */ &wyn_builtin_types[0], &wyn_builtin_types[0],
+    /* 327 */ &wyn_builtin_types[0], &wyn_builtin_types[0],
+    /* 328 */ &wyn_builtin_types[0],
+    /* 329 */ &wyn_builtin_types[0],
+    /* 330 */ &wyn_builtin_types[0],
+    /* 331 */ &wyn_builtin_types[0],
+    /* 332 */ &wyn_builtin_types[0], &wyn_builtin_types[0],
+    /* 333 */ &wyn_builtin_types[0], &wyn_builtin_types[0],
+    /* 334 */ &wyn_builtin_types[0],
+    /* 335 */ &wyn_builtin_types[0],
+    /* 336 */ &wyn_builtin_types[0], &wyn_builtin_types[0],
+    /* 337 */ &wyn_builtin_types[0], &wyn_builtin_types[0], &wyn_builtin_types[0],
+    /* 338 */ &wyn_builtin_types[0], &wyn_builtin_types[0],
+    /* 339 */ &wyn_builtin_types[0], &wyn_builtin_types[0],
+    /* 340 */ &wyn_builtin_types[0], &wyn_builtin_types[0], &wyn_builtin_types[0],
+    /* 341 */ &wyn_builtin_types[0],
+    /* 342 */ &wyn_builtin_types[0],
+    /* 343 */ &wyn_builtin_types[0], &wyn_builtin_types[0],
+    /* 344 */ &wyn_builtin_types[0], &wyn_builtin_types[0], &wyn_builtin_types[0],
+    /* 345 */ &wyn_builtin_types[0],
+    /* 346 */ &wyn_builtin_types[0], &wyn_builtin_types[0],
+    /* 347 */ &wyn_builtin_types[0], &wyn_builtin_types[0],
+    /* 348 */ &wyn_builtin_types[0], &wyn_builtin_types[0],
+    /* 349 */ &wyn_builtin_types[0], &wyn_builtin_types[0],
+    /* 350 */ &wyn_builtin_types[0],
+    /* 351 */ &wyn_builtin_types[0], &wyn_builtin_types[0],
+    /* 352 */ &wyn_builtin_types[0],
+    /* 353 */ &wyn_builtin_types[0], &wyn_builtin_types[0], &wyn_builtin_types[0],
+    /* 354 */ &wyn_builtin_types[0], &wyn_builtin_types[0],
+    /* 355 */ &wyn_builtin_types[0], &wyn_builtin_types[0],
+    /* 356 */ &wyn_builtin_types[0],
+    /* 357 */ &wyn_builtin_types[0],
+    /* 358 */ &wyn_builtin_types[0],
+    /* 359 */ &wyn_builtin_types[0], &wyn_builtin_types[0],
+    /* 360 */ &wyn_builtin_types[0],
+    /* 361 */ &wyn_builtin_types[0],
+    /* 362 */ &wyn_builtin_types[0],
+    /* 363 */ &wyn_builtin_types[0],
+    /* 364 */ &wyn_builtin_types[0],
+    /* 366 */ &wyn_builtin_types[0],
+    /* 367 */ &wyn_builtin_types[0],
+    /* 368 */ &wyn_builtin_types[0],
+    /* 369 */ &wyn_builtin_types[0], &wyn_builtin_types[0],
+    /* 370 */ &wyn_builtin_types[0], &wyn_builtin_types[0],
+    /* 371 */ &wyn_builtin_types[0], &wyn_builtin_types[0],
+    /* 372 */ &wyn_builtin_types[0],
+    /* 373 */ &wyn_builtin_types[0],
+    /* 374 */ &wyn_builtin_types[0],
+    /* 377 */ &wyn_builtin_types[0], &wyn_builtin_types[0],
+    /* 378 */ &wyn_builtin_types[0], &wyn_builtin_types[0],
+    /* 379 */ &wyn_builtin_types[0], &wyn_builtin_types[0],
+    /* 380 */ &wyn_builtin_types[0], &wyn_builtin_types[0],
+    /* 381 */ &wyn_builtin_types[0],
+    /* 382 */ &wyn_builtin_types[0],
+    /* 383 */ &wyn_builtin_types[0],
+    /* 384 */ &wyn_builtin_types[0],
+    /* 385 */ &wyn_builtin_types[0],
+    /* 387 */ &wyn_builtin_types[0],
+    /* 388 */ &wyn_builtin_types[0],
+    /* 389 */ &wyn_builtin_types[0],
+    /* 390 */ &wyn_builtin_types[0],
+    /* 391 */ &wyn_builtin_types[0],
+    /* 392 */ &wyn_builtin_types[0],
+    /* 393 */ &wyn_builtin_types[0],
+    /* 394 */ &wyn_builtin_types[0],
+    /* 396 */ &wyn_builtin_types[0], &wyn_builtin_types[0],
+    /* 397 */ &wyn_builtin_types[0], &wyn_builtin_types[0],
+    /* 398 */ &wyn_builtin_types[0],
+    /* 399 */ &wyn_builtin_types[0],
+    /* 400 */ &wyn_builtin_types[0],
+    /* 401 */ &wyn_builtin_types[0],
+    /* 402 */ &wyn_builtin_types[0], &wyn_builtin_types[0],
+    /* 403 */ &wyn_builtin_types[0], &wyn_builtin_types[0], &wyn_builtin_types[0],
+    /* 404 */ &wyn_builtin_types[0],
+    /* 405 */ &wyn_builtin_types[0],
+    /* 406 */ &wyn_builtin_types[0],
+    /* 409 */ &wyn_builtin_types[0],
+    /* 410 */ &wyn_builtin_types[0], &wyn_builtin_types[0],
+    /* 411 */ &wyn_builtin_types[0],
+    /* 412 */ &wyn_builtin_types[0],
+    /* 413 */ &wyn_builtin_types[0],
+    /* 414 */ &wyn_builtin_types[0],
+    /* 415 */ &wyn_builtin_types[0],
+    /* 417 */ &wyn_builtin_types[0], &wyn_builtin_types[0],
+    /* 418 */ &wyn_builtin_types[0],
+    /* 419 */ &wyn_builtin_types[0],
+    /* 420 */ &wyn_builtin_types[0],
+    /* 421 */ &wyn_builtin_types[0],
+    /* 422 */ &wyn_builtin_types[0],
+    /* 424 */ &wyn_builtin_types[0], &wyn_builtin_types[0],
+    /* 425 */ &wyn_builtin_types[0],
+    /* 426 */ &wyn_builtin_types[0],
+    /* 427 */ &wyn_builtin_types[0],
+    /* 428 */ &wyn_builtin_types[0],
+    /* 429 */ &wyn_builtin_types[0],
+    /* 430 */ &wyn_builtin_types[0],
+    /* 431 */ &wyn_builtin_types[0],
+    /* 432 */ &wyn_builtin_types[0],
+    /* 433 */ &wyn_builtin_types[0],
+    /* 434 */ &wyn_builtin_types[0],
+    /* 435 */ &wyn_builtin_types[0],
+    /* 436 */ &wyn_builtin_types[0],
+    /* 437 */ &wyn_builtin_types[0],
+    /* 438 */ &wyn_builtin_types[0],
+    /* 439 */ &wyn_builtin_types[0],
+    /* 440 */ &wyn_builtin_types[0],
+    /* 441 */ &wyn_builtin_types[0],
+    /* 442 */ &wyn_builtin_types[0],
+    /* 443 */ &wyn_builtin_types[0],
+    /* 444 */ &wyn_builtin_types[0],
+    /* 445 */ &wyn_builtin_types[0],
+    /* 446 */ &wyn_builtin_types[2], &wyn_builtin_types[0], &wyn_builtin_types[0],
+    /* 447 */ &wyn_builtin_types[0], &wyn_builtin_types[0], &wyn_builtin_types[0],
+    /* 448 */ &wyn_builtin_types[0], &wyn_builtin_types[0], &wyn_builtin_types[0],
+    /* 449 */ &wyn_builtin_types[0], &wyn_builtin_types[0], &wyn_builtin_types[0], &wyn_builtin_types[0],
+    /* 450 */ &wyn_builtin_types[0], &wyn_builtin_types[0], &wyn_builtin_types[0], &wyn_builtin_types[0],
+    /* 451 */ &wyn_builtin_types[0], &wyn_builtin_types[0],
+    /* 455 */ &wyn_builtin_types[0],
+    /* 459 */ &wyn_builtin_types[0], &wyn_builtin_types[0], &wyn_builtin_types[2], &wyn_builtin_types[0],
+    /* 460 */ &wyn_builtin_types[0], &wyn_builtin_types[0], &wyn_builtin_types[0], &wyn_builtin_types[0],
+    /* 461 */ &wyn_builtin_types[0],
+    /* 462 */ &wyn_builtin_types[0],
+    /* 465 */ &wyn_builtin_types[0],
+    /* 466 */ &wyn_builtin_types[0], &wyn_builtin_types[0], &wyn_builtin_types[0], &wyn_builtin_types[0], &wyn_builtin_types[0],
+    /* 467 */ &wyn_builtin_types[0], &wyn_builtin_types[0], &wyn_builtin_types[0], &wyn_builtin_types[0], &wyn_builtin_types[0], &wyn_builtin_types[0],
+    /* 468 */ &wyn_builtin_types[0], &wyn_builtin_types[0], &wyn_builtin_types[0], &wyn_builtin_types[0],
+    /* 469 */ &wyn_builtin_types[0], &wyn_builtin_types[0], &wyn_builtin_types[0], &wyn_builtin_types[0], &wyn_builtin_types[0],
+    /* 470 */ &wyn_builtin_types[0], &wyn_builtin_types[0], &wyn_builtin_types[0],
+    /* 471 */ &wyn_builtin_types[0], &wyn_builtin_types[0], &wyn_builtin_types[0],
+    /* 472 */ &wyn_builtin_types[0], &wyn_builtin_types[0], &wyn_builtin_types[0], &wyn_builtin_types[0],
+    /* 473 */ &wyn_builtin_types[0],
+    /* 478 */ &wyn_builtin_types[0],
+    /* 479 */ &wyn_builtin_types[0], &wyn_builtin_types[0], &wyn_builtin_types[0],
+    /* 480 */ &wyn_builtin_types[0], &wyn_builtin_types[0], &wyn_builtin_types[0], &wyn_builtin_types[0], &wyn_builtin_types[0],
+};
+
+static Type wyn_builtin_types[WYN_BUILTIN_TYPE_COUNT] = {
+    /*   0 */ {.kind = (TypeKind)0},
+    /*   1 */ {.kind = (TypeKind)1},
+    /*   2 */ {.kind = (TypeKind)2},
+    /*   3 */ {.kind = (TypeKind)3},
+    /*   4 */ {.kind = (TypeKind)4},
+    /*   5 */ {.kind = (TypeKind)6, .struct_type = {.name = {(WynTokenType)6, "void*", 5, 0}}},
+    /*   6 */ {.kind = (TypeKind)5, .array_type = {.element_type = NULL}},
+    /*   7 */ {.kind = (TypeKind)11, .optional_type = {.inner_type = &wyn_builtin_types[0]}},
+    /*   8 */ {.kind = (TypeKind)9, .map_type = {.key_type = NULL, .value_type = NULL}},
+    /*   9 */ {.kind = (TypeKind)10, .map_type = {.key_type = NULL, .value_type = NULL}},
+    /*  10 */ {.kind = (TypeKind)6, .struct_type = {.name = {(WynTokenType)6, "ResultInt", 9, 0}}},
+    /*  11 */ {.kind = (TypeKind)6, .struct_type = {.name = {(WynTokenType)6, "ResultString", 12, 0}}},
+    /*  12 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[0], .param_count = 0, .min_param_count = -1, .return_type = &wyn_builtin_types[1], .is_variadic = false}},
+    /*  13 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[0], .param_count = 0, .min_param_count = -1, .return_type = &wyn_builtin_types[2], .is_variadic = false}},
+    /*  14 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[1], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[2], .is_variadic = false}},
+    /*  15 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[2], .param_count = 2, .min_param_count = -1, .return_type = &wyn_builtin_types[2], .is_variadic = false}},
+    /*  16 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[4], .param_count = 2, .min_param_count = -1, .return_type = &wyn_builtin_types[2], .is_variadic = false}},
+    /*  17 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[6], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[2], .is_variadic = false}},
+    /*  18 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[7], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[2], .is_variadic = false}},
+    /*  19 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[8], .param_count = 2, .min_param_count = -1, .return_type = &wyn_builtin_types[2], .is_variadic = false}},
+    /*  20 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[10], .param_count = 2, .min_param_count = -1, .return_type = &wyn_builtin_types[4], .is_variadic = false}},
+    /*  21 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[0], .param_count = 0, .min_param_count = -1, .return_type = &wyn_builtin_types[4], .is_variadic = false}},
+    /*  22 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[0], .param_count = 0, .min_param_count = -1, .return_type = &wyn_builtin_types[0], .is_variadic = false}},
+    /*  23 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[0], .param_count = 0, .min_param_count = -1, .return_type = &wyn_builtin_types[2], .is_variadic = false}},
+    /*  24 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[12], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[25], .is_variadic = false}},
+    /*  25 */ {.kind = (TypeKind)5, .array_type = {.element_type = &wyn_builtin_types[0]}},
+    /*  26 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[0], .param_count = 0, .min_param_count = -1, .return_type = &wyn_builtin_types[0], .is_variadic = false}},
+    /*  27 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[13], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[2], .is_variadic = false}},
+    /*  28 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[14], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[2], .is_variadic = false}},
+    /*  29 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[15], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[3], .is_variadic = false}},
+    /*  30 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[16], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[3], .is_variadic = false}},
+    /*  31 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[17], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[3], .is_variadic = false}},
+    /*  32 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[0], .param_count = 0, .min_param_count = -1, .return_type = &wyn_builtin_types[0], .is_variadic = false}},
+    /*  33 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[0], .param_count = 0, .min_param_count = -1, .return_type = &wyn_builtin_types[0], .is_variadic = false}},
+    /*  34 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[0], .param_count = 0, .min_param_count = -1, .return_type = &wyn_builtin_types[0], .is_variadic = false}},
+    /*  35 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[18], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[0], .is_variadic = false}},
+    /*  36 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[0], .param_count = 0, .min_param_count = -1, .return_type = &wyn_builtin_types[3], .is_variadic = false}},
+    /*  37 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[19], .param_count = 2, .min_param_count = -1, .return_type = &wyn_builtin_types[3], .is_variadic = false}},
+    /*  38 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[21], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[2], .is_variadic = false}},
+    /*  39 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[22], .param_count = 2, .min_param_count = -1, .return_type = &wyn_builtin_types[3], .is_variadic = false}},
+    /*  40 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[24], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[3], .is_variadic = false}},
+    /*  41 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[25], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[10], .is_variadic = false}},
+    /*  42 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[26], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[10], .is_variadic = false}},
+    /*  43 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[27], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[0], .is_variadic = false}},
+    /*  44 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[28], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[0], .is_variadic = false}},
+    /*  45 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[29], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[11], .is_variadic = false}},
+    /*  46 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[30], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[11], .is_variadic = false}},
+    /*  47 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[31], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[0], .is_variadic = false}},
+    /*  48 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[32], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[0], .is_variadic = false}},
+    /*  49 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[33], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[0], .is_variadic = false}},
+    /*  50 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[34], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[2], .is_variadic = false}},
+    /*  51 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[35], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[2], .is_variadic = false}},
+    /*  52 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[36], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[2], .is_variadic = false}},
+    /*  53 */ {.kind = (TypeKind)6, .struct_type = {.name = {(WynTokenType)6, "OptionInt", 9, 0}}},
+    /*  54 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[37], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[53], .is_variadic = false}},
+    /*  55 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[0], .param_count = 0, .min_param_count = -1, .return_type = &wyn_builtin_types[53], .is_variadic = false}},
+    /*  56 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[38], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[0], .is_variadic = false}},
+    /*  57 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[39], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[0], .is_variadic = false}},
+    /*  58 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[40], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[0], .is_variadic = false}},
+    /*  59 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[41], .param_count = 2, .min_param_count = -1, .return_type = &wyn_builtin_types[0], .is_variadic = false}},
+    /*  60 */ {.kind = (TypeKind)6, .struct_type = {.name = {(WynTokenType)6, "OptionString", 12, 0}}},
+    /*  61 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[43], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[60], .is_variadic = false}},
+    /*  62 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[0], .param_count = 0, .min_param_count = -1, .return_type = &wyn_builtin_types[60], .is_variadic = false}},
+    /*  63 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[44], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[0], .is_variadic = false}},
+    /*  64 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[45], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[0], .is_variadic = false}},
+    /*  65 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[46], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[2], .is_variadic = false}},
+    /*  66 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[47], .param_count = 2, .min_param_count = -1, .return_type = &wyn_builtin_types[2], .is_variadic = false}},
+    /*  67 */ {.kind = (TypeKind)6, .struct_type = {.name = {(WynTokenType)6, "OptionFloat", 11, 0}}},
+    /*  68 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[49], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[67], .is_variadic = false}},
+    /*  69 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[0], .param_count = 0, .min_param_count = -1, .return_type = &wyn_builtin_types[67], .is_variadic = false}},
+    /*  70 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[50], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[0], .is_variadic = false}},
+    /*  71 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[51], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[0], .is_variadic = false}},
+    /*  72 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[52], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[1], .is_variadic = false}},
+    /*  73 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[53], .param_count = 2, .min_param_count = -1, .return_type = &wyn_builtin_types[1], .is_variadic = false}},
+    /*  74 */ {.kind = (TypeKind)6, .struct_type = {.name = {(WynTokenType)6, "OptionBool", 10, 0}}},
+    /*  75 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[55], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[74], .is_variadic = false}},
+    /*  76 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[0], .param_count = 0, .min_param_count = -1, .return_type = &wyn_builtin_types[74], .is_variadic = false}},
+    /*  77 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[56], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[0], .is_variadic = false}},
+    /*  78 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[57], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[0], .is_variadic = false}},
+    /*  79 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[58], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[3], .is_variadic = false}},
+    /*  80 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[59], .param_count = 2, .min_param_count = -1, .return_type = &wyn_builtin_types[3], .is_variadic = false}},
+    /*  81 */ {.kind = (TypeKind)6, .struct_type = {.name = {(WynTokenType)6, "ResultFloat", 11, 0}}},
+    /*  82 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[61], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[81], .is_variadic = false}},
+    /*  83 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[62], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[81], .is_variadic = false}},
+    /*  84 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[63], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[0], .is_variadic = false}},
+    /*  85 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[64], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[0], .is_variadic = false}},
+    /*  86 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[65], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[1], .is_variadic = false}},
+    /*  87 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[66], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[2], .is_variadic = false}},
+    /*  88 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[67], .param_count = 2, .min_param_count = -1, .return_type = &wyn_builtin_types[1], .is_variadic = false}},
+    /*  89 */ {.kind = (TypeKind)6, .struct_type = {.name = {(WynTokenType)6, "ResultBool", 10, 0}}},
+    /*  90 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[69], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[89], .is_variadic = false}},
+    /*  91 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[70], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[89], .is_variadic = false}},
+    /*  92 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[71], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[0], .is_variadic = false}},
+    /*  93 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[72], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[0], .is_variadic = false}},
+    /*  94 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[73], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[3], .is_variadic = false}},
+    /*  95 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[74], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[2], .is_variadic = false}},
+    /*  96 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[75], .param_count = 2, .min_param_count = -1, .return_type = &wyn_builtin_types[3], .is_variadic = false}},
+    /*  97 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[77], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[2], .is_variadic = false}},
+    /*  98 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[78], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[0], .is_variadic = false}},
+    /*  99 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[79], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[4], .is_variadic = false}},
+    /* 100 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[80], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[2], .is_variadic = false}},
+    /* 101 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[81], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[2], .is_variadic = false}},
+    /* 102 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[82], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[2], .is_variadic = false}},
+    /* 103 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[83], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[1], .is_variadic = false}},
+    /* 104 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[84], .param_count = 2, .min_param_count = -1, .return_type = &wyn_builtin_types[1], .is_variadic = false}},
+    /* 105 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[86], .param_count = 2, .min_param_count = -1, .return_type = &wyn_builtin_types[1], .is_variadic = false}},
+    /* 106 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[88], .param_count = 2, .min_param_count = -1, .return_type = &wyn_builtin_types[1], .is_variadic = false}},
+    /* 107 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[90], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[1], .is_variadic = false}},
+    /* 108 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[91], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[1], .is_variadic = false}},
+    /* 109 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[92], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[1], .is_variadic = false}},
+    /* 110 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[93], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[1], .is_variadic = false}},
+    /* 111 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[94], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[1], .is_variadic = false}},
+    /* 112 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[95], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[1], .is_variadic = false}},
+    /* 113 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[96], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[1], .is_variadic = false}},
+    /* 114 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[97], .param_count = 2, .min_param_count = -1, .return_type = &wyn_builtin_types[1], .is_variadic = false}},
+    /* 115 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[99], .param_count = 2, .min_param_count = -1, .return_type = &wyn_builtin_types[1], .is_variadic = false}},
+    /* 116 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[0], .param_count = 0, .min_param_count = -1, .return_type = &wyn_builtin_types[1], .is_variadic = false}},
+    /* 117 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[0], .param_count = 0, .min_param_count = -1, .return_type = &wyn_builtin_types[1], .is_variadic = false}},
+    /* 118 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[0], .param_count = 0, .min_param_count = -1, .return_type = &wyn_builtin_types[1], .is_variadic = false}},
+    /* 119 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[101], .param_count = 2, .min_param_count = -1, .return_type = &wyn_builtin_types[0], .is_variadic = false}},
+    /* 120 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[103], .param_count = 3, .min_param_count = -1, .return_type = &wyn_builtin_types[2], .is_variadic = false}},
+    /* 121 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[106], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[2], .is_variadic = false}},
+    /* 122 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[107], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[2], .is_variadic = false}},
+    /* 123 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[108], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[2], .is_variadic = false}},
+    /* 124 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[109], .param_count = 2, .min_param_count = -1, .return_type = &wyn_builtin_types[2], .is_variadic = false}},
+    /* 125 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[0], .param_count = 0, .min_param_count = -1, .return_type = &wyn_builtin_types[126], .is_variadic = false}},
+    /* 126 */ {.kind = (TypeKind)9, .map_type = {.key_type = NULL, .value_type = NULL}},
+    /* 127 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[111], .param_count = 3, .min_param_count = -1, .return_type = &wyn_builtin_types[4], .is_variadic = false}},
+    /* 128 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[114], .param_count = 3, .min_param_count = -1, .return_type = &wyn_builtin_types[4], .is_variadic = false}},
+    /* 129 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[117], .param_count = 2, .min_param_count = -1, .return_type = &wyn_builtin_types[2], .is_variadic = false}},
+    /* 130 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[119], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[2], .is_variadic = false}},
+    /* 131 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[120], .param_count = 2, .min_param_count = -1, .return_type = &wyn_builtin_types[3], .is_variadic = false}},
+    /* 132 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[122], .param_count = 3, .min_param_count = -1, .return_type = &wyn_builtin_types[2], .is_variadic = false}},
+    /* 133 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[125], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[2], .is_variadic = false}},
+    /* 134 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[126], .param_count = 2, .min_param_count = -1, .return_type = &wyn_builtin_types[0], .is_variadic = false}},
+    /* 135 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[128], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[0], .is_variadic = false}},
+    /* 136 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[129], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[0], .is_variadic = false}},
+    /* 137 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[130], .param_count = 2, .min_param_count = -1, .return_type = &wyn_builtin_types[0], .is_variadic = false}},
+    /* 138 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[132], .param_count = 2, .min_param_count = -1, .return_type = &wyn_builtin_types[0], .is_variadic = false}},
+    /* 139 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[134], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[0], .is_variadic = false}},
+    /* 140 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[135], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[0], .is_variadic = false}},
+    /* 141 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[136], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[0], .is_variadic = false}},
+    /* 142 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[137], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[0], .is_variadic = false}},
+    /* 143 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[138], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[2], .is_variadic = false}},
+    /* 144 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[139], .param_count = 2, .min_param_count = -1, .return_type = &wyn_builtin_types[0], .is_variadic = false}},
+    /* 145 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[0], .param_count = 0, .min_param_count = -1, .return_type = &wyn_builtin_types[2], .is_variadic = false}},
+    /* 146 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[141], .param_count = 2, .min_param_count = -1, .return_type = &wyn_builtin_types[0], .is_variadic = false}},
+    /* 147 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[143], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[2], .is_variadic = false}},
+    /* 148 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[144], .param_count = 2, .min_param_count = -1, .return_type = &wyn_builtin_types[0], .is_variadic = false}},
+    /* 149 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[146], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[0], .is_variadic = false}},
+    /* 150 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[147], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[4], .is_variadic = false}},
+    /* 151 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[148], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[152], .is_variadic = false}},
+    /* 152 */ {.kind = (TypeKind)5, .array_type = {.element_type = &wyn_builtin_types[2]}},
+    /* 153 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[149], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[154], .is_variadic = false}},
+    /* 154 */ {.kind = (TypeKind)5, .array_type = {.element_type = &wyn_builtin_types[2]}},
+    /* 155 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[0], .param_count = 0, .min_param_count = -1, .return_type = &wyn_builtin_types[156], .is_variadic = false}},
+    /* 156 */ {.kind = (TypeKind)9, .map_type = {.key_type = NULL, .value_type = NULL}},
+    /* 157 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[0], .param_count = 0, .min_param_count = -1, .return_type = &wyn_builtin_types[158], .is_variadic = false}},
+    /* 158 */ {.kind = (TypeKind)10, .map_type = {.key_type = NULL, .value_type = NULL}},
+    /* 159 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[0], .param_count = 0, .min_param_count = -1, .return_type = &wyn_builtin_types[160], .is_variadic = false}},
+    /* 160 */ {.kind = (TypeKind)9, .map_type = {.key_type = NULL, .value_type = NULL}},
+    /* 161 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[150], .param_count = 3, .min_param_count = -1, .return_type = &wyn_builtin_types[4], .is_variadic = false}},
+    /* 162 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[153], .param_count = 3, .min_param_count = -1, .return_type = &wyn_builtin_types[4], .is_variadic = false}},
+    /* 163 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[156], .param_count = 3, .min_param_count = -1, .return_type = &wyn_builtin_types[4], .is_variadic = false}},
+    /* 164 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[159], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[2], .is_variadic = false}},
+    /* 165 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[160], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[2], .is_variadic = false}},
+    /* 166 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[0], .param_count = 0, .min_param_count = -1, .return_type = &wyn_builtin_types[0], .is_variadic = false}},
+    /* 167 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[0], .param_count = 0, .min_param_count = -1, .return_type = &wyn_builtin_types[0], .is_variadic = false}},
+    /* 168 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[0], .param_count = 0, .min_param_count = -1, .return_type = &wyn_builtin_types[4], .is_variadic = false}},
+    /* 169 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[0], .param_count = 0, .min_param_count = -1, .return_type = &wyn_builtin_types[4], .is_variadic = false}},
+    /* 170 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[0], .param_count = 0, .min_param_count = -1, .return_type = &wyn_builtin_types[0], .is_variadic = false}},
+    /* 171 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[0], .param_count = 0, .min_param_count = -1, .return_type = &wyn_builtin_types[4], .is_variadic = false}},
+    /* 172 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[161], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[4], .is_variadic = false}},
+    /* 173 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[162], .param_count = 2, .min_param_count = -1, .return_type = &wyn_builtin_types[4], .is_variadic = false}},
+    /* 174 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[164], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[2], .is_variadic = false}},
+    /* 175 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[165], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[2], .is_variadic = false}},
+    /* 176 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[166], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[2], .is_variadic = false}},
+    /* 177 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[167], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[2], .is_variadic = false}},
+    /* 178 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[168], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[2], .is_variadic = false}},
+    /* 179 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[169], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[2], .is_variadic = false}},
+    /* 180 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[170], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[2], .is_variadic = false}},
+    /* 181 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[171], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[2], .is_variadic = false}},
+    /* 182 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[172], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[2], .is_variadic = false}},
+    /* 183 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[173], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[2], .is_variadic = false}},
+    /* 184 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[0], .param_count = 0, .min_param_count = -1, .return_type = &wyn_builtin_types[0], .is_variadic = false}},
+    /* 185 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[0], .param_count = 0, .min_param_count = -1, .return_type = &wyn_builtin_types[0], .is_variadic = false}},
+    /* 186 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[0], .param_count = 0, .min_param_count = -1, .return_type = &wyn_builtin_types[0], .is_variadic = false}},
+    /* 187 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[174], .param_count = 2, .min_param_count = -1, .return_type = &wyn_builtin_types[2], .is_variadic = false}},
+    /* 188 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[176], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[4], .is_variadic = false}},
+    /* 189 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[177], .param_count = 2, .min_param_count = -1, .return_type = &wyn_builtin_types[2], .is_variadic = false}},
+    /* 190 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[179], .param_count = 2, .min_param_count = -1, .return_type = &wyn_builtin_types[2], .is_variadic = false}},
+    /* 191 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[181], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[2], .is_variadic = false}},
+    /* 192 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[182], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[0], .is_variadic = false}},
+    /* 193 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[183], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[2], .is_variadic = false}},
+    /* 194 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[184], .param_count = 4, .min_param_count = -1, .return_type = &wyn_builtin_types[4], .is_variadic = false}},
+    /* 195 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[188], .param_count = 3, .min_param_count = -1, .return_type = &wyn_builtin_types[4], .is_variadic = false}},
+    /* 196 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[191], .param_count = 3, .min_param_count = -1, .return_type = &wyn_builtin_types[4], .is_variadic = false}},
+    /* 197 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[194], .param_count = 2, .min_param_count = -1, .return_type = &wyn_builtin_types[4], .is_variadic = false}},
+    /* 198 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[196], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[2], .is_variadic = false}},
+    /* 199 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[197], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[2], .is_variadic = false}},
+    /* 200 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[198], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[0], .is_variadic = false}},
+    /* 201 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[199], .param_count = 2, .min_param_count = -1, .return_type = &wyn_builtin_types[0], .is_variadic = false}},
+    /* 202 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[201], .param_count = 2, .min_param_count = -1, .return_type = &wyn_builtin_types[0], .is_variadic = false}},
+    /* 203 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[203], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[2], .is_variadic = false}},
+    /* 204 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[204], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[0], .is_variadic = false}},
+    /* 205 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[205], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[0], .is_variadic = false}},
+    /* 206 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[206], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[0], .is_variadic = false}},
+    /* 207 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[207], .param_count = 2, .min_param_count = -1, .return_type = &wyn_builtin_types[4], .is_variadic = false}},
+    /* 208 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[209], .param_count = 2, .min_param_count = -1, .return_type = &wyn_builtin_types[4], .is_variadic = false}},
+    /* 209 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[211], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[0], .is_variadic = false}},
+    /* 210 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[212], .param_count = 2, .min_param_count = -1, .return_type = &wyn_builtin_types[4], .is_variadic = false}},
+    /* 211 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[214], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[0], .is_variadic = false}},
+    /* 212 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[215], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[4], .is_variadic = false}},
+    /* 213 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[216], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[7], .is_variadic = false}},
+    /* 214 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[217], .param_count = 2, .min_param_count = -1, .return_type = &wyn_builtin_types[0], .is_variadic = false}},
+    /* 215 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[219], .param_count = 3, .min_param_count = -1, .return_type = &wyn_builtin_types[0], .is_variadic = false}},
+    /* 216 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[222], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[4], .is_variadic = false}},
+    /* 217 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[0], .param_count = 0, .min_param_count = -1, .return_type = &wyn_builtin_types[3], .is_variadic = false}},
+    /* 218 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[223], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[0], .is_variadic = false}},
+    /* 219 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[0], .param_count = 0, .min_param_count = -1, .return_type = &wyn_builtin_types[0], .is_variadic = false}},
+    /* 220 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[0], .param_count = 0, .min_param_count = -1, .return_type = &wyn_builtin_types[5], .is_variadic = false}},
+    /* 221 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[224], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[5], .is_variadic = false}},
+    /* 222 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[225], .param_count = 2, .min_param_count = -1, .return_type = &wyn_builtin_types[4], .is_variadic = false}},
+    /* 223 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[227], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[4], .is_variadic = false}},
+    /* 224 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[228], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[0], .is_variadic = true}},
+    /* 225 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[229], .param_count = 2, .min_param_count = -1, .return_type = &wyn_builtin_types[2], .is_variadic = true}},
+    /* 226 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[231], .param_count = 2, .min_param_count = -1, .return_type = &wyn_builtin_types[2], .is_variadic = true}},
+    /* 227 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[233], .param_count = 2, .min_param_count = -1, .return_type = &wyn_builtin_types[0], .is_variadic = true}},
+    /* 228 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[235], .param_count = 2, .min_param_count = -1, .return_type = &wyn_builtin_types[0], .is_variadic = true}},
+    /* 229 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[237], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[0], .is_variadic = true}},
+    /* 230 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[238], .param_count = 2, .min_param_count = -1, .return_type = &wyn_builtin_types[0], .is_variadic = true}},
+    /* 231 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[240], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[2], .is_variadic = true}},
+    /* 232 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[241], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[2], .is_variadic = true}},
+    /* 233 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[242], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[2], .is_variadic = true}},
+    /* 234 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[243], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[2], .is_variadic = true}},
+    /* 235 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[244], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[2], .is_variadic = true}},
+    /* 236 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[245], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[2], .is_variadic = true}},
+    /* 237 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[0], .param_count = 0, .min_param_count = -1, .return_type = &wyn_builtin_types[2], .is_variadic = true}},
+    /* 238 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[0], .param_count = 0, .min_param_count = -1, .return_type = &wyn_builtin_types[2], .is_variadic = true}},
+    /* 239 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[0], .param_count = 0, .min_param_count = -1, .return_type = &wyn_builtin_types[2], .is_variadic = true}},
+    /* 240 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[0], .param_count = 0, .min_param_count = -1, .return_type = &wyn_builtin_types[0], .is_variadic = true}},
+    /* 241 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[0], .param_count = 0, .min_param_count = -1, .return_type = &wyn_builtin_types[2], .is_variadic = true}},
+    /* 242 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[0], .param_count = 0, .min_param_count = -1, .return_type = &wyn_builtin_types[2], .is_variadic = true}},
+    /* 243 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[0], .param_count = 0, .min_param_count = -1, .return_type = &wyn_builtin_types[2], .is_variadic = true}},
+    /* 244 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[246], .param_count = 3, .min_param_count = -1, .return_type = &wyn_builtin_types[0], .is_variadic = true}},
+    /* 245 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[249], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[0], .is_variadic = true}},
+    /* 246 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[250], .param_count = 2, .min_param_count = -1, .return_type = &wyn_builtin_types[0], .is_variadic = true}},
+    /* 247 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[252], .param_count = 2, .min_param_count = -1, .return_type = &wyn_builtin_types[0], .is_variadic = true}},
+    /* 248 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[254], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[2], .is_variadic = true}},
+    /* 249 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[255], .param_count = 2, .min_param_count = -1, .return_type = &wyn_builtin_types[0], .is_variadic = true}},
+    /* 250 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[257], .param_count = 2, .min_param_count = -1, .return_type = &wyn_builtin_types[2], .is_variadic = true}},
+    /* 251 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[259], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[2], .is_variadic = true}},
+    /* 252 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[260], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[2], .is_variadic = true}},
+    /* 253 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[261], .param_count = 2, .min_param_count = -1, .return_type = &wyn_builtin_types[0], .is_variadic = true}},
+    /* 254 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[263], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[4], .is_variadic = true}},
+    /* 255 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[264], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[4], .is_variadic = true}},
+    /* 256 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[265], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[4], .is_variadic = true}},
+    /* 257 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[266], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[4], .is_variadic = true}},
+    /* 258 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[267], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[4], .is_variadic = true}},
+    /* 259 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[268], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[2], .is_variadic = true}},
+    /* 260 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[269], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[0], .is_variadic = true}},
+    /* 261 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[270], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[0], .is_variadic = true}},
+    /* 262 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[271], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[0], .is_variadic = true}},
+    /* 263 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[272], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[0], .is_variadic = true}},
+    /* 264 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[273], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[2], .is_variadic = true}},
+    /* 265 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[274], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[2], .is_variadic = true}},
+    /* 266 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[275], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[2], .is_variadic = true}},
+    /* 267 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[276], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[2], .is_variadic = true}},
+    /* 268 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[277], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[2], .is_variadic = true}},
+    /* 269 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[278], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[0], .is_variadic = true}},
+    /* 270 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[279], .param_count = 5, .min_param_count = -1, .return_type = &wyn_builtin_types[4], .is_variadic = true}},
+    /* 271 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[284], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[4], .is_variadic = true}},
+    /* 272 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[285], .param_count = 3, .min_param_count = -1, .return_type = &wyn_builtin_types[0], .is_variadic = true}},
+    /* 273 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[288], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[0], .is_variadic = true}},
+    /* 274 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[289], .param_count = 2, .min_param_count = -1, .return_type = &wyn_builtin_types[0], .is_variadic = true}},
+    /* 275 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[291], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[2], .is_variadic = true}},
+    /* 276 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[292], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[0], .is_variadic = true}},
+    /* 277 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[293], .param_count = 2, .min_param_count = -1, .return_type = &wyn_builtin_types[0], .is_variadic = true}},
+    /* 278 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[295], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[2], .is_variadic = true}},
+    /* 279 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[296], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[2], .is_variadic = true}},
+    /* 280 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[297], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[2], .is_variadic = true}},
+    /* 281 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[298], .param_count = 2, .min_param_count = -1, .return_type = &wyn_builtin_types[2], .is_variadic = true}},
+    /* 282 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[300], .param_count = 2, .min_param_count = -1, .return_type = &wyn_builtin_types[2], .is_variadic = true}},
+    /* 283 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[302], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[2], .is_variadic = true}},
+    /* 284 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[303], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[2], .is_variadic = true}},
+    /* 285 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[304], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[0], .is_variadic = true}},
+    /* 286 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[305], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[0], .is_variadic = true}},
+    /* 287 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[306], .param_count = 2, .min_param_count = -1, .return_type = &wyn_builtin_types[2], .is_variadic = true}},
+    /* 288 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[308], .param_count = 3, .min_param_count = -1, .return_type = &wyn_builtin_types[2], .is_variadic = true}},
+    /* 289 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[311], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[0], .is_variadic = true}},
+    /* 290 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[312], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[2], .is_variadic = true}},
+    /* 291 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[313], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[0], .is_variadic = true}},
+    /* 292 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[314], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[0], .is_variadic = true}},
+    /* 293 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[315], .param_count = 3, .min_param_count = -1, .return_type = &wyn_builtin_types[0], .is_variadic = true}},
+    /* 294 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[318], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[3], .is_variadic = true}},
+    /* 295 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[319], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[0], .is_variadic = true}},
+    /* 296 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[320], .param_count = 2, .min_param_count = -1, .return_type = &wyn_builtin_types[0], .is_variadic = true}},
+    /* 297 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[322], .param_count = 2, .min_param_count = -1, .return_type = &wyn_builtin_types[2], .is_variadic = true}},
+    /* 298 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[324], .param_count = 2, .min_param_count = -1, .return_type = &wyn_builtin_types[0], .is_variadic = true}},
+    /* 299 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[326], .param_count = 2, .min_param_count = -1, .return_type = &wyn_builtin_types[1], .is_variadic = true}},
+    /* 300 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[328], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[4], .is_variadic = true}},
+    /* 301 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[329], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[0], .is_variadic = true}},
+    /* 302 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[330], .param_count = 2, .min_param_count = -1, .return_type = &wyn_builtin_types[0], .is_variadic = true}},
+    /* 303 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[332], .param_count = 2, .min_param_count = -1, .return_type = &wyn_builtin_types[1], .is_variadic = true}},
+    /* 304 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[334], .param_count = 2, .min_param_count = -1, .return_type = &wyn_builtin_types[0], .is_variadic = true}},
+    /* 305 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[336], .param_count = 2, .min_param_count = -1, .return_type = &wyn_builtin_types[0], .is_variadic = true}},
+    /* 306 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[338], .param_count = 2, .min_param_count = -1, .return_type = &wyn_builtin_types[0], .is_variadic = true}},
+    /* 307 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[340], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[2], .is_variadic = true}},
+    /* 308 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[341], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[2], .is_variadic = true}},
+    /* 309 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[342], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[2], .is_variadic = true}},
+    /* 310 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[343], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[2], .is_variadic = true}},
+    /* 311 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[344], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[0], .is_variadic = true}},
+    /* 312 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[345], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[0], .is_variadic = true}},
+    /* 313 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[346], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[0], .is_variadic = true}},
+    /* 314 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[347], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[0], .is_variadic = true}},
+    /* 315 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[348], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[0], .is_variadic = true}},
+    /* 316 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[349], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[0], .is_variadic = true}},
+    /* 317 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[350], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[0], .is_variadic = true}},
+    /* 318 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[351], .param_count = 2, .min_param_count = -1, .return_type = &wyn_builtin_types[2], .is_variadic = true}},
+    /* 319 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[353], .param_count = 2, .min_param_count = -1, .return_type = &wyn_builtin_types[2], .is_variadic = true}},
+    /* 320 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[355], .param_count = 2, .min_param_count = -1, .return_type = &wyn_builtin_types[0], .is_variadic = true}},
+    /* 321 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[357], .param_count = 2, .min_param_count = -1, .return_type = &wyn_builtin_types[2], .is_variadic = true}},
+    /* 322 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[359], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[0], .is_variadic = true}},
+    /* 323 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[360], .param_count = 2, .min_param_count = -1, .return_type = &wyn_builtin_types[3], .is_variadic = true}},
+    /* 324 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[362], .param_count = 2, .min_param_count = -1, .return_type = &wyn_builtin_types[0], .is_variadic = true}},
+    /* 325 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[364], .param_count = 3, .min_param_count = -1, .return_type = &wyn_builtin_types[2], .is_variadic = true}},
+    /* 326 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[367], .param_count = 2, .min_param_count = -1, .return_type = &wyn_builtin_types[2], .is_variadic = true}},
+    /* 327 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[369], .param_count = 2, .min_param_count = -1, .return_type = &wyn_builtin_types[2], .is_variadic = true}},
+    /* 328 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[371], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[4], .is_variadic = true}},
+    /* 329 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[372], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[2], .is_variadic = true}},
+    /* 330 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[373], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[2], .is_variadic = true}},
+    /* 331 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[374], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[2], .is_variadic = true}},
+    /* 332 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[375], .param_count = 2, .min_param_count = -1, .return_type = &wyn_builtin_types[0], .is_variadic = true}},
+    /* 333 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[377], .param_count = 2, .min_param_count = -1, .return_type = &wyn_builtin_types[0], .is_variadic = true}},
+    /* 334 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[379], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[0], .is_variadic = true}},
+    /* 335 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[380], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[4], .is_variadic = true}},
+    /* 336 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[381], .param_count = 2, .min_param_count = -1, .return_type = &wyn_builtin_types[0], .is_variadic = true}},
+    /* 337 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[383], .param_count = 3, .min_param_count = -1, .return_type = &wyn_builtin_types[0], .is_variadic = true}},
+    /* 338 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[386], .param_count = 2, .min_param_count = -1, .return_type = &wyn_builtin_types[2], .is_variadic = true}},
+    /* 339 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[388], .param_count = 2, .min_param_count = -1, .return_type = &wyn_builtin_types[2], .is_variadic = true}},
+    /* 340 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[390], .param_count = 3, .min_param_count = -1, .return_type = &wyn_builtin_types[2], .is_variadic = true}},
+    /* 341 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[393], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[2], .is_variadic = true}},
+    /* 342 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[394], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[0], .is_variadic = true}},
+    /* 343 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[395], .param_count = 2, .min_param_count = -1, .return_type = &wyn_builtin_types[0], .is_variadic = true}},
+    /* 344 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[397], .param_count = 3, .min_param_count = -1, .return_type = &wyn_builtin_types[0], .is_variadic = true}},
+    /* 345 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[400], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[3], .is_variadic = true}},
+    /* 346 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[401], .param_count = 2, .min_param_count = -1, .return_type = &wyn_builtin_types[0], .is_variadic = true}},
+    /* 347 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[403], .param_count = 2, .min_param_count = -1, .return_type = &wyn_builtin_types[1], .is_variadic = true}},
+    /* 348 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[405], .param_count = 2, .min_param_count = -1, .return_type = &wyn_builtin_types[2], .is_variadic = true}},
+    /* 349 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[407], .param_count = 2, .min_param_count = -1, .return_type = &wyn_builtin_types[3], .is_variadic = true}},
+    /* 350 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[409], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[0], .is_variadic = true}},
+    /* 351 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[410], .param_count = 2, .min_param_count = -1, .return_type = &wyn_builtin_types[2], .is_variadic = true}},
+    /* 352 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[412], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[4], .is_variadic = true}},
+    /* 353 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[413], .param_count = 3, .min_param_count = -1, .return_type = &wyn_builtin_types[0], .is_variadic = true}},
+    /* 354 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[416], .param_count = 2, .min_param_count = -1, .return_type = &wyn_builtin_types[4], .is_variadic = true}},
+    /* 355 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[418], .param_count = 2, .min_param_count = -1, .return_type = &wyn_builtin_types[3], .is_variadic = true}},
+    /* 356 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[420], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[0], .is_variadic = true}},
+    /* 357 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[421], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[3], .is_variadic = true}},
+    /* 358 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[422], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[4], .is_variadic = true}},
+    /* 359 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[423], .param_count = 2, .min_param_count = -1, .return_type = &wyn_builtin_types[2], .is_variadic = true}},
+    /* 360 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[425], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[0], .is_variadic = true}},
+    /* 361 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[426], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[0], .is_variadic = true}},
+    /* 362 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[427], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[4], .is_variadic = true}},
+    /* 363 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[428], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[4], .is_variadic = true}},
+    /* 364 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[429], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[4], .is_variadic = true}},
+    /* 365 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[0], .param_count = 0, .min_param_count = -1, .return_type = &wyn_builtin_types[0], .is_variadic = true}},
+    /* 366 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[430], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[2], .is_variadic = true}},
+    /* 367 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[431], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[4], .is_variadic = true}},
+    /* 368 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[432], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[4], .is_variadic = true}},
+    /* 369 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[433], .param_count = 2, .min_param_count = -1, .return_type = &wyn_builtin_types[0], .is_variadic = true}},
+    /* 370 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[435], .param_count = 2, .min_param_count = -1, .return_type = &wyn_builtin_types[0], .is_variadic = true}},
+    /* 371 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[437], .param_count = 2, .min_param_count = -1, .return_type = &wyn_builtin_types[0], .is_variadic = true}},
+    /* 372 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[439], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[2], .is_variadic = true}},
+    /* 373 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[440], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[4], .is_variadic = true}},
+    /* 374 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[441], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[4], .is_variadic = true}},
+    /* 375 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[0], .param_count = 0, .min_param_count = -1, .return_type = &wyn_builtin_types[4], .is_variadic = true}},
+    /* 376 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[0], .param_count = 0, .min_param_count = -1, .return_type = &wyn_builtin_types[4], .is_variadic = true}},
+    /* 377 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[442], .param_count = 2, .min_param_count = -1, .return_type = &wyn_builtin_types[0], .is_variadic = true}},
+    /* 378 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[444], .param_count = 2, .min_param_count = -1, .return_type = &wyn_builtin_types[4], .is_variadic = true}},
+    /* 379 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[446], .param_count = 2, .min_param_count = -1, .return_type = &wyn_builtin_types[2], .is_variadic = true}},
+    /* 380 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[448], .param_count = 2, .min_param_count = -1, .return_type = &wyn_builtin_types[2], .is_variadic = true}},
+    /* 381 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[450], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[2], .is_variadic = true}},
+    /* 382 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[451], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[2], .is_variadic = true}},
+    /* 383 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[452], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[2], .is_variadic = true}},
+    /* 384 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[453], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[2], .is_variadic = true}},
+    /* 385 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[454], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[4], .is_variadic = true}},
+    /* 386 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[0], .param_count = 0, .min_param_count = -1, .return_type = &wyn_builtin_types[0], .is_variadic = true}},
+    /* 387 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[455], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[0], .is_variadic = true}},
+    /* 388 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[456], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[0], .is_variadic = true}},
+    /* 389 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[457], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[0], .is_variadic = true}},
+    /* 390 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[458], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[4], .is_variadic = true}},
+    /* 391 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[459], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[0], .is_variadic = true}},
+    /* 392 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[460], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[0], .is_variadic = true}},
+    /* 393 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[461], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[0], .is_variadic = true}},
+    /* 394 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[462], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[0], .is_variadic = true}},
+    /* 395 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[0], .param_count = 0, .min_param_count = -1, .return_type = &wyn_builtin_types[5], .is_variadic = true}},
+    /* 396 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[463], .param_count = 2, .min_param_count = -1, .return_type = &wyn_builtin_types[4], .is_variadic = true}},
+    /* 397 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[465], .param_count = 2, .min_param_count = -1, .return_type = &wyn_builtin_types[4], .is_variadic = true}},
+    /* 398 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[467], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[0], .is_variadic = true}},
+    /* 399 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[468], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[0], .is_variadic = true}},
+    /* 400 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[469], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[0], .is_variadic = true}},
+    /* 401 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[470], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[0], .is_variadic = true}},
+    /* 402 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[471], .param_count = 2, .min_param_count = -1, .return_type = &wyn_builtin_types[0], .is_variadic = true}},
+    /* 403 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[473], .param_count = 3, .min_param_count = -1, .return_type = &wyn_builtin_types[4], .is_variadic = true}},
+    /* 404 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[476], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[0], .is_variadic = true}},
+    /* 405 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[477], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[3], .is_variadic = true}},
+    /* 406 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[478], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[4], .is_variadic = true}},
+    /* 407 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[0], .param_count = 0, .min_param_count = -1, .return_type = &wyn_builtin_types[408], .is_variadic = true}},
+    /* 408 */ {.kind = (TypeKind)6, .struct_type = {.name = {(WynTokenType)6, "PriorityQueue_int*", 18, 0}}},
+    /* 409 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[479], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[408], .is_variadic = true}},
+    /* 410 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[480], .param_count = 2, .min_param_count = -1, .return_type = &wyn_builtin_types[4], .is_variadic = true}},
+    /* 411 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[482], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[0], .is_variadic = true}},
+    /* 412 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[483], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[0], .is_variadic = true}},
+    /* 413 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[484], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[0], .is_variadic = true}},
+    /* 414 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[485], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[3], .is_variadic = true}},
+    /* 415 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[486], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[416], .is_variadic = true}},
+    /* 416 */ {.kind = (TypeKind)6, .struct_type = {.name = {(WynTokenType)6, "PriorityQueue_float*", 20, 0}}},
+    /* 417 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[487], .param_count = 2, .min_param_count = -1, .return_type = &wyn_builtin_types[4], .is_variadic = true}},
+    /* 418 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[489], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[1], .is_variadic = true}},
+    /* 419 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[490], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[1], .is_variadic = true}},
+    /* 420 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[491], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[0], .is_variadic = true}},
+    /* 421 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[492], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[3], .is_variadic = true}},
+    /* 422 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[493], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[423], .is_variadic = true}},
+    /* 423 */ {.kind = (TypeKind)6, .struct_type = {.name = {(WynTokenType)6, "PriorityQueue_string*", 21, 0}}},
+    /* 424 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[494], .param_count = 2, .min_param_count = -1, .return_type = &wyn_builtin_types[4], .is_variadic = true}},
+    /* 425 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[496], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[2], .is_variadic = true}},
+    /* 426 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[497], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[2], .is_variadic = true}},
+    /* 427 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[498], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[0], .is_variadic = true}},
+    /* 428 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[499], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[3], .is_variadic = true}},
+    /* 429 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[500], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[4], .is_variadic = true}},
+    /* 430 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[501], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[4], .is_variadic = true}},
+    /* 431 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[502], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[4], .is_variadic = true}},
+    /* 432 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[503], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[4], .is_variadic = true}},
+    /* 433 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[504], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[4], .is_variadic = true}},
+    /* 434 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[505], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[4], .is_variadic = true}},
+    /* 435 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[506], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[4], .is_variadic = true}},
+    /* 436 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[507], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[4], .is_variadic = true}},
+    /* 437 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[508], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[4], .is_variadic = true}},
+    /* 438 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[509], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[4], .is_variadic = true}},
+    /* 439 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[510], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[4], .is_variadic = true}},
+    /* 440 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[511], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[4], .is_variadic = true}},
+    /* 441 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[512], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[4], .is_variadic = true}},
+    /* 442 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[513], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[4], .is_variadic = true}},
+    /* 443 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[514], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[4], .is_variadic = true}},
+    /* 444 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[515], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[0], .is_variadic = true}},
+    /* 445 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[516], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[4], .is_variadic = true}},
+    /* 446 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[517], .param_count = 3, .min_param_count = -1, .return_type = &wyn_builtin_types[0], .is_variadic = false}},
+    /* 447 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[520], .param_count = 3, .min_param_count = -1, .return_type = &wyn_builtin_types[4], .is_variadic = false}},
+    /* 448 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[523], .param_count = 3, .min_param_count = -1, .return_type = &wyn_builtin_types[4], .is_variadic = false}},
+    /* 449 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[526], .param_count = 4, .min_param_count = -1, .return_type = &wyn_builtin_types[4], .is_variadic = false}},
+    /* 450 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[530], .param_count = 4, .min_param_count = -1, .return_type = &wyn_builtin_types[4], .is_variadic = false}},
+    /* 451 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[534], .param_count = 2, .min_param_count = -1, .return_type = &wyn_builtin_types[4], .is_variadic = false}},
+    /* 452 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[0], .param_count = 0, .min_param_count = -1, .return_type = &wyn_builtin_types[4], .is_variadic = false}},
+    /* 453 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[0], .param_count = 0, .min_param_count = -1, .return_type = &wyn_builtin_types[2], .is_variadic = false}},
+    /* 454 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[0], .param_count = 0, .min_param_count = -1, .return_type = &wyn_builtin_types[0], .is_variadic = false}},
+    /* 455 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[536], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[4], .is_variadic = false}},
+    /* 456 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[0], .param_count = 0, .min_param_count = -1, .return_type = &wyn_builtin_types[0], .is_variadic = false}},
+    /* 457 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[0], .param_count = 0, .min_param_count = -1, .return_type = &wyn_builtin_types[0], .is_variadic = false}},
+    /* 458 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[0], .param_count = 0, .min_param_count = -1, .return_type = &wyn_builtin_types[4], .is_variadic = false}},
+    /* 459 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[537], .param_count = 4, .min_param_count = -1, .return_type = &wyn_builtin_types[4], .is_variadic = false}},
+    /* 460 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[541], .param_count = 4, .min_param_count = -1, .return_type = &wyn_builtin_types[4], .is_variadic = false}},
+    /* 461 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[545], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[4], .is_variadic = false}},
+    /* 462 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[546], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[0], .is_variadic = false}},
+    /* 463 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[0], .param_count = 0, .min_param_count = -1, .return_type = &wyn_builtin_types[2], .is_variadic = false}},
+    /* 464 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[0], .param_count = 0, .min_param_count = -1, .return_type = &wyn_builtin_types[4], .is_variadic = false}},
+    /* 465 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[547], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[4], .is_variadic = false}},
+    /* 466 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[548], .param_count = 5, .min_param_count = -1, .return_type = &wyn_builtin_types[4], .is_variadic = false}},
+    /* 467 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[553], .param_count = 6, .min_param_count = -1, .return_type = &wyn_builtin_types[0], .is_variadic = false}},
+    /* 468 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[559], .param_count = 4, .min_param_count = -1, .return_type = &wyn_builtin_types[4], .is_variadic = false}},
+    /* 469 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[563], .param_count = 5, .min_param_count = -1, .return_type = &wyn_builtin_types[4], .is_variadic = false}},
+    /* 470 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[568], .param_count = 3, .min_param_count = -1, .return_type = &wyn_builtin_types[4], .is_variadic = false}},
+    /* 471 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[571], .param_count = 3, .min_param_count = -1, .return_type = &wyn_builtin_types[4], .is_variadic = false}},
+    /* 472 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[574], .param_count = 4, .min_param_count = -1, .return_type = &wyn_builtin_types[4], .is_variadic = false}},
+    /* 473 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[578], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[0], .is_variadic = false}},
+    /* 474 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[0], .param_count = 0, .min_param_count = -1, .return_type = &wyn_builtin_types[0], .is_variadic = false}},
+    /* 475 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[0], .param_count = 0, .min_param_count = -1, .return_type = &wyn_builtin_types[0], .is_variadic = false}},
+    /* 476 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[0], .param_count = 0, .min_param_count = -1, .return_type = &wyn_builtin_types[0], .is_variadic = false}},
+    /* 477 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[0], .param_count = 0, .min_param_count = -1, .return_type = &wyn_builtin_types[0], .is_variadic = false}},
+    /* 478 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[579], .param_count = 1, .min_param_count = -1, .return_type = &wyn_builtin_types[0], .is_variadic = false}},
+    /* 479 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[580], .param_count = 3, .min_param_count = -1, .return_type = &wyn_builtin_types[4], .is_variadic = false}},
+    /* 480 */ {.kind = (TypeKind)8, .fn_type = {.param_types = &wyn_builtin_params[583], .param_count = 5, .min_param_count = -1, .return_type = &wyn_builtin_types[4], .is_variadic = false}},
+};
+
+static const BuiltinSym wyn_builtin_syms[WYN_BUILTIN_SYM_COUNT] = {
+    {"HashMap", 7, 8, false},
+    {"HashSet", 7, 9, false},
+    {"ResultInt", 9, 10, false},
+    {"ResultString", 12, 11, false},
+    {"print", 5, 0, false},
+    {"print_float", 11, 0, false},
+    {"print_str", 9, 0, false},
+    {"print_bool", 10, 0, false},
+    {"print_hex", 9, 0, false},
+    {"print_bin", 9, 0, false},
+    {"println", 7, 0, false},
+    {"print_debug", 11, 0, false},
+    {"input", 5, 0, false},
+    {"printf_wyn", 10, 0, false},
+    {"string_format", 13, 0, false},
+    {"sin_approx", 10, 0, false},
+    {"cos_approx", 10, 0, false},
+    {"pi_const", 8, 0, false},
+    {"e_const", 7, 0, false},
+    {"str_len", 7, 0, false},
+    {"str_eq", 6, 0, false},
+    {"str_concat", 10, 0, false},
+    {"str_upper", 9, 0, false},
+    {"str_lower", 9, 0, false},
+    {"str_contains", 12, 0, false},
+    {"str_starts_with", 15, 0, false},
+    {"str_ends_with", 13, 0, false},
+    {"str_trim", 8, 0, false},
+    {"str_replace", 11, 0, false},
+    {"str_split", 9, 0, false},
+    {"str_join", 8, 0, false},
+    {"int_to_str", 10, 0, false},
+    {"str_to_int", 10, 0, false},
+    {"str_repeat", 10, 0, false},
+    {"str_reverse", 11, 0, false},
+    {"str_parse_int", 13, 0, false},
+    {"str_parse_int_failed", 20, 0, false},
+    {"str_parse_float", 15, 0, false},
+    {"str_free", 8, 0, false},
+    {"split_get", 9, 0, false},
+    {"split_count", 11, 0, false},
+    {"char_at", 7, 0, false},
+    {"is_numeric", 10, 0, false},
+    {"str_count", 9, 0, false},
+    {"str_contains_substr", 19, 0, false},
+    {"string_char_at", 14, 0, false},
+    {"string_length", 13, 0, false},
+    {"abs_val", 7, 0, false},
+    {"min", 3, 0, false},
+    {"max", 3, 0, false},
+    {"pow_int", 7, 0, false},
+    {"clamp", 5, 0, false},
+    {"sign", 4, 0, false},
+    {"gcd", 3, 0, false},
+    {"lcm", 3, 0, false},
+    {"is_even", 7, 0, false},
+    {"is_odd", 6, 0, false},
+    {"sqrt_int", 8, 0, false},
+    {"ceil_int", 8, 0, false},
+    {"floor_int", 9, 0, false},
+    {"round_int", 9, 0, false},
+    {"abs_float", 9, 0, false},
+    {"swap", 4, 0, false},
+    {"clamp_float", 11, 0, false},
+    {"lerp", 4, 0, false},
+    {"map_range", 9, 0, false},
+    {"bit_set", 7, 0, false},
+    {"bit_clear", 9, 0, false},
+    {"bit_toggle", 10, 0, false},
+    {"bit_check", 9, 0, false},
+    {"bit_count", 9, 0, false},
+    {"arr_sum", 7, 0, false},
+    {"arr_max", 7, 0, false},
+    {"arr_min", 7, 0, false},
+    {"arr_contains", 12, 0, false},
+    {"arr_find", 8, 0, false},
+    {"arr_reverse", 11, 0, false},
+    {"arr_sort", 8, 0, false},
+    {"arr_count", 9, 0, false},
+    {"arr_fill", 8, 0, false},
+    {"arr_all", 7, 0, false},
+    {"arr_join", 8, 0, false},
+    {"arr_map_double", 14, 0, false},
+    {"arr_map_square", 14, 0, false},
+    {"arr_filter_positive", 19, 0, false},
+    {"arr_filter_even", 15, 0, false},
+    {"arr_filter_greater_than_3", 25, 0, false},
+    {"arr_reduce_sum", 14, 0, false},
+    {"arr_reduce_product", 18, 0, false},
+    {"file_exists", 11, 0, false},
+    {"file_size", 9, 0, false},
+    {"file_delete", 11, 0, false},
+    {"file_append", 11, 0, false},
+    {"file_copy", 9, 0, false},
+    {"last_error_get", 14, 0, false},
+    {"file_move", 9, 0, false},
+    {"file_list_dir", 13, 0, false},
+    {"file_mkdir", 10, 0, false},
+    {"file_rmdir", 10, 0, false},
+    {"file_is_file", 12, 0, false},
+    {"file_is_dir", 11, 0, false},
+    {"random_int", 10, 0, false},
+    {"random_range", 12, 0, false},
+    {"random_float", 12, 0, false},
+    {"seed_random", 11, 0, false},
+    {"random_bool", 11, 0, false},
+    {"random_string", 13, 0, false},
+    {"random_hex", 10, 0, false},
+    {"random_uuid", 11, 0, false},
+    {"random_choice_int", 17, 0, false},
+    {"random_choice_str", 17, 0, false},
+    {"random_seed_auto", 16, 0, false},
+    {"time_now", 8, 0, false},
+    {"time_format", 11, 0, false},
+    {"range", 5, 0, false},
+    {"array_new", 9, 0, false},
+    {"array_push", 10, 0, false},
+    {"array_push_str", 14, 0, false},
+    {"array_pop", 9, 0, false},
+    {"array_length_dyn", 16, 0, false},
+    {"len", 3, 0, false},
+    {"assert_eq", 9, 0, false},
+    {"assert_true", 11, 0, false},
+    {"assert_false", 12, 0, false},
+    {"panic", 5, 0, false},
+    {"todo", 4, 0, false},
+    {"await_any", 9, 0, false},
+    {"exit_program", 12, 0, false},
+    {"sleep_ms", 8, 0, false},
+    {"getenv_var", 10, 0, false},
+    {"setenv_var", 10, 0, false},
+    {"Error", 5, 0, false},
+    {"TypeError", 9, 0, false},
+    {"ValueError", 10, 0, false},
+    {"DivisionByZeroError", 19, 0, false},
+    {"print_error", 11, 0, false},
+    {"hashmap_new", 11, 0, false},
+    {"hashmap_insert", 14, 0, false},
+    {"hashmap_get", 11, 0, false},
+    {"hashmap_has", 11, 0, false},
+    {"hashmap_remove", 14, 0, false},
+    {"hashmap_free", 12, 0, false},
+    {"hashmap_insert_int", 18, 0, false},
+    {"hashmap_insert_float", 20, 0, false},
+    {"hashmap_insert_string", 21, 0, false},
+    {"hashmap_insert_bool", 19, 0, false},
+    {"hashmap_get_int", 15, 0, false},
+    {"hashmap_get_float", 17, 0, false},
+    {"hashmap_get_string", 18, 0, false},
+    {"hashmap_get_bool", 16, 0, false},
+    {"wyn_hashmap_new", 15, 0, false},
+    {"wyn_hashmap_insert_int", 22, 0, false},
+    {"wyn_hashmap_get_int", 19, 0, false},
+    {"wyn_hashmap_has", 15, 0, false},
+    {"wyn_hashmap_len", 15, 0, false},
+    {"wyn_hashmap_free", 16, 0, false},
+    {"hashset_new", 11, 0, false},
+    {"hashset_add", 11, 0, false},
+    {"hashset_contains", 16, 0, false},
+    {"hashset_remove", 14, 0, false},
+    {"hashset_free", 12, 0, false},
+    {"hashset_add_int", 15, 0, false},
+    {"hashset_contains_int", 20, 0, false},
+    {"hashset_remove_int", 18, 0, false},
+    {"hashset_reserve", 15, 0, false},
+    {"set_len", 7, 0, false},
+    {"set_is_empty", 12, 0, false},
+    {"set_clear", 9, 0, false},
+    {"set_union", 9, 0, false},
+    {"set_intersection", 16, 0, false},
+    {"set_difference", 14, 0, false},
+    {"set_is_subset", 13, 0, false},
+    {"set_is_superset", 15, 0, false},
+    {"json_parse", 10, 0, false},
+    {"json_get_int", 12, 0, false},
+    {"json_free", 9, 0, false},
+    {"json_get_str", 12, 0, false},
+    {"json_get_bool", 13, 0, false},
+    {"json_has_key", 12, 0, false},
+    {"json_stringify_int", 18, 0, false},
+    {"json_stringify_str", 18, 0, false},
+    {"json_stringify_bool", 19, 0, false},
+    {"json_array_stringify", 20, 0, false},
+    {"json_array_length", 17, 0, false},
+    {"json_array_get", 14, 0, false},
+    {"url_encode", 10, 0, false},
+    {"url_decode", 10, 0, false},
+    {"base64_encode", 13, 0, false},
+    {"hash_string", 11, 0, false},
+    {"wyn_string_len", 14, 0, false},
+    {"wyn_string_contains", 19, 0, false},
+    {"wyn_string_starts_with", 22, 0, false},
+    {"wyn_string_ends_with", 20, 0, false},
+    {"wyn_string_to_upper", 19, 0, false},
+    {"wyn_string_to_lower", 19, 0, false},
+    {"wyn_string_trim", 15, 0, false},
+    {"wyn_str_replace", 15, 0, false},
+    {"wyn_string_split", 16, 0, false},
+    {"wyn_string_join", 15, 0, false},
+    {"wyn_str_substring", 17, 0, false},
+    {"wyn_string_index_of", 19, 0, false},
+    {"wyn_string_last_index_of", 24, 0, false},
+    {"wyn_string_repeat", 17, 0, false},
+    {"wyn_string_reverse", 18, 0, false},
+    {"wyn_string_pad_left", 19, 0, false},
+    {"wyn_string_pad_right", 20, 0, false},
+    {"wyn_string_pad_left_safe", 24, 0, false},
+    {"wyn_string_pad_right_safe", 25, 0, false},
+    {"wyn_array_map", 13, 0, false},
+    {"wyn_array_filter", 16, 0, false},
+    {"wyn_array_reduce", 16, 0, false},
+    {"wyn_array_find", 14, 0, false},
+    {"wyn_array_find_index", 20, 0, false},
+    {"wyn_array_unique", 16, 0, false},
+    {"wyn_array_join", 14, 0, false},
+    {"wyn_array_first", 15, 0, false},
+    {"wyn_array_last", 14, 0, false},
+    {"wyn_array_is_empty", 18, 0, false},
+    {"wyn_array_any", 13, 0, false},
+    {"wyn_array_all", 13, 0, false},
+    {"wyn_array_reverse", 17, 0, false},
+    {"wyn_array_sort", 14, 0, false},
+    {"wyn_array_contains", 18, 0, false},
+    {"wyn_array_index_of", 18, 0, false},
+    {"wyn_array_last_index_of", 23, 0, false},
+    {"wyn_array_slice", 15, 0, false},
+    {"wyn_array_concat", 16, 0, false},
+    {"wyn_array_fill", 14, 0, false},
+    {"wyn_array_sum", 13, 0, false},
+    {"wyn_array_min", 13, 0, false},
+    {"wyn_array_max", 13, 0, false},
+    {"wyn_array_average", 17, 0, false},
+    {"wyn_time_now", 12, 0, false},
+    {"wyn_time_now_millis", 19, 0, false},
+    {"wyn_time_now_micros", 19, 0, false},
+    {"wyn_time_sleep", 14, 0, false},
+    {"wyn_time_sleep_millis", 21, 0, false},
+    {"wyn_time_sleep_micros", 21, 0, false},
+    {"wyn_time_format", 15, 0, false},
+    {"wyn_time_parse", 14, 0, false},
+    {"wyn_time_year", 13, 0, false},
+    {"wyn_time_month", 14, 0, false},
+    {"wyn_time_day", 12, 0, false},
+    {"wyn_time_hour", 13, 0, false},
+    {"wyn_time_minute", 15, 0, false},
+    {"wyn_time_second", 15, 0, false},
+    {"wyn_crypto_hash32", 17, 0, false},
+    {"wyn_crypto_hash64", 17, 0, false},
+    {"wyn_crypto_md5", 14, 0, false},
+    {"wyn_crypto_sha256", 17, 0, false},
+    {"wyn_crypto_base64_encode", 24, 0, false},
+    {"wyn_crypto_base64_decode", 24, 0, false},
+    {"wyn_crypto_random_bytes", 23, 0, false},
+    {"wyn_crypto_random_hex", 21, 0, false},
+    {"wyn_crypto_xor_cipher", 21, 0, false},
+    {"wyn_math_abs", 12, 0, false},
+    {"wyn_math_min", 12, 0, false},
+    {"wyn_math_max", 12, 0, false},
+    {"wyn_math_pow", 12, 0, false},
+    {"wyn_math_sqrt", 13, 0, false},
+    {"wyn_math_floor", 14, 0, false},
+    {"wyn_math_ceil", 13, 0, false},
+    {"wyn_math_round", 14, 0, false},
+    {"input_float", 11, 12, false},
+    {"input_line", 10, 13, false},
+    {"http_get", 8, 14, false},
+    {"http_post", 9, 15, false},
+    {"http_put", 8, 16, false},
+    {"http_delete", 11, 17, false},
+    {"https_get", 9, 18, false},
+    {"https_post", 10, 19, false},
+    {"http_set_header", 15, 20, false},
+    {"http_clear_headers", 18, 21, false},
+    {"http_status", 11, 22, false},
+    {"http_error", 10, 23, false},
+    {"await_all", 9, 24, false},
+    {"get_argc", 8, 26, false},
+    {"get_argv", 8, 27, false},
+    {"read_file_content", 17, 28, false},
+    {"check_file_exists", 17, 29, false},
+    {"is_content_valid", 16, 30, false},
+    {"c_init_lexer", 12, 31, false},
+    {"c_init_parser", 13, 32, false},
+    {"c_parse_program", 15, 33, false},
+    {"c_init_checker", 14, 34, false},
+    {"c_check_program", 15, 35, false},
+    {"c_checker_had_error", 19, 36, false},
+    {"c_generate_code", 15, 37, false},
+    {"c_create_c_filename", 19, 38, false},
+    {"c_compile_to_binary", 19, 39, false},
+    {"c_remove_file", 13, 40, false},
+    {"ResultInt_Ok", 12, 41, false},
+    {"ResultInt_Err", 13, 42, false},
+    {"ResultInt_is_ok", 15, 43, false},
+    {"ResultInt_is_err", 16, 44, false},
+    {"ResultString_Ok", 15, 45, false},
+    {"ResultString_Err", 16, 46, false},
+    {"ResultString_is_ok", 18, 47, false},
+    {"ResultString_is_err", 19, 48, false},
+    {"ResultInt_unwrap", 16, 49, false},
+    {"ResultInt_unwrap_err", 20, 50, false},
+    {"ResultString_unwrap", 19, 51, false},
+    {"ResultString_unwrap_err", 23, 52, false},
+    {"OptionInt", 9, 53, false},
+    {"OptionInt_Some", 14, 54, false},
+    {"OptionInt_None", 14, 55, false},
+    {"OptionInt_is_some", 17, 56, false},
+    {"OptionInt_is_none", 17, 57, false},
+    {"OptionInt_unwrap", 16, 58, false},
+    {"OptionInt_unwrap_or", 19, 59, false},
+    {"OptionString", 12, 60, false},
+    {"OptionString_Some", 17, 61, false},
+    {"OptionString_None", 17, 62, false},
+    {"OptionString_is_some", 20, 63, false},
+    {"OptionString_is_none", 20, 64, false},
+    {"OptionString_unwrap", 19, 65, false},
+    {"OptionString_unwrap_or", 22, 66, false},
+    {"OptionFloat", 11, 67, false},
+    {"OptionFloat_Some", 16, 68, false},
+    {"OptionFloat_None", 16, 69, false},
+    {"OptionFloat_is_some", 19, 70, false},
+    {"OptionFloat_is_none", 19, 71, false},
+    {"OptionFloat_unwrap", 18, 72, false},
+    {"OptionFloat_unwrap_or", 21, 73, false},
+    {"OptionBool", 10, 74, false},
+    {"OptionBool_Some", 15, 75, false},
+    {"OptionBool_None", 15, 76, false},
+    {"OptionBool_is_some", 18, 77, false},
+    {"OptionBool_is_none", 18, 78, false},
+    {"OptionBool_unwrap", 17, 79, false},
+    {"OptionBool_unwrap_or", 20, 80, false},
+    {"ResultFloat", 11, 81, false},
+    {"ResultFloat_Ok", 14, 82, false},
+    {"ResultFloat_Err", 15, 83, false},
+    {"ResultFloat_is_ok", 17, 84, false},
+    {"ResultFloat_is_err", 18, 85, false},
+    {"ResultFloat_unwrap", 18, 86, false},
+    {"ResultFloat_unwrap_err", 22, 87, false},
+    {"ResultFloat_unwrap_or", 21, 88, false},
+    {"ResultBool", 10, 89, false},
+    {"ResultBool_Ok", 13, 90, false},
+    {"ResultBool_Err", 14, 91, false},
+    {"ResultBool_is_ok", 16, 92, false},
+    {"ResultBool_is_err", 17, 93, false},
+    {"ResultBool_unwrap", 17, 94, false},
+    {"ResultBool_unwrap_err", 21, 95, false},
+    {"ResultBool_unwrap_or", 20, 96, false},
+    {"System_exec", 11, 97, false},
+    {"System_exec_code", 16, 98, false},
+    {"System_exit", 11, 99, false},
+    {"System_env", 10, 100, false},
+    {"int_to_string", 13, 101, false},
+    {"float_to_string", 15, 102, false},
+    {"Math_abs", 8, 103, false},
+    {"Math_max", 8, 104, false},
+    {"Math_min", 8, 105, false},
+    {"Math_pow", 8, 106, false},
+    {"Math_sqrt", 9, 107, false},
+    {"Math_floor", 10, 108, false},
+    {"Math_ceil", 9, 109, false},
+    {"Math_round", 10, 110, false},
+    {"Math_sin", 8, 111, false},
+    {"Math_cos", 8, 112, false},
+    {"Math_tan", 8, 113, false},
+    {"Math_round_to", 13, 114, false},
+    {"Math_atan2", 10, 115, false},
+    {"Math_pi", 7, 116, false},
+    {"Math_e", 6, 117, false},
+    {"Math_random", 11, 118, false},
+    {"str_index_of", 12, 119, false},
+    {"str_substring", 13, 120, false},
+    {"Path_basename", 13, 121, false},
+    {"Path_dirname", 12, 122, false},
+    {"Path_extension", 14, 123, false},
+    {"Path_join", 9, 124, false},
+    {"json_new", 8, 125, false},
+    {"json_set_string", 15, 127, false},
+    {"json_set_int", 12, 128, false},
+    {"json_get_string", 15, 129, false},
+    {"json_stringify", 14, 130, false},
+    {"Regex_match", 11, 131, false},
+    {"Regex_replace", 13, 132, false},
+    {"File", 4, 0, false},
+    {"Path", 4, 0, false},
+    {"DateTime", 8, 0, false},
+    {"Time", 4, 0, false},
+    {"Json", 4, 0, false},
+    {"Http", 4, 0, false},
+    {"Regex", 5, 0, false},
+    {"System", 6, 0, false},
+    {"Terminal", 8, 0, false},
+    {"Color", 5, 0, false},
+    {"Test", 4, 0, false},
+    {"Math", 4, 0, false},
+    {"Env", 3, 0, false},
+    {"Net", 3, 0, false},
+    {"Url", 3, 0, false},
+    {"Task", 4, 0, false},
+    {"Db", 2, 0, false},
+    {"Gui", 3, 0, false},
+    {"Audio", 5, 0, false},
+    {"StringBuilder", 13, 0, false},
+    {"Crypto", 6, 0, false},
+    {"Encoding", 8, 0, false},
+    {"Os", 2, 0, false},
+    {"Uuid", 4, 0, false},
+    {"Log", 3, 0, false},
+    {"Process", 7, 0, false},
+    {"Csv", 3, 0, false},
+    {"Template", 8, 0, false},
+    {"Socket", 6, 0, false},
+    {"Ws", 2, 0, false},
+    {"Args", 4, 0, false},
+    {"Base64", 6, 0, false},
+    {"Toml", 4, 0, false},
+    {"Bcrypt", 6, 0, false},
+    {"Random", 6, 0, false},
+    {"Web", 3, 0, false},
+    {"Smtp", 4, 0, false},
+    {"App", 3, 0, false},
+    {"Shared", 6, 0, false},
+    {"Ptr", 3, 0, false},
+    {"File_read", 9, 133, false},
+    {"File_write", 10, 134, false},
+    {"File_exists", 11, 135, false},
+    {"File_delete", 11, 136, false},
+    {"File_copy", 9, 137, false},
+    {"File_move", 9, 138, false},
+    {"File_size", 9, 139, false},
+    {"File_is_dir", 11, 140, false},
+    {"File_is_file", 12, 141, false},
+    {"File_mkdir", 10, 142, false},
+    {"File_list_dir", 13, 143, false},
+    {"File_append", 11, 144, false},
+    {"File_cwd", 8, 145, false},
+    {"File_open", 9, 146, false},
+    {"File_read_line", 14, 147, false},
+    {"File_write_line", 15, 148, false},
+    {"File_eof", 8, 149, false},
+    {"File_close", 10, 150, false},
+    {"File_read_lines", 15, 151, false},
+    {"Json_keys", 9, 153, false},
+    {"HashMap_new", 11, 155, false},
+    {"HashSet_new", 11, 157, false},
+    {"Json_new", 8, 159, false},
+    {"Json_set_string", 15, 161, false},
+    {"Json_set_int", 12, 162, false},
+    {"Json_set_bool", 13, 163, false},
+    {"Json_stringify", 14, 164, false},
+    {"Http_get", 8, 165, false},
+    {"Terminal_cols", 13, 166, false},
+    {"Terminal_rows", 13, 167, false},
+    {"Terminal_raw_mode", 17, 168, false},
+    {"Terminal_restore", 16, 169, false},
+    {"Terminal_read_key", 17, 170, false},
+    {"Terminal_clear", 14, 171, false},
+    {"Terminal_write", 14, 172, false},
+    {"Terminal_move", 13, 173, false},
+    {"Color_red", 9, 174, false},
+    {"Color_green", 11, 175, false},
+    {"Color_yellow", 12, 176, false},
+    {"Color_blue", 10, 177, false},
+    {"Color_magenta", 13, 178, false},
+    {"Color_cyan", 10, 179, false},
+    {"Color_gray", 10, 180, false},
+    {"Color_bold", 10, 181, false},
+    {"Color_dim", 9, 182, false},
+    {"Color_underline", 15, 183, false},
+    {"DateTime_now", 12, 184, false},
+    {"DateTime_millis", 15, 185, false},
+    {"DateTime_micros", 15, 186, false},
+    {"DateTime_format", 15, 187, false},
+    {"DateTime_sleep", 14, 188, false},
+    {"Http_post", 9, 189, false},
+    {"Http_put", 8, 190, false},
+    {"Http_delete", 11, 191, false},
+    {"Http_serve", 10, 192, false},
+    {"Http_accept", 11, 193, false},
+    {"Http_respond", 12, 194, false},
+    {"Http_respond_json", 17, 195, false},
+    {"Http_respond_html", 17, 196, false},
+    {"Http_set_header", 15, 197, false},
+    {"Url_encode", 10, 198, false},
+    {"Url_decode", 10, 199, false},
+    {"Net_listen", 10, 200, false},
+    {"Net_connect", 11, 201, false},
+    {"Net_send", 8, 202, false},
+    {"Net_recv", 8, 203, false},
+    {"Net_close", 9, 204, false},
+    {"Task_value", 10, 205, false},
+    {"Task_get", 8, 206, false},
+    {"Task_set", 8, 207, false},
+    {"Task_add", 8, 208, false},
+    {"Task_channel", 12, 209, false},
+    {"Task_send", 9, 210, false},
+    {"Task_recv", 9, 211, false},
+    {"Task_close", 10, 212, false},
+    {"Task_try_recv", 13, 213, false},
+    {"Task_select_2", 13, 214, false},
+    {"Task_select_3", 13, 215, false},
+    {"Task_cancel", 11, 216, false},
+    {"Task_is_cancelled", 17, 217, false},
+    {"Task_blocking", 13, 218, false},
+    {"Ptr_cell", 8, 220, false},
+    {"Ptr_read", 8, 221, false},
+    {"Ptr_write", 9, 222, false},
+    {"Ptr_free", 8, 223, false},
+    {"Json_parse", 10, 224, false},
+    {"Json_get", 8, 225, false},
+    {"Json_get_string", 15, 226, false},
+    {"Json_get_int", 12, 227, false},
+    {"Json_has", 8, 228, false},
+    {"Json_array_len", 14, 229, false},
+    {"Json_array_get", 14, 230, false},
+    {"Json_node_str", 13, 231, false},
+    {"Encoding_base64_encode", 22, 232, false},
+    {"Encoding_base64_decode", 22, 233, false},
+    {"Encoding_hex_encode", 19, 234, false},
+    {"Crypto_sha256", 13, 235, false},
+    {"Crypto_md5", 10, 236, false},
+    {"Os_platform", 11, 237, false},
+    {"Os_arch", 7, 238, false},
+    {"Os_hostname", 11, 239, false},
+    {"Os_pid", 6, 240, false},
+    {"Os_temp_dir", 11, 241, false},
+    {"Os_home_dir", 11, 242, false},
+    {"Uuid_generate", 13, 243, false},
+    {"Math_clamp", 10, 244, false},
+    {"Math_sign", 9, 245, false},
+    {"DateTime_diff", 13, 246, false},
+    {"DateTime_add_seconds", 20, 247, false},
+    {"DateTime_to_iso", 15, 248, false},
+    {"regex_find", 10, 249, false},
+    {"regex_find_all", 14, 250, false},
+    {"Net_resolve", 11, 251, false},
+    {"Db_escape", 9, 252, false},
+    {"Db_table_exists", 15, 253, false},
+    {"Log_debug", 9, 254, false},
+    {"Log_info", 8, 255, false},
+    {"Log_warn", 8, 256, false},
+    {"Log_error", 9, 257, false},
+    {"Log_set_level", 13, 258, false},
+    {"Process_exec_capture", 20, 259, false},
+    {"Process_exec_status", 19, 260, false},
+    {"Http_timeout", 12, 261, false},
+    {"Http_listen", 11, 262, false},
+    {"Http_accept_fd", 14, 263, false},
+    {"Http_read_request", 17, 264, false},
+    {"Http_method", 11, 265, false},
+    {"Http_path", 9, 266, false},
+    {"Http_body", 9, 267, false},
+    {"Http_req_body", 13, 268, false},
+    {"Http_fd", 7, 269, false},
+    {"Http_respond_with_header", 24, 270, false},
+    {"Http_close_client", 17, 271, false},
+    {"Http_route_match", 16, 272, false},
+    {"Ws_connect", 10, 273, false},
+    {"Ws_send", 7, 274, false},
+    {"Ws_recv", 7, 275, false},
+    {"Socket_connect", 14, 276, false},
+    {"Socket_send", 11, 277, false},
+    {"Socket_recv", 11, 278, false},
+    {"Crypto_sha1", 11, 279, false},
+    {"Crypto_sha1_base64", 18, 280, false},
+    {"Crypto_hmac_sha256", 18, 281, false},
+    {"Crypto_hmac_sha256_hex", 22, 282, false},
+    {"Crypto_random_bytes", 19, 283, false},
+    {"Json_to_pretty_string", 21, 284, false},
+    {"Csv_parse", 9, 285, false},
+    {"Csv_row_count", 13, 286, false},
+    {"Csv_get", 7, 287, false},
+    {"Csv_get_field", 13, 288, false},
+    {"Csv_col_count", 13, 289, false},
+    {"Csv_header", 10, 290, false},
+    {"Csv_header_count", 16, 291, false},
+    {"Csv_open", 8, 292, false},
+    {"Csv_open_part", 13, 293, false},
+    {"Csv_next", 8, 294, false},
+    {"Csv_columns", 11, 295, false},
+    {"Csv_column", 10, 296, false},
+    {"Csv_get_text", 12, 297, false},
+    {"Csv_get_int", 11, 298, false},
+    {"Csv_get_float", 13, 299, false},
+    {"Csv_close", 9, 300, false},
+    {"Http_get_json", 13, 301, false},
+    {"Http_post_json", 14, 302, false},
+    {"Json_get_float", 14, 303, false},
+    {"Json_get_bool", 13, 304, false},
+    {"Json_get_array", 14, 305, false},
+    {"Json_get_object", 15, 306, false},
+    {"File_glob", 9, 307, false},
+    {"File_walk_dir", 13, 308, false},
+    {"File_temp_file", 14, 309, false},
+    {"DateTime_format_duration", 24, 310, false},
+    {"DateTime_day_of_week", 20, 311, false},
+    {"DateTime_year", 13, 312, false},
+    {"DateTime_month", 14, 313, false},
+    {"DateTime_day", 12, 314, false},
+    {"DateTime_hour", 13, 315, false},
+    {"DateTime_minute", 15, 316, false},
+    {"DateTime_second", 15, 317, false},
+    {"regex_split", 11, 318, false},
+    {"Regex_split", 11, 319, false},
+    {"Regex_find", 10, 320, false},
+    {"Regex_find_all", 14, 321, false},
+    {"Regex_compile", 13, 322, false},
+    {"Regex_is_match", 14, 323, false},
+    {"Regex_find_in", 13, 324, false},
+    {"Regex_replace_in", 16, 325, false},
+    {"Regex_find_all_in", 17, 326, false},
+    {"Regex_split_in", 14, 327, false},
+    {"Regex_free", 10, 328, false},
+    {"Encoding_hex_decode", 19, 329, false},
+    {"Encoding_csv_parse", 18, 330, false},
+    {"Env_get", 7, 331, false},
+    {"Env_set", 7, 332, false},
+    {"File_rename", 11, 333, false},
+    {"Db_open", 7, 334, false},
+    {"Db_close", 8, 335, false},
+    {"Db_exec", 7, 336, false},
+    {"Db_exec_p", 9, 337, false},
+    {"Db_query", 8, 338, false},
+    {"Db_query_one", 12, 339, false},
+    {"Db_query_p", 10, 340, false},
+    {"Db_error", 8, 341, false},
+    {"Db_last_insert_id", 17, 342, false},
+    {"Db_cursor", 9, 343, false},
+    {"Db_cursor_p", 11, 344, false},
+    {"Db_next", 7, 345, false},
+    {"Db_get_int", 10, 346, false},
+    {"Db_get_float", 12, 347, false},
+    {"Db_get_text", 11, 348, false},
+    {"Db_is_null", 10, 349, false},
+    {"Db_columns", 10, 350, false},
+    {"Db_column_name", 14, 351, false},
+    {"Db_close_cursor", 15, 352, false},
+    {"Db_batch", 8, 353, false},
+    {"Db_set_batch_size", 17, 354, false},
+    {"Db_set_import_mode", 18, 355, false},
+    {"Db_begin", 8, 356, false},
+    {"Db_end", 6, 357, false},
+    {"Db_rollback", 11, 358, false},
+    {"Http_header", 11, 359, false},
+    {"Http_status", 11, 360, false},
+    {"Http_ctx_fd", 11, 361, false},
+    {"Http_set_timeout", 16, 362, false},
+    {"Http_close_server", 17, 363, false},
+    {"Http_free", 9, 364, false},
+    {"Time_now_millis", 15, 365, false},
+    {"Time_format", 11, 366, false},
+    {"Time_sleep", 10, 367, false},
+    {"Task_free_value", 15, 368, false},
+    {"Socket_set_timeout", 18, 369, false},
+    {"Socket_set_nonblocking", 22, 370, false},
+    {"Socket_poll_read", 16, 371, false},
+    {"Socket_read_line", 16, 372, false},
+    {"Socket_close", 12, 373, false},
+    {"Ws_close", 8, 374, false},
+    {"System_gc", 9, 375, false},
+    {"System_load_env", 15, 376, false},
+    {"System_set_env", 14, 377, false},
+    {"Data_save", 9, 378, false},
+    {"Template_render", 15, 379, false},
+    {"Template_render_string", 22, 380, false},
+    {"String_char_from_int", 20, 381, false},
+    {"String_char", 11, 382, false},
+    {"String_from_chars", 17, 383, false},
+    {"Fs_read_file", 12, 384, false},
+    {"Queue_push", 10, 385, false},
+    {"Queue_pop", 9, 386, false},
+    {"Queue_peek", 10, 387, false},
+    {"Queue_len", 9, 388, false},
+    {"Queue_is_empty", 14, 389, false},
+    {"Stack_push", 10, 390, false},
+    {"Stack_pop", 9, 391, false},
+    {"Stack_peek", 10, 392, false},
+    {"Stack_len", 9, 393, false},
+    {"Stack_is_empty", 14, 394, false},
+    {"Deque_new", 9, 395, false},
+    {"Deque_push_back", 15, 396, false},
+    {"Deque_push_front", 16, 397, false},
+    {"Deque_pop_front", 15, 398, false},
+    {"Deque_pop_back", 14, 399, false},
+    {"Deque_front", 11, 400, false},
+    {"Deque_back", 10, 401, false},
+    {"Deque_get", 9, 402, false},
+    {"Deque_set", 9, 403, false},
+    {"Deque_len", 9, 404, false},
+    {"Deque_is_empty", 14, 405, false},
+    {"Deque_clear", 11, 406, false},
+    {"PriorityQueue_new", 17, 407, false},
+    {"PriorityQueue_int_new", 21, 409, false},
+    {"PriorityQueue_int_push", 22, 410, false},
+    {"PriorityQueue_int_pop", 21, 411, false},
+    {"PriorityQueue_int_peek", 22, 412, false},
+    {"PriorityQueue_int_len", 21, 413, false},
+    {"PriorityQueue_int_is_empty", 26, 414, false},
+    {"PriorityQueue_float_new", 23, 415, false},
+    {"PriorityQueue_float_push", 24, 417, false},
+    {"PriorityQueue_float_pop", 23, 418, false},
+    {"PriorityQueue_float_peek", 24, 419, false},
+    {"PriorityQueue_float_len", 23, 420, false},
+    {"PriorityQueue_float_is_empty", 28, 421, false},
+    {"PriorityQueue_string_new", 24, 422, false},
+    {"PriorityQueue_string_push", 25, 424, false},
+    {"PriorityQueue_string_pop", 24, 425, false},
+    {"PriorityQueue_string_peek", 25, 426, false},
+    {"PriorityQueue_string_len", 24, 427, false},
+    {"PriorityQueue_string_is_empty", 29, 428, false},
+    {"Terminal_color", 14, 429, false},
+    {"Terminal_bg", 11, 430, false},
+    {"Terminal_bol", 12, 431, false},
+    {"Terminal_dim", 12, 432, false},
+    {"Terminal_underline", 18, 433, false},
+    {"Terminal_reset", 14, 434, false},
+    {"Terminal_hide_cursor", 20, 435, false},
+    {"Terminal_show_cursor", 20, 436, false},
+    {"Terminal_box", 12, 437, false},
+    {"Terminal_progress", 17, 438, false},
+    {"Terminal_print_color", 20, 439, false},
+    {"Test_init", 9, 440, false},
+    {"Test_assert", 11, 441, false},
+    {"Test_describe", 13, 442, false},
+    {"Test_skip", 9, 443, false},
+    {"Test_summary", 12, 444, false},
+    {"Json_set", 8, 445, false},
+    {"Gui_create", 10, 446, false},
+    {"Gui_clear", 9, 447, false},
+    {"Gui_color", 9, 448, false},
+    {"Gui_rect", 8, 449, false},
+    {"Gui_line", 8, 450, false},
+    {"Gui_point", 9, 451, false},
+    {"Gui_present", 11, 452, false},
+    {"Gui_poll", 8, 453, false},
+    {"Gui_running", 11, 454, false},
+    {"Gui_delay", 9, 455, false},
+    {"Gui_width", 9, 456, false},
+    {"Gui_height", 10, 457, false},
+    {"Gui_destroy", 11, 458, false},
+    {"Gui_text", 8, 459, false},
+    {"Gui_text_input", 14, 460, false},
+    {"Gui_text_input_activate", 23, 461, false},
+    {"Gui_text_input_key", 18, 462, false},
+    {"Gui_text_input_value", 20, 463, false},
+    {"Gui_text_input_clear", 20, 464, false},
+    {"Gui_text_input_set", 18, 465, false},
+    {"Gui_button", 10, 466, false},
+    {"Gui_button_clicked", 18, 467, false},
+    {"Gui_panel", 9, 468, false},
+    {"Gui_progress", 12, 469, false},
+    {"Gui_circle", 10, 470, false},
+    {"Gui_label", 9, 471, false},
+    {"Gui_rect_outline", 16, 472, false},
+    {"Gui_key_pressed", 15, 473, false},
+    {"Gui_mouse_x", 11, 474, false},
+    {"Gui_mouse_y", 11, 475, false},
+    {"Gui_mouse_down", 14, 476, false},
+    {"Gui_ticks", 9, 477, false},
+    {"Gui_load_sprite", 15, 478, false},
+    {"Gui_draw_sprite", 15, 479, false},
+    {"Gui_draw_sprite_scaled", 22, 480, false},
+};
+
+static const uint16_t wyn_builtin_disp[WYN_BUILTIN_DISP_COUNT] = {
+    0, 5, 1, 6, 9, 3, 0, 2, 3, 0, 0, 6, 6, 2, 9, 1,
+    4, 3, 0, 1, 3, 2, 0, 3, 0, 2, 0, 1, 0, 6, 0, 12,
+    0, 1, 18, 8, 0, 0, 0, 18, 1, 1, 1, 2, 8, 4, 3, 0,
+    1, 0, 3, 0, 0, 0, 2, 2, 3, 0, 0, 0, 7, 0, 0, 4,
+    3, 0, 7, 28, 10, 0, 7, 0, 3, 0, 2, 0, 4, 4, 3, 5,
+    6, 4, 9, 2, 0, 2, 0, 0, 0, 0, 0, 1, 0, 0, 8, 0,
+    15, 2, 14, 1, 14, 0, 0, 17, 20, 5, 7, 3, 1, 0, 8, 0,
+    0, 4, 3, 4, 5, 1, 0, 7, 0, 0, 5, 11, 0, 0, 2, 3,
+    1, 3, 6, 0, 0, 17, 0, 1, 0, 1, 1, 2, 0, 2, 2, 2,
+    7, 2, 2, 18, 9, 1, 3, 1, 1, 3, 6, 4, 2, 5, 7, 2,
+    9, 6, 4, 8, 4, 3, 3, 10, 5, 17, 0, 1, 7, 0, 5, 10,
+    0, 6, 10, 0, 1, 14, 2, 3, 7, 3, 0, 0, 3, 20, 6, 33,
+    3, 5, 10, 0, 7, 11, 14, 1, 9, 0, 11, 6, 14, 1, 14, 7,
+    30, 17, 5, 1, 4, 5, 0, 6, 6, 0, 2, 5, 4, 15, 5, 4,
+    1, 46, 0, 0, 6, 3, 7, 2, 0, 33, 0, 3, 1, 0, 25, 11,
+    0, 0, 1, 0, 12, 3, 1, 10, 0, 2, 13, 27, 54, 20, 1, 2,
+};
+
+static const int16_t wyn_builtin_slot[WYN_BUILTIN_SLOT_COUNT] = {
+    -1, 2, -1, 92, 75, 359, 501, 719, 626, 293, -1, -1, -1, 494, 750, 64,
+    125, -1, 108, 733, 138, 232, -1, 731, 559, -1, -1, 646, -1, -1, -1, 173,
+    207, 151, 182, 161, 177, -1, -1, 511, -1, 245, 430, 475, 409, 327, -1, 567,
+    433, 671, -1, -1, 529, 77, -1, 367, 343, 247, 73, 386, 591, 647, 347, -1,
+    493, 451, 391, -1, 253, -1, 442, 526, -1, 179, 263, 233, 421, 340, 107, 689,
+    54, 550, 72, 39, 592, 619, -1, 676, 44, 490, 390, 533, -1, -1, -1, -1,
+    -1, 16, 254, 127, 238, -1, -1, -1, -1, -1, -1, 479, 706, -1, 418, 379,
+    714, -1, 512, 614, 114, 709, 728, 94, 85, 636, -1, -1, 81, -1, 67, 416,
+    286, 336, 371, 542, 536, 297, 250, 145, 319, 609, -1, 756, -1, 663, 691, 539,
+    570, 453, 49, 19, 202, -1, 380, 208, 236, 604, -1, 136, 302, 7, -1, -1,
+    -1, 335, 443, 516, 3, 134, 112, 700, 205, -1, 555, -1, 98, 683, 441, -1,
+    504, 383, 404, 437, 41, 414, 1, -1, 174, -1, -1, 172, -1, 588, -1, 484,
+    457, 445, 140, -1, 751, 468, 235, -1, 586, 515, 388, 284, 681, 362, -1, 28,
+    147, 303, 405, 171, 687, 5, 693, 111, 42, 510, 408, 192, 488, 741, -1, 50,
+    260, 717, -1, 87, -1, -1, 51, 543, -1, 290, 685, 308, 513, -1, 500, 582,
+    157, 422, 240, 291, 735, 723, -1, -1, 432, 697, 745, 702, 287, 564, 255, 113,
+    396, 69, 621, -1, -1, 40, 628, 670, 746, 325, 469, 458, -1, 124, 602, 594,
+    15, 305, -1, 473, -1, 78, 110, 374, 502, 104, 48, 556, 708, 568, 256, 617,
+    560, 690, 456, -1, 497, -1, 68, 523, 65, -1, 363, 213, 465, 243, 265, -1,
+    191, 541, 686, 505, 220, 673, 522, 135, 328, -1, 495, -1, 401, -1, -1, -1,
+    152, 462, 231, -1, 37, 467, -1, 638, -1, 217, 133, 264, 368, -1, 309, 197,
+    -1, 47, 45, -1, 118, 677, 524, 530, 337, 357, 600, -1, 459, 461, 355, 93,
+    -1, 672, 252, 25, 518, 155, 448, 572, -1, 222, 370, 280, 346, -1, 531, -1,
+    180, 195, 275, 434, 400, 540, -1, 283, -1, 620, 55, 12, 447, 554, 491, 184,
+    -1, 83, 474, 743, 642, 156, 721, 354, 605, 53, 553, 227, 637, 163, 499, 279,
+    -1, 629, 407, 358, 248, -1, 225, -1, 648, 33, 668, 754, 148, 206, 224, 126,
+    701, 329, 244, -1, 653, 321, 229, 738, 97, -1, 634, 70, -1, 705, -1, 316,
+    330, -1, 258, 413, -1, 587, 382, 574, 623, 361, 688, -1, 696, 276, 534, 117,
+    -1, 96, 348, 508, -1, 333, 115, 230, -1, 32, 454, 82, -1, 632, 489, -1,
+    517, -1, -1, 527, 575, 311, 35, 323, -1, 577, 737, -1, 373, 419, 312, 645,
+    223, -1, 627, 411, -1, 318, 650, -1, -1, 674, 753, 557, -1, 464, 727, 455,
+    141, 353, 351, 722, 449, 732, -1, -1, -1, 273, -1, 63, 216, 142, 744, -1,
+    -1, 649, 631, 509, 43, 375, -1, 506, -1, 66, 655, 342, 483, 520, 711, 300,
+    36, -1, -1, 643, 394, 435, -1, 615, -1, 487, 164, -1, 389, 187, 704, -1,
+    -1, 350, -1, 219, -1, 716, -1, 660, 268, 62, 31, 678, -1, 565, 288, 143,
+    -1, 23, 710, 415, 393, 377, 589, -1, -1, -1, 661, -1, -1, 281, -1, -1,
+    544, 239, 158, 406, 654, 304, 269, 538, -1, 56, 294, -1, 168, 169, -1, -1,
+    480, -1, 261, 160, -1, -1, -1, 234, 91, 525, 579, -1, 79, 123, 749, -1,
+    521, -1, -1, 270, 439, 760, 563, -1, -1, 334, -1, 742, 27, -1, -1, -1,
+    392, 446, 395, 221, 431, 186, -1, 384, 713, 356, -1, 13, 477, 657, -1, 476,
+    624, 424, 314, 119, -1, 71, 322, 246, 630, -1, 60, 537, 715, -1, 301, 162,
+    436, -1, 507, 150, 167, 680, 282, 417, -1, -1, -1, -1, 665, 310, -1, -1,
+    -1, -1, 492, 684, 381, 211, 759, 183, -1, -1, 486, 295, 571, -1, 34, 10,
+    420, 403, 299, -1, 612, -1, -1, 573, 558, 481, -1, 8, 651, 30, -1, 613,
+    611, 178, 0, -1, 285, 625, 584, 120, -1, 726, 652, 578, 193, 194, 618, 58,
+    170, 324, 729, 257, -1, -1, 317, 212, -1, 695, 176, 758, 122, 74, -1, 105,
+    478, 159, 339, -1, 593, 444, 662, 241, 659, 707, 547, 669, 675, -1, -1, 514,
+    349, 188, 664, 616, 580, 720, 289, -1, 699, 748, -1, -1, 569, 425, 99, 11,
+    496, 218, -1, 466, 101, 438, 460, -1, 376, 344, 633, -1, 46, 181, -1, 692,
+    429, 450, 610, 552, 583, 398, 658, 214, -1, -1, 667, 272, -1, -1, 482, -1,
+    137, 452, 144, -1, -1, -1, 266, 364, -1, -1, 86, 679, -1, 470, 639, 601,
+    -1, -1, -1, 585, -1, 546, 440, 548, 296, 736, -1, 203, 635, 103, 757, -1,
+    204, 165, 26, 590, 307, 551, -1, 352, -1, 116, 88, 747, 535, 130, 360, 200,
+    -1, 549, 598, -1, 428, -1, -1, 331, -1, 712, -1, 730, 739, 463, 109, 198,
+    -1, -1, 562, 498, 426, 641, 532, 106, 345, 603, 724, 228, 397, 139, -1, 52,
+    -1, -1, -1, -1, 378, 306, 338, 596, 84, 320, 249, 755, 175, 20, 740, 694,
+    201, 734, 90, 132, -1, 146, 644, 215, -1, 80, 199, 387, -1, 22, -1, 606,
+    607, 18, 622, 190, 89, -1, 149, -1, -1, -1, -1, 528, 24, 277, 189, 131,
+    698, 313, 237, 267, 6, 366, 298, 29, -1, 471, 581, 259, 503, 656, 576, 95,
+    -1, 725, 703, -1, 262, 129, 21, -1, 196, 640, 608, 369, 210, 209, -1, 597,
+    -1, -1, 595, 185, 4, -1, 251, 154, 682, 128, 153, -1, 17, 365, 242, 102,
+    -1, 121, -1, 472, 423, 519, 385, 226, 341, -1, -1, -1, -1, -1, 666, 752,
+    14, 545, -1, 372, 718, 59, 76, 599, 485, 271, 315, 326, 274, 100, -1, 166,
+    561, 292, 9, 427, 412, -1, 57, 38, 61, 399, 566, 402, -1, 332, 278, 410,
+};
+
+#endif // WYN_CHECKER_BUILTINS_TABLE_H
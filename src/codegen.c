@@ -592,22 +592,163 @@ static char** str_array_var_names = NULL;
 static int str_array_var_count = 0;
 static int str_array_var_cap = 0;
 
-// Typed int array tracking - [int] arrays using WynIntArray (growable)
-static char** int_array_var_names = NULL;
-static int int_array_var_count = 0;
-static int int_array_var_cap = 0;
-void register_int_array_var(const char* name) {
-    WYN_ENSURE_CAP(int_array_var_names, int_array_var_count, int_array_var_cap);
-    int_array_var_names[int_array_var_count++] = strdup(name);
-}
-int is_int_array_var(const char* name) {
-    for (int i = 0; i < int_array_var_count; i++) {
-        if (strcmp(int_array_var_names[i], name) == 0) return 1;
+// --- Packed (unboxed) array locals -----------------------------------------
+//
+// A local array whose element type the checker knows statically is stored in a
+// monomorphic layout instead of WynArray's 16-byte tagged WynValue slots:
+//   [int]    -> WynIntArray    (long long*)
+//   [float]  -> WynFloatArray  (double*)
+//   [bool]   -> WynBoolArray   (uint8_t*)
+//   [Struct] -> WynStructArray (structs by value, no per-element heap box)
+// Sums and sorts over a contiguous long long*/double* are what the C compiler
+// can vectorize, and [int]/[float] take half the memory ([bool] a sixteenth).
+//
+// Eligibility is decided at the declaration (codegen_stmt.c STMT_VAR): the
+// initializer must be an array literal (`[]`, `[1, 2, 3]`) and the name must
+// survive the veto pre-pass below, which removes every variable used in a way
+// the packed lowerings do not cover. Uses then dispatch on the name's kind:
+// push/len/sort/sum, xs[i] reads and stores, `for x in xs`, and map/filter/
+// reduce (lowered to typed loops that produce an ordinary WynArray).
+//
+// The registry is keyed by name and is PER FUNCTION: it is reset at every
+// function entry and exit, and a later non-packed declaration of the same name
+// unregisters it. (It used to live for the whole program, so `var xs: [int]`
+// in one function turned `xs[1]` in the next function into int_array_get on a
+// WynArray - a C type error for a program the checker accepted.)
+typedef enum { PACKED_NONE = 0, PACKED_INT, PACKED_FLOAT, PACKED_BOOL, PACKED_STRUCT } PackedArrayKind;
+typedef struct { char* name; PackedArrayKind kind; char* elem_ctype; } PackedArrayVar;
+static PackedArrayVar* packed_array_vars = NULL;
+static int packed_array_var_count = 0;
+static int packed_array_var_cap = 0;
+static PackedArrayVar* find_packed_array_var(const char* name) {
+    for (int i = packed_array_var_count - 1; i >= 0; i--)
+        if (strcmp(packed_array_vars[i].name, name) == 0) return &packed_array_vars[i];
+    return NULL;
+}
+void unregister_packed_array_var(const char* name) {
+    PackedArrayVar* v = find_packed_array_var(name);
+    if (v) v->kind = PACKED_NONE;
+}
+void register_packed_array_var(const char* name, PackedArrayKind kind, const char* elem_ctype) {
+    PackedArrayVar* v = find_packed_array_var(name);
+    if (!v) {
+        WYN_ENSURE_CAP(packed_array_vars, packed_array_var_count, packed_array_var_cap);
+        v = &packed_array_vars[packed_array_var_count++];
+        v->name = strdup(name);
+        v->elem_ctype = NULL;
+    }
+    v->kind = kind;
+    free(v->elem_ctype);
+    v->elem_ctype = strdup(elem_ctype ? elem_ctype : "long long");
+}
+void reset_packed_array_vars(void) {
+    for (int i = 0; i < packed_array_var_count; i++) {
+        free(packed_array_vars[i].name);
+        free(packed_array_vars[i].elem_ctype);
+    }
+    packed_array_var_count = 0;
+}
+PackedArrayKind packed_array_kind(const char* name) {
+    PackedArrayVar* v = find_packed_array_var(name);
+    return v ? v->kind : PACKED_NONE;
+}
+// Kind of a bare-identifier array expression (PACKED_NONE for anything else).
+static PackedArrayKind packed_array_kind_of(Expr* e) {
+    if (!e || e->type != EXPR_IDENT) return PACKED_NONE;
+    char n[256]; token_to_cstr(n, sizeof(n), e->token);
+    return packed_array_kind(n);
+}
+// C element type of a packed struct array ("long long" etc. for the others).
+const char* packed_array_elem_ctype(const char* name) {
+    PackedArrayVar* v = find_packed_array_var(name);
+    return v && v->elem_ctype ? v->elem_ctype : "long long";
+}
+static const char* packed_array_c_type(PackedArrayKind k) {
+    switch (k) {
+        case PACKED_INT: return "WynIntArray";
+        case PACKED_FLOAT: return "WynFloatArray";
+        case PACKED_BOOL: return "WynBoolArray";
+        case PACKED_STRUCT: return "WynStructArray";
+        default: return "WynArray";
+    }
+}
+// Runtime-helper prefix per kind: int_array_push, float_array_len, ...
+static const char* packed_array_prefix(PackedArrayKind k) {
+    switch (k) {
+        case PACKED_INT: return "int_array";
+        case PACKED_FLOAT: return "float_array";
+        case PACKED_BOOL: return "bool_array";
+        case PACKED_STRUCT: return "struct_array";
+        default: return "array";
+    }
+}
+int is_int_array_var(const char* name) { return packed_array_kind(name) == PACKED_INT; }
+// Layout for the declaration `var name[: [T]] = [...]`, or PACKED_NONE when it
+// must stay a WynArray. Writes the element's C type to ctype for PACKED_STRUCT.
+int is_int_array_vetoed(const char* name);
+int is_spawn_array(const char* name);
+const char* codegen_c_type_from_type(Type* t);
+static PackedArrayKind packed_kind_for_decl(Stmt* stmt, char* ctype, size_t cap) {
+    Expr* init = stmt->var.init;
+    snprintf(ctype, cap, "long long");
+    // A function returning an array may return this local by name; the packed
+    // value cannot flow into the WynArray return slot.
+    if (codegen_fn_returns_array || !init || init->type != EXPR_ARRAY) return PACKED_NONE;
+    char vn[256]; token_to_cstr(vn, sizeof(vn), stmt->var.name);
+    if (is_int_array_vetoed(vn) || is_spawn_array(vn)) return PACKED_NONE;
+    PackedArrayKind k = PACKED_NONE;
+    Type* elem = (init->expr_type && init->expr_type->kind == TYPE_ARRAY)
+                 ? init->expr_type->array_type.element_type : NULL;
+    if (stmt->var.type) {
+        // The annotation is authoritative (`var xs: [float] = []` has no
+        // element for the checker to type).
+        Expr* ann = stmt->var.type;
+        if (ann->type != EXPR_ARRAY || ann->array.count != 1 ||
+            ann->array.elements[0]->type != EXPR_IDENT) return PACKED_NONE;
+        char en[128]; token_to_cstr(en, sizeof(en), ann->array.elements[0]->token);
+        extern int is_known_struct(const char*);
+        if (strcmp(en, "int") == 0) k = PACKED_INT;
+        else if (strcmp(en, "float") == 0) k = PACKED_FLOAT;
+        else if (strcmp(en, "bool") == 0) k = PACKED_BOOL;
+        else if (!current_module_prefix && is_known_struct(en)) { k = PACKED_STRUCT; snprintf(ctype, cap, "%s", en); }
+    } else if (elem && init->array.count > 0) {
+        if (elem->kind == TYPE_INT) k = PACKED_INT;
+        else if (elem->kind == TYPE_FLOAT) k = PACKED_FLOAT;
+        else if (elem->kind == TYPE_BOOL) k = PACKED_BOOL;
+        else if (elem->kind == TYPE_STRUCT && !current_module_prefix) {
+            const char* ct = codegen_c_type_from_type(elem);
+            extern int is_known_struct(const char*);
+            if (ct && is_known_struct(ct)) { k = PACKED_STRUCT; snprintf(ctype, cap, "%s", ct); }
+        }
     }
-    return 0;
+    if (k == PACKED_NONE) return PACKED_NONE;
+    // Every element must already have the element type: a mixed literal keeps
+    // WynArray's per-element tags. [float] accepts int elements (widened).
+    for (int i = 0; i < init->array.count; i++) {
+        Type* et = init->array.elements[i]->expr_type;
+        if (!et) return PACKED_NONE;
+        switch (k) {
+            case PACKED_INT: if (et->kind != TYPE_INT) return PACKED_NONE; break;
+            case PACKED_FLOAT: if (et->kind != TYPE_FLOAT && et->kind != TYPE_INT) return PACKED_NONE; break;
+            case PACKED_BOOL: if (et->kind != TYPE_BOOL) return PACKED_NONE; break;
+            case PACKED_STRUCT: {
+                if (et->kind != TYPE_STRUCT) return PACKED_NONE;
+                const char* ct = codegen_c_type_from_type(et);
+                if (!ct || strcmp(ct, ctype) != 0) return PACKED_NONE;
+                break;
+            }
+            default: return PACKED_NONE;
+        }
+    }
+    return k;
 }
+// Set while a packed declaration's array-literal initializer is emitted, so
+// EXPR_ARRAY builds the matching layout (the int kind keeps using the older
+// codegen_emit_int_array flag, which spawn-handle arrays share).
+static PackedArrayKind codegen_emit_packed_kind = PACKED_NONE;
+static const char* codegen_emit_packed_ctype = NULL;
 
-// --- WynIntArray opt-in safety ("int-array veto") -------------------------
+// --- Packed-array opt-in safety ("int-array veto") -------------------------
 //
 // `var xs: [int] = ...` opts the variable into the packed WynIntArray
 // representation (long long*), which is ~2x faster than the generic WynArray
@@ -637,6 +778,9 @@ int is_int_array_var(const char* name) {
 // optimization was built for, and every other shape becomes correct instead of
 // broken. The veto is keyed on the variable NAME because that is the key
 // is_int_array_var() dispatch already uses.
+//
+// The same veto guards every packed layout (float/bool/struct too, see the
+// packed-array block above); the kind-aware whitelist is in codegen_lambda.c.
 static char** int_array_veto_names = NULL;
 static int int_array_veto_count = 0;
 static int int_array_veto_cap = 0;
@@ -726,10 +870,14 @@ void register_string_var(const char* name) {
     string_var_names[string_var_count++] = strdup(name);
 }
 
-// Array scope tracking - parallel to string scope (growable)
+// Array scope tracking - parallel to string scope (growable). Each entry
+// carries the release function for its layout: array_free for WynArray,
+// int_array_free / float_array_free / ... for packed locals.
 static char** array_scope_names = NULL;
+static const char** array_scope_free_fns = NULL;
 static int array_scope_count = 0;
 static int array_scope_cap = 0;
+static int array_scope_free_cap = 0;
 static int* array_scope_stack = NULL;
 static int array_scope_top = 0;
 static int array_scope_stack_cap = 0;
@@ -745,16 +893,19 @@ void pop_array_scope_and_release(void) {
     FILE* out = codegen_get_output();
     if (out) {
         for (int i = saved; i < array_scope_count; i++)
-            fprintf(out, "array_free(&%s); ", array_scope_names[i]);
+            fprintf(out, "%s(&%s); ", array_scope_free_fns[i], array_scope_names[i]);
     }
     array_scope_count = saved;
 }
-void register_array_scope_var(const char* name) {
+void register_array_scope_var_with(const char* name, const char* free_fn) {
     for (int i = 0; i < array_scope_count; i++)
         if (strcmp(array_scope_names[i], name) == 0) return;
     WYN_ENSURE_CAP(array_scope_names, array_scope_count, array_scope_cap);
+    WYN_ENSURE_CAP(array_scope_free_fns, array_scope_count, array_scope_free_cap);
+    array_scope_free_fns[array_scope_count] = free_fn;
     array_scope_names[array_scope_count++] = strdup(name);
 }
+void register_array_scope_var(const char* name) { register_array_scope_var_with(name, "array_free"); }
 void reset_array_scope(void) { array_scope_count = 0; array_scope_top = 0; }
 
 // HashMap scope tracking (growable)
@@ -943,13 +1094,23 @@ int get_string_var_count(void) { return string_var_releasable_count; }
 // at the return. Fresh string locals (produced by concat/interp/alloc) are
 // already +1 and must NOT be retained. We track the borrowed set explicitly so
 // the return classifier can tell a borrow apart from a fresh owner.
+//
+// The borrow also matters when the local is reassigned: `var out = s` took no
+// reference, so releasing the old value on `out = out + "."` would drop the
+// caller's reference to s. Each borrowed local records the parameter it
+// ultimately aliases (its origin) and the assignment skips the release while
+// the local still points at it.
 static char** borrowed_string_locals = NULL;
+static char** borrowed_string_origins = NULL;
 static int borrowed_string_local_count = 0;
 static int borrowed_string_local_cap = 0;
-void register_borrowed_string_local(const char* name) {
+static int borrowed_string_origin_cap = 0;
+void register_borrowed_string_local(const char* name, const char* origin) {
     for (int i = 0; i < borrowed_string_local_count; i++)
         if (strcmp(borrowed_string_locals[i], name) == 0) return;
+    WYN_ENSURE_CAP(borrowed_string_origins, borrowed_string_local_count, borrowed_string_origin_cap);
     WYN_ENSURE_CAP(borrowed_string_locals, borrowed_string_local_count, borrowed_string_local_cap);
+    borrowed_string_origins[borrowed_string_local_count] = strdup(origin);
     borrowed_string_locals[borrowed_string_local_count++] = strdup(name);
 }
 int is_borrowed_string_local(const char* name) {
@@ -957,8 +1118,17 @@ int is_borrowed_string_local(const char* name) {
         if (strcmp(borrowed_string_locals[i], name) == 0) return 1;
     return 0;
 }
+// The parameter a borrowed local aliases, or NULL if `name` is not borrowed.
+const char* borrowed_string_origin(const char* name) {
+    for (int i = 0; i < borrowed_string_local_count; i++)
+        if (strcmp(borrowed_string_locals[i], name) == 0) return borrowed_string_origins[i];
+    return NULL;
+}
 void reset_borrowed_string_locals(void) {
-    for (int i = 0; i < borrowed_string_local_count; i++) free(borrowed_string_locals[i]);
+    for (int i = 0; i < borrowed_string_local_count; i++) {
+        free(borrowed_string_locals[i]);
+        free(borrowed_string_origins[i]);
+    }
     borrowed_string_local_count = 0;
 }
 
@@ -1733,6 +1903,10 @@ const char* codegen_c_type_from_type(Type* t);
 void codegen_expr(Expr* expr);
 #include "codegen_gpu.c"
 
+// Iterator fusion: map/filter/take chains ending in sum/reduce/any/all or an
+// array compile to one loop (codegen_expr.c's EXPR_METHOD_CALL asks first).
+#include "codegen_fusion.c"
+
 // Expression code generation
 #include "codegen_expr.c"
 
@@ -1797,6 +1971,13 @@ void push_defer(Expr* e) {
 int get_defer_count() { return defer_count; }
 Expr* get_defer(int i) { return defer_stack[i]; }
 void reset_defers() { defer_count = 0; }
+// A Db.transaction block's closing call is on the stack only while the block
+// is being emitted: a `return` inside runs it, the end of the function must not.
+void remove_defer_at(int i) {
+    if (i < 0 || i >= defer_count) return;
+    memmove(&defer_stack[i], &defer_stack[i + 1], (size_t)(defer_count - i - 1) * sizeof(Expr*));
+    defer_count--;
+}
 
 // Enum name tracking for constructor detection (growable)
 static char** enum_type_names = NULL;
@@ -0,0 +1,313 @@
+// codegen_escape.c - escape analysis for string values.
+// Included from codegen.c before codegen_expr.c - shares all statics (emit,
+// is_string_var, is_parameter, the string scope lists).
+//
+// Every string temporary was a heap block with its own retain/release, even
+// when it died inside the expression that made it: `line.trim().len()` went
+// through the slab, wrote an RC header, and released the block one call later.
+// String locals bound from a pointer they do not own (an array element, a
+// struct field, a for-in element, a parameter) were worse: the binding took no
+// reference, yet the block still released them at scope exit - an
+// over-release of the array's or the caller's reference.
+//
+// This file proves two things over the checked AST:
+//
+//  1. A string local bound from a borrowed pointer that the rest of its block
+//     only READS - method receiver or argument of a builtin string method,
+//     operand of a comparison or `+`, interpolation piece, println argument -
+//     never needs a reference: the binding's retain and the scope-exit release
+//     are both dropped (register_unowned_string_var). A local that may escape
+//     - returned, stored, pushed, passed to a user function, captured by a
+//     lambda, reassigned, aliased by another local - is retained where it is
+//     bound, so the release it already gets is balanced.
+//
+//  2. A string temporary in a method chain whose result is a scalar observed
+//     by a builtin (`s.upper().contains("X")`, `a.trim().lower().len()`) is
+//     allocated in the thread's scratch region (wyn_rc_region_enter/leave in
+//     wyn_rc.c) and dropped wholesale when the expression ends: a bump
+//     allocation, no slab or malloc traffic, and retain/release on the block
+//     are no-ops. Only builtin producers (upper, lower, trim, substring,
+//     slice, replace, repeat, `+`, interpolation) over call-free arguments
+//     qualify, so nothing else can allocate while the region is open and keep
+//     the result.
+//
+// Anything the walkers do not recognise counts as an escape.
+// `wyn build --emit-stats` reports both counts.
+
+static int escape_rc_elided = 0;     // string locals bound with no reference
+static int escape_temps_scoped = 0;  // chain temporaries placed in the region
+static int escape_region_depth = 0;  // > 0 while emitting inside a region
+void codegen_escape_stats(int* rc_elided, int* temps_scoped) {
+    *rc_elided = escape_rc_elided;
+    *temps_scoped = escape_temps_scoped;
+}
+
+// Builtin string methods that read their receiver and arguments without
+// keeping them, split by what they return.
+static const char* const escape_observers[] = {
+    "len", "contains", "starts_with", "ends_with", "index_of", "last_index_of",
+    "is_empty", "to_int", "to_float", NULL
+};
+static const char* const escape_producers[] = {
+    "upper", "lower", "trim", "substring", "slice", "replace", "repeat", NULL
+};
+
+static bool escape_tok_is(Token t, const char* s) {
+    int n = (int)strlen(s);
+    return t.length == n && memcmp(t.start, s, n) == 0;
+}
+
+static bool escape_tok_in(Token t, const char* const* list) {
+    for (; *list; list++)
+        if (escape_tok_is(t, *list)) return true;
+    return false;
+}
+
+static bool escape_is_string(Expr* e) {
+    return e && e->expr_type && e->expr_type->kind == TYPE_STRING;
+}
+
+// A builtin string method call: the receiver is typed string and the method
+// is one of the lists above.
+static bool escape_builtin_string_call(Expr* e) {
+    return e->type == EXPR_METHOD_CALL && escape_is_string(e->method_call.object) &&
+           (escape_tok_in(e->method_call.method, escape_observers) ||
+            escape_tok_in(e->method_call.method, escape_producers));
+}
+
+// --- 1. Borrowed string locals ----------------------------------------------
+
+static bool escape_expr(Expr* e, const char* name);
+
+// e sits where its value is only read: a bare use of the local is fine.
+static bool escape_read(Expr* e, const char* name) {
+    if (e && e->type == EXPR_IDENT) return false;
+    return escape_expr(e, name);
+}
+
+// May `name` outlive, be stored by, or be rebound within e?
+static bool escape_expr(Expr* e, const char* name) {
+    if (!e) return false;
+    switch (e->type) {
+        case EXPR_INT: case EXPR_FLOAT: case EXPR_STRING: case EXPR_CHAR:
+        case EXPR_BOOL: case EXPR_NONE:
+            return false;
+        case EXPR_IDENT:
+            // A bare use whose consumer is not known to only read it.
+            return escape_tok_is(e->token, name);
+        case EXPR_BINARY: {
+            WynTokenType op = e->binary.op.type;
+            if (op == TOKEN_PLUS || op == TOKEN_EQEQ || op == TOKEN_BANGEQ ||
+                op == TOKEN_LT || op == TOKEN_GT || op == TOKEN_LTEQ || op == TOKEN_GTEQ)
+                return escape_read(e->binary.left, name) || escape_read(e->binary.right, name);
+            return escape_expr(e->binary.left, name) || escape_expr(e->binary.right, name);
+        }
+        case EXPR_UNARY:
+            return escape_expr(e->unary.operand, name);
+        case EXPR_STRING_INTERP:
+            for (int i = 0; i < e->string_interp.count; i++)
+                if (escape_read(e->string_interp.expressions[i], name)) return true;
+            return false;
+        case EXPR_METHOD_CALL: {
+            bool reads = escape_builtin_string_call(e);
+            if (reads ? escape_read(e->method_call.object, name)
+                      : escape_expr(e->method_call.object, name)) return true;
+            for (int i = 0; i < e->method_call.arg_count; i++)
+                if (reads ? escape_read(e->method_call.args[i], name)
+                          : escape_expr(e->method_call.args[i], name)) return true;
+            return false;
+        }
+        case EXPR_CALL: {
+            Expr* callee = e->call.callee;
+            bool prints = callee->type == EXPR_IDENT &&
+                (escape_tok_is(callee->token, "println") || escape_tok_is(callee->token, "print"));
+            if (escape_expr(callee, name)) return true;
+            for (int i = 0; i < e->call.arg_count; i++)
+                if (prints ? escape_read(e->call.args[i], name)
+                           : escape_expr(e->call.args[i], name)) return true;
+            return false;
+        }
+        case EXPR_INDEX:
+            return escape_expr(e->index.array, name) || escape_expr(e->index.index, name);
+        case EXPR_FIELD_ACCESS:
+            return escape_expr(e->field_access.object, name);
+        case EXPR_ASSIGN:
+            if (escape_tok_is(e->assign.name, name)) return true;
+            return escape_expr(e->assign.value, name);
+        case EXPR_TERNARY:
+            return escape_expr(e->ternary.condition, name) ||
+                   escape_expr(e->ternary.then_expr, name) ||
+                   escape_expr(e->ternary.else_expr, name);
+        case EXPR_ARRAY:
+            for (int i = 0; i < e->array.count; i++)
+                if (escape_expr(e->array.elements[i], name)) return true;
+            return false;
+        case EXPR_STRUCT_INIT:
+            for (int i = 0; i < e->struct_init.field_count; i++)
+                if (escape_expr(e->struct_init.field_values[i], name)) return true;
+            return false;
+        default:
+            return true;
+    }
+}
+
+static bool escape_stmt(Stmt* s, const char* name) {
+    if (!s) return false;
+    switch (s->type) {
+        case STMT_EXPR:
+            return escape_expr(s->expr, name);
+        case STMT_VAR:
+            // A shadowing declaration would make later uses ambiguous.
+            if (escape_tok_is(s->var.name, name)) return true;
+            return escape_expr(s->var.init, name);
+        case STMT_RETURN:
+            return escape_expr(s->ret.value, name);
+        case STMT_IF:
+            return escape_expr(s->if_stmt.condition, name) ||
+                   escape_stmt(s->if_stmt.then_branch, name) ||
+                   escape_stmt(s->if_stmt.else_branch, name);
+        case STMT_WHILE:
+            return escape_expr(s->while_stmt.condition, name) ||
+                   escape_stmt(s->while_stmt.body, name);
+        case STMT_FOR:
+            return escape_stmt(s->for_stmt.init, name) ||
+                   escape_expr(s->for_stmt.condition, name) ||
+                   escape_expr(s->for_stmt.increment, name) ||
+                   escape_expr(s->for_stmt.array_expr, name) ||
+                   escape_stmt(s->for_stmt.body, name);
+        case STMT_BLOCK:
+            for (int i = 0; i < s->block.count; i++)
+                if (escape_stmt(s->block.stmts[i], name)) return true;
+            return false;
+        case STMT_BREAK: case STMT_CONTINUE:
+            return false;
+        default:
+            return true;
+    }
+}
+
+// Does the string local `name`, declared by stmts[idx], escape the rest of
+// its block?
+static bool escape_local_escapes(Stmt** stmts, int count, int idx, const char* name) {
+    if (!stmts) return true;
+    for (int i = idx + 1; i < count; i++)
+        if (escape_stmt(stmts[i], name)) return true;
+    return false;
+}
+
+// `var x = init` with a string init that hands over a pointer x does not own:
+// an array element (array_get_str), a struct field, or a string identifier
+// that is not an owning local (for-in element, parameter, alias of one).
+static bool escape_init_is_borrow(Expr* init) {
+    if (!init) return false;
+    switch (init->type) {
+        case EXPR_INDEX:
+            return init->index.array->expr_type && init->index.array->expr_type->kind == TYPE_ARRAY;
+        case EXPR_FIELD_ACCESS:
+            return !init->field_access.is_enum_access && init->field_access.object->expr_type &&
+                   init->field_access.object->expr_type->kind == TYPE_STRUCT;
+        case EXPR_IDENT: {
+            char nm[256]; token_to_cstr(nm, sizeof nm, init->token);
+            return !is_string_var(nm);
+        }
+        default:
+            return false;
+    }
+}
+
+// Called for each string `var` right after its declaration is emitted. A
+// borrowed binding that does not escape becomes unowned (no release at scope
+// exit); one that escapes takes the reference the release expects. Aliases of
+// a parameter that escape keep their return-time retain (bug #32) instead.
+static void escape_bind_string_local(Stmt* stmt, const char* cname) {
+    Expr* init = stmt->var.init;
+    if (!escape_init_is_borrow(init)) return;
+    char vn[256]; token_to_cstr(vn, sizeof vn, stmt->var.name);
+    extern Stmt** current_block_stmts; extern int current_block_count; extern int current_stmt_idx;
+    if (!escape_local_escapes(current_block_stmts, current_block_count, current_stmt_idx, vn)) {
+        register_unowned_string_var(vn);
+        escape_rc_elided++;
+        return;
+    }
+    if (init->type == EXPR_IDENT) {
+        char src[256]; token_to_cstr(src, sizeof src, init->token);
+        if (is_parameter(src) || is_borrowed_string_local(src)) return;
+    }
+    emit("wyn_rc_retain(%s);\n", cname);
+}
+
+// --- 2. Region-scoped chain temporaries ----------------------------------------
+
+static bool escape_region_operand(Expr* e);
+
+// A string operand of a region chain: a value that already exists (literal,
+// local, field), or one the region produces - a builtin producer call, `+`
+// or an interpolation over region operands. Counts the produced temporaries.
+static bool escape_region_string(Expr* e, int* temps) {
+    if (!e) return false;
+    switch (e->type) {
+        case EXPR_STRING: case EXPR_IDENT:
+            return true;
+        case EXPR_FIELD_ACCESS:
+            return escape_region_operand(e->field_access.object);
+        case EXPR_METHOD_CALL:
+            if (!escape_is_string(e) || !escape_tok_in(e->method_call.method, escape_producers) ||
+                !escape_is_string(e->method_call.object)) return false;
+            for (int i = 0; i < e->method_call.arg_count; i++)
+                if (!escape_region_operand(e->method_call.args[i])) return false;
+            (*temps)++;
+            return escape_region_string(e->method_call.object, temps);
+        case EXPR_BINARY:
+            if (!escape_is_string(e) || e->binary.op.type != TOKEN_PLUS) return false;
+            (*temps)++;
+            return escape_region_string(e->binary.left, temps) &&
+                   escape_region_string(e->binary.right, temps);
+        case EXPR_STRING_INTERP:
+            for (int i = 0; i < e->string_interp.count; i++) {
+                Expr* p = e->string_interp.expressions[i];
+                if (!p || !p->expr_type) return false;
+                TypeKind k = p->expr_type->kind;
+                if (k != TYPE_STRING && k != TYPE_INT && k != TYPE_FLOAT && k != TYPE_BOOL) return false;
+                if (!escape_region_operand(p)) return false;
+            }
+            (*temps)++;
+            return true;
+        default:
+            return false;
+    }
+}
+
+// An argument that allocates nothing that could outlive the region: literals,
+// locals, field reads, arithmetic on them, or a region-produced string.
+static bool escape_region_operand(Expr* e) {
+    if (!e) return false;
+    if (escape_is_string(e)) { int t = 0; return escape_region_string(e, &t); }
+    switch (e->type) {
+        case EXPR_INT: case EXPR_FLOAT: case EXPR_CHAR: case EXPR_BOOL: case EXPR_IDENT:
+            return true;
+        case EXPR_FIELD_ACCESS:
+            return escape_region_operand(e->field_access.object);
+        case EXPR_UNARY:
+            return escape_region_operand(e->unary.operand);
+        case EXPR_BINARY:
+            return escape_region_operand(e->binary.left) && escape_region_operand(e->binary.right);
+        default:
+            return false;
+    }
+}
+
+// Can the string receiver chain of `call` live in the region? call must be a
+// builtin observer (scalar result) whose arguments allocate nothing lasting,
+// on a receiver the region produces. Returns the number of temporaries the
+// region takes, 0 when ineligible (or already inside a region).
+static int escape_scoped_chain(Expr* call) {
+    if (escape_region_depth > 0 || call->type != EXPR_METHOD_CALL) return 0;
+    if (!escape_tok_in(call->method_call.method, escape_observers)) return 0;
+    if (!call->expr_type || call->expr_type->kind == TYPE_STRING) return 0;
+    if (!escape_is_string(call->method_call.object)) return 0;
+    for (int i = 0; i < call->method_call.arg_count; i++)
+        if (!escape_region_operand(call->method_call.args[i])) return 0;
+    int temps = 0;
+    if (!escape_region_string(call->method_call.object, &temps)) return 0;
+    return temps;
+}
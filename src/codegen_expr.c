@@ -52,6 +52,15 @@ static const char* hashmap_insert_fn_for(Expr* value_expr) {
     return "hashmap_insert_int";
 }
 
+// HashSet keys are specialized per set (raw 64-bit ints vs arena strings, see
+// src/hashset.c): an int/bool element goes to the _int entry points, anything
+// else to the string ones. Before this, `s.add(5)` passed 5 as a const char*.
+static bool hashset_elem_is_int(Expr* e) {
+    if (!e) return false;
+    if (e->type == EXPR_INT || e->type == EXPR_BOOL) return true;
+    return e->expr_type && (e->expr_type->kind == TYPE_INT || e->expr_type->kind == TYPE_BOOL);
+}
+
 // A string pushed into an array transfers ownership: array_push_str stores the
 // pointer without retaining, and array_free releases it. So a local string var
 // pushed into an array must NOT also be released at scope exit - that would
@@ -140,6 +149,175 @@ static const char* wyn_option_ctor_kind(Expr* e, const char* kind) {
     return wyn_ctor_family(e->option.value ? e->option.value->expr_type : NULL, kind);
 }
 
+bool bce_index_unchecked(Expr* array, Expr* index);
+
+// C element type / element read for a packed receiver bound to `__src`.
+static const char* packed_elem_c(PackedArrayKind k, Expr* obj) {
+    switch (k) {
+        case PACKED_FLOAT: return "double";
+        case PACKED_BOOL: return "bool";
+        case PACKED_STRUCT: {
+            char n[256]; token_to_cstr(n, sizeof(n), obj->token);
+            return packed_array_elem_ctype(n);
+        }
+        default: return "long long";
+    }
+}
+static void emit_packed_elem_read(PackedArrayKind k, const char* ect) {
+    if (k == PACKED_STRUCT) emit("((%s*)__src.data)[__i]", ect);
+    else if (k == PACKED_BOOL) emit("(bool)__src.data[__i]");
+    else emit("__src.data[__i]");
+}
+// Boxed push matching a value's Type (the WynArray that map/filter produce).
+static void emit_boxed_push_for(Type* t, const char* ect, const char* val) {
+    if (t && t->kind == TYPE_STRUCT) {
+        const char* rc = codegen_c_type_from_type(t);
+        emit("array_push_struct(&__dst, %s, %s); ", val, rc ? rc : ect);
+    } else if (t && t->kind == TYPE_STRING) {
+        emit("{ const char* __m = %s; array_push_str(&__dst, __m ? wyn_strdup(__m) : wyn_strdup(\"\")); } ", val);
+    } else if (t && t->kind == TYPE_FLOAT) {
+        emit("array_push_float(&__dst, %s); ", val);
+    } else if (t && t->kind == TYPE_BOOL) {
+        emit("array_push_bool(&__dst, %s); ", val);
+    } else {
+        emit("array_push_int(&__dst, %s); ", val);
+    }
+}
+// C type of parameter i / the return of a function-typed argument, falling
+// back to `dflt` when the checker left it open.
+static const char* packed_fn_c_type(Expr* fn, int param, const char* dflt) {
+    Type* ft = fn ? fn->expr_type : NULL;
+    if (!ft || ft->kind != TYPE_FUNCTION) return dflt;
+    Type* t = param < 0 ? ft->fn_type.return_type
+            : (param < ft->fn_type.param_count ? ft->fn_type.param_types[param] : NULL);
+    const char* c = t ? codegen_c_type_from_type(t) : NULL;
+    return c ? c : dflt;
+}
+
+// Lower a method call on a packed array local. Returns false (nothing
+// emitted) for a method without a packed lowering - the veto pre-pass keeps
+// those receivers boxed, so that only happens for names it could not see.
+static bool codegen_packed_method(Expr* expr, PackedArrayKind k) {
+    Expr* obj = expr->method_call.object;
+    Token m = expr->method_call.method;
+    int argc = expr->method_call.arg_count;
+    const char* pre = packed_array_prefix(k);
+    const char* arr_t = packed_array_c_type(k);
+    char ect[128]; snprintf(ect, sizeof(ect), "%s", packed_elem_c(k, obj));
+#define PM_IS(lit) (m.length == (int)sizeof(lit) - 1 && memcmp(m.start, lit, sizeof(lit) - 1) == 0)
+    if (PM_IS("push") && argc == 1) {
+        if (k == PACKED_STRUCT) {
+            emit("struct_array_push(&("); codegen_expr(obj); emit("), ");
+            codegen_expr(expr->method_call.args[0]); emit(", %s)", ect);
+        } else {
+            emit("%s_push(&(", pre); codegen_expr(obj);
+            emit("), (%s)(", k == PACKED_FLOAT ? "double" : k == PACKED_BOOL ? "int" : "long long");
+            codegen_expr(expr->method_call.args[0]); emit("))");
+        }
+        return true;
+    }
+    if (PM_IS("len") && argc == 0) {
+        emit("%s_len(", pre); codegen_expr(obj); emit(")");
+        return true;
+    }
+    if (PM_IS("sort") && argc == 0 && (k == PACKED_INT || k == PACKED_FLOAT)) {
+        // sort in place AND yield the array (usable as an expression)
+        emit("({ %s_sort(&(", pre); codegen_expr(obj);
+        emit(")); "); codegen_expr(obj); emit("; })");
+        return true;
+    }
+    if (PM_IS("sum") && argc == 0 && (k == PACKED_INT || k == PACKED_FLOAT)) {
+        emit("%s_sum(", pre); codegen_expr(obj); emit(")");
+        return true;
+    }
+    if ((PM_IS("map") || PM_IS("filter")) && argc == 1) {
+        Expr* fn = expr->method_call.args[0];
+        bool is_map = PM_IS("map");
+        const char* rc = packed_fn_c_type(fn, -1, is_map ? ect : "bool");
+        const char* pc = packed_fn_c_type(fn, 0, ect);
+        emit("({ %s __src = ", arr_t); codegen_expr(obj);
+        emit("; %s (*__fn)(%s) = ", rc, pc); codegen_expr(fn);
+        emit("; WynArray __dst = array_new(); for (int __i = 0; __i < __src.count; __i++) { %s __v = ", ect);
+        emit_packed_elem_read(k, ect);
+        emit("; ");
+        if (is_map) {
+            Type* rt = (fn->expr_type && fn->expr_type->kind == TYPE_FUNCTION) ? fn->expr_type->fn_type.return_type : NULL;
+            if (!rt) rt = (obj->expr_type && obj->expr_type->kind == TYPE_ARRAY) ? obj->expr_type->array_type.element_type : NULL;
+            emit_boxed_push_for(rt, ect, "__fn(__v)");
+        } else {
+            emit("if (__fn(__v)) ");
+            emit_boxed_push_for((obj->expr_type && obj->expr_type->kind == TYPE_ARRAY)
+                                ? obj->expr_type->array_type.element_type : NULL, ect, "__v");
+        }
+        emit("} __dst; })");
+        return true;
+    }
+    if (PM_IS("reduce") && argc == 2) {
+        // reduce(fn, init); reduce(init, fn) is accepted too (see the boxed path).
+        Expr* fn = expr->method_call.args[0];
+        Expr* init = expr->method_call.args[1];
+        if (fn->type != EXPR_LAMBDA && init->type == EXPR_LAMBDA) { Expr* t = fn; fn = init; init = t; }
+        const char* rc = packed_fn_c_type(fn, -1, ect);
+        const char* ac = packed_fn_c_type(fn, 0, rc);
+        const char* pc = packed_fn_c_type(fn, 1, ect);
+        emit("({ %s __src = ", arr_t); codegen_expr(obj);
+        emit("; %s (*__fn)(%s, %s) = ", rc, ac, pc); codegen_expr(fn);
+        emit("; %s __acc = (", rc); codegen_expr(init);
+        emit("); for (int __i = 0; __i < __src.count; __i++) __acc = __fn(__acc, ");
+        emit_packed_elem_read(k, ect);
+        emit("); __acc; })");
+        return true;
+    }
+#undef PM_IS
+    return false;
+}
+
+// A literal run of an interpolated string as C string-literal text. The parser
+// keeps real newlines and Wyn escapes; C escapes pass through unchanged.
+static void emit_interp_literal(const char* part) {
+    while (*part) {
+        if (*part == '\n') emit("\\n");
+        else if (*part == '\\' && *(part+1) == '"') { emit("\\\""); part++; }
+        // `\$` is an escaped dollar (from a literal `\${...}`);
+        // emit a bare `$` (not a C escape sequence).
+        else if (*part == '\\' && *(part+1) == '$') { emit("$"); part++; }
+        else if (*part == '"') emit("\\\"");
+        else emit("%c", *part);
+        part++;
+    }
+}
+
+// `s = s + a + b` (and `s += a`, which the parser desugars to the same tree):
+// collect the appended pieces a, b left to right into out[]. Returns the piece
+// count, or 0 when the assignment must stay an ordinary concat - the leftmost
+// operand is not the target itself, a node is not a string `+`, a piece is
+// neither a string nor an int, or a piece mentions the target (it would read
+// the very buffer being appended to).
+#define STR_APPEND_MAX_PIECES 16
+static int string_append_pieces(Expr* rhs, Token target, Expr** out) {
+    Expr* rev[STR_APPEND_MAX_PIECES];
+    int n = 0;
+    Expr* e = rhs;
+    while (e->type == EXPR_BINARY && e->binary.op.type == TOKEN_PLUS) {
+        if (!e->expr_type || e->expr_type->kind != TYPE_STRING) return 0;
+        if (n == STR_APPEND_MAX_PIECES) return 0;
+        rev[n++] = e->binary.right;
+        e = e->binary.left;
+    }
+    if (n == 0 || e->type != EXPR_IDENT || e->token.length != target.length ||
+        memcmp(e->token.start, target.start, target.length) != 0) return 0;
+    char tname[256]; token_to_cstr(tname, sizeof tname, target);
+    for (int i = 0; i < n; i++) {
+        Expr* p = rev[n - 1 - i];
+        bool is_str = p->type == EXPR_STRING || (p->expr_type && p->expr_type->kind == TYPE_STRING);
+        bool is_int = p->expr_type && p->expr_type->kind == TYPE_INT;
+        if (!is_str && !is_int) return 0;
+        if (expr_references_var(p, tname)) return 0;
+        out[i] = p;
+    }
+    return n;
+}
+
 void codegen_expr(Expr* expr) {
     if (!expr) return;
     // If this expr was pre-evaluated to a temp, emit the temp name
@@ -636,7 +814,8 @@ void codegen_expr(Expr* expr) {
                 if (ct && ct->kind == TYPE_MAP) {
                     emit("hashmap_has("); codegen_expr(cont); emit(", "); codegen_expr(elem); emit(")");
                 } else if (ct && ct->kind == TYPE_SET) {
-                    emit("hashset_contains("); codegen_expr(cont); emit(", "); codegen_expr(elem); emit(")");
+                    emit(hashset_elem_is_int(elem) ? "hashset_contains_int(" : "hashset_contains(");
+                    codegen_expr(cont); emit(", "); codegen_expr(elem); emit(")");
                 } else if (ct && ct->kind == TYPE_STRING) {
                     emit("wyn_string_contains("); codegen_expr(cont); emit(", "); codegen_expr(elem); emit(")");
                 } else {
@@ -2057,6 +2236,20 @@ void codegen_expr(Expr* expr) {
                         emit("({ union { double _d; long long _i; } _u; _u._d = ");
                         codegen_expr(_sv);
                         emit("; _u._i; })");
+                    } else if (_sv && ((_ch_elem && _ch_elem->kind == TYPE_STRING) ||
+                                       (_sv->expr_type && _sv->expr_type->kind == TYPE_STRING))) {
+                        // The receiver is another coroutine, likely on another
+                        // thread: promote the string to the shared RC count.
+                        // The queued message owns a reference - a fresh value
+                        // hands over its own, a variable is retained - so the
+                        // sender reassigning (or appending to) it afterwards
+                        // cannot free or rewrite what the receiver will read.
+                        bool _sv_fresh = _sv->type == EXPR_BINARY || _sv->type == EXPR_CALL ||
+                                         _sv->type == EXPR_METHOD_CALL || _sv->type == EXPR_STRING_INTERP;
+                        emit("({ const char* __cs = ");
+                        codegen_expr(_sv);
+                        emit(_sv_fresh ? "; " : "; wyn_rc_retain(__cs); ");
+                        emit("(long long)(intptr_t)wyn_rc_share(__cs); })");
                     } else if (_sv) {
                         emit("(long long)(intptr_t)(");
                         codegen_expr(_sv);
@@ -2089,6 +2282,13 @@ void codegen_expr(Expr* expr) {
                 }
             }
 
+            // Scalar array pipelines (map/filter/take ... sum/reduce/any/all)
+            // fuse into a single loop with the lambda bodies spliced in - see
+            // codegen_fusion.c. Ineligible chains emit nothing and go on below.
+            if (expr->method_call.object->expr_type &&
+                expr->method_call.object->expr_type->kind == TYPE_ARRAY &&
+                fusion_try_emit(expr)) break;
+
             // Release intermediate string temps from chained method calls
             // e.g. "hello".upper().trim() - upper() result leaked without this
             Expr* _mc_obj = expr->method_call.object;
@@ -2449,25 +2649,14 @@ void codegen_expr(Expr* expr) {
                 }
             }
             
-            // WynIntArray dispatch - typed [int] arrays
-            if (expr->method_call.object->type == EXPR_IDENT) {
-                char _ian[128]; token_to_cstr(_ian, sizeof(_ian), expr->method_call.object->token);
-                extern int is_int_array_var(const char*);
-                if (is_int_array_var(_ian)) {
-                    Token m = expr->method_call.method;
-                    if (m.length == 4 && memcmp(m.start, "push", 4) == 0) {
-                        emit("int_array_push(&("); codegen_expr(expr->method_call.object); emit("), ");
-                        codegen_expr(expr->method_call.args[0]); emit(")"); break;
-                    }
-                    if (m.length == 4 && memcmp(m.start, "sort", 4) == 0) {
-                        // sort in place AND yield the array (usable as an expression)
-                        emit("({ int_array_sort(&("); codegen_expr(expr->method_call.object);
-                        emit(")); "); codegen_expr(expr->method_call.object); emit("; })"); break;
-                    }
-                    if (m.length == 3 && memcmp(m.start, "len", 3) == 0) {
-                        emit("int_array_len("); codegen_expr(expr->method_call.object); emit(")"); break;
-                    }
-                }
+            // Packed-array dispatch - [int]/[float]/[bool]/[Struct] locals in a
+            // monomorphic layout (codegen.c packed-array block). Only the
+            // methods the veto pre-pass whitelists (codegen_lambda.c) can reach
+            // here with a packed receiver; map/filter/reduce become typed loops
+            // over the raw buffer that yield an ordinary WynArray / scalar.
+            {
+                PackedArrayKind _pk = packed_array_kind_of(expr->method_call.object);
+                if (_pk != PACKED_NONE && codegen_packed_method(expr, _pk)) break;
             }
 
             // Type-aware method dispatch (Phase 4)
@@ -3387,6 +3576,26 @@ void codegen_expr(Expr* expr) {
             } else {
             }
             
+            // set.add/insert/contains/remove: pick the int or string entry point
+            // from the element's type, the same way map.set() picks its insert.
+            if (receiver_type && strcmp(receiver_type, "set") == 0 &&
+                expr->method_call.arg_count == 1 &&
+                hashset_elem_is_int(expr->method_call.args[0])) {
+                char method_name[64]; token_to_cstr(method_name, sizeof(method_name), method);
+                const char* _setfn = NULL;
+                if (strcmp(method_name, "add") == 0 || strcmp(method_name, "insert") == 0) _setfn = "hashset_add_int";
+                else if (strcmp(method_name, "contains") == 0) _setfn = "hashset_contains_int";
+                else if (strcmp(method_name, "remove") == 0) _setfn = "hashset_remove_int";
+                if (_setfn) {
+                    emit("%s(", _setfn);
+                    codegen_expr(expr->method_call.object);
+                    emit(", ");
+                    codegen_expr(expr->method_call.args[0]);
+                    emit(")");
+                    break;
+                }
+            }
+
             // Special handling for map.set() - need to determine insert function from value type
             if (receiver_type && strcmp(receiver_type, "map") == 0) {
                 char method_name[256]; token_to_cstr(method_name, sizeof(method_name), method);
@@ -3864,6 +4073,29 @@ void codegen_expr(Expr* expr) {
                 emit("__arr_%d; })", arr_id);
                 break;
             }
+            if (codegen_emit_packed_kind != PACKED_NONE) {
+                // Packed [float]/[bool]/[Struct] declaration (see codegen.c's
+                // packed-array block); [int] takes the WynIntArray path above.
+                PackedArrayKind _pk = codegen_emit_packed_kind;
+                const char* _pct = codegen_emit_packed_ctype ? codegen_emit_packed_ctype : "long long";
+                codegen_emit_packed_kind = PACKED_NONE;   // not for nested literals
+                emit("({ %s __arr_%d = %s_new(); ", packed_array_c_type(_pk), arr_id, packed_array_prefix(_pk));
+                for (int i = 0; i < expr->array.count; i++) {
+                    if (_pk == PACKED_STRUCT) {
+                        emit("struct_array_push(&__arr_%d, ", arr_id);
+                        codegen_expr(expr->array.elements[i]);
+                        emit(", %s); ", _pct);
+                    } else {
+                        emit("%s_push(&__arr_%d, (%s)(", packed_array_prefix(_pk), arr_id,
+                             _pk == PACKED_FLOAT ? "double" : "int");
+                        codegen_expr(expr->array.elements[i]);
+                        emit(")); ");
+                    }
+                }
+                emit("__arr_%d; })", arr_id);
+                codegen_emit_packed_kind = _pk;
+                break;
+            }
             emit("({ WynArray __arr_%d = array_new(); ", arr_id);
             for (int i = 0; i < expr->array.count; i++) {
                 Expr* elem = expr->array.elements[i];
@@ -4026,7 +4258,7 @@ void codegen_expr(Expr* expr) {
                 
                 // Add elements
                 for (int i = 0; i < expr->array.count; i++) {
-                    emit("hashset_add(__set_%d, ", set_id);
+                    emit(hashset_elem_is_int(expr->array.elements[i]) ? "hashset_add_int(__set_%d, " : "hashset_add(__set_%d, ", set_id);
                     codegen_expr(expr->array.elements[i]);
                     emit("); ");
                 }
@@ -4097,8 +4329,7 @@ void codegen_expr(Expr* expr) {
                 // Check if this is a spawn array (WynIntArray)
                 if (expr->index.array->type == EXPR_IDENT) {
                     char _on[256]; token_to_cstr(_on, sizeof(_on), expr->index.array->token);
-                    extern int is_int_array_var(const char*);
-                    if (is_spawn_array(_on) || is_int_array_var(_on)) {
+                    if (is_spawn_array(_on)) {
                         emit("int_array_get(");
                         codegen_expr(expr->index.array);
                         emit(", ");
@@ -4106,6 +4337,29 @@ void codegen_expr(Expr* expr) {
                         emit(")");
                         break;
                     }
+                    // Packed local: direct element read, same bounds/negative-
+                    // index semantics as the boxed getters.
+                    PackedArrayKind _pk = packed_array_kind(_on);
+                    if (_pk != PACKED_NONE && bce_index_unchecked(expr->index.array, expr->index.index)) {
+                        // Proven in range: read the buffer directly.
+                        if (_pk == PACKED_STRUCT) emit("((%s*)(", packed_array_elem_ctype(_on));
+                        else emit(_pk == PACKED_BOOL ? "((bool)((" : "((");
+                        codegen_expr(expr->index.array);
+                        emit(").data)[");
+                        codegen_expr(expr->index.index);
+                        emit("]%s", _pk == PACKED_BOOL ? ")" : "");
+                        break;
+                    }
+                    if (_pk != PACKED_NONE) {
+                        emit("%s(", _pk == PACKED_INT ? "int_array_at" : _pk == PACKED_FLOAT ? "float_array_get"
+                                  : _pk == PACKED_BOOL ? "bool_array_get" : "struct_array_get");
+                        codegen_expr(expr->index.array);
+                        emit(", ");
+                        codegen_expr(expr->index.index);
+                        if (_pk == PACKED_STRUCT) emit(", %s", packed_array_elem_ctype(_on));
+                        emit(")");
+                        break;
+                    }
                 }
                 // Array indexing with tagged union support
                 // Determine if this is a string array by checking the source
@@ -4293,7 +4547,7 @@ void codegen_expr(Expr* expr) {
                         emit("%.*s", type_name.length, type_name.start);
                         emit(")");
                     } else if (is_float_array) {
-                        emit("array_get_float(");
+                        emit(bce_index_unchecked(expr->index.array, expr->index.index) ? "array_get_float_nc(" : "array_get_float(");
                         codegen_expr(expr->index.array);
                         emit(", ");
                         codegen_expr(expr->index.index);
@@ -4302,20 +4556,20 @@ void codegen_expr(Expr* expr) {
                         // Read as bool so to_string()/interpolation format it as
                         // true/false, not 1/0 (G5). array_get_int would pick
                         // int_to_string via _Generic.
-                        emit("array_get_bool(");
+                        emit(bce_index_unchecked(expr->index.array, expr->index.index) ? "array_get_bool_nc(" : "array_get_bool(");
                         codegen_expr(expr->index.array);
                         emit(", ");
                         codegen_expr(expr->index.index);
                         emit(")");
                     } else if (is_string_array) {
-                        emit("array_get_str(");
+                        emit(bce_index_unchecked(expr->index.array, expr->index.index) ? "array_get_str_nc(" : "array_get_str(");
                         codegen_expr(expr->index.array);
                         emit(", ");
                         codegen_expr(expr->index.index);
                         emit(")");
                     } else {
                         // Default to int array (most common case)
-                        emit("array_get_int(");
+                        emit(bce_index_unchecked(expr->index.array, expr->index.index) ? "array_get_int_nc(" : "array_get_int(");
                         codegen_expr(expr->index.array);
                         emit(", ");
                         codegen_expr(expr->index.index);
@@ -4345,17 +4599,61 @@ void codegen_expr(Expr* expr) {
                 Expr* rhs = expr->assign.value;
                 bool rhs_is_fresh = (rhs->type == EXPR_BINARY || rhs->type == EXPR_CALL ||
                                      rhs->type == EXPR_METHOD_CALL || rhs->type == EXPR_STRING_INTERP);
+                // Self-append `s = s + a + ...` on a string this function owns:
+                // wyn_string_append_owned() writes the pieces into s's spare
+                // capacity when s is uniquely referenced, so a build-up loop
+                // copies each byte O(1) times instead of re-copying the whole
+                // prefix every iteration. Parameters and locals aliased from
+                // one are borrows (refcount 1 belongs to the caller) and keep
+                // the copying concat. Pieces are evaluated before the append;
+                // none may mention s (string_append_pieces).
+                Expr* _ap[STR_APPEND_MAX_PIECES];
+                int _apn = 0;
+                extern int is_borrowed_string_local(const char*);
+                if (!is_parameter(target_name) && !is_borrowed_string_local(target_name))
+                    _apn = string_append_pieces(rhs, expr->assign.name, _ap);
+                if (_apn > 0) {
+                    // Each piece is formatted by its C type (wyn_interp_piece,
+                    // shared with interpolation), so an int piece costs no
+                    // allocation either.
+                    emit("({ const char* __ap[%d]; size_t __al[%d]; ", _apn, _apn);
+                    for (int i = 0; i < _apn; i++) {
+                        emit("char __ab%d[40]; const char* __ao%d = NULL; __ap[%d] = wyn_interp_piece((", i, i, i);
+                        codegen_expr(_ap[i]);
+                        emit("), __ab%d, &__al[%d], &__ao%d); ", i, i, i);
+                    }
+                    emit("const char* __rc_tmp = wyn_string_append_owned(%s, __ap, __al, %d);", target_name, _apn);
+                    for (int i = 0; i < _apn; i++) {
+                        Expr* p = _ap[i];
+                        emit(" if (__ao%d) wyn_rc_release(__ao%d);", i, i);
+                        if (p->expr_type && p->expr_type->kind == TYPE_STRING &&
+                            (p->type == EXPR_CALL || p->type == EXPR_METHOD_CALL ||
+                             p->type == EXPR_BINARY || p->type == EXPR_STRING_INTERP))
+                            emit(" wyn_rc_release(__ap[%d]);", i);
+                    }
+                    emit(" if (__rc_tmp != %s) { wyn_rc_release(%s); } %s = __rc_tmp; })", target_name, target_name, target_name);
+                    break;
+                }
+                // A local aliased from a parameter holds no reference while it
+                // still points at the parameter: don't release the caller's.
+                extern const char* borrowed_string_origin(const char*);
+                const char* _origin = borrowed_string_origin(target_name);
+                char _keep[600] = "";
+                if (_origin) snprintf(_keep, sizeof _keep, " && %s != %s", target_name, _origin);
                 if (rhs_is_fresh) {
                     // Fresh temporary: ownership transfer
                     // If concat reused the buffer (same pointer), don't release
                     emit("({ const char* __rc_tmp = ");
                     codegen_expr(expr->assign.value);
-                    emit("; if (__rc_tmp != %s) { wyn_rc_release(%s); } %s = __rc_tmp; })", target_name, target_name, target_name);
+                    emit("; if (__rc_tmp != %s%s) { wyn_rc_release(%s); } %s = __rc_tmp; })", target_name, _keep, target_name, target_name);
                 } else {
                     // Shared reference: retain new, release old
                     emit("({ const char* __rc_tmp = ");
                     codegen_expr(expr->assign.value);
-                    emit("; wyn_rc_retain(__rc_tmp); wyn_rc_release(%s); %s = __rc_tmp; })", target_name, target_name);
+                    if (_origin)
+                        emit("; wyn_rc_retain(__rc_tmp); if (%s != %s) wyn_rc_release(%s); %s = __rc_tmp; })", target_name, _origin, target_name, target_name);
+                    else
+                        emit("; wyn_rc_retain(__rc_tmp); wyn_rc_release(%s); %s = __rc_tmp; })", target_name, target_name);
                 }
                 break;
             }
@@ -5371,80 +5669,62 @@ void codegen_expr(Expr* expr) {
             emit(")");
             break;
         case EXPR_STRING_INTERP: {
-            // String interpolation: "Hello ${name}" -> sprintf format
+            // String interpolation: "id=${i} name=${n}" -> one exact-size
+            // allocation filled piece by piece. Each embedded value goes
+            // through wyn_interp_piece(), which _Generic-dispatches on the
+            // value's C type exactly like to_string() does (the checker's type
+            // is not trustworthy here - bool results are typed int for the C
+            // ABI, Option payloads and some builtins are typed loosely): ints
+            // format through the digit-pair table and floats through the
+            // shortest-round-trip fast path into a stack buffer, bools and
+            // strings are a pointer + length. Literal runs are static arrays
+            // whose length the C compiler knows, and the total is summed before
+            // the single wyn_str_alloc. This used to be a to_string()
+            // allocation per value plus a snprintf size probe and a second
+            // snprintf, parsing the format string twice. The only piece that
+            // still allocates is an array (array_to_string), handed back in
+            // __so and released after the copy. __buf is RC-allocated, so the
+            // existing release / skip-strdup ownership rules are unchanged.
             emit("({ ");
-            // Capture temporaries
             int _ti = 0;
             for (int i = 0; i < expr->string_interp.count; i++) {
-                if (expr->string_interp.expressions[i]) {
-                    Expr* e = expr->string_interp.expressions[i];
-                    emit("const char* __si%d = ", _ti);
-                    if (e->type == EXPR_STRING) {
-                        codegen_expr(e);
-                    } else {
-                        emit("to_string(");
-                        codegen_expr(e);
-                        emit(")");
-                    }
-                    emit("; ");
-                    _ti++;
+                if (expr->string_interp.parts[i]) {
+                    if (!expr->string_interp.parts[i][0]) continue;
+                    emit("static const char __sp%d[] = \"", i);
+                    emit_interp_literal(expr->string_interp.parts[i]);
+                    emit("\"; ");
+                    continue;
                 }
+                if (!expr->string_interp.expressions[i]) continue;
+                emit("char __sb%d[40]; size_t __sl%d; const char* __so%d = NULL; "
+                     "const char* __si%d = wyn_interp_piece((", _ti, _ti, _ti, _ti);
+                codegen_expr(expr->string_interp.expressions[i]);
+                emit("), __sb%d, &__sl%d, &__so%d); ", _ti, _ti, _ti);
+                _ti++;
             }
-
-            // Size-probe then heap-allocate so interpolation is NOT truncated at
-            // a fixed buffer (was char __buf[512]). __buf is RC-allocated via
-            // wyn_str_alloc so the existing release / skip-strdup ownership holds.
-            // The format string + args are emitted twice: once for the probe
-            // (snprintf into NULL,0) and once for the real write.
-            for (int pass = 0; pass < 2; pass++) {
-                if (pass == 0) emit("int __n = snprintf(NULL, 0, \"");
-                else           emit("char* __buf = wyn_str_alloc(__n + 1); snprintf(__buf, __n + 1, \"");
-                for (int i = 0; i < expr->string_interp.count; i++) {
-                    if (expr->string_interp.parts[i]) {
-                        const char* part = expr->string_interp.parts[i];
-                        while (*part) {
-                            if (*part == '%') emit("%%%%");
-                            else if (*part == '\n') emit("\\n");
-                            else if (*part == '\\' && *(part+1) == '"') { emit("\\\""); part++; }
-                            // `\$` is an escaped dollar (from a literal `\${...}`);
-                            // emit a bare `$` (not a C escape sequence).
-                            else if (*part == '\\' && *(part+1) == '$') { emit("$"); part++; }
-                            else if (*part == '"') emit("\\\"");
-                            else emit("%c", *part);
-                            part++;
-                        }
-                    } else {
-                        emit("%%s");
-                    }
-                }
-                emit("\"");
-                _ti = 0;
-                for (int i = 0; i < expr->string_interp.count; i++) {
-                    if (expr->string_interp.expressions[i]) {
-                        emit(", __si%d", _ti++);
-                    }
+            emit("size_t __n = 0");
+            _ti = 0;
+            for (int i = 0; i < expr->string_interp.count; i++) {
+                if (expr->string_interp.parts[i]) {
+                    if (expr->string_interp.parts[i][0]) emit(" + (sizeof(__sp%d) - 1)", i);
+                } else if (expr->string_interp.expressions[i]) {
+                    emit(" + __sl%d", _ti++);
                 }
-                emit("); ");
             }
-            // Release temporaries (only non-string expressions that created new strings)
+            emit("; char* __buf = wyn_str_alloc(__n + 1); char* __p = __buf; ");
             _ti = 0;
             for (int i = 0; i < expr->string_interp.count; i++) {
-                if (expr->string_interp.expressions[i]) {
-                    Expr* e = expr->string_interp.expressions[i];
-                    // Only release if the expression is NOT already a string
-                    // (to_string on a string returns the same pointer - releasing it frees the original)
-                    bool is_str_expr = (e->type == EXPR_STRING) ||
-                                       (e->expr_type && e->expr_type->kind == TYPE_STRING) ||
-                                       (e->type == EXPR_IDENT && e->expr_type && e->expr_type->kind == TYPE_STRING);
-                    if (!is_str_expr) {
-                        emit("wyn_rc_release(__si%d); ", _ti);
-                    }
+                if (expr->string_interp.parts[i]) {
+                    if (expr->string_interp.parts[i][0])
+                        emit("memcpy(__p, __sp%d, sizeof(__sp%d) - 1); __p += sizeof(__sp%d) - 1; ", i, i, i);
+                } else if (expr->string_interp.expressions[i]) {
+                    emit("memcpy(__p, __si%d, __sl%d); __p += __sl%d; ", _ti, _ti, _ti);
                     _ti++;
                 }
             }
-            // __buf is already an owned heap RC string (wyn_str_alloc), so both
-            // the skip and non-skip cases just yield it - no extra wyn_strdup copy
-            // (which would leak __buf and double-allocate).
+            emit("*__p = 0; ");
+            for (int i = 0; i < _ti; i++)
+                emit("if (__so%d) wyn_rc_release(__so%d); ", i, i);
             emit("__buf; })");
             break;
         }
@@ -5556,11 +5836,13 @@ void codegen_expr(Expr* expr) {
                 } else if (arg_count == 1 && !_arg1_needs_box) {
                     // A string arg is RC-retained for the task (the wrapper
                     // releases it): the spawning scope's own release could
-                    // otherwise free it before the task runs.
+                    // otherwise free it before the task runs. wyn_rc_share
+                    // moves it to the shared count, since the task releases
+                    // it on another thread.
                     if (_arg1_str) {
                         emit("({ const char* __sarg = (");
                         codegen_expr(call->call.args[0]);
-                        emit("); wyn_rc_retain(__sarg); ");
+                        emit("); wyn_rc_retain(__sarg); wyn_rc_share(__sarg); ");
                         if (_can_inline)
                             emit("wyn_spawn_inline((TaskFuncWithReturn)__spawn_wrapper_%s_1, (void*)(intptr_t)__sarg); })", func_name);
                         else
@@ -5610,7 +5892,7 @@ void codegen_expr(Expr* expr) {
                         emit("__sa_%d->a%d = ", sid, i);
                         codegen_expr(call->call.args[i]);
                         emit("; ");
-                        if (_fisstr) emit("wyn_rc_retain(__sa_%d->a%d); ", sid, i);
+                        if (_fisstr) emit("wyn_rc_retain(__sa_%d->a%d); wyn_rc_share(__sa_%d->a%d); ", sid, i, sid, i);
                     }
                     if (_can_inline)
                         emit("wyn_spawn_inline((TaskFuncWithReturn)__spawn_wrapper_%s_%d, __sa_%d); })", func_name, arg_count, sid);
@@ -5721,6 +6003,38 @@ void codegen_expr(Expr* expr) {
             break;
         }
         case EXPR_INDEX_ASSIGN: {
+            // Packed local: store straight into the buffer. Compound forms
+            // arrive with the value already re-reading xs[i].
+            {
+                PackedArrayKind _pk = packed_array_kind_of(expr->index_assign.object);
+                if (_pk != PACKED_NONE && bce_index_unchecked(expr->index_assign.object, expr->index_assign.index)) {
+                    // Proven in range: store into the buffer directly.
+                    char _on[256]; token_to_cstr(_on, sizeof(_on), expr->index_assign.object->token);
+                    if (_pk == PACKED_STRUCT) emit("((%s*)(", packed_array_elem_ctype(_on));
+                    else emit("((");
+                    codegen_expr(expr->index_assign.object);
+                    emit(").data)[");
+                    codegen_expr(expr->index_assign.index);
+                    emit("] = ");
+                    if (_pk == PACKED_BOOL) emit("(");
+                    codegen_expr(expr->index_assign.value);
+                    if (_pk == PACKED_BOOL) emit(") ? 1 : 0");
+                    break;
+                }
+                if (_pk != PACKED_NONE) {
+                    char _on[256]; token_to_cstr(_on, sizeof(_on), expr->index_assign.object->token);
+                    emit("%s(&(", _pk == PACKED_INT ? "int_array_set" : _pk == PACKED_FLOAT ? "float_array_set"
+                              : _pk == PACKED_BOOL ? "bool_array_set" : "struct_array_set");
+                    codegen_expr(expr->index_assign.object);
+                    emit("), ");
+                    codegen_expr(expr->index_assign.index);
+                    emit(", ");
+                    codegen_expr(expr->index_assign.value);
+                    if (_pk == PACKED_STRUCT) emit(", %s", packed_array_elem_ctype(_on));
+                    emit(")");
+                    break;
+                }
+            }
             // Check if this is map assignment
             bool is_map_assign = false;
             if (expr->index_assign.object->expr_type && expr->index_assign.object->expr_type->kind == TYPE_MAP) {
@@ -0,0 +1,282 @@
+// codegen_fusion.c - iterator fusion for scalar array pipelines.
+// Included from codegen.c before codegen_expr.c - shares all statics (emit,
+// lambda_ref_counter, packed-array helpers).
+//
+// Without this, `xs.map(f).filter(g).sum()` ran one runtime loop per stage:
+// each map/filter allocated a full intermediate WynArray, pushed every element
+// through array_push_* and called the lambda through a function pointer, so a
+// three-stage pipeline over 10M ints touched ~480MB of boxed temporaries and
+// made 20M indirect calls the C compiler could not see through.
+//
+// A chain rooted at a [int]/[float]/[bool] array whose stages are map, filter
+// and take, ending in one of sum / reduce / any / all or in an array-producing
+// stage, now compiles to ONE loop over the source: each lambda body is spliced
+// in as a statement expression with its parameters bound to the current
+// element, filter becomes a `continue`, take a counter, and the terminal folds
+// into an accumulator (any/all exit early). Array-producing chains write into
+// a destination presized to the source length, so there are no intermediate
+// arrays and no growth reallocs.
+//
+// Eligibility (anything else falls through to the per-stage lowering):
+//   - every lambda is single-expression, takes and returns int/float/bool, and
+//     its body uses only literals, identifiers, operators, conditionals, calls,
+//     method calls, field reads and indexing - no nested lambda, assignment,
+//     block or string literal, so splicing cannot change what it computes
+//   - the source is a boxed array or a packed [int]/[float]/[bool] local
+//   - not inside a module function (identifier prefixing there keys on the
+//     enclosing function's locals, which a spliced parameter is not)
+// Lambdas that are spliced still bump lambda_ref_counter, keeping the ids of
+// every later lambda in step with the pre-pass that emitted __lambda_N.
+
+#define FUSION_MAX_STAGES 16
+
+typedef enum { FUSE_MAP, FUSE_FILTER, FUSE_TAKE } FusionStageKind;
+typedef enum { FUSE_TO_ARRAY, FUSE_TO_SUM, FUSE_TO_REDUCE, FUSE_TO_ANY, FUSE_TO_ALL } FusionSink;
+
+typedef struct {
+    FusionStageKind kind;
+    Expr* arg;            // lambda (map/filter) or count (take)
+} FusionStage;
+
+// How many pipelines this compilation fused (for the --release report).
+static int fusion_sites = 0;
+int codegen_fusion_count(void) { return fusion_sites; }
+
+static bool fusion_tok_is(Token t, const char* s) {
+    int n = (int)strlen(s);
+    return t.length == n && memcmp(t.start, s, n) == 0;
+}
+
+// C type of a scalar element / lambda slot, or NULL when it is not one.
+static const char* fusion_scalar_c(Type* t) {
+    if (!t) return NULL;
+    switch (t->kind) {
+        case TYPE_INT: return "long long";
+        case TYPE_FLOAT: return "double";
+        case TYPE_BOOL: return "bool";
+        default: return NULL;
+    }
+}
+
+// Expression shapes a spliced lambda body may contain.
+static bool fusion_expr_inlinable(Expr* e) {
+    if (!e) return false;
+    switch (e->type) {
+        case EXPR_INT: case EXPR_FLOAT: case EXPR_BOOL: case EXPR_CHAR: case EXPR_IDENT:
+            return true;
+        case EXPR_BINARY:
+            return fusion_expr_inlinable(e->binary.left) && fusion_expr_inlinable(e->binary.right);
+        case EXPR_UNARY:
+            return fusion_expr_inlinable(e->unary.operand);
+        case EXPR_TERNARY:
+            return fusion_expr_inlinable(e->ternary.condition) &&
+                   fusion_expr_inlinable(e->ternary.then_expr) &&
+                   fusion_expr_inlinable(e->ternary.else_expr);
+        case EXPR_IF_EXPR:
+            return fusion_expr_inlinable(e->if_expr.condition) &&
+                   fusion_expr_inlinable(e->if_expr.then_expr) &&
+                   fusion_expr_inlinable(e->if_expr.else_expr);
+        case EXPR_CALL:
+            if (!e->call.callee || e->call.callee->type != EXPR_IDENT) return false;
+            for (int i = 0; i < e->call.arg_count; i++)
+                if (!fusion_expr_inlinable(e->call.args[i])) return false;
+            return true;
+        case EXPR_METHOD_CALL:
+            if (!fusion_expr_inlinable(e->method_call.object)) return false;
+            for (int i = 0; i < e->method_call.arg_count; i++)
+                if (!fusion_expr_inlinable(e->method_call.args[i])) return false;
+            return true;
+        case EXPR_FIELD_ACCESS:
+            return fusion_expr_inlinable(e->field_access.object);
+        case EXPR_INDEX:
+            return fusion_expr_inlinable(e->index.array) && fusion_expr_inlinable(e->index.index);
+        default:
+            return false;
+    }
+}
+
+// A lambda that can be spliced: `arity` scalar params, scalar result.
+static bool fusion_lambda_ok(Expr* fn, int arity) {
+    if (!fn || fn->type != EXPR_LAMBDA || fn->lambda.param_count != arity) return false;
+    if (fn->lambda.body_stmt_count != 0 || !fusion_expr_inlinable(fn->lambda.body)) return false;
+    Type* ft = fn->expr_type;
+    if (!ft || ft->kind != TYPE_FUNCTION || ft->fn_type.param_count != arity) return false;
+    if (!fusion_scalar_c(ft->fn_type.return_type)) return false;
+    for (int i = 0; i < arity; i++) {
+        if (!fusion_scalar_c(ft->fn_type.param_types[i])) return false;
+        char pn[128]; token_to_cstr(pn, sizeof(pn), fn->lambda.params[i]);
+        if (is_mut_parameter(pn)) return false;  // would emit as (*name)
+    }
+    return true;
+}
+
+// `({ T p0 = a0; T p1 = a1; body; })` - the lambda applied to C values.
+static void fusion_emit_apply(Expr* fn, const char* a0, const char* a1) {
+    lambda_ref_counter++;
+    Type* ft = fn->expr_type;
+    emit("({ ");
+    for (int i = 0; i < fn->lambda.param_count; i++) {
+        emit("%s %.*s = %s; ", fusion_scalar_c(ft->fn_type.param_types[i]),
+             fn->lambda.params[i].length, fn->lambda.params[i].start, i == 0 ? a0 : a1);
+    }
+    codegen_expr(fn->lambda.body);
+    emit("; })");
+}
+
+// Boxed element i of __src as C type `c`. WynValue tags are numeric here
+// (1 int, 2 float - the WynTypeId values) because the slim --release header
+// does not carry the enum.
+static void fusion_emit_boxed_read(const char* c) {
+    if (strcmp(c, "double") == 0)
+        emit("(__src.data[__i].type == 1 ? (double)__src.data[__i].data.int_val : __src.data[__i].data.float_val)");
+    else if (strcmp(c, "bool") == 0)
+        emit("(__src.data[__i].data.int_val != 0)");
+    else
+        emit("(__src.data[__i].type == 2 ? (long long)__src.data[__i].data.float_val : __src.data[__i].data.int_val)");
+}
+
+// Try to emit `expr` (an array method call) as one fused loop. Returns false
+// with nothing emitted when the chain is not eligible.
+static bool fusion_try_emit(Expr* expr) {
+    if (current_module_prefix || expr->type != EXPR_METHOD_CALL) return false;
+    Token m = expr->method_call.method;
+    int argc = expr->method_call.arg_count;
+
+    FusionSink sink;
+    Expr* sink_fn = NULL;
+    Expr* sink_init = NULL;
+    Expr* cur;
+    if ((fusion_tok_is(m, "map") || fusion_tok_is(m, "filter") || fusion_tok_is(m, "take")) && argc == 1) {
+        sink = FUSE_TO_ARRAY; cur = expr;
+    } else if (fusion_tok_is(m, "sum") && argc == 0) {
+        sink = FUSE_TO_SUM; cur = expr->method_call.object;
+    } else if (fusion_tok_is(m, "reduce") && argc == 2) {
+        // reduce(fn, init); reduce(init, fn) is accepted too (see the boxed path).
+        sink = FUSE_TO_REDUCE; cur = expr->method_call.object;
+        sink_fn = expr->method_call.args[0]; sink_init = expr->method_call.args[1];
+        if (sink_fn->type != EXPR_LAMBDA && sink_init->type == EXPR_LAMBDA) {
+            Expr* t = sink_fn; sink_fn = sink_init; sink_init = t;
+        }
+    } else if ((fusion_tok_is(m, "any") || fusion_tok_is(m, "all")) && argc == 1) {
+        sink = fusion_tok_is(m, "any") ? FUSE_TO_ANY : FUSE_TO_ALL;
+        cur = expr->method_call.object;
+        sink_fn = expr->method_call.args[0];
+    } else {
+        return false;
+    }
+
+    // Walk down to the source, collecting stages outermost-first.
+    FusionStage rev[FUSION_MAX_STAGES];
+    int n = 0;
+    while (cur && cur->type == EXPR_METHOD_CALL && cur->method_call.arg_count == 1 &&
+           cur->method_call.object->expr_type && cur->method_call.object->expr_type->kind == TYPE_ARRAY) {
+        Token sm = cur->method_call.method;
+        FusionStageKind k;
+        if (fusion_tok_is(sm, "map")) k = FUSE_MAP;
+        else if (fusion_tok_is(sm, "filter")) k = FUSE_FILTER;
+        else if (fusion_tok_is(sm, "take")) k = FUSE_TAKE;
+        else break;
+        if (n == FUSION_MAX_STAGES) return false;
+        rev[n].kind = k; rev[n].arg = cur->method_call.args[0]; n++;
+        cur = cur->method_call.object;
+    }
+    Expr* src = cur;
+    if (!src || !src->expr_type || src->expr_type->kind != TYPE_ARRAY) return false;
+    const char* elem_c = fusion_scalar_c(src->expr_type->array_type.element_type);
+    if (!elem_c) return false;
+    PackedArrayKind pk = packed_array_kind_of(src);
+    if (pk == PACKED_STRUCT) return false;
+
+    // Source-first order, with the type flowing out of each stage.
+    FusionStage st[FUSION_MAX_STAGES];
+    const char* out_c[FUSION_MAX_STAGES];
+    bool any_lambda = sink_fn != NULL;
+    const char* flow = elem_c;
+    for (int i = 0; i < n; i++) {
+        st[i] = rev[n - 1 - i];
+        if (st[i].kind == FUSE_TAKE) {
+            if (!fusion_expr_inlinable(st[i].arg)) return false;
+        } else {
+            if (!fusion_lambda_ok(st[i].arg, 1)) return false;
+            any_lambda = true;
+            if (st[i].kind == FUSE_MAP) flow = fusion_scalar_c(st[i].arg->expr_type->fn_type.return_type);
+        }
+        out_c[i] = flow;
+    }
+    if (!any_lambda) return false;  // plain take()/sum() keep their runtime helpers
+    if (sink_fn && !fusion_lambda_ok(sink_fn, sink == FUSE_TO_REDUCE ? 2 : 1)) return false;
+    if (sink_init && !fusion_expr_inlinable(sink_init)) return false;
+    if (sink == FUSE_TO_SUM && strcmp(flow, "bool") == 0) return false;
+    // A lone [float].map stays on its own path so the GPU dual dispatch can see it.
+    if (gpu_dispatch_enabled && sink == FUSE_TO_ARRAY && n == 1 && st[0].kind == FUSE_MAP) return false;
+
+    fusion_sites++;
+    const char* acc_c = sink == FUSE_TO_REDUCE ? fusion_scalar_c(sink_fn->expr_type->fn_type.return_type)
+                      : sink == FUSE_TO_SUM ? flow : "bool";
+    emit("({ %s __src = ", pk != PACKED_NONE ? packed_array_c_type(pk) : "WynArray");
+    codegen_expr(src);
+    emit("; int __n = __src.count; ");
+    switch (sink) {
+        case FUSE_TO_ARRAY:
+            emit("WynArray __dst = array_new(); if (__n > 0) { __dst.data = malloc(sizeof(WynValue) * __n); __dst.capacity = __n; } ");
+            break;
+        case FUSE_TO_SUM: emit("%s __acc = 0; ", acc_c); break;
+        case FUSE_TO_REDUCE: emit("%s __acc = (", acc_c); codegen_expr(sink_init); emit("); "); break;
+        case FUSE_TO_ANY: emit("bool __acc = false; "); break;
+        case FUSE_TO_ALL: emit("bool __acc = true; "); break;
+    }
+    for (int i = 0; i < n; i++) {
+        if (st[i].kind != FUSE_TAKE) continue;
+        emit("long long __tk%d = 0, __tn%d = (", i, i); codegen_expr(st[i].arg); emit("); ");
+    }
+    emit("for (int __i = 0; __i < __n; __i++) { %s __f0 = ", elem_c);
+    if (pk == PACKED_BOOL) emit("(__src.data[__i] != 0)");
+    else if (pk != PACKED_NONE) emit("__src.data[__i]");
+    else fusion_emit_boxed_read(elem_c);
+    emit("; ");
+    // `val` names the element as it leaves the last stage emitted so far.
+    char val[32] = "__f0";
+    for (int i = 0; i < n; i++) {
+        switch (st[i].kind) {
+            case FUSE_MAP:
+                emit("%s __f%d = ", out_c[i], i + 1);
+                fusion_emit_apply(st[i].arg, val, NULL);
+                emit("; ");
+                snprintf(val, sizeof(val), "__f%d", i + 1);
+                break;
+            case FUSE_FILTER:
+                emit("if (!");
+                fusion_emit_apply(st[i].arg, val, NULL);
+                emit(") continue; ");
+                break;
+            case FUSE_TAKE:
+                emit("if (__tk%d >= __tn%d) break; __tk%d++; ", i, i, i);
+                break;
+        }
+    }
+    switch (sink) {
+        case FUSE_TO_ARRAY: {
+            const char* tag = strcmp(flow, "double") == 0 ? "2" : strcmp(flow, "bool") == 0 ? "3" : "1";
+            emit("__dst.data[__dst.count].type = %s; __dst.data[__dst.count].data.%s = %s; __dst.count++; ",
+                 tag, strcmp(flow, "double") == 0 ? "float_val" : "int_val", val);
+            break;
+        }
+        case FUSE_TO_SUM: emit("__acc += %s; ", val); break;
+        case FUSE_TO_REDUCE:
+            emit("__acc = ");
+            fusion_emit_apply(sink_fn, "__acc", val);
+            emit("; ");
+            break;
+        case FUSE_TO_ANY:
+            emit("if ("); fusion_emit_apply(sink_fn, val, NULL); emit(") { __acc = true; break; } ");
+            break;
+        case FUSE_TO_ALL:
+            emit("if (!"); fusion_emit_apply(sink_fn, val, NULL); emit(") { __acc = false; break; } ");
+            break;
+    }
+    // Once a take() is full nothing more can reach the sink.
+    for (int i = 0; i < n; i++)
+        if (st[i].kind == FUSE_TAKE) emit("if (__tk%d >= __tn%d) break; ", i, i);
+    emit("} %s; })", sink == FUSE_TO_ARRAY ? "__dst" : "__acc");
+    return true;
+}
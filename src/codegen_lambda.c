@@ -279,6 +279,9 @@ static void scan_expr_for_lambdas(Expr* expr) {
                         spawn_wrappers[i].arg_count == arg_count) {
                         already_added = true;
                         spawn_wrappers[i].returns_void = 0; // EXPR_SPAWN needs return value
+                        extern const char* get_function_return_type(const char*);
+                        const char* _rt0 = get_function_return_type(func_name);
+                        spawn_wrappers[i].returns_string = (_rt0 && strcmp(_rt0, "string") == 0) ? 1 : 0;
                         break;
                     }
                 }
@@ -344,48 +347,80 @@ static void scan_for_lambdas(Stmt* body) {
     scan_stmt_for_lambdas(body);
 }
 
-// --- WynIntArray veto pre-pass -------------------------------------------
+// --- Packed-array veto pre-pass --------------------------------------------
 //
 // See the "int-array veto" block in codegen.c for the why. This pass walks the
-// whole program BEFORE any code is emitted and vetoes the packed WynIntArray
-// representation for every `[int]`-annotated variable whose uses that
-// representation cannot express. Vetoed variables fall back to the generic
-// WynArray, which is exactly what the inferred spelling (`xs = [1,2]`) already
-// emits - so both spellings agree by construction.
+// whole program BEFORE any code is emitted and vetoes the packed layouts
+// (WynIntArray / WynFloatArray / WynBoolArray / WynStructArray) for every
+// array variable whose uses those layouts cannot express. Vetoed variables
+// fall back to the generic WynArray, which is exactly what the boxed spelling
+// already emits - so both spellings agree by construction.
 //
 // The pass is deliberately CONSERVATIVE (whitelist, not blacklist): a bare
 // mention of the name in any position not explicitly known to be safe vetoes
 // it. A false veto only costs the packed-representation speedup; a missed veto
 // is a miscompile. New syntax therefore fails safe.
 
-// Ops with a real WynIntArray lowering. Keep in sync with the WynIntArray
-// dispatch in codegen_expr.c (~:2453) and the for-loop path in
-// codegen_stmt.c (~:4155).
+// Ops with a real packed lowering for the receiver's element type. Keep in
+// sync with codegen_packed_method in codegen_expr.c and the for-loop path in
+// codegen_stmt.c. The element type is read from the checker; with none the
+// receiver could become any layout, so only the ops every layout has pass.
 //
-// `sort` is deliberately NOT here: its packed lowering is the statement form
-// `int_array_sort(&xs)`, which yields the WynIntArray as its value. When that
-// value is CONSUMED (`var s = xs.sort()`) it flows into a var whose type the
-// STMT_VAR path independently decided is WynArray - the same store/load
-// disagreement in miniature. Statement-position `xs.sort()` discards the value
-// and is handled as a special case in veto_scan_stmt's STMT_EXPR arm.
-static int int_array_safe_method(Token m) {
+// `sort` is deliberately NOT here: its packed lowering yields the packed
+// array as its value. When that value is CONSUMED (`var s = xs.sort()`) it
+// flows into a var whose type the STMT_VAR path independently decided is
+// WynArray - the same store/load disagreement in miniature. Statement-position
+// `xs.sort()` discards the value and is handled as a special case in
+// veto_scan_stmt's STMT_EXPR arm.
+//
+// map/filter/reduce build their loop from the callback's checker signature, so
+// they are only safe when the checker typed the callback.
+static TypeKind packed_receiver_elem_kind(Expr* obj) {
+    Type* t = obj ? obj->expr_type : NULL;
+    if (!t || t->kind != TYPE_ARRAY || !t->array_type.element_type) return TYPE_VOID;  // no element type known
+    return t->array_type.element_type->kind;
+}
+static int packed_callback_typed(Expr* fn) {
+    return fn && fn->expr_type && fn->expr_type->kind == TYPE_FUNCTION &&
+           fn->expr_type->fn_type.return_type;
+}
+static int int_array_safe_method(Expr* call) {
+    Token m = call->method_call.method;
+    TypeKind ek = packed_receiver_elem_kind(call->method_call.object);
+    int argc = call->method_call.arg_count;
     if (m.length == 4 && memcmp(m.start, "push", 4) == 0) return 1;
     if (m.length == 3 && memcmp(m.start, "len", 3) == 0) return 1;
+    if (m.length == 3 && memcmp(m.start, "sum", 3) == 0)
+        return ek == TYPE_INT || ek == TYPE_FLOAT;
+    if (ek == TYPE_VOID) return 0;
+    // With GPU dispatch on, [float].map stays boxed: the dual-path site in
+    // codegen_gpu.c hands the receiver to wyn_gpu_try_map_float as a WynArray.
+    if (m.length == 3 && memcmp(m.start, "map", 3) == 0 && ek == TYPE_FLOAT && gpu_dispatch_enabled)
+        return 0;
+    if ((m.length == 3 && memcmp(m.start, "map", 3) == 0) ||
+        (m.length == 6 && memcmp(m.start, "filter", 6) == 0))
+        return argc == 1 && packed_callback_typed(call->method_call.args[0]);
+    if (m.length == 6 && memcmp(m.start, "reduce", 6) == 0 && argc == 2)
+        return packed_callback_typed(call->method_call.args[0]) ||
+               packed_callback_typed(call->method_call.args[1]);
     return 0;
 }
 
-// True for `xs.sort()` where xs is a bare identifier - packed-safe ONLY when
-// the resulting value is discarded (statement position).
+// True for `xs.sort()` where xs is a bare identifier of [int]/[float] -
+// packed-safe ONLY when the resulting value is discarded (statement position).
 static int is_bare_sort_call(Expr* e) {
-    return e && e->type == EXPR_METHOD_CALL &&
-           e->method_call.object->type == EXPR_IDENT &&
-           e->method_call.method.length == 4 &&
-           memcmp(e->method_call.method.start, "sort", 4) == 0;
+    if (!(e && e->type == EXPR_METHOD_CALL &&
+          e->method_call.object->type == EXPR_IDENT &&
+          e->method_call.method.length == 4 &&
+          memcmp(e->method_call.method.start, "sort", 4) == 0)) return 0;
+    TypeKind ek = packed_receiver_elem_kind(e->method_call.object);
+    return ek == TYPE_INT || ek == TYPE_FLOAT;
 }
 
 static void veto_scan_expr(Expr* e);
 static void veto_scan_stmt(Stmt* s);
 static void veto_all_idents_in(Expr* e);
+static void bce_note_lambda_ident(Expr* e);
 
 // Veto the name if `e` is a bare identifier. Used for every position where a
 // whole array value would flow into generic-WynArray code.
@@ -400,37 +435,42 @@ static void veto_scan_expr(Expr* e) {
     if (!e) return;
     switch (e->type) {
         case EXPR_METHOD_CALL: {
-            // `xs.push(v)` / `xs.sort()` / `xs.len()` on a bare identifier are
-            // the packed-safe forms: recurse into the ARGS but do not treat the
-            // receiver itself as a generic-array use. Everything else
-            // (.map/.filter/.slice/.join/.sum/.first/.contains/...) routes
-            // through a WynArray-taking helper, so it vetoes.
+            // Whitelisted methods on a bare identifier are the packed-safe
+            // forms: recurse into the ARGS but do not treat the receiver
+            // itself as a generic-array use. Everything else
+            // (.slice/.join/.first/.contains/...) routes through a
+            // WynArray-taking helper, so it vetoes.
             bool receiver_ok = (e->method_call.object->type == EXPR_IDENT &&
-                                int_array_safe_method(e->method_call.method));
+                                int_array_safe_method(e));
             if (!receiver_ok) {
                 veto_if_ident(e->method_call.object);
                 veto_scan_expr(e->method_call.object);
             }
-            for (int i = 0; i < e->method_call.arg_count; i++)
+            // An array ARGUMENT (`a.concat(b)`, `ys.push(xs)`) is handed over
+            // as a WynArray whatever the receiver is.
+            for (int i = 0; i < e->method_call.arg_count; i++) {
+                veto_if_ident(e->method_call.args[i]);
                 veto_scan_expr(e->method_call.args[i]);
+            }
             break;
         }
         case EXPR_INDEX:
-            // `xs[i]` has a packed lowering (int_array_get); the index does not
+            // `xs[i]` has a packed lowering (int_array_at & co); the index does not
             // carry the array, so only recurse into it. A non-ident base (e.g.
             // `f()[i]`, `m[k][j]`) is scanned normally.
             if (e->index.array->type != EXPR_IDENT) veto_scan_expr(e->index.array);
             veto_scan_expr(e->index.index);
             break;
         case EXPR_INDEX_ASSIGN:
-            // `xs[i] = v` has NO packed lowering: the emitter casts &xs to
-            // WynArray* and writes a 16-byte WynValue into an 8-byte packed
-            // slot - a silent wrong answer plus an out-of-bounds write. This is
-            // the one shape that MUST veto (it used to compile "fine").
-            veto_if_ident(e->index_assign.object);
-            veto_scan_expr(e->index_assign.object);
+            // `xs[i] = v` on a bare identifier has a packed lowering
+            // (int_array_set & co). Before it did, the emitter cast &xs to
+            // WynArray* and wrote a 16-byte WynValue into an 8-byte packed slot
+            // - a silent wrong answer plus an out-of-bounds write - so any
+            // other base still goes through the scan.
+            if (e->index_assign.object->type != EXPR_IDENT)
+                veto_scan_expr(e->index_assign.object);
             veto_scan_expr(e->index_assign.index);
-            veto_scan_expr(e->index_assign.value);
+            veto_if_ident(e->index_assign.value); veto_scan_expr(e->index_assign.value);
             break;
         case EXPR_CALL:
             // Passing the array to any function hands a WynIntArray to a
@@ -541,10 +581,13 @@ static void veto_scan_stmt(Stmt* s) {
         case STMT_EXPR:
             // Statement-position `xs.sort()` discards the yielded value, so the
             // packed in-place sort is safe. Only recurse into the args.
+            // A bare identifier here can be a block's implicit result, which
+            // hands the array on as a WynArray.
             if (is_bare_sort_call(s->expr)) {
                 for (int i = 0; i < s->expr->method_call.arg_count; i++)
                     veto_scan_expr(s->expr->method_call.args[i]);
             } else {
+                veto_if_ident(s->expr);
                 veto_scan_expr(s->expr);
             }
             break;
@@ -561,7 +604,7 @@ static void veto_scan_stmt(Stmt* s) {
         case STMT_WHILE:
             veto_scan_expr(s->while_stmt.condition); veto_scan_stmt(s->while_stmt.body); break;
         case STMT_FOR:
-            // `for x in xs` HAS a packed lowering (codegen_stmt.c ~:4155), so a
+            // `for x in xs` HAS a packed lowering (codegen_stmt.c), so a
             // bare-ident iterable does not veto.
             if (s->for_stmt.array_expr && s->for_stmt.array_expr->type != EXPR_IDENT)
                 veto_scan_expr(s->for_stmt.array_expr);
@@ -601,7 +644,7 @@ static void veto_scan_stmt(Stmt* s) {
 static void veto_all_idents_in_stmt(Stmt* s);
 static void veto_all_idents_in(Expr* e) {
     if (!e) return;
-    if (e->type == EXPR_IDENT) { veto_if_ident(e); return; }
+    if (e->type == EXPR_IDENT) { veto_if_ident(e); bce_note_lambda_ident(e); return; }
     switch (e->type) {
         case EXPR_BINARY: veto_all_idents_in(e->binary.left); veto_all_idents_in(e->binary.right); break;
         case EXPR_UNARY: veto_all_idents_in(e->unary.operand); break;
@@ -729,6 +772,238 @@ void veto_scan_program(Program* prog) {
     for (int i = 0; i < prog->count; i++) veto_scan_stmt(prog->stmts[i]);
 }
 
+// --- Bounds-check elimination -------------------------------------------------
+//
+// Every `xs[i]` read goes through a checked getter (array_get_int & co, or the
+// packed int_array_at & co): negative-index adjust, range check, panic path.
+// Inside the two loop shapes below the index is in range BY CONSTRUCTION, so
+// codegen emits the unchecked form (array_get_int_nc & co, or a direct
+// `xs.data[i]` on a packed array) instead:
+//
+//   for i in <non-negative literal>..xs.len()     (the parser's C-style desugar)
+//   for i, v in xs
+//
+// The argument needs three facts for the whole body, and the walk below proves
+// each one syntactically - anything it does not recognise disqualifies the loop:
+//   - i only moves by the loop's own `i = i + 1`: the body never assigns or
+//     re-declares i (a nested loop re-using the name counts as re-declaring).
+//   - xs keeps its length: the body never assigns or re-declares xs, never
+//     passes `&xs` to a mut param, and only calls read-only methods on it.
+//     Length-preserving element stores (`xs[j] = v`) are fine.
+//   - nothing else can reach xs: it is a local or a by-value parameter (a
+//     called fn cannot see either), and no lambda anywhere in the program
+//     mentions the name (closures could capture it; recorded by the veto
+//     pre-pass, which already walks every lambda body).
+// Constructs the walk does not model (match, spawn, defer, try, lambdas in the
+// body) make the loop keep its checks - a missed elimination costs a compare,
+// a wrong one is a silent out-of-bounds read.
+
+typedef struct { char arr[128]; char idx[128]; } BceRange;
+static BceRange* bce_ranges = NULL;
+static int bce_range_count = 0;
+static int bce_range_cap = 0;
+static char** bce_lambda_names = NULL;   // every identifier any lambda body mentions
+static int bce_lambda_name_count = 0;
+static int bce_lambda_name_cap = 0;
+static int bce_index_sites = 0;          // element reads/stores emitted
+static int bce_unchecked_sites = 0;      // ... of which proven in range
+
+static void bce_note_lambda_ident(Expr* e) {
+    char n[256]; token_to_cstr(n, sizeof(n), e->token);
+    for (int i = 0; i < bce_lambda_name_count; i++)
+        if (strcmp(bce_lambda_names[i], n) == 0) return;
+    WYN_ENSURE_CAP(bce_lambda_names, bce_lambda_name_count, bce_lambda_name_cap);
+    bce_lambda_names[bce_lambda_name_count++] = strdup(n);
+}
+
+static bool bce_tok_is(Token t, const char* name) {
+    return t.start && (int)strlen(name) == t.length && memcmp(t.start, name, t.length) == 0;
+}
+static bool bce_ident_is(Expr* e, const char* name) {
+    return e && e->type == EXPR_IDENT && bce_tok_is(e->token, name);
+}
+
+// Methods that neither change the receiver's length nor let it escape.
+static bool bce_readonly_method(Token m) {
+    static const char* ok[] = { "len", "contains", "index_of", "join", "sum", "first", "last",
+                                "slice", "count", "min", "max", "is_empty", NULL };
+    for (int i = 0; ok[i]; i++) if (bce_tok_is(m, ok[i])) return true;
+    return false;
+}
+
+static bool bce_stmt_keeps(Stmt* s, const char* arr, const char* idx);
+static bool bce_expr_keeps(Expr* e, const char* arr, const char* idx) {
+    if (!e) return true;
+    switch (e->type) {
+        case EXPR_INT: case EXPR_FLOAT: case EXPR_STRING: case EXPR_CHAR:
+        case EXPR_BOOL: case EXPR_NONE: case EXPR_IDENT:
+            return true;
+        case EXPR_BINARY:
+            return bce_expr_keeps(e->binary.left, arr, idx) && bce_expr_keeps(e->binary.right, arr, idx);
+        case EXPR_UNARY:
+            // `&xs` / `&i` hands the variable to a mut parameter.
+            if (e->unary.op.type == TOKEN_AMP &&
+                (bce_ident_is(e->unary.operand, arr) || bce_ident_is(e->unary.operand, idx))) return false;
+            return bce_expr_keeps(e->unary.operand, arr, idx);
+        case EXPR_ASSIGN:
+            if (bce_tok_is(e->assign.name, arr) || bce_tok_is(e->assign.name, idx)) return false;
+            return bce_expr_keeps(e->assign.value, arr, idx);
+        case EXPR_CALL:
+            if (!bce_expr_keeps(e->call.callee, arr, idx)) return false;
+            for (int i = 0; i < e->call.arg_count; i++)
+                if (!bce_expr_keeps(e->call.args[i], arr, idx)) return false;
+            return true;
+        case EXPR_METHOD_CALL:
+            if (bce_ident_is(e->method_call.object, arr) && !bce_readonly_method(e->method_call.method))
+                return false;
+            if (!bce_expr_keeps(e->method_call.object, arr, idx)) return false;
+            for (int i = 0; i < e->method_call.arg_count; i++)
+                if (!bce_expr_keeps(e->method_call.args[i], arr, idx)) return false;
+            return true;
+        case EXPR_INDEX:
+            return bce_expr_keeps(e->index.array, arr, idx) && bce_expr_keeps(e->index.index, arr, idx);
+        case EXPR_INDEX_ASSIGN:
+            // An element store keeps the length.
+            return bce_expr_keeps(e->index_assign.object, arr, idx) &&
+                   bce_expr_keeps(e->index_assign.index, arr, idx) &&
+                   bce_expr_keeps(e->index_assign.value, arr, idx);
+        case EXPR_FIELD_ACCESS: return bce_expr_keeps(e->field_access.object, arr, idx);
+        case EXPR_FIELD_ASSIGN:
+            return bce_expr_keeps(e->field_assign.object, arr, idx) && bce_expr_keeps(e->field_assign.value, arr, idx);
+        case EXPR_TERNARY:
+            return bce_expr_keeps(e->ternary.condition, arr, idx) &&
+                   bce_expr_keeps(e->ternary.then_expr, arr, idx) && bce_expr_keeps(e->ternary.else_expr, arr, idx);
+        case EXPR_IF_EXPR:
+            return bce_expr_keeps(e->if_expr.condition, arr, idx) &&
+                   bce_expr_keeps(e->if_expr.then_expr, arr, idx) && bce_expr_keeps(e->if_expr.else_expr, arr, idx);
+        case EXPR_STRING_INTERP:
+            for (int i = 0; i < e->string_interp.count; i++)
+                if (!bce_expr_keeps(e->string_interp.expressions[i], arr, idx)) return false;
+            return true;
+        case EXPR_ARRAY:
+            for (int i = 0; i < e->array.count; i++)
+                if (!bce_expr_keeps(e->array.elements[i], arr, idx)) return false;
+            return true;
+        case EXPR_STRUCT_INIT:
+            for (int i = 0; i < e->struct_init.field_count; i++)
+                if (!bce_expr_keeps(e->struct_init.field_values[i], arr, idx)) return false;
+            return true;
+        case EXPR_TUPLE:
+            for (int i = 0; i < e->tuple.count; i++)
+                if (!bce_expr_keeps(e->tuple.elements[i], arr, idx)) return false;
+            return true;
+        case EXPR_TUPLE_INDEX: return bce_expr_keeps(e->tuple_index.tuple, arr, idx);
+        case EXPR_SOME: case EXPR_OK: case EXPR_ERR: return bce_expr_keeps(e->option.value, arr, idx);
+        default:
+            return false;   // lambda, match, spawn, await, block, ... : not modelled
+    }
+}
+static bool bce_stmt_keeps(Stmt* s, const char* arr, const char* idx) {
+    if (!s) return true;
+    switch (s->type) {
+        case STMT_EXPR: return bce_expr_keeps(s->expr, arr, idx);
+        case STMT_VAR: case STMT_CONST: {
+            VarStmt* v = s->type == STMT_VAR ? &s->var : &s->const_stmt;
+            if (v->uses_pattern || bce_tok_is(v->name, arr) || bce_tok_is(v->name, idx)) return false;
+            return bce_expr_keeps(v->init, arr, idx);
+        }
+        case STMT_RETURN: return bce_expr_keeps(s->ret.value, arr, idx);
+        case STMT_BREAK: case STMT_CONTINUE: return true;
+        case STMT_BLOCK:
+            for (int i = 0; i < s->block.count; i++)
+                if (!bce_stmt_keeps(s->block.stmts[i], arr, idx)) return false;
+            return true;
+        case STMT_IF:
+            return bce_expr_keeps(s->if_stmt.condition, arr, idx) &&
+                   bce_stmt_keeps(s->if_stmt.then_branch, arr, idx) && bce_stmt_keeps(s->if_stmt.else_branch, arr, idx);
+        case STMT_WHILE:
+            return bce_expr_keeps(s->while_stmt.condition, arr, idx) && bce_stmt_keeps(s->while_stmt.body, arr, idx);
+        case STMT_FOR:
+            if (s->for_stmt.array_expr &&
+                (bce_tok_is(s->for_stmt.loop_var, arr) || bce_tok_is(s->for_stmt.loop_var, idx) ||
+                 (s->for_stmt.has_index && (bce_tok_is(s->for_stmt.index_var, arr) ||
+                                            bce_tok_is(s->for_stmt.index_var, idx))))) return false;
+            return bce_expr_keeps(s->for_stmt.array_expr, arr, idx) && bce_stmt_keeps(s->for_stmt.init, arr, idx) &&
+                   bce_expr_keeps(s->for_stmt.condition, arr, idx) && bce_expr_keeps(s->for_stmt.increment, arr, idx) &&
+                   bce_stmt_keeps(s->for_stmt.body, arr, idx);
+        default:
+            return false;
+    }
+}
+
+// `xs` can only change through code the loop body contains.
+static bool bce_array_is_private(const char* arr) {
+    if (!(is_local_variable(arr) || (is_parameter(arr) && !is_mut_parameter(arr)))) return false;
+    for (int i = 0; i < bce_lambda_name_count; i++)
+        if (strcmp(bce_lambda_names[i], arr) == 0) return false;
+    return true;
+}
+
+// Called by STMT_FOR before its body is emitted. Returns true (and makes
+// `arr[idx]` unchecked for the body) when the loop has one of the two shapes
+// above; the caller then calls bce_leave_loop() after the body.
+bool bce_enter_loop(Stmt* s) {
+    char arr[128] = "", idx[128] = "";
+    if (s->for_stmt.array_expr) {
+        // for i, v in xs
+        if (!s->for_stmt.has_index || s->for_stmt.array_expr->type != EXPR_IDENT) return false;
+        token_to_cstr(arr, sizeof(arr), s->for_stmt.array_expr->token);
+        token_to_cstr(idx, sizeof(idx), s->for_stmt.index_var);
+        if (bce_tok_is(s->for_stmt.loop_var, arr)) return false;
+    } else {
+        // for i in 0..xs.len(): init `var i = <literal>`, cond `i < xs.len()`,
+        // increment `i = i + <literal>`.
+        Stmt* init = s->for_stmt.init;
+        Expr* cond = s->for_stmt.condition;
+        Expr* inc = s->for_stmt.increment;
+        if (!init || init->type != STMT_VAR || !init->var.init || init->var.init->type != EXPR_INT) return false;
+        token_to_cstr(idx, sizeof(idx), init->var.name);
+        if (!cond || cond->type != EXPR_BINARY || cond->binary.op.type != TOKEN_LT ||
+            !bce_ident_is(cond->binary.left, idx)) return false;
+        Expr* bound = cond->binary.right;
+        if (bound && bound->type == EXPR_METHOD_CALL && bound->method_call.arg_count == 0 &&
+            bce_tok_is(bound->method_call.method, "len") && bound->method_call.object->type == EXPR_IDENT)
+            token_to_cstr(arr, sizeof(arr), bound->method_call.object->token);
+        else if (bound && bound->type == EXPR_CALL && bound->call.arg_count == 1 &&
+                 bce_ident_is(bound->call.callee, "len") && bound->call.args[0]->type == EXPR_IDENT)
+            token_to_cstr(arr, sizeof(arr), bound->call.args[0]->token);
+        else return false;
+        if (!inc || inc->type != EXPR_ASSIGN || !bce_tok_is(inc->assign.name, idx) ||
+            !inc->assign.value || inc->assign.value->type != EXPR_BINARY ||
+            inc->assign.value->binary.op.type != TOKEN_PLUS ||
+            !bce_ident_is(inc->assign.value->binary.left, idx) ||
+            !inc->assign.value->binary.right || inc->assign.value->binary.right->type != EXPR_INT) return false;
+        if (strcmp(arr, idx) == 0) return false;
+    }
+    if (!bce_array_is_private(arr) || !bce_stmt_keeps(s->for_stmt.body, arr, idx)) return false;
+    WYN_ENSURE_CAP(bce_ranges, bce_range_count, bce_range_cap);
+    snprintf(bce_ranges[bce_range_count].arr, sizeof(bce_ranges[0].arr), "%s", arr);
+    snprintf(bce_ranges[bce_range_count].idx, sizeof(bce_ranges[0].idx), "%s", idx);
+    bce_range_count++;
+    return true;
+}
+void bce_leave_loop(void) { if (bce_range_count > 0) bce_range_count--; }
+
+// Asked by EXPR_INDEX / EXPR_INDEX_ASSIGN for every element access they emit
+// through a bounds-checked helper; true means emit the unchecked form.
+bool bce_index_unchecked(Expr* array, Expr* index) {
+    bce_index_sites++;
+    if (!array || array->type != EXPR_IDENT || !index || index->type != EXPR_IDENT) return false;
+    for (int i = bce_range_count - 1; i >= 0; i--) {
+        if (bce_tok_is(array->token, bce_ranges[i].arr) && bce_tok_is(index->token, bce_ranges[i].idx)) {
+            bce_unchecked_sites++;
+            return true;
+        }
+    }
+    return false;
+}
+
+// For the `--release` report: element accesses emitted / proven in range.
+void codegen_bce_stats(int* sites, int* unchecked) {
+    if (sites) *sites = bce_index_sites;
+    if (unchecked) *unchecked = bce_unchecked_sites;
+}
+
 // S2: Emit a lambda function using the real codegen_expr pipeline instead of the
 // string-based mini-emitter. This gives string concat, string methods, float ops,
 // and block bodies for free - everything codegen_expr already handles.
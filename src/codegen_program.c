@@ -1247,13 +1247,15 @@ void codegen_program(Program* prog) {
                         }
                         emit(");\n    return __r;\n");
                     } else {
-                        emit("    (void)arg; return (void*)(intptr_t)%s(", spawn_wrappers[i].func_name);
+                        emit("    (void)arg; long long __r = (long long)%s(", spawn_wrappers[i].func_name);
                         for (int di = 0; di < total_params; di++) {
                             if (di > 0) emit(", ");
                             Expr* def = get_fn_default(spawn_wrappers[i].func_name, di);
                             if (def) { codegen_expr(def); } else { emit("0"); }
                         }
                         emit(");\n");
+                        if (spawn_wrappers[i].returns_string) emit("    wyn_rc_share((const void*)(intptr_t)__r);\n");
+                        emit("    return (void*)(intptr_t)__r;\n");
                     }
                 } else {
                     if (spawn_wrappers[i].returns_void) {
@@ -1262,7 +1264,9 @@ void codegen_program(Program* prog) {
                         emit("    (void)arg; %s* __r = malloc(sizeof(%s)); *__r = %s();\n    return __r;\n",
                              spawn_wrappers[i].return_type, spawn_wrappers[i].return_type, spawn_wrappers[i].func_name);
                     } else {
-                        emit("    (void)arg; return (void*)(intptr_t)%s();\n", spawn_wrappers[i].func_name);
+                        emit("    (void)arg; long long __r = (long long)%s();\n", spawn_wrappers[i].func_name);
+                        if (spawn_wrappers[i].returns_string) emit("    wyn_rc_share((const void*)(intptr_t)__r);\n");
+                        emit("    return (void*)(intptr_t)__r;\n");
                     }
                 }
                 emit("}\n\n");
@@ -1280,8 +1284,9 @@ void codegen_program(Program* prog) {
                     emit("    %s* __r = malloc(sizeof(%s));\n    *__r = %s(args->a0);\n    free(args);\n    return __r;\n",
                          spawn_wrappers[i].return_type, spawn_wrappers[i].return_type, spawn_wrappers[i].func_name);
                 } else {
-                    emit("    long long __r = (long long)%s(args->a0);\n    free(args);\n    return (void*)(intptr_t)__r;\n",
-                         spawn_wrappers[i].func_name);
+                    emit("    long long __r = (long long)%s(args->a0);\n    free(args);\n", spawn_wrappers[i].func_name);
+                    if (spawn_wrappers[i].returns_string) emit("    wyn_rc_share((const void*)(intptr_t)__r);\n");
+                    emit("    return (void*)(intptr_t)__r;\n");
                 }
                 emit("}\n\n");
             } else if (ac == 1) {
@@ -1328,6 +1333,7 @@ void codegen_program(Program* prog) {
                     }
                     emit(");\n");
                     if (_a1_str) emit("    wyn_rc_release(__a0);\n");
+                    if (spawn_wrappers[i].returns_string) emit("    wyn_rc_share((const void*)(intptr_t)__r);\n");
                     emit("    return (void*)(intptr_t)__r;\n");
                 }
                 emit("}\n\n");
@@ -1389,7 +1395,9 @@ void codegen_program(Program* prog) {
                         emit(");\n");
                         for (int j = 0; j < ac && j < 64; j++)
                             if (_str_field[j]) emit("    wyn_rc_release(args->a%d);\n", j);
-                        emit("    free(args);\n    return (void*)(intptr_t)__r;\n");
+                        emit("    free(args);\n");
+                        if (spawn_wrappers[i].returns_string) emit("    wyn_rc_share((const void*)(intptr_t)__r);\n");
+                        emit("    return (void*)(intptr_t)__r;\n");
                     }
                 }
                 emit("}\n\n");
@@ -169,7 +169,7 @@ static void emit_function_with_prefix(Stmt* fn_stmt, const char* prefix) {
     { extern void reset_shadow_vars(void); reset_shadow_vars(); }
     { extern void reset_string_vars(void); reset_string_vars(); }
     { extern void reset_borrowed_string_locals(void); reset_borrowed_string_locals(); }
-    { extern void reset_array_scope(void); reset_array_scope(); } { extern void reset_hashmap_scope(void); reset_hashmap_scope(); } { extern void reset_closure_scope(void); reset_closure_scope(); }
+    { extern void reset_array_scope(void); reset_array_scope(); } { extern void reset_hashmap_scope(void); reset_hashmap_scope(); } reset_packed_array_vars(); { extern void reset_closure_scope(void); reset_closure_scope(); }
     for (int i = 0; i < fn_stmt->fn.param_count; i++) {
         char param_name[256]; token_to_cstr(param_name, sizeof(param_name), fn_stmt->fn.params[i]);
         bool is_mut = fn_stmt->fn.param_mutable && fn_stmt->fn.param_mutable[i];
@@ -333,6 +333,7 @@ static void emit_function_with_prefix(Stmt* fn_stmt, const char* prefix) {
     // Restore context
     current_module_prefix = saved_prefix;
     current_fn_returns_string = _prev_fn_returns_string_mp;
+    reset_packed_array_vars();
 }
 
 static int stmt_line(Stmt* s) {
@@ -510,33 +511,24 @@ void codegen_stmt(Stmt* stmt) {
                         needs_arc_management = true;
                     }
                 } else if (stmt->var.type->type == EXPR_ARRAY) {
-                    // Handle typed array annotation like [int], [TokenType]
-                    // Use WynIntArray for [int] for performance (only when not returned from function)
-                    bool is_int_array = false;
-                    extern bool codegen_fn_returns_array;
-                    if (!codegen_fn_returns_array && stmt->var.type->array.count > 0 && stmt->var.type->array.elements[0]->type == EXPR_IDENT) {
-                        Token et = stmt->var.type->array.elements[0]->token;
-                        if (et.length == 3 && memcmp(et.start, "int", 3) == 0) is_int_array = true;
-                    }
-                    // The packed WynIntArray only supports push/sort/len/index/
-                    // iterate. If the veto pre-pass saw any other use of this
-                    // name, fall back to WynArray - the same representation the
-                    // INFERRED spelling (`xs = [1,2]`) uses - so both spellings
-                    // agree by construction instead of emitting C that mixes the
-                    // two (check-passes-then-codegen-fails, or worse a silent
-                    // wrong answer for `xs[i] = v`). See codegen.c's veto block.
-                    if (is_int_array) {
-                        char _vvn[128]; token_to_cstr(_vvn, sizeof(_vvn), stmt->var.name);
-                        extern int is_int_array_vetoed(const char*);
-                        if (is_int_array_vetoed(_vvn)) is_int_array = false;
-                    }
-                    if (is_int_array) {
-                        c_type = "WynIntArray";
-                        char _vn[128]; token_to_cstr(_vn, sizeof(_vn), stmt->var.name);
-                        extern void register_int_array_var(const char*);
-                        register_int_array_var(_vn);
+                    // Handle typed array annotation like [int], [TokenType].
+                    // [int]/[float]/[bool]/[Struct] locals built from an array
+                    // literal get a packed layout unless the veto pre-pass saw
+                    // a use it cannot express - then they stay WynArray, the
+                    // same representation the INFERRED spelling falls back to,
+                    // so both spellings agree by construction instead of
+                    // emitting C that mixes the two (check-passes-then-codegen-
+                    // fails, or worse a silent wrong answer for `xs[i] = v`).
+                    // See codegen.c's packed-array and veto blocks.
+                    char _vn[128]; token_to_cstr(_vn, sizeof(_vn), stmt->var.name);
+                    char _pct[128];
+                    PackedArrayKind _pk = packed_kind_for_decl(stmt, _pct, sizeof(_pct));
+                    if (_pk != PACKED_NONE) {
+                        c_type = packed_array_c_type(_pk);
+                        register_packed_array_var(_vn, _pk, _pct);
                     } else {
                         c_type = "WynArray";
+                        unregister_packed_array_var(_vn);
                     }
                     needs_arc_management = false;
                 } else if (stmt->var.type->type == EXPR_CALL) {
@@ -682,10 +674,19 @@ void codegen_stmt(Stmt* stmt) {
                 } else if (stmt->var.init->type == EXPR_ARRAY || stmt->var.init->type == EXPR_LIST_COMP) {
                     // Check if this array holds spawn futures (detected in pre-scan)
                     char _vn[256]; token_to_cstr(_vn, sizeof(_vn), stmt->var.name);
+                    char _pct[128];
+                    PackedArrayKind _pk = stmt->var.init->type == EXPR_ARRAY
+                        ? packed_kind_for_decl(stmt, _pct, sizeof(_pct)) : PACKED_NONE;
                     if (is_spawn_array(_vn)) {
                         c_type = "WynIntArray";
+                    } else if (_pk != PACKED_NONE) {
+                        // Checker-typed literal (`var xs = [1, 2, 3]`): packed
+                        // layout, same rules as the annotated spelling above.
+                        c_type = packed_array_c_type(_pk);
+                        register_packed_array_var(_vn, _pk, _pct);
                     } else {
                         c_type = "WynArray";
+                        unregister_packed_array_var(_vn);
                         register_array_var(_vn);
                     }
                     needs_arc_management = false;
@@ -1808,8 +1809,10 @@ void codegen_stmt(Stmt* stmt) {
                 // from a fresh producer (concat/interp/alloc) is NOT borrowed.
                 if (stmt->var.init && stmt->var.init->type == EXPR_IDENT) {
                     char _isrc[256]; token_to_cstr(_isrc, sizeof(_isrc), stmt->var.init->token);
-                    if (is_parameter(_isrc) || is_borrowed_string_local(_isrc))
-                        register_borrowed_string_local(_svn);
+                    if (is_parameter(_isrc))
+                        register_borrowed_string_local(_svn, _isrc);
+                    else if (is_borrowed_string_local(_isrc))
+                        register_borrowed_string_local(_svn, borrowed_string_origin(_isrc));
                 }
             }
             // Detect await_all on string spawn arrays → register result as string array
@@ -1992,10 +1995,19 @@ void codegen_stmt(Stmt* stmt) {
             {
                 char var_name[256]; token_to_cstr(var_name, sizeof(var_name), stmt->var.name);
                 register_local_variable(var_name);
+                // A non-packed redeclaration shadows an earlier packed local of
+                // the same name (the registry is keyed by name).
+                if (strcmp(c_type, "WynIntArray") != 0 && strcmp(c_type, "WynFloatArray") != 0 &&
+                    strcmp(c_type, "WynBoolArray") != 0 && strcmp(c_type, "WynStructArray") != 0)
+                    unregister_packed_array_var(var_name);
                 // Track arrays for scope-based cleanup
                 if (strcmp(c_type, "WynArray") == 0) {
                     extern void register_array_scope_var(const char*);
                     register_array_scope_var(var_name);
+                } else if (packed_array_kind(var_name) != PACKED_NONE && !is_spawn_array(var_name)) {
+                    static const char* _pfree[] = { "array_free", "int_array_free", "float_array_free",
+                                                    "bool_array_free", "struct_array_free" };
+                    register_array_scope_var_with(var_name, _pfree[packed_array_kind(var_name)]);
                 }
                 if (strcmp(c_type, "WynHashMap*") == 0) {
                     extern void register_hashmap_scope_var(const char*);
@@ -2018,13 +2030,22 @@ void codegen_stmt(Stmt* stmt) {
             if (needs_arc_management) {
                 codegen_expr(stmt->var.init);
             } else {
-                // Set spawn/int array flag for WynIntArray emission
+                // Set spawn/packed array flags so the literal initializer
+                // builds the declared layout
                 bool _was_int_array = codegen_emit_int_array;
+                PackedArrayKind _was_packed = codegen_emit_packed_kind;
+                const char* _was_packed_ct = codegen_emit_packed_ctype;
                 { char _vn[256]; token_to_cstr(_vn, sizeof(_vn), stmt->var.name);
-                  extern int is_int_array_var(const char*);
-                  if (is_spawn_array(_vn) || is_int_array_var(_vn)) codegen_emit_int_array = true; }
+                  PackedArrayKind _pk = packed_array_kind(_vn);
+                  if (is_spawn_array(_vn) || _pk == PACKED_INT) codegen_emit_int_array = true;
+                  else if (_pk != PACKED_NONE && stmt->var.init->type == EXPR_ARRAY) {
+                      codegen_emit_packed_kind = _pk;
+                      codegen_emit_packed_ctype = packed_array_elem_ctype(_vn);
+                  } }
                 codegen_expr(stmt->var.init);
                 codegen_emit_int_array = _was_int_array;
+                codegen_emit_packed_kind = _was_packed;
+                codegen_emit_packed_ctype = _was_packed_ct;
             }
             current_assign_target_kind = _prev_assign_kind;
             emit(";\n");
@@ -2328,7 +2349,7 @@ void codegen_stmt(Stmt* stmt) {
                     if (_w && _isstr) {
                         emit("{ const char* __sarg = (");
                         codegen_expr(call->call.args[0]);
-                        emit("); wyn_rc_retain(__sarg); wyn_spawn_fast_traced((TaskFunc)__spawn_wrapper_%s_1, (void*)(intptr_t)__sarg, __FILE__, __LINE__); }\n", func_name);
+                        emit("); wyn_rc_retain(__sarg); wyn_rc_share(__sarg); wyn_spawn_fast_traced((TaskFunc)__spawn_wrapper_%s_1, (void*)(intptr_t)__sarg, __FILE__, __LINE__); }\n", func_name);
                     } else if (_w) {
                         // Word-sized arg: rides the pointer cast, no malloc.
                         emit("wyn_spawn_fast_traced((TaskFunc)__spawn_wrapper_%s_1, (void*)(intptr_t)(", func_name);
@@ -2360,7 +2381,7 @@ void codegen_stmt(Stmt* stmt) {
                         emit("__sa_%d->a%d = ", sid, i);
                         codegen_expr(call->call.args[i]);
                         emit("; ");
-                        if (_fisstr) emit("wyn_rc_retain(__sa_%d->a%d); ", sid, i);
+                        if (_fisstr) emit("wyn_rc_retain(__sa_%d->a%d); wyn_rc_share(__sa_%d->a%d); ", sid, i, sid, i);
                     }
                     emit("wyn_spawn_fast_traced((TaskFunc)__spawn_wrapper_%s_%d, __sa_%d, __FILE__, __LINE__); }\n",
                          func_name, arg_count, sid);
@@ -2408,11 +2429,19 @@ void codegen_stmt(Stmt* stmt) {
                 extern Stmt** current_block_stmts; extern int current_block_count; extern int current_stmt_idx;
                 Stmt** _saved_stmts = current_block_stmts; int _saved_count = current_block_count; int _saved_idx = current_stmt_idx;
                 current_block_stmts = stmt->block.stmts; current_block_count = stmt->block.count;
+                // Db.transaction: a `return` inside ends the transaction too.
+                int _tx_defer = -1;
+                if (stmt->block.tx_end) {
+                    extern int get_defer_count(); extern void push_defer(Expr*);
+                    _tx_defer = get_defer_count();
+                    push_defer(stmt->block.tx_end);
+                }
                 for (int i = 0; i < stmt->block.count; i++) {
                     current_stmt_idx = i;
                     emit("    ");
                     codegen_stmt(stmt->block.stmts[i]);
                 }
+                if (_tx_defer >= 0) { extern void remove_defer_at(int); remove_defer_at(_tx_defer); }
                 current_block_stmts = _saved_stmts; current_block_count = _saved_count; current_stmt_idx = _saved_idx;
                 
                 // String cleanup first (needs macros still defined)
@@ -2959,7 +2988,7 @@ void codegen_stmt(Stmt* stmt) {
             { extern void reset_shadow_vars(void); reset_shadow_vars(); }
             { extern void reset_string_vars(void); reset_string_vars(); }
             { extern void reset_borrowed_string_locals(void); reset_borrowed_string_locals(); }
-            { extern void reset_array_scope(void); reset_array_scope(); } { extern void reset_hashmap_scope(void); reset_hashmap_scope(); } { extern void reset_closure_scope(void); reset_closure_scope(); }
+            { extern void reset_array_scope(void); reset_array_scope(); } { extern void reset_hashmap_scope(void); reset_hashmap_scope(); } reset_packed_array_vars(); { extern void reset_closure_scope(void); reset_closure_scope(); }
             for (int i = 0; i < stmt->fn.param_count; i++) {
                 char pname[256]; token_to_cstr(pname, sizeof(pname), stmt->fn.params[i]);
                 bool is_mut_p = stmt->fn.param_mutable && stmt->fn.param_mutable[i];
@@ -3213,6 +3242,7 @@ void codegen_stmt(Stmt* stmt) {
             current_fn_c_nonvoid = prev_fn_c_nonvoid;
             current_fn_returns_string = prev_fn_returns_string;
             codegen_fn_returns_array = _prev_fn_returns_array;
+            reset_packed_array_vars();
             emit("}\n\n");
             break;
         }
@@ -4192,19 +4222,31 @@ void codegen_stmt(Stmt* stmt) {
                         break;
                     }
                 }
-                // Check if iterating over a WynIntArray
+                // Check if iterating over a packed array local (WynIntArray,
+                // WynFloatArray, ...): walk the buffer directly, no WynValue.
                 if (stmt->for_stmt.array_expr->type == EXPR_IDENT) {
                     char _ian[128]; token_to_cstr(_ian, sizeof(_ian), stmt->for_stmt.array_expr->token);
-                    extern int is_int_array_var(const char*);
-                    if (is_int_array_var(_ian)) {
+                    PackedArrayKind _pk = packed_array_kind(_ian);
+                    if (_pk != PACKED_NONE) {
+                        Token lv = stmt->for_stmt.loop_var;
                         emit("{\n"); push_scope();
-                        emit("    WynIntArray __iter_iarr = "); codegen_expr(stmt->for_stmt.array_expr); emit(";\n");
+                        emit("    %s __iter_iarr = ", packed_array_c_type(_pk)); codegen_expr(stmt->for_stmt.array_expr); emit(";\n");
                         emit("    for (long long __i = 0; __i < __iter_iarr.count; __i++) {\n");
-                        emit("        long long %.*s = __iter_iarr.data[__i];\n", stmt->for_stmt.loop_var.length, stmt->for_stmt.loop_var.start);
+                        if (_pk == PACKED_STRUCT) {
+                            const char* _et = packed_array_elem_ctype(_ian);
+                            emit("        %s %.*s = ((%s*)__iter_iarr.data)[__i];\n", _et, lv.length, lv.start, _et);
+                        } else if (_pk == PACKED_BOOL) {
+                            emit("        bool %.*s = __iter_iarr.data[__i] != 0;\n", lv.length, lv.start);
+                        } else {
+                            emit("        %s %.*s = __iter_iarr.data[__i];\n", _pk == PACKED_FLOAT ? "double" : "long long", lv.length, lv.start);
+                        }
                         if (stmt->for_stmt.has_index) {
                             emit("        long long %.*s = __i;\n", stmt->for_stmt.index_var.length, stmt->for_stmt.index_var.start);
                         }
-                        codegen_stmt(stmt->for_stmt.body);
+                        { extern bool bce_enter_loop(Stmt*); extern void bce_leave_loop(void);
+                          bool _bce = bce_enter_loop(stmt);
+                          codegen_stmt(stmt->for_stmt.body);
+                          if (_bce) bce_leave_loop(); }
                         emit("    }\n");
                         pop_scope(); emit("}\n");
                         break;
@@ -4354,7 +4396,10 @@ void codegen_stmt(Stmt* stmt) {
                         register_local_variable(_ivn);
                     }
                 }
-                codegen_stmt(stmt->for_stmt.body);
+                { extern bool bce_enter_loop(Stmt*); extern void bce_leave_loop(void);
+                  bool _bce = bce_enter_loop(stmt);
+                  codegen_stmt(stmt->for_stmt.body);
+                  if (_bce) bce_leave_loop(); }
                 emit("    }\n");
                 pop_scope();
                 emit("}\n");
@@ -4375,7 +4420,10 @@ void codegen_stmt(Stmt* stmt) {
                 }
                 emit(") {\n");
                 push_scope();
-                codegen_stmt(stmt->for_stmt.body);
+                { extern bool bce_enter_loop(Stmt*); extern void bce_leave_loop(void);
+                  bool _bce = bce_enter_loop(stmt);
+                  codegen_stmt(stmt->for_stmt.body);
+                  if (_bce) bce_leave_loop(); }
                 pop_scope();
                 emit("    }\n");
             }
@@ -0,0 +1,31 @@
+#ifndef WYN_DNS_H
+#define WYN_DNS_H
+
+// Built-in DNS resolver (implemented in net_advanced.c). Every outbound
+// connect in the runtime resolves through it instead of the blocking libc
+// resolver: IP literals pass straight through, then the hosts file, then a
+// shared TTL cache (with negative caching), then UDP queries to the
+// resolv.conf nameservers that park a calling coroutine instead of blocking
+// its scheduler worker.
+//
+// Overrides (environment, read on first use):
+//   WYN_RESOLV_CONF  resolv.conf path (default /etc/resolv.conf). Its
+//                    nameserver lines may name a port as "ip#port".
+//   WYN_HOSTS_FILE   hosts file path (default /etc/hosts)
+
+#define WYN_DNS_ADDRSTRLEN 46   // INET6_ADDRSTRLEN
+#define WYN_DNS_MAX_ADDRS 8
+
+#define WYN_DNS_ANY 0
+#define WYN_DNS_V4 4
+#define WYN_DNS_V6 6
+
+// Resolve host to at most max textual addresses of the given family
+// (WYN_DNS_ANY prefers IPv4 and falls back to IPv6). Returns the number
+// written; 0 when the name does not exist or has no address of that family.
+int wyn_dns_resolve(const char* host, int family, char (*out)[WYN_DNS_ADDRSTRLEN], int max);
+
+// Forget every cached answer and re-check the hosts file on the next lookup.
+void wyn_dns_cache_clear(void);
+
+#endif
@@ -32,6 +32,12 @@ void wyn_spawn_fast_traced(TaskFunc func, void* arg, const char* file, int line)
 Future* wyn_spawn_async(TaskFuncWithReturn func, void* arg);
 Future* wyn_spawn_async_traced(TaskFuncWithReturn func, void* arg, const char* file, int line);
 
+// Blocking offload: from a coroutine, run func(arg) on the bounded blocking-task
+// pool and park the coroutine until it returns, so the scheduler worker stays
+// free; anywhere else, just call it. Backs Task.blocking and the runtime's file,
+// process, SQLite and log calls.
+void* wyn_blocking_run(TaskFuncWithReturn func, void* arg);
+
 // Spawn origin query (for coroutine-aware error messages)
 const char* wyn_spawn_origin_file(void);
 int wyn_spawn_origin_line(void);
@@ -1,96 +1,480 @@
 #define _POSIX_C_SOURCE 200809L
 #include "hashset.h"
+#include <stdint.h>
+#include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 
-#define HASHSET_SIZE 128
+// Open-addressing hash set with one control byte per slot, probed sixteen
+// slots at a time.
+//
+// The old set was a fixed 128-bucket chained table: it never grew, so past a
+// few thousand elements every lookup walked a long chain, and every insert
+// paid a malloc for the Entry plus a strdup for the key. Here the table is a
+// power-of-two array of slots (kept at most 7/8 full) plus a parallel array of
+// control bytes: EMPTY, DELETED, or the low 7 bits of the slot's hash. A
+// lookup hashes once, picks a 16-slot group, and compares all sixteen control
+// bytes against the 7-bit tag in one SSE2/NEON compare; only tag hits touch
+// the key array. Groups are probed triangularly (g, g+1, g+3, g+6, ...), which
+// visits every group of a power-of-two table, and a lookup stops at the first
+// group that still has an EMPTY byte.
+//
+// Keys are specialized per set: an int set stores the raw 64-bit values, a
+// string set stores the full 64-bit hash and a pointer into a per-set byte
+// arena, so adding a string is one memcpy into the arena instead of two
+// mallocs, and growth/rehash never rehashes a string. A set takes its kind
+// from its first element; mixing kinds degrades gracefully (ints are stored
+// as their decimal text) instead of reading an int as a char*.
+//
+// Union/intersection/difference size the result once from the inputs, walk
+// the full slots of one input group by group, probe the other with the stored
+// hash, and place keys without a duplicate check when they are known unique,
+// so set algebra does no per-element allocation or rehashing.
 
-typedef struct Entry {
-    char* key;
-    struct Entry* next;
-} Entry;
+#if defined(__SSE2__) && !defined(__TINYC__)
+#include <emmintrin.h>
+#define HS_SSE2 1
+#elif defined(__ARM_NEON) && defined(__aarch64__) && !defined(__TINYC__)
+#include <arm_neon.h>
+#define HS_NEON 1
+#endif
+
+#define HS_GROUP 16
+#define HS_MIN_CAP 16
+#define HS_EMPTY ((signed char)-128)
+#define HS_DELETED ((signed char)-2)
+#define HS_NOT_FOUND ((size_t)-1)
+#define HS_CHUNK_MIN (64 * 1024)
+
+enum { HS_NONE, HS_INT, HS_STR };
+
+typedef struct HsChunk {
+    struct HsChunk* next;
+    size_t used, cap;
+    char data[];
+} HsChunk;
 
 struct WynHashSet {
-    Entry* buckets[HASHSET_SIZE];
+    signed char* ctrl;     // cap control bytes
+    long long* ints;       // HS_INT: key per slot
+    const char** strs;     // HS_STR: key per slot, pointing into chunks
+    uint64_t* hashes;      // HS_STR: full hash per slot
+    size_t cap;            // slots, power of two, 0 until the first insert
+    size_t count;          // live keys
+    size_t tombs;          // DELETED control bytes
+    int kind;
+    HsChunk* chunks;       // string bytes; newest first
+    size_t live_bytes;     // string bytes still referenced by a slot
+    size_t arena_bytes;    // string bytes written to chunks
+    size_t reserved;       // reserve() before the first key fixed the kind
 };
 
-static unsigned int hash(const char* key) {
-    unsigned int h = 0;
-    while (*key) {
-        h = h * 31 + *key++;
+// --- hashing --------------------------------------------------------------
+
+static inline uint64_t hs_mix(uint64_t x) {
+    x ^= x >> 33;
+    x *= 0xff51afd7ed558ccdULL;
+    x ^= x >> 33;
+    x *= 0xc4ceb9fe1a85ec53ULL;
+    x ^= x >> 33;
+    return x;
+}
+
+static inline uint64_t hs_hash_int(long long k) {
+    return hs_mix((uint64_t)k);
+}
+
+static uint64_t hs_hash_str(const char* s, size_t n) {
+    uint64_t h = 0x9e3779b97f4a7c15ULL ^ (n * 0x2127599bf4325c37ULL);
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        uint64_t w;
+        memcpy(&w, s + i, 8);
+        h = (h ^ hs_mix(w)) * 0x880355f21e6d1965ULL;
+    }
+    if (i < n) {
+        uint64_t w = 0;
+        memcpy(&w, s + i, n - i);
+        h = (h ^ hs_mix(w)) * 0x880355f21e6d1965ULL;
+    }
+    return hs_mix(h);
+}
+
+static inline signed char hs_tag(uint64_t h) {
+    return (signed char)(h & 0x7f);
+}
+
+// --- control-byte groups --------------------------------------------------
+
+// Bit i set <=> ctrl[i] == b, for the sixteen bytes at g.
+static inline unsigned hs_match(const signed char* g, signed char b) {
+#if HS_SSE2
+    __m128i v = _mm_loadu_si128((const __m128i*)g);
+    return (unsigned)_mm_movemask_epi8(_mm_cmpeq_epi8(v, _mm_set1_epi8(b)));
+#elif HS_NEON
+    static const uint8_t bit[16] = {1, 2, 4, 8, 16, 32, 64, 128, 1, 2, 4, 8, 16, 32, 64, 128};
+    uint8x16_t m = vandq_u8(vceqq_s8(vld1q_s8(g), vdupq_n_s8(b)), vld1q_u8(bit));
+    return vaddv_u8(vget_low_u8(m)) | ((unsigned)vaddv_u8(vget_high_u8(m)) << 8);
+#else
+    unsigned m = 0;
+    for (int i = 0; i < HS_GROUP; i++) if (g[i] == b) m |= 1u << i;
+    return m;
+#endif
+}
+
+// Bit i set <=> ctrl[i] is EMPTY or DELETED (the only negative values).
+static inline unsigned hs_match_free(const signed char* g) {
+#if HS_SSE2
+    return (unsigned)_mm_movemask_epi8(_mm_loadu_si128((const __m128i*)g));
+#elif HS_NEON
+    static const uint8_t bit[16] = {1, 2, 4, 8, 16, 32, 64, 128, 1, 2, 4, 8, 16, 32, 64, 128};
+    uint8x16_t m = vandq_u8(vcltzq_s8(vld1q_s8(g)), vld1q_u8(bit));
+    return vaddv_u8(vget_low_u8(m)) | ((unsigned)vaddv_u8(vget_high_u8(m)) << 8);
+#else
+    unsigned m = 0;
+    for (int i = 0; i < HS_GROUP; i++) if (g[i] < 0) m |= 1u << i;
+    return m;
+#endif
+}
+
+static inline int hs_ctz(unsigned m) {
+#if defined(__GNUC__) && !defined(__TINYC__)
+    return __builtin_ctz(m);
+#else
+    int n = 0;
+    while (!(m & 1u)) { m >>= 1; n++; }
+    return n;
+#endif
+}
+
+// --- string arena ---------------------------------------------------------
+
+static const char* hs_keep(WynHashSet* set, const char* key, size_t n) {
+    HsChunk* c = set->chunks;
+    if (!c || c->cap - c->used < n + 1) {
+        size_t cap = c ? c->cap * 2 : HS_CHUNK_MIN;
+        if (cap > 16 * HS_CHUNK_MIN) cap = 16 * HS_CHUNK_MIN;
+        if (cap < n + 1) cap = n + 1;
+        c = malloc(sizeof(HsChunk) + cap);
+        if (!c) { fprintf(stderr, "HashSet: out of memory\n"); exit(1); }
+        c->next = set->chunks;
+        c->used = 0;
+        c->cap = cap;
+        set->chunks = c;
+    }
+    char* p = c->data + c->used;
+    memcpy(p, key, n);
+    p[n] = '\0';
+    c->used += n + 1;
+    set->live_bytes += n + 1;
+    set->arena_bytes += n + 1;
+    return p;
+}
+
+static void hs_free_chunks(HsChunk* c) {
+    while (c) {
+        HsChunk* next = c->next;
+        free(c);
+        c = next;
+    }
+}
+
+// --- table ----------------------------------------------------------------
+
+static void hs_alloc(WynHashSet* set, size_t cap) {
+    set->cap = cap;
+    set->ctrl = malloc(cap);
+    if (!set->ctrl) { fprintf(stderr, "HashSet: out of memory\n"); exit(1); }
+    memset(set->ctrl, (unsigned char)HS_EMPTY, cap);
+    if (set->kind == HS_INT) {
+        set->ints = malloc(cap * sizeof(long long));
+        if (!set->ints) { fprintf(stderr, "HashSet: out of memory\n"); exit(1); }
+    } else {
+        set->strs = malloc(cap * sizeof(const char*));
+        set->hashes = malloc(cap * sizeof(uint64_t));
+        if (!set->strs || !set->hashes) { fprintf(stderr, "HashSet: out of memory\n"); exit(1); }
+    }
+    set->tombs = 0;
+}
+
+static size_t hs_cap_for(size_t n) {
+    size_t cap = HS_MIN_CAP;
+    while (cap - cap / 8 < n) cap *= 2;
+    return cap;
+}
+
+// First EMPTY or DELETED slot on h's probe sequence. The caller guarantees
+// the key is absent and there is room.
+static size_t hs_free_slot(const WynHashSet* set, uint64_t h) {
+    size_t gmask = set->cap / HS_GROUP - 1;
+    size_t g = (size_t)(h >> 7) & gmask;
+    for (size_t step = 1;; step++) {
+        unsigned m = hs_match_free(set->ctrl + g * HS_GROUP);
+        if (m) return g * HS_GROUP + hs_ctz(m);
+        g = (g + step) & gmask;
+    }
+}
+
+static size_t hs_find_int(const WynHashSet* set, long long key, uint64_t h) {
+    if (set->cap == 0) return HS_NOT_FOUND;
+    size_t gmask = set->cap / HS_GROUP - 1;
+    size_t g = (size_t)(h >> 7) & gmask;
+    signed char tag = hs_tag(h);
+    for (size_t step = 1;; step++) {
+        const signed char* c = set->ctrl + g * HS_GROUP;
+        unsigned m = hs_match(c, tag);
+        while (m) {
+            size_t i = g * HS_GROUP + hs_ctz(m);
+            if (set->ints[i] == key) return i;
+            m &= m - 1;
+        }
+        if (hs_match(c, HS_EMPTY)) return HS_NOT_FOUND;
+        g = (g + step) & gmask;
+        if (step > gmask + 1) return HS_NOT_FOUND;
+    }
+}
+
+static size_t hs_find_str(const WynHashSet* set, const char* key, uint64_t h) {
+    if (set->cap == 0) return HS_NOT_FOUND;
+    size_t gmask = set->cap / HS_GROUP - 1;
+    size_t g = (size_t)(h >> 7) & gmask;
+    signed char tag = hs_tag(h);
+    for (size_t step = 1;; step++) {
+        const signed char* c = set->ctrl + g * HS_GROUP;
+        unsigned m = hs_match(c, tag);
+        while (m) {
+            size_t i = g * HS_GROUP + hs_ctz(m);
+            if (set->hashes[i] == h && strcmp(set->strs[i], key) == 0) return i;
+            m &= m - 1;
+        }
+        if (hs_match(c, HS_EMPTY)) return HS_NOT_FOUND;
+        g = (g + step) & gmask;
+        if (step > gmask + 1) return HS_NOT_FOUND;
+    }
+}
+
+static inline void hs_place_int(WynHashSet* set, long long key, uint64_t h) {
+    size_t i = hs_free_slot(set, h);
+    if (set->ctrl[i] == HS_DELETED) set->tombs--;
+    set->ctrl[i] = hs_tag(h);
+    set->ints[i] = key;
+    set->count++;
+}
+
+static inline void hs_place_str(WynHashSet* set, const char* kept, uint64_t h) {
+    size_t i = hs_free_slot(set, h);
+    if (set->ctrl[i] == HS_DELETED) set->tombs--;
+    set->ctrl[i] = hs_tag(h);
+    set->strs[i] = kept;
+    set->hashes[i] = h;
+    set->count++;
+}
+
+// Rebuild into a table sized for `want` keys. Drops tombstones, and for a
+// string set whose arena is mostly removed keys, compacts the arena too.
+static void hs_rehash(WynHashSet* set, size_t want) {
+    signed char* octrl = set->ctrl;
+    long long* oints = set->ints;
+    const char** ostrs = set->strs;
+    uint64_t* ohashes = set->hashes;
+    size_t ocap = set->cap;
+    HsChunk* ochunks = NULL;
+    int compact = set->kind == HS_STR && set->arena_bytes > 2 * set->live_bytes + HS_CHUNK_MIN;
+    if (compact) {
+        ochunks = set->chunks;
+        set->chunks = NULL;
+        set->live_bytes = set->arena_bytes = 0;
     }
-    return h % HASHSET_SIZE;
+    hs_alloc(set, hs_cap_for(want));
+    set->count = 0;
+    for (size_t i = 0; i < ocap; i++) {
+        if (octrl[i] < 0) continue;
+        if (set->kind == HS_INT) {
+            hs_place_int(set, oints[i], hs_hash_int(oints[i]));
+        } else {
+            const char* k = compact ? hs_keep(set, ostrs[i], strlen(ostrs[i])) : ostrs[i];
+            hs_place_str(set, k, ohashes[i]);
+        }
+    }
+    free(octrl);
+    free(oints);
+    free(ostrs);
+    free(ohashes);
+    hs_free_chunks(ochunks);
+}
+
+// Make room for one more key.
+static void hs_room(WynHashSet* set) {
+    if (set->cap == 0) {
+        hs_alloc(set, hs_cap_for(set->reserved));
+        return;
+    }
+    if (set->count + set->tombs + 1 <= set->cap - set->cap / 8) return;
+    // Mostly tombstones: rebuild in place; otherwise double.
+    hs_rehash(set, set->count * 2 > set->cap / 2 ? set->count * 2 + 1 : set->count + 1);
+}
+
+static void hs_become_str(WynHashSet* set);
+
+static int hs_int_text(long long key, char* buf, size_t n) {
+    return snprintf(buf, n, "%lld", key);
+}
+
+// A string that is exactly the decimal form of an int (what hs_int_text
+// would produce), so an int set can answer for it.
+static int hs_text_int(const char* key, long long* out) {
+    if (!*key) return 0;
+    char* end;
+    long long v = strtoll(key, &end, 10);
+    if (*end) return 0;
+    char buf[32];
+    hs_int_text(v, buf, sizeof buf);
+    if (strcmp(buf, key) != 0) return 0;
+    *out = v;
+    return 1;
 }
 
+static void hs_add_str(WynHashSet* set, const char* key) {
+    size_t n = strlen(key);
+    uint64_t h = hs_hash_str(key, n);
+    if (hs_find_str(set, key, h) != HS_NOT_FOUND) return;
+    hs_room(set);
+    hs_place_str(set, hs_keep(set, key, n), h);
+}
+
+static void hs_add_int(WynHashSet* set, long long key) {
+    uint64_t h = hs_hash_int(key);
+    if (hs_find_int(set, key, h) != HS_NOT_FOUND) return;
+    hs_room(set);
+    hs_place_int(set, key, h);
+}
+
+// Mark slot i free. A slot may go straight back to EMPTY when its group
+// still has an EMPTY byte: no probe ever continued past such a group, so no
+// key further along depends on this slot being occupied.
+static void hs_erase(WynHashSet* set, size_t i) {
+    const signed char* g = set->ctrl + (i & ~(size_t)(HS_GROUP - 1));
+    if (hs_match(g, HS_EMPTY)) {
+        set->ctrl[i] = HS_EMPTY;
+    } else {
+        set->ctrl[i] = HS_DELETED;
+        set->tombs++;
+    }
+    set->count--;
+}
+
+// An int set that receives a string key switches to string keys: each int
+// is re-added as its decimal text.
+static void hs_become_str(WynHashSet* set) {
+    signed char* octrl = set->ctrl;
+    long long* oints = set->ints;
+    size_t ocap = set->cap;
+    set->kind = HS_STR;
+    set->ints = NULL;
+    hs_alloc(set, hs_cap_for(set->count + 1));
+    set->count = 0;
+    char buf[32];
+    for (size_t i = 0; i < ocap; i++) {
+        if (octrl[i] < 0) continue;
+        int n = hs_int_text(oints[i], buf, sizeof buf);
+        hs_place_str(set, hs_keep(set, buf, (size_t)n), hs_hash_str(buf, (size_t)n));
+    }
+    free(octrl);
+    free(oints);
+}
+
+// --- public API -----------------------------------------------------------
+
 WynHashSet* hashset_new(void) {
     WynHashSet* set = calloc(1, sizeof(WynHashSet));
     return set;
 }
 
+void hashset_reserve(WynHashSet* set, long long n) {
+    if (n <= 0) return;
+    if (set->kind == HS_NONE) { set->reserved = (size_t)n; return; }
+    if ((size_t)n + set->tombs <= set->cap - set->cap / 8) return;
+    if (set->cap == 0) hs_alloc(set, hs_cap_for((size_t)n));
+    else hs_rehash(set, (size_t)n);
+}
+
 void hashset_add(WynHashSet* set, const char* key) {
-    unsigned int idx = hash(key);
-    Entry* entry = set->buckets[idx];
-    
-    // Check if already exists
-    while (entry) {
-        if (strcmp(entry->key, key) == 0) {
-            return; // Already in set
-        }
-        entry = entry->next;
-    }
-    
-    // Add new entry
-    Entry* new_entry = malloc(sizeof(Entry));
-    new_entry->key = strdup(key);
-    new_entry->next = set->buckets[idx];
-    set->buckets[idx] = new_entry;
-}
-
-int hashset_contains(WynHashSet* set, const char* key) {
-    unsigned int idx = hash(key);
-    Entry* entry = set->buckets[idx];
-    
-    while (entry) {
-        if (strcmp(entry->key, key) == 0) {
-            return 1;
-        }
-        entry = entry->next;
+    if (!key) key = "";
+    if (set->kind == HS_INT) {
+        long long v;
+        if (hs_text_int(key, &v)) { hs_add_int(set, v); return; }
+        hs_become_str(set);
     }
-    
-    return 0;
+    set->kind = HS_STR;
+    hs_add_str(set, key);
+}
+
+void hashset_add_int(WynHashSet* set, long long key) {
+    if (set->kind == HS_STR) {
+        char buf[32];
+        hs_int_text(key, buf, sizeof buf);
+        hs_add_str(set, buf);
+        return;
+    }
+    set->kind = HS_INT;
+    hs_add_int(set, key);
+}
+
+bool hashset_contains(WynHashSet* set, const char* key) {
+    if (!key) key = "";
+    if (set->kind == HS_INT) {
+        long long v;
+        return hs_text_int(key, &v) && hs_find_int(set, v, hs_hash_int(v)) != HS_NOT_FOUND;
+    }
+    if (set->kind != HS_STR) return 0;
+    return hs_find_str(set, key, hs_hash_str(key, strlen(key))) != HS_NOT_FOUND;
+}
+
+bool hashset_contains_int(WynHashSet* set, long long key) {
+    if (set->kind == HS_STR) {
+        char buf[32];
+        int n = hs_int_text(key, buf, sizeof buf);
+        return hs_find_str(set, buf, hs_hash_str(buf, (size_t)n)) != HS_NOT_FOUND;
+    }
+    if (set->kind != HS_INT) return 0;
+    return hs_find_int(set, key, hs_hash_int(key)) != HS_NOT_FOUND;
 }
 
 void hashset_remove(WynHashSet* set, const char* key) {
-    unsigned int idx = hash(key);
-    Entry* entry = set->buckets[idx];
-    Entry* prev = NULL;
-    
-    while (entry) {
-        if (strcmp(entry->key, key) == 0) {
-            if (prev) {
-                prev->next = entry->next;
-            } else {
-                set->buckets[idx] = entry->next;
-            }
-            free(entry->key);
-            free(entry);
-            return;
-        }
-        prev = entry;
-        entry = entry->next;
+    if (!key) key = "";
+    size_t i;
+    if (set->kind == HS_INT) {
+        long long v;
+        if (!hs_text_int(key, &v)) return;
+        i = hs_find_int(set, v, hs_hash_int(v));
+    } else if (set->kind == HS_STR) {
+        i = hs_find_str(set, key, hs_hash_str(key, strlen(key)));
+        if (i != HS_NOT_FOUND) set->live_bytes -= strlen(set->strs[i]) + 1;
+    } else {
+        return;
     }
+    if (i != HS_NOT_FOUND) hs_erase(set, i);
 }
 
-void hashset_free(WynHashSet* set) {
-    for (int i = 0; i < HASHSET_SIZE; i++) {
-        Entry* entry = set->buckets[i];
-        while (entry) {
-            Entry* next = entry->next;
-            free(entry->key);
-            free(entry);
-            entry = next;
-        }
+void hashset_remove_int(WynHashSet* set, long long key) {
+    if (set->kind == HS_STR) {
+        char buf[32];
+        hs_int_text(key, buf, sizeof buf);
+        hashset_remove(set, buf);
+        return;
     }
+    if (set->kind != HS_INT) return;
+    size_t i = hs_find_int(set, key, hs_hash_int(key));
+    if (i != HS_NOT_FOUND) hs_erase(set, i);
+}
+
+void hashset_free(WynHashSet* set) {
+    if (!set) return;
+    free(set->ctrl);
+    free(set->ints);
+    free(set->strs);
+    free(set->hashes);
+    hs_free_chunks(set->chunks);
     free(set);
 }
 
@@ -99,7 +483,7 @@ void wyn_hashset_insert(WynHashSet* set, const char* key) {
     hashset_add(set, key);
 }
 
-int wyn_hashset_contains(WynHashSet* set, const char* key) {
+bool wyn_hashset_contains(WynHashSet* set, const char* key) {
     return hashset_contains(set, key);
 }
 
@@ -107,102 +491,159 @@ void wyn_hashset_remove(WynHashSet* set, const char* key) {
     hashset_remove(set, key);
 }
 
+void wyn_hashset_add_int(WynHashSet* set, long long key) {
+    hashset_add_int(set, key);
+}
+
+bool wyn_hashset_contains_int(WynHashSet* set, long long key) {
+    return hashset_contains_int(set, key);
+}
+
 int wyn_hashset_len(WynHashSet* set) {
-    int count = 0;
-    for (int i = 0; i < HASHSET_SIZE; i++) {
-        Entry* entry = set->buckets[i];
-        while (entry) {
-            count++;
-            entry = entry->next;
-        }
-    }
-    return count;
+    return (int)set->count;
 }
 
-int wyn_hashset_is_empty(WynHashSet* set) {
-    return wyn_hashset_len(set) == 0;
+bool wyn_hashset_is_empty(WynHashSet* set) {
+    return set->count == 0;
 }
 
 void wyn_hashset_clear(WynHashSet* set) {
-    for (int i = 0; i < HASHSET_SIZE; i++) {
-        Entry* entry = set->buckets[i];
-        while (entry) {
-            Entry* next = entry->next;
-            free(entry->key);
-            free(entry);
-            entry = next;
+    free(set->ctrl);
+    free(set->ints);
+    free(set->strs);
+    free(set->hashes);
+    hs_free_chunks(set->chunks);
+    memset(set, 0, sizeof *set);
+}
+
+// --- set algebra ----------------------------------------------------------
+
+// Bitmask of the full slots in the group starting at slot g.
+static inline unsigned hs_full(const WynHashSet* set, size_t g) {
+    return ~hs_match_free(set->ctrl + g) & 0xffffu;
+}
+
+// Both operands in one key kind. A set that has never held a key takes the
+// other's kind; an int set meeting a string set is viewed as strings through
+// a temporary copy (*tmp, freed by the caller).
+static int hs_common_kind(WynHashSet** a, WynHashSet** b, WynHashSet** tmp) {
+    *tmp = NULL;
+    if ((*a)->kind == HS_NONE) return (*b)->kind;
+    if ((*b)->kind == HS_NONE || (*a)->kind == (*b)->kind) return (*a)->kind;
+    WynHashSet** ints = (*a)->kind == HS_INT ? a : b;
+    WynHashSet* copy = hashset_new();
+    char buf[32];
+    copy->kind = HS_STR;
+    hashset_reserve(copy, (long long)(*ints)->count);
+    for (size_t g = 0; g < (*ints)->cap; g += HS_GROUP) {
+        for (unsigned m = hs_full(*ints, g); m; m &= m - 1) {
+            int n = hs_int_text((*ints)->ints[g + hs_ctz(m)], buf, sizeof buf);
+            hs_place_str(copy, hs_keep(copy, buf, (size_t)n), hs_hash_str(buf, (size_t)n));
         }
-        set->buckets[i] = NULL;
     }
+    *ints = copy;
+    *tmp = copy;
+    return HS_STR;
+}
+
+static inline int hs_has_slot(const WynHashSet* in, const WynHashSet* of, size_t i) {
+    if (in->kind != of->kind) return 0;
+    if (of->kind == HS_INT) return hs_find_int(in, of->ints[i], hs_hash_int(of->ints[i])) != HS_NOT_FOUND;
+    return hs_find_str(in, of->strs[i], of->hashes[i]) != HS_NOT_FOUND;
+}
+
+// Copy slot i of `from` into `to`, which has room and does not hold the key.
+static inline void hs_put_slot(WynHashSet* to, const WynHashSet* from, size_t i) {
+    if (from->kind == HS_INT) {
+        hs_place_int(to, from->ints[i], hs_hash_int(from->ints[i]));
+    } else {
+        const char* k = from->strs[i];
+        hs_place_str(to, hs_keep(to, k, strlen(k)), from->hashes[i]);
+    }
+}
+
+static WynHashSet* hs_sized(int kind, size_t n, size_t bytes) {
+    WynHashSet* r = hashset_new();
+    r->kind = kind;
+    if (kind == HS_NONE) return r;
+    hs_alloc(r, hs_cap_for(n));
+    if (kind == HS_STR && bytes) {
+        // One chunk big enough for every key the result can take.
+        HsChunk* c = malloc(sizeof(HsChunk) + bytes);
+        if (!c) { fprintf(stderr, "HashSet: out of memory\n"); exit(1); }
+        c->next = NULL;
+        c->used = 0;
+        c->cap = bytes;
+        r->chunks = c;
+    }
+    return r;
 }
 
 WynHashSet* wyn_hashset_union(WynHashSet* set1, WynHashSet* set2) {
-    WynHashSet* result = hashset_new();
-    for (int i = 0; i < HASHSET_SIZE; i++) {
-        Entry* entry = set1->buckets[i];
-        while (entry) {
-            hashset_add(result, entry->key);
-            entry = entry->next;
+    WynHashSet *a = set1, *b = set2, *tmp;
+    int kind = hs_common_kind(&a, &b, &tmp);
+    WynHashSet* r = hs_sized(kind, a->count + b->count, a->live_bytes + b->live_bytes);
+    for (size_t g = 0; g < a->cap; g += HS_GROUP)
+        for (unsigned m = hs_full(a, g); m; m &= m - 1)
+            hs_put_slot(r, a, g + hs_ctz(m));
+    for (size_t g = 0; g < b->cap; g += HS_GROUP)
+        for (unsigned m = hs_full(b, g); m; m &= m - 1) {
+            size_t i = g + hs_ctz(m);
+            if (!hs_has_slot(a, b, i)) hs_put_slot(r, b, i);
         }
-        entry = set2->buckets[i];
-        while (entry) {
-            hashset_add(result, entry->key);
-            entry = entry->next;
-        }
-    }
-    return result;
+    hashset_free(tmp);
+    return r;
 }
 
 WynHashSet* wyn_hashset_intersection(WynHashSet* set1, WynHashSet* set2) {
-    WynHashSet* result = hashset_new();
-    for (int i = 0; i < HASHSET_SIZE; i++) {
-        Entry* entry = set1->buckets[i];
-        while (entry) {
-            if (hashset_contains(set2, entry->key)) {
-                hashset_add(result, entry->key);
-            }
-            entry = entry->next;
+    WynHashSet *a = set1, *b = set2, *tmp;
+    int kind = hs_common_kind(&a, &b, &tmp);
+    WynHashSet* small = a->count <= b->count ? a : b;
+    WynHashSet* large = small == a ? b : a;
+    WynHashSet* r = hs_sized(kind, small->count, small->live_bytes);
+    for (size_t g = 0; g < small->cap; g += HS_GROUP)
+        for (unsigned m = hs_full(small, g); m; m &= m - 1) {
+            size_t i = g + hs_ctz(m);
+            if (hs_has_slot(large, small, i)) hs_put_slot(r, small, i);
         }
-    }
-    return result;
+    hashset_free(tmp);
+    return r;
 }
 
 WynHashSet* wyn_hashset_difference(WynHashSet* set1, WynHashSet* set2) {
-    WynHashSet* result = hashset_new();
-    for (int i = 0; i < HASHSET_SIZE; i++) {
-        Entry* entry = set1->buckets[i];
-        while (entry) {
-            if (!hashset_contains(set2, entry->key)) {
-                hashset_add(result, entry->key);
-            }
-            entry = entry->next;
+    WynHashSet *a = set1, *b = set2, *tmp;
+    int kind = hs_common_kind(&a, &b, &tmp);
+    WynHashSet* r = hs_sized(kind, a->count, a->live_bytes);
+    for (size_t g = 0; g < a->cap; g += HS_GROUP)
+        for (unsigned m = hs_full(a, g); m; m &= m - 1) {
+            size_t i = g + hs_ctz(m);
+            if (!hs_has_slot(b, a, i)) hs_put_slot(r, a, i);
         }
-    }
-    return result;
+    hashset_free(tmp);
+    return r;
 }
 
-int wyn_hashset_is_subset(WynHashSet* set1, WynHashSet* set2) {
-    for (int i = 0; i < HASHSET_SIZE; i++) {
-        Entry* entry = set1->buckets[i];
-        while (entry) {
-            if (!hashset_contains(set2, entry->key)) {
-                return 0;
-            }
-            entry = entry->next;
-        }
-    }
-    return 1;
+bool wyn_hashset_is_subset(WynHashSet* set1, WynHashSet* set2) {
+    if (set1->count > set2->count) return 0;
+    WynHashSet *a = set1, *b = set2, *tmp;
+    hs_common_kind(&a, &b, &tmp);
+    int ok = 1;
+    for (size_t g = 0; ok && g < a->cap; g += HS_GROUP)
+        for (unsigned m = hs_full(a, g); m; m &= m - 1)
+            if (!hs_has_slot(b, a, g + hs_ctz(m))) { ok = 0; break; }
+    hashset_free(tmp);
+    return ok;
 }
 
-int wyn_hashset_is_disjoint(WynHashSet* set1, WynHashSet* set2) {
-    for (int i = 0; i < HASHSET_SIZE; i++) {
-        Entry* entry = set1->buckets[i];
-        while (entry) {
-            if (hashset_contains(set2, entry->key)) {
-                return 0;
-            }
-            entry = entry->next;
-        }
-    }
-    return 1;
+bool wyn_hashset_is_disjoint(WynHashSet* set1, WynHashSet* set2) {
+    WynHashSet *a = set1, *b = set2, *tmp;
+    hs_common_kind(&a, &b, &tmp);
+    WynHashSet* small = a->count <= b->count ? a : b;
+    WynHashSet* large = small == a ? b : a;
+    int ok = 1;
+    for (size_t g = 0; ok && g < small->cap; g += HS_GROUP)
+        for (unsigned m = hs_full(small, g); m; m &= m - 1)
+            if (hs_has_slot(large, small, g + hs_ctz(m))) { ok = 0; break; }
+    hashset_free(tmp);
+    return ok;
 }
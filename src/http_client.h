@@ -0,0 +1,41 @@
+#ifndef WYN_HTTP_CLIENT_H
+#define WYN_HTTP_CLIENT_H
+
+#include <stddef.h>
+
+// Pooled, coroutine-aware HTTP/1.1 client (implemented in net_advanced.c).
+// Http_get/Http_post and the http_get/http_post/... builtins all go through
+// wyn_http_fetch, so they share one keep-alive pool per host:port.
+//
+// Tunables (environment, read once on first use):
+//   WYN_HTTP_POOL_MAX  idle connections kept per host:port (default 64;
+//                      0 disables pooling - every request sends
+//                      Connection: close, the old behaviour)
+//   WYN_HTTP_IDLE_MS   evict idle pooled connections after this long
+//                      (default 30000)
+
+typedef struct {
+    int status;
+    char* headers;      // raw header block incl. status line, NUL-terminated
+    char* body;         // NUL-terminated; body_len is authoritative (may hold NULs)
+    size_t body_len;
+    char error[256];    // set when wyn_http_fetch returns non-zero
+} WynHttpResult;
+
+// Perform one request. Inside a coroutine every connect/send/recv that would
+// block parks the coroutine on the io_loop reactor instead of blocking the
+// scheduler worker; outside one it waits with poll() up to Http.set_timeout.
+// extra_headers are complete "Name: value" lines without CRLF. content_type is
+// only sent when body is non-NULL. Returns 0 on success (out owns malloc'd
+// headers/body - release with wyn_http_result_free), -1 with out->error set.
+int wyn_http_fetch(const char* method, const char* url,
+                   const char* const* extra_headers, int extra_count,
+                   const char* body, size_t body_len, const char* content_type,
+                   WynHttpResult* out);
+
+void wyn_http_result_free(WynHttpResult* r);
+
+// Close every idle pooled connection (tests, and programs about to fork).
+void wyn_http_pool_clear(void);
+
+#endif
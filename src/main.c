@@ -871,6 +871,13 @@ int main(int argc, char** argv) {
         return 1;
     }
     
+    // Build-time helper, not a user command: prints src/checker_builtins_table.h
+    // (the static builtin symbol table). The Makefile runs it after linking.
+    if (strcmp(command, "__builtin-table") == 0) {
+        extern int checker_emit_builtin_table(FILE* out);
+        return checker_emit_builtin_table(stdout);
+    }
+
     if (strcmp(command, "wisdom") == 0) {
         extern void print_flight_rules();
         print_flight_rules();
@@ -1439,6 +1446,7 @@ int main(int argc, char** argv) {
             else if (strcmp(argv[i], "--python") == 0) build_flag = " --python";
             else if (strcmp(argv[i], "--release") == 0) build_release = 1;
             else if (strcmp(argv[i], "--fast") == 0) { /* skip optimizations - default behavior */ }
+            else if (strcmp(argv[i], "-O0") == 0 || strcmp(argv[i], "-O1") == 0 || strcmp(argv[i], "-O2") == 0) { /* AST optimizer level: opt_level_from_args */ }
             else if (strcmp(argv[i], "--pgo") == 0) build_pgo = 1;
             else if (strcmp(argv[i], "-o") == 0 && i + 1 < argc) { output_name = argv[++i]; }
             else if (strcmp(argv[i], "--target") == 0 && i + 1 < argc) { build_target = argv[++i]; }
@@ -1560,6 +1568,8 @@ int main(int argc, char** argv) {
         { extern void set_checker_source(const char*, const char*); set_checker_source(source, entry); }
         check_program(prog);
         if (checker_had_error()) { fprintf(stderr, "Compilation failed\n"); wynter_encourage(); free(source); return 1; }
+        init_optimizer(opt_level_from_args(argc, argv));
+        optimize_program(prog);
         
         char out_c[256];
         snprintf(out_c, sizeof(out_c), "%s.c", entry);
@@ -1871,6 +1881,15 @@ int main(int argc, char** argv) {
             } else {
                 printf("\033[32m✓\033[0m Built: %s (%ldms)\n", bin_path, _build_ms);
             }
+            // Release builds report what bounds-check elimination removed
+            // (see codegen_lambda.c), so a loop that silently lost its
+            // eligibility shows up as a lower count.
+            if (build_release) {
+                extern void codegen_bce_stats(int*, int*);
+                int _sites = 0, _nc = 0;
+                codegen_bce_stats(&_sites, &_nc);
+                printf("  bounds checks: %d of %d array index sites unchecked (index proven in range)\n", _nc, _sites);
+            }
         } else {
             fprintf(stderr, "\033[31m✗\033[0m Build failed\n");
             // Show compiler errors if available
@@ -2188,6 +2207,8 @@ int main(int argc, char** argv) {
             free(source);
             return 1;
         }
+        init_optimizer(opt_level_from_args(argc, argv));
+        optimize_program(prog);
 
         // Cross-compile parity: honor the [gpu] opt-in for the CROSS target too,
         // so `wyn cross linux` on a [gpu]-opted project emits the dual-path map
@@ -2856,6 +2877,7 @@ int main(int argc, char** argv) {
             if (strcmp(argv[i], "--debug") == 0) keep_artifacts = 1;
             else if (strcmp(argv[i], "--mem-stats") == 0) mem_stats = 1;
             else if (strcmp(argv[i], "--fast") == 0 || strcmp(argv[i], "--release") == 0 || strcmp(argv[i], "--shared") == 0 || strcmp(argv[i], "--python") == 0) {}
+            else if (strcmp(argv[i], "-O0") == 0 || strcmp(argv[i], "-O1") == 0 || strcmp(argv[i], "-O2") == 0) {}
             else if (strcmp(argv[i], "-e") == 0 && i + 1 < argc) { eval_code = argv[++i]; }
             else if (!file) file = argv[i];
         }
@@ -2897,10 +2919,20 @@ int main(int argc, char** argv) {
         const char* platform_libs = "-Wl,--allow-multiple-definition -lpthread -lm";
         #endif
         
+        // The cached binary is per AST-optimizer level. With one <file>.out
+        // shared by every level, `wyn run x.wyn -O0` followed by `-O2` silently
+        // re-ran the -O0 binary (the mtime check below cannot tell them apart),
+        // so comparing levels measured nothing. The default level keeps the
+        // plain <file>.out name; -O0 / -O2 get <file>.O0.out / <file>.O2.out.
+        OptLevel run_opt = opt_level_from_args(argc, argv);
+        char run_bin[560];
+        if (run_opt == OPT_O1) snprintf(run_bin, sizeof(run_bin), "%s.out", file);
+        else snprintf(run_bin, sizeof(run_bin), "%s.O%d.out", file, (int)run_opt);
+
         // Incremental: skip recompilation if binary is newer than source
         {
-            char out_path[512];
-            snprintf(out_path, sizeof(out_path), "%s.out", file);
+            char out_path[600];
+            snprintf(out_path, sizeof(out_path), "%s", run_bin);
             struct stat src_st, out_st;
             if (stat(file, &src_st) == 0 && stat(out_path, &out_st) == 0) {
                 // Cache validity also depends on the COMPILER: a rebuilt `wyn`
@@ -2996,6 +3028,8 @@ int main(int argc, char** argv) {
             free(source);
             return 1;
         }
+        init_optimizer(run_opt);
+        optimize_program(prog);
         
         char out_path[256];
         snprintf(out_path, 256, "%s.c", file);
@@ -3126,8 +3160,8 @@ int main(int argc, char** argv) {
             // Read the generated C source
             char* c_source = read_file(out_path);
             if (c_source) {
-                char exe_path[512];
-                snprintf(exe_path, sizeof(exe_path), "%s.out", file);
+                char exe_path[600];
+                snprintf(exe_path, sizeof(exe_path), "%s", run_bin);
                 int tcc_result = wyn_tcc_compile_to_exe(c_source, exe_path, wyn_root, NULL);
                 free(c_source);
                 if (tcc_result == 0) {
@@ -3140,11 +3174,11 @@ int main(int argc, char** argv) {
                     int rc = 0;
                     // A leading "./" is a Unix idiom; cmd.exe rejects it with
                     // "'.' is not recognized". On Windows run the path as-is.
-                    if (file[0] == '/') rc = snprintf(run_cmd, sizeof(run_cmd), "%s.out", file);
+                    if (file[0] == '/') rc = snprintf(run_cmd, sizeof(run_cmd), "%s", run_bin);
 #ifdef _WIN32
-                    else rc = snprintf(run_cmd, sizeof(run_cmd), "%s.out", file);
+                    else rc = snprintf(run_cmd, sizeof(run_cmd), "%s", run_bin);
 #else
-                    else rc = snprintf(run_cmd, sizeof(run_cmd), "./%s.out", file);
+                    else rc = snprintf(run_cmd, sizeof(run_cmd), "./%s", run_bin);
 #endif
                     if (user_args_start > 0) {
                         for (int i = user_args_start; i < argc && rc < (int)sizeof(run_cmd) - 2; i++) {
@@ -3179,15 +3213,15 @@ int main(int argc, char** argv) {
         if (rt_check) {
             fclose(rt_check);
             snprintf(compile_cmd, sizeof(compile_cmd),
-                     "%s -std=c11 %s -w -Wno-error -Wno-incompatible-pointer-types -Wno-int-conversion -I %s/src -o %s.out %s.c %s/runtime/libwyn_rt.a %s 2>wyn_cc_err.txt",
-                     cc, opt_level, wyn_root, file, file, wyn_root, platform_libs);
+                     "%s -std=c11 %s -w -Wno-error -Wno-incompatible-pointer-types -Wno-int-conversion -I %s/src -o %s %s.c %s/runtime/libwyn_rt.a %s 2>wyn_cc_err.txt",
+                     cc, opt_level, wyn_root, run_bin, file, wyn_root, platform_libs);
         } else {
             // Fallback: compile from source using unified source list
             char src_list[4096];
             build_source_list(src_list, sizeof(src_list), wyn_root);
             snprintf(compile_cmd, sizeof(compile_cmd),
-                     "%s -std=c11 %s -w -Wno-error -Wno-incompatible-pointer-types -Wno-int-conversion -D_GNU_SOURCE -I %s/src -I %s/vendor/minicoro -o %s.out %s.c %s %s 2>wyn_cc_err.txt",
-                     cc, opt_level, wyn_root, wyn_root, file, file, src_list, platform_libs);
+                     "%s -std=c11 %s -w -Wno-error -Wno-incompatible-pointer-types -Wno-int-conversion -D_GNU_SOURCE -I %s/src -I %s/vendor/minicoro -o %s %s.c %s %s 2>wyn_cc_err.txt",
+                     cc, opt_level, wyn_root, wyn_root, run_bin, file, src_list, platform_libs);
         }
         // Append optional flags before the redirect
         if (sqlite_flags[0] || gui_flags[0] || app_flags[0] || ffi_flags[0]) {
@@ -3440,9 +3474,9 @@ int main(int argc, char** argv) {
         char run_cmd[4096];
         int _rc = 0;
         if (mem_stats) {
-            char bin[512];
-            if (file[0] == '/') snprintf(bin, 512, "%s.out", file);
-            else snprintf(bin, 512, "./%s.out", file);
+            char bin[600];
+            if (file[0] == '/') snprintf(bin, sizeof(bin), "%s", run_bin);
+            else snprintf(bin, sizeof(bin), "./%s", run_bin);
             _rc = snprintf(run_cmd, sizeof(run_cmd),
                 "%s; /usr/bin/time -l %s < /dev/null 2>/tmp/__wyn_ms > /dev/null;"
                 " echo '\\033[2m=== Memory Stats ===\\033[0m';"
@@ -3450,9 +3484,9 @@ int main(int argc, char** argv) {
                 " rm -f /tmp/__wyn_ms", bin, bin);
         } else {
             if (file[0] == '/')
-                _rc = snprintf(run_cmd, sizeof(run_cmd), "%s.out", file);
+                _rc = snprintf(run_cmd, sizeof(run_cmd), "%s", run_bin);
             else
-                _rc = snprintf(run_cmd, sizeof(run_cmd), "./%s.out", file);
+                _rc = snprintf(run_cmd, sizeof(run_cmd), "./%s", run_bin);
             if (user_args_start > 0) {
                 for (int i = user_args_start; i < argc && _rc < (int)sizeof(run_cmd) - 2; i++) {
                     _rc += snprintf(run_cmd + _rc, sizeof(run_cmd) - _rc, " %s", argv[i]);
@@ -3550,16 +3584,7 @@ int main(int argc, char** argv) {
     // Apply optimizations
     if (optimization > OPT_NONE) {
         printf("Applying optimizations (level %d)...\n", optimization);
-        eliminate_dead_code(prog);
-        inline_small_functions(prog);
-        
-        // Apply constant folding to all expressions in the program
-        for (int i = 0; i < prog->count; i++) {
-            Stmt* stmt = prog->stmts[i];
-            if (stmt && stmt->type == STMT_EXPR && stmt->expr) {
-                stmt->expr = fold_constants(stmt->expr);
-            }
-        }
+        optimize_program(prog);
     }
     
 }
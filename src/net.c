@@ -681,7 +681,9 @@ void wyn_net_cleanup(void) {
     // On Unix systems, no special cleanup needed
 }
 
-// DNS resolution
+// DNS resolution. POSIX builds resolve through the built-in resolver in
+// net_advanced.c (dns.h); this getaddrinfo version is the Windows path.
+#ifdef _WIN32
 char** wyn_resolve_hostname(const char* hostname, WynNetError* error) {
     if (!hostname) {
         if (error) *error = WYN_NET_ERROR_INVALID_ADDR;
@@ -728,6 +730,7 @@ char** wyn_resolve_hostname(const char* hostname, WynNetError* error) {
     if (error) *error = WYN_NET_SUCCESS;
     return addresses;
 }
+#endif
 
 void wyn_free_hostname_list(char** addresses) {
     if (!addresses) return;
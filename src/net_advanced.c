@@ -21,13 +21,655 @@
 #include <netdb.h>
 #include <fcntl.h>
 #include <poll.h>
+#include <netinet/tcp.h>
+#include <pthread.h>
 #include "wyn_arena.h"
 #include "coroutine.h"
 #include "io_loop.h"
 
+// ============================================================================
+// DNS resolver
+// ============================================================================
+//
+// wyn_dns_resolve (see dns.h) is what every outbound connect in the runtime
+// resolves through: the HTTP client, Socket_connect, Net.connect/Net.resolve
+// and wyn_resolve_hostname.
+//
+// WHY: each connect used to call getaddrinfo/gethostbyname. That is a blocking
+// libc call (gethostbyname is not even thread-safe), it stalls the scheduler
+// worker it runs on, and nothing was cached, so a service making thousands of
+// calls per second to a handful of hosts sent thousands of identical queries.
+// Now a lookup goes:
+//   1. IP literal           - returned as-is, no I/O.
+//   2. hosts file           - parsed once, re-read when its mtime changes.
+//   3. shared cache         - positive answers live for the record TTL,
+//                             NXDOMAIN/NODATA for the SOA negative TTL
+//                             (RFC 2308). Concurrent misses for one name
+//                             coalesce onto a single query.
+//   4. UDP query            - to the resolv.conf nameservers, honouring its
+//                             search/ndots/timeout/attempts.
+// The socket is non-blocking. Inside a coroutine the wait parks on io_loop
+// timers in short slices rather than on fd readiness: a reactor fd wait has no
+// timeout and cannot be cancelled, and a lost UDP datagram must not strand the
+// coroutine. Outside a coroutine it poll()s.
+//
+// If no nameserver answers at all (none configured or reachable, or a reply
+// truncated past 512 bytes - there is no TCP fallback) the lookup falls back to
+// getaddrinfo, so hosts that depend on NSS (mDNS, LDAP, ...) keep working; that
+// result is cached briefly since getaddrinfo reports no TTL.
+
+#include <ctype.h>
+#include <stdatomic.h>
+#include <strings.h>
+#include <sys/stat.h>
+#include "dns.h"
+#include "net.h"
+
+#define DNS_MAX_SERVERS 3
+#define DNS_MAX_SEARCH 6
+#define DNS_CACHE_BUCKETS 256
+#define DNS_CACHE_MAX 4096
+#define DNS_MAX_TTL 86400
+#define DNS_DEFAULT_NEG_TTL 30
+#define DNS_FALLBACK_TTL 5
+
+typedef struct {
+    struct sockaddr_storage addr[DNS_MAX_SERVERS];
+    socklen_t addr_len[DNS_MAX_SERVERS];
+    int server_count;
+    char search[DNS_MAX_SEARCH][256];
+    int search_count;
+    int ndots, timeout_s, attempts;
+} DnsConf;
+
+typedef struct {
+    char ip[WYN_DNS_ADDRSTRLEN];
+    char name[256];
+} DnsHostEntry;
+
+typedef struct DnsCacheEntry {
+    char name[256];
+    int family;
+    int count;                  // 0 = negative entry
+    char addrs[WYN_DNS_MAX_ADDRS][WYN_DNS_ADDRSTRLEN];
+    long long expires_ms;
+    int pending;                // a lookup for this name is in flight
+    struct DnsCacheEntry* next;
+} DnsCacheEntry;
+
+static pthread_mutex_t dns_lock = PTHREAD_MUTEX_INITIALIZER;
+static DnsConf dns_conf;
+static int dns_conf_loaded = 0;
+static DnsHostEntry* dns_hosts = NULL;
+static int dns_host_count = 0;
+static time_t dns_hosts_mtime = 0;
+static long long dns_hosts_checked_ms = -1;
+static DnsCacheEntry* dns_cache[DNS_CACHE_BUCKETS];
+static int dns_cache_size = 0;
+
+static long long dns_now_ms(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (long long)ts.tv_sec * 1000 + ts.tv_nsec / 1000000;
+}
+
+static int dns_family_of(const char* ip) {
+    return strchr(ip, ':') ? WYN_DNS_V6 : WYN_DNS_V4;
+}
+
+// Textual address + port -> sockaddr. Returns 1 when ip parsed.
+static int dns_sockaddr(const char* ip, int port, struct sockaddr_storage* ss, socklen_t* len) {
+    memset(ss, 0, sizeof(*ss));
+    struct sockaddr_in* v4 = (struct sockaddr_in*)ss;
+    struct sockaddr_in6* v6 = (struct sockaddr_in6*)ss;
+    if (inet_pton(AF_INET, ip, &v4->sin_addr) == 1) {
+        v4->sin_family = AF_INET;
+        v4->sin_port = htons(port);
+        *len = sizeof(*v4);
+        return 1;
+    }
+    if (inet_pton(AF_INET6, ip, &v6->sin6_addr) == 1) {
+        v6->sin6_family = AF_INET6;
+        v6->sin6_port = htons(port);
+        *len = sizeof(*v6);
+        return 1;
+    }
+    return 0;
+}
+
+// "a.b.c.d" or "::1", optionally followed by "#port". Returns 1 when parsed.
+static int dns_parse_server(const char* s, struct sockaddr_storage* ss, socklen_t* len) {
+    char ip[WYN_DNS_ADDRSTRLEN];
+    const char* hash = strchr(s, '#');
+    size_t n = hash ? (size_t)(hash - s) : strlen(s);
+    if (n == 0 || n >= sizeof(ip)) return 0;
+    memcpy(ip, s, n);
+    ip[n] = '\0';
+    return dns_sockaddr(ip, hash ? atoi(hash + 1) : 53, ss, len);
+}
+
+// Caller holds dns_lock. resolv.conf is read once per process, like libc.
+// WYN_RESOLV_CONF overrides the path; nameserver lines may carry "#port" (a
+// Wyn extension, for pointing tests at a stub server).
+static void dns_load_conf(void) {
+    if (dns_conf_loaded) return;
+    dns_conf_loaded = 1;
+    DnsConf* c = &dns_conf;
+    memset(c, 0, sizeof(*c));
+    c->ndots = 1;
+    c->timeout_s = 5;
+    c->attempts = 2;
+    const char* path = getenv("WYN_RESOLV_CONF");
+    FILE* f = fopen(path && *path ? path : "/etc/resolv.conf", "r");
+    char line[512];
+    while (f && fgets(line, sizeof(line), f)) {
+        char* save = NULL;
+        char* key = strtok_r(line, " \t\r\n", &save);
+        if (!key || key[0] == '#' || key[0] == ';') continue;
+        if (strcmp(key, "nameserver") == 0) {
+            char* v = strtok_r(NULL, " \t\r\n", &save);
+            int i = c->server_count;
+            if (v && i < DNS_MAX_SERVERS && dns_parse_server(v, &c->addr[i], &c->addr_len[i]))
+                c->server_count++;
+        } else if (strcmp(key, "search") == 0 || strcmp(key, "domain") == 0) {
+            // The last search/domain line wins, as in libc.
+            c->search_count = 0;
+            char* v;
+            while ((v = strtok_r(NULL, " \t\r\n", &save)) && c->search_count < DNS_MAX_SEARCH)
+                snprintf(c->search[c->search_count++], 256, "%s", v);
+        } else if (strcmp(key, "options") == 0) {
+            char* v;
+            while ((v = strtok_r(NULL, " \t\r\n", &save))) {
+                if (strncmp(v, "ndots:", 6) == 0) c->ndots = atoi(v + 6);
+                else if (strncmp(v, "timeout:", 8) == 0) c->timeout_s = atoi(v + 8);
+                else if (strncmp(v, "attempts:", 9) == 0) c->attempts = atoi(v + 9);
+            }
+        }
+    }
+    if (f) fclose(f);
+    if (c->server_count == 0)   // libc's default when none is configured
+        c->server_count = dns_parse_server("127.0.0.1", &c->addr[0], &c->addr_len[0]);
+    if (c->timeout_s < 1) c->timeout_s = 1;
+    if (c->attempts < 1) c->attempts = 1;
+}
+
+// Caller holds dns_lock. Re-reads the hosts file (WYN_HOSTS_FILE overrides
+// /etc/hosts) when its mtime moved; the stat is rate-limited to once a second.
+static void dns_load_hosts(long long now) {
+    if (dns_hosts_checked_ms >= 0 && now - dns_hosts_checked_ms < 1000) return;
+    dns_hosts_checked_ms = now;
+    const char* path = getenv("WYN_HOSTS_FILE");
+    if (!path || !*path) path = "/etc/hosts";
+    struct stat st;
+    if (stat(path, &st) != 0) {
+        dns_host_count = 0;
+        return;
+    }
+    if (dns_hosts && st.st_mtime == dns_hosts_mtime) return;
+    dns_hosts_mtime = st.st_mtime;
+    dns_host_count = 0;
+    FILE* f = fopen(path, "r");
+    int cap = 0;
+    char line[1024];
+    while (f && fgets(line, sizeof(line), f)) {
+        char* hash = strchr(line, '#');
+        if (hash) *hash = '\0';
+        char* save = NULL;
+        char* ip = strtok_r(line, " \t\r\n", &save);
+        if (!ip || strlen(ip) >= WYN_DNS_ADDRSTRLEN) continue;
+        unsigned char probe[16];
+        if (inet_pton(AF_INET, ip, probe) != 1 && inet_pton(AF_INET6, ip, probe) != 1) continue;
+        char* name;
+        while ((name = strtok_r(NULL, " \t\r\n", &save))) {
+            if (dns_host_count == cap) {
+                int ncap = cap ? cap * 2 : 32;
+                DnsHostEntry* n = realloc(dns_hosts, ncap * sizeof(DnsHostEntry));
+                if (!n) break;
+                dns_hosts = n;
+                cap = ncap;
+            }
+            snprintf(dns_hosts[dns_host_count].ip, WYN_DNS_ADDRSTRLEN, "%s", ip);
+            snprintf(dns_hosts[dns_host_count].name, 256, "%s", name);
+            dns_host_count++;
+        }
+    }
+    if (f) fclose(f);
+}
+
+static unsigned dns_hash(const char* name, int family) {
+    unsigned h = 2166136261u ^ (unsigned)family;
+    for (const char* p = name; *p; p++) h = (h ^ (unsigned char)*p) * 16777619u;
+    return h % DNS_CACHE_BUCKETS;
+}
+
+// Caller holds dns_lock.
+static DnsCacheEntry* dns_cache_find(const char* name, int family) {
+    for (DnsCacheEntry* e = dns_cache[dns_hash(name, family)]; e; e = e->next)
+        if (e->family == family && strcmp(e->name, name) == 0) return e;
+    return NULL;
+}
+
+// Caller holds dns_lock. Drops expired entries; if the cache is still full,
+// drops everything not in flight - a burst of distinct names is rare enough
+// that an occasional cold cache is cheaper than tracking recency.
+static void dns_cache_trim(long long now) {
+    for (int pass = 0; pass < 2 && dns_cache_size >= DNS_CACHE_MAX; pass++) {
+        for (int b = 0; b < DNS_CACHE_BUCKETS; b++) {
+            DnsCacheEntry** link = &dns_cache[b];
+            while (*link) {
+                DnsCacheEntry* e = *link;
+                if (!e->pending && (pass == 1 || e->expires_ms <= now)) {
+                    *link = e->next;
+                    free(e);
+                    dns_cache_size--;
+                } else {
+                    link = &e->next;
+                }
+            }
+        }
+    }
+}
+
+void wyn_dns_cache_clear(void) {
+    pthread_mutex_lock(&dns_lock);
+    for (int b = 0; b < DNS_CACHE_BUCKETS; b++) {
+        DnsCacheEntry** link = &dns_cache[b];
+        while (*link) {
+            DnsCacheEntry* e = *link;
+            if (e->pending) { link = &e->next; continue; }   // its owner still writes to it
+            *link = e->next;
+            free(e);
+            dns_cache_size--;
+        }
+    }
+    dns_hosts_checked_ms = -1;
+    pthread_mutex_unlock(&dns_lock);
+}
+
+// Sleep a short slice without holding a worker: an io_loop timer in a
+// coroutine, nanosleep otherwise.
+static void dns_sleep_ms(long long ms) {
+    if (wyn_coro_current()) {
+        void* task = wyn_current_task();
+        if (task && wyn_io_wait_timer(task, ms)) {
+            wyn_io_park();
+            wyn_coro_yield();
+            return;
+        }
+        wyn_coro_yield();
+        return;
+    }
+    struct timespec ts = { (time_t)(ms / 1000), (long)(ms % 1000) * 1000000L };
+    nanosleep(&ts, NULL);
+}
+
+// --- wire format -------------------------------------------------------------
+
+static int dns_encode_query(unsigned char* buf, size_t cap, unsigned short id,
+                            const char* name, int qtype) {
+    if (cap < 12) return -1;
+    memset(buf, 0, 12);
+    buf[0] = id >> 8; buf[1] = id & 0xff;
+    buf[2] = 0x01;                      // RD
+    buf[5] = 1;                         // QDCOUNT
+    size_t pos = 12;
+    const char* label = name;
+    while (*label) {
+        const char* dot = strchr(label, '.');
+        size_t n = dot ? (size_t)(dot - label) : strlen(label);
+        if (n == 0 || n > 63 || pos + n + 1 >= cap) return -1;
+        buf[pos++] = (unsigned char)n;
+        memcpy(buf + pos, label, n);
+        pos += n;
+        label += n;
+        if (*label == '.') label++;
+    }
+    if (pos + 5 > cap) return -1;
+    buf[pos++] = 0;
+    buf[pos++] = 0; buf[pos++] = (unsigned char)qtype;
+    buf[pos++] = 0; buf[pos++] = 1;     // IN
+    return (int)pos;
+}
+
+// Advance past a (possibly compressed) name. Returns the new offset or -1.
+static int dns_skip_name(const unsigned char* m, int len, int pos) {
+    while (pos < len) {
+        unsigned char l = m[pos];
+        if ((l & 0xc0) == 0xc0) return pos + 2 <= len ? pos + 2 : -1;
+        if (l & 0xc0) return -1;
+        pos += 1 + l;
+        if (l == 0) return pos <= len ? pos : -1;
+    }
+    return -1;
+}
+
+static unsigned dns_u32(const unsigned char* p) {
+    return ((unsigned)p[0] << 24) | ((unsigned)p[1] << 16) | ((unsigned)p[2] << 8) | p[3];
+}
+
+enum { DNS_ANSWER, DNS_NODATA, DNS_NXDOMAIN, DNS_FAIL };
+
+// Parse a reply. Addresses of qtype go to e->addrs; *ttl is the smallest TTL
+// of the records used (or the negative TTL for NXDOMAIN/NODATA).
+static int dns_parse_reply(const unsigned char* m, int len, unsigned short id, int qtype,
+                           DnsCacheEntry* e, long long* ttl) {
+    if (len < 12 || ((m[0] << 8) | m[1]) != id || !(m[2] & 0x80)) return DNS_FAIL;
+    if (m[2] & 0x02) return DNS_FAIL;                  // TC: no TCP fallback
+    int rcode = m[3] & 0x0f;
+    if (rcode != 0 && rcode != 3) return DNS_FAIL;     // SERVFAIL, REFUSED, ...
+    int qd = (m[4] << 8) | m[5], an = (m[6] << 8) | m[7], ns = (m[8] << 8) | m[9];
+    int pos = 12;
+    for (int i = 0; i < qd; i++) {
+        pos = dns_skip_name(m, len, pos);
+        if (pos < 0 || pos + 4 > len) return DNS_FAIL;
+        pos += 4;
+    }
+    long long min_ttl = -1;
+    e->count = 0;
+    for (int i = 0; i < an + ns; i++) {
+        pos = dns_skip_name(m, len, pos);
+        if (pos < 0 || pos + 10 > len) return DNS_FAIL;
+        int type = (m[pos] << 8) | m[pos + 1];
+        long long rr_ttl = dns_u32(m + pos + 4) & 0x7fffffff;
+        int rdlen = (m[pos + 8] << 8) | m[pos + 9];
+        pos += 10;
+        if (pos + rdlen > len) return DNS_FAIL;
+        if (i < an && type == qtype && e->count < WYN_DNS_MAX_ADDRS &&
+            rdlen == (qtype == 1 ? 4 : 16)) {
+            inet_ntop(qtype == 1 ? AF_INET : AF_INET6, m + pos, e->addrs[e->count++], WYN_DNS_ADDRSTRLEN);
+            if (min_ttl < 0 || rr_ttl < min_ttl) min_ttl = rr_ttl;
+        } else if (i >= an && type == 6 && e->count == 0) {
+            // SOA in the authority section: negative TTL = min(TTL, MINIMUM).
+            int p = dns_skip_name(m, len, pos);
+            if (p > 0) p = dns_skip_name(m, len, p);
+            if (p > 0 && p + 20 <= pos + rdlen) {
+                long long minimum = dns_u32(m + p + 16);
+                min_ttl = rr_ttl < minimum ? rr_ttl : minimum;
+            }
+        }
+        pos += rdlen;
+    }
+    if (e->count > 0) {
+        *ttl = min_ttl;
+        return DNS_ANSWER;
+    }
+    *ttl = min_ttl >= 0 ? min_ttl : DNS_DEFAULT_NEG_TTL;
+    return rcode == 3 ? DNS_NXDOMAIN : DNS_NODATA;
+}
+
+static unsigned short dns_next_id(void) {
+    static _Atomic unsigned long long seed = 0;
+    unsigned long long s = atomic_load(&seed);
+    if (s == 0) s = (unsigned long long)time(NULL) ^ ((unsigned long long)getpid() << 32) ^ (unsigned long long)dns_now_ms();
+    unsigned long long next;
+    do {
+        next = s ^ (s << 13);
+        next ^= next >> 7;
+        next ^= next << 17;
+    } while (!atomic_compare_exchange_weak(&seed, &s, next));
+    return (unsigned short)(next >> 16);
+}
+
+// Ask each nameserver in turn, conf.attempts rounds, for fqdn/qtype.
+static int dns_exchange(const DnsConf* c, const char* fqdn, int qtype, DnsCacheEntry* e, long long* ttl) {
+    unsigned char q[300], r[512];
+    for (int attempt = 0; attempt < c->attempts; attempt++) {
+        for (int s = 0; s < c->server_count; s++) {
+            unsigned short id = dns_next_id();
+            int qlen = dns_encode_query(q, sizeof(q), id, fqdn, qtype);
+            if (qlen < 0) return DNS_NXDOMAIN;          // not a valid DNS name
+            int fd = socket(c->addr[s].ss_family, SOCK_DGRAM, 0);
+            if (fd < 0) continue;
+            fcntl(fd, F_SETFL, fcntl(fd, F_GETFL, 0) | O_NONBLOCK);
+            // Connected UDP: the kernel drops datagrams from anyone but the
+            // server, and an ICMP refusal surfaces as ECONNREFUSED at once.
+            if (connect(fd, (const struct sockaddr*)&c->addr[s], c->addr_len[s]) < 0 ||
+                send(fd, q, (size_t)qlen, 0) != qlen) {
+                close(fd);
+                continue;
+            }
+            long long deadline = dns_now_ms() + (long long)c->timeout_s * 1000;
+            long long slice = 1;
+            int result = DNS_FAIL, done = 0;
+            while (!done) {
+                ssize_t n = recv(fd, r, sizeof(r), 0);
+                if (n > 0) {
+                    result = dns_parse_reply(r, (int)n, id, qtype, e, ttl);
+                    // A stale or spoofed id parses as FAIL; keep listening.
+                    if (result != DNS_FAIL || (((r[0] << 8) | r[1]) == id)) done = 1;
+                    continue;
+                }
+                if (n < 0 && errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR) break;
+                long long left = deadline - dns_now_ms();
+                if (left <= 0) break;
+                if (wyn_coro_current()) {
+                    dns_sleep_ms(slice < left ? slice : left);
+                    if (slice < 32) slice *= 2;
+                } else {
+                    struct pollfd pfd = { .fd = fd, .events = POLLIN, .revents = 0 };
+                    poll(&pfd, 1, (int)left);
+                }
+            }
+            close(fd);
+            if (done && result != DNS_FAIL) return result;
+        }
+    }
+    return DNS_FAIL;
+}
+
+// Candidate names in libc order: as-is first when it has ndots dots (or is
+// absolute), otherwise the search domains first.
+static int dns_candidates(const DnsConf* c, const char* name, char out[][256]) {
+    int n = 0, dots = 0;
+    size_t len = strlen(name);
+    for (const char* p = name; *p; p++) dots += *p == '.';
+    if (len > 0 && name[len - 1] == '.') {
+        snprintf(out[n], 256, "%.*s", (int)(len - 1), name);
+        return 1;
+    }
+    if (dots >= c->ndots) snprintf(out[n++], 256, "%s", name);
+    for (int i = 0; i < c->search_count; i++)
+        snprintf(out[n++], 256, "%s.%s", name, c->search[i]);
+    if (dots < c->ndots) snprintf(out[n++], 256, "%s", name);
+    return n;
+}
+
+// Resolve over the network into e. Returns 1 with e filled (count 0 =
+// negative), 0 when no nameserver produced an answer.
+static int dns_lookup_network(const char* name, int family, DnsCacheEntry* e, long long* ttl) {
+    pthread_mutex_lock(&dns_lock);
+    dns_load_conf();
+    DnsConf c = dns_conf;
+    pthread_mutex_unlock(&dns_lock);
+    char cands[DNS_MAX_SEARCH + 1][256];
+    int nc = dns_candidates(&c, name, cands);
+    int negative = 0;
+    long long neg_ttl = DNS_MAX_TTL;
+    for (int i = 0; i < nc; i++) {
+        int qtypes[2] = { family == WYN_DNS_V6 ? 28 : 1, family == WYN_DNS_ANY ? 28 : 0 };
+        for (int t = 0; t < 2 && qtypes[t]; t++) {
+            long long rttl = 0;
+            int r = dns_exchange(&c, cands[i], qtypes[t], e, &rttl);
+            if (r == DNS_ANSWER) { *ttl = rttl; return 1; }
+            if (r == DNS_FAIL) return 0;
+            negative = 1;
+            if (rttl < neg_ttl) neg_ttl = rttl;
+            if (r == DNS_NXDOMAIN) break;   // no other type exists either
+        }
+    }
+    e->count = 0;
+    *ttl = negative ? neg_ttl : DNS_DEFAULT_NEG_TTL;
+    return 1;
+}
+
+// Last resort when no nameserver answered: the system resolver (NSS).
+static void dns_lookup_system(const char* name, int family, DnsCacheEntry* e) {
+    struct addrinfo hints, *res = NULL;
+    memset(&hints, 0, sizeof(hints));
+    hints.ai_family = family == WYN_DNS_V4 ? AF_INET : family == WYN_DNS_V6 ? AF_INET6 : AF_UNSPEC;
+    hints.ai_socktype = SOCK_STREAM;
+    e->count = 0;
+    if (getaddrinfo(name, NULL, &hints, &res) != 0) return;
+    for (struct addrinfo* ai = res; ai && e->count < WYN_DNS_MAX_ADDRS; ai = ai->ai_next) {
+        const void* a = ai->ai_family == AF_INET
+            ? (const void*)&((struct sockaddr_in*)ai->ai_addr)->sin_addr
+            : (const void*)&((struct sockaddr_in6*)ai->ai_addr)->sin6_addr;
+        inet_ntop(ai->ai_family, a, e->addrs[e->count], WYN_DNS_ADDRSTRLEN);
+        int dup = 0;
+        for (int i = 0; i < e->count; i++) dup |= strcmp(e->addrs[i], e->addrs[e->count]) == 0;
+        if (!dup) e->count++;
+    }
+    freeaddrinfo(res);
+}
+
+static int dns_copy_out(const DnsCacheEntry* e, char (*out)[WYN_DNS_ADDRSTRLEN], int max) {
+    int n = e->count < max ? e->count : max;
+    for (int i = 0; i < n; i++) memcpy(out[i], e->addrs[i], WYN_DNS_ADDRSTRLEN);
+    return n;
+}
+
+int wyn_dns_resolve(const char* host, int family, char (*out)[WYN_DNS_ADDRSTRLEN], int max) {
+    if (!host || !*host || max <= 0) return 0;
+    // 1. Literal address.
+    unsigned char probe[16];
+    if ((family != WYN_DNS_V6 && inet_pton(AF_INET, host, probe) == 1) ||
+        (family != WYN_DNS_V4 && inet_pton(AF_INET6, host, probe) == 1)) {
+        snprintf(out[0], WYN_DNS_ADDRSTRLEN, "%s", host);
+        return 1;
+    }
+    char name[256];
+    size_t hl = strlen(host);
+    if (hl >= sizeof(name)) return 0;
+    for (size_t i = 0; i <= hl; i++) name[i] = (char)tolower((unsigned char)host[i]);
+
+    long long now = dns_now_ms();
+    pthread_mutex_lock(&dns_lock);
+    // 2. Hosts file.
+    dns_load_hosts(now);
+    int n = 0;
+    for (int i = 0; i < dns_host_count && n < max; i++) {
+        if (strcasecmp(dns_hosts[i].name, name) != 0) continue;
+        if (family != WYN_DNS_ANY && dns_family_of(dns_hosts[i].ip) != family) continue;
+        memcpy(out[n++], dns_hosts[i].ip, WYN_DNS_ADDRSTRLEN);
+    }
+    if (n > 0) {
+        pthread_mutex_unlock(&dns_lock);
+        return n;
+    }
+    // 3. Cache; wait out a lookup another caller already has in flight.
+    DnsCacheEntry* e;
+    for (;;) {
+        e = dns_cache_find(name, family);
+        now = dns_now_ms();
+        if (!e || (!e->pending && e->expires_ms <= now)) break;
+        if (!e->pending) {
+            n = dns_copy_out(e, out, max);
+            pthread_mutex_unlock(&dns_lock);
+            return n;
+        }
+        if (e->expires_ms <= now) break;    // in-flight owner overran: take over
+        pthread_mutex_unlock(&dns_lock);
+        dns_sleep_ms(2);
+        pthread_mutex_lock(&dns_lock);
+    }
+    if (!e) {
+        dns_cache_trim(now);
+        e = calloc(1, sizeof(DnsCacheEntry));
+        if (!e) {
+            pthread_mutex_unlock(&dns_lock);
+            return 0;
+        }
+        snprintf(e->name, sizeof(e->name), "%s", name);
+        e->family = family;
+        unsigned b = dns_hash(name, family);
+        e->next = dns_cache[b];
+        dns_cache[b] = e;
+        dns_cache_size++;
+    }
+    // Mark in flight; the deadline lets waiters take over from an owner that
+    // never finishes (worst case: every server times out on every attempt).
+    dns_load_conf();
+    e->pending = 1;
+    e->expires_ms = now + 1000 + (long long)dns_conf.timeout_s * 1000 * dns_conf.attempts *
+                          dns_conf.server_count * (dns_conf.search_count + 1) * 2;
+    pthread_mutex_unlock(&dns_lock);
+
+    // 4. Network, then the system resolver. Results go into a private entry
+    // and are published under the lock.
+    DnsCacheEntry fresh;
+    memset(&fresh, 0, sizeof(fresh));
+    long long ttl = 0;
+    if (!dns_lookup_network(name, family, &fresh, &ttl)) {
+        dns_lookup_system(name, family, &fresh);
+        ttl = DNS_FALLBACK_TTL;
+    }
+    if (ttl > DNS_MAX_TTL) ttl = DNS_MAX_TTL;
+
+    pthread_mutex_lock(&dns_lock);
+    e->count = fresh.count;
+    memcpy(e->addrs, fresh.addrs, sizeof(e->addrs));
+    e->expires_ms = dns_now_ms() + ttl * 1000;
+    e->pending = 0;
+    n = dns_copy_out(e, out, max);
+    pthread_mutex_unlock(&dns_lock);
+    return n;
+}
+
+// net.h's resolver entry point. POSIX builds answer it here; net.c keeps the
+// getaddrinfo version for Windows, where this file compiles to nothing.
+// IPv4 only, as it always was.
+char** wyn_resolve_hostname(const char* hostname, WynNetError* error) {
+    char addrs[WYN_DNS_MAX_ADDRS][WYN_DNS_ADDRSTRLEN];
+    int count = hostname ? wyn_dns_resolve(hostname, WYN_DNS_V4, addrs, WYN_DNS_MAX_ADDRS) : 0;
+    if (count <= 0) {
+        if (error) *error = hostname ? WYN_NET_ERROR_UNKNOWN : WYN_NET_ERROR_INVALID_ADDR;
+        return NULL;
+    }
+    char** list = malloc((count + 1) * sizeof(char*));
+    if (!list) {
+        if (error) *error = WYN_NET_ERROR_UNKNOWN;
+        return NULL;
+    }
+    int n = 0;
+    for (int i = 0; i < count; i++) {
+        list[n] = strdup(addrs[i]);
+        if (list[n]) n++;
+    }
+    list[n] = NULL;
+    if (error) *error = WYN_NET_SUCCESS;
+    return list;
+}
+
 // ============================================================================
 // HTTP Client
 // ============================================================================
+//
+// One engine, wyn_http_fetch (see http_client.h), behind Http_get/Http_post
+// here and the http_get/http_post/... builtins in wyn_runtime.h.
+//
+// WHY: the old client resolved with gethostbyname (blocking, not thread-safe),
+// opened a socket per request with Connection: close, and blocked in recv()
+// into a fixed 64KB stack buffer. Inside a spawned coroutine that recv stalled
+// a whole scheduler worker, and anything past 64KB was silently truncated.
+// Now:
+//   - Sockets are non-blocking. A connect/send/recv that would block inside a
+//     coroutine parks it on wyn_io_wait_readable/writable, so the worker keeps
+//     running other tasks. Outside a coroutine it poll()s with the
+//     Http.set_timeout deadline (the old SO_RCVTIMEO/SO_SNDTIMEO behaviour).
+//   - Connections are pooled per host:port and reused while the server allows
+//     keep-alive. Idle ones are evicted after WYN_HTTP_IDLE_MS. A pooled socket
+//     the server has since closed is caught on checkout with a MSG_PEEK probe,
+//     and a request that fails before any response byte on a reused socket is
+//     retried once on a fresh one - the race between our checkout and the
+//     server's idle timeout cannot be closed from the client side.
+//   - The response is read to its framing - Content-Length, chunked, or EOF -
+//     into a growable buffer, so its size is bounded only by memory.
+
+#include "http_client.h"
+
+#ifndef MSG_NOSIGNAL
+#define MSG_NOSIGNAL 0   // macOS: SO_NOSIGPIPE is set on the socket instead
+#endif
 
 typedef struct {
     int status_code;
@@ -36,189 +678,548 @@ typedef struct {
     int body_len;
 } HttpResponse;
 
-// Parse HTTP response
-static HttpResponse* parse_http_response(const char* raw) {
-    HttpResponse* resp = malloc(sizeof(HttpResponse));
-    if (!resp) return NULL;
-    
-    resp->status_code = 0;
-    resp->headers = NULL;
-    resp->body = NULL;
-    resp->body_len = 0;
-    
-    // Parse status line
-    if (sscanf(raw, "HTTP/%*d.%*d %d", &resp->status_code) != 1) {
-        free(resp);
-        return NULL;
-    }
-    
-    // Find body separator
-    const char* body_start = strstr(raw, "\r\n\r\n");
-    if (body_start) {
-        body_start += 4;
-        
-        // Extract headers
-        int header_len = body_start - raw - 4;
-        resp->headers = malloc(header_len + 1);
-        if (resp->headers) {
-            memcpy(resp->headers, raw, header_len);
-            resp->headers[header_len] = '\0';
+typedef struct HttpIdleConn {
+    int fd;
+    long long idle_since_ms;
+    struct HttpIdleConn* next;
+} HttpIdleConn;
+
+typedef struct HttpHostPool {
+    char key[300];              // "host:port"
+    HttpIdleConn* idle;
+    int idle_count;
+    struct HttpHostPool* next;
+} HttpHostPool;
+
+static pthread_mutex_t http_pool_lock = PTHREAD_MUTEX_INITIALIZER;
+static HttpHostPool* http_pools = NULL;
+static int http_pool_max = -1;          // -1 = env not read yet
+static long long http_idle_ms = 30000;
+
+static long long http_now_ms(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (long long)ts.tv_sec * 1000 + ts.tv_nsec / 1000000;
+}
+
+// Caller holds http_pool_lock.
+static void http_pool_config(void) {
+    if (http_pool_max >= 0) return;
+    const char* e = getenv("WYN_HTTP_POOL_MAX");
+    http_pool_max = (e && *e) ? atoi(e) : 64;
+    if (http_pool_max < 0) http_pool_max = 0;
+    e = getenv("WYN_HTTP_IDLE_MS");
+    if (e && *e) http_idle_ms = atoll(e);
+}
+
+// Caller holds http_pool_lock. Closes this pool's connections idle too long.
+static void http_pool_evict(HttpHostPool* p, long long now) {
+    HttpIdleConn** link = &p->idle;
+    while (*link) {
+        HttpIdleConn* c = *link;
+        if (now - c->idle_since_ms > http_idle_ms) {
+            *link = c->next;
+            close(c->fd);
+            free(c);
+            p->idle_count--;
+        } else {
+            link = &c->next;
         }
-        
-        // Extract body
-        resp->body_len = strlen(body_start);
-        resp->body = malloc(resp->body_len + 1);
-        if (resp->body) {
-            memcpy(resp->body, body_start, resp->body_len);
-            resp->body[resp->body_len] = '\0';
+    }
+}
+
+// Take a live idle connection for key, or -1. Pools are a short list - a
+// process talks to a handful of hosts - so a linear scan beats hashing here.
+static int http_pool_checkout(const char* key) {
+    int fd = -1;
+    pthread_mutex_lock(&http_pool_lock);
+    http_pool_config();
+    long long now = http_now_ms();
+    for (HttpHostPool* p = http_pools; p; p = p->next) {
+        if (strcmp(p->key, key) != 0) continue;
+        http_pool_evict(p, now);
+        while (p->idle && fd < 0) {
+            HttpIdleConn* c = p->idle;
+            p->idle = c->next;
+            p->idle_count--;
+            // Probe: EAGAIN means open and quiet. EOF (server closed it) or
+            // stray bytes both make the socket unusable for a new request.
+            char probe;
+            ssize_t n = recv(c->fd, &probe, 1, MSG_PEEK | MSG_DONTWAIT);
+            if (n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) fd = c->fd;
+            else close(c->fd);
+            free(c);
         }
+        break;
     }
-    
-    return resp;
+    pthread_mutex_unlock(&http_pool_lock);
+    return fd;
 }
 
-// HTTP GET request
-HttpResponse* Http_get(const char* url) {
-    // Parse URL
-    char host[256] = {0};
-    char path[512] = "/";
-    int port = 80;
-    int use_https = 0;
-    
-    if (strncmp(url, "https://", 8) == 0) {
-        use_https = 1;
-        port = 443;
-        sscanf(url + 8, "%255[^/]%511s", host, path);
-    } else if (strncmp(url, "http://", 7) == 0) {
-        sscanf(url + 7, "%255[^/]%511s", host, path);
+static void http_pool_checkin(const char* key, int fd) {
+    pthread_mutex_lock(&http_pool_lock);
+    http_pool_config();
+    long long now = http_now_ms();
+    HttpHostPool* p = http_pools;
+    while (p && strcmp(p->key, key) != 0) p = p->next;
+    if (!p) {
+        p = calloc(1, sizeof(HttpHostPool));
+        if (p) {
+            snprintf(p->key, sizeof(p->key), "%s", key);
+            p->next = http_pools;
+            http_pools = p;
+        }
+    }
+    // Sweep every host, not just this one: a host the program stopped
+    // calling would otherwise hold its sockets until exit.
+    for (HttpHostPool* q = http_pools; q; q = q->next) http_pool_evict(q, now);
+    HttpIdleConn* c = (p && p->idle_count < http_pool_max) ? malloc(sizeof(HttpIdleConn)) : NULL;
+    if (c) {
+        c->fd = fd;
+        c->idle_since_ms = now;
+        c->next = p->idle;
+        p->idle = c;
+        p->idle_count++;
     } else {
-        sscanf(url, "%255[^/]%511s", host, path);
+        close(fd);
     }
-    
-    // Check for port in host
-    char* colon = strchr(host, ':');
-    if (colon) {
-        *colon = '\0';
-        port = atoi(colon + 1);
+    pthread_mutex_unlock(&http_pool_lock);
+}
+
+static int http_pooling_enabled(void) {
+    pthread_mutex_lock(&http_pool_lock);
+    http_pool_config();
+    int on = http_pool_max > 0;
+    pthread_mutex_unlock(&http_pool_lock);
+    return on;
+}
+
+void wyn_http_pool_clear(void) {
+    pthread_mutex_lock(&http_pool_lock);
+    for (HttpHostPool* p = http_pools; p; p = p->next) {
+        while (p->idle) {
+            HttpIdleConn* c = p->idle;
+            p->idle = c->next;
+            close(c->fd);
+            free(c);
+        }
+        p->idle_count = 0;
+    }
+    pthread_mutex_unlock(&http_pool_lock);
+}
+
+// Wait for fd to become readable/writable. In a coroutine this parks on the
+// reactor (the same pattern as Socket_send/Socket_recv below); otherwise it
+// poll()s. Returns 0 when the caller should retry the I/O, -1 on timeout.
+static int http_wait(int fd, int writable) {
+    if (wyn_coro_current()) {
+        void* task = wyn_current_task();
+        if (task) {
+            if (writable) wyn_io_wait_writable(fd, task);
+            else wyn_io_wait_readable(fd, task);
+            wyn_io_park();
+        }
+        wyn_coro_yield();
+        return 0;
     }
-    
-    // Resolve host
-    struct hostent* he = gethostbyname(host);
-    if (!he) return NULL;
-    
-    // Create socket
-    int sock = socket(AF_INET, SOCK_STREAM, 0);
-    if (sock < 0) return NULL;
-    
-    struct sockaddr_in addr;
-    addr.sin_family = AF_INET;
-    addr.sin_port = htons(port);
-    memcpy(&addr.sin_addr, he->h_addr_list[0], he->h_length);
-    
-    // Set timeout
     extern int _wyn_http_timeout;
-    if (_wyn_http_timeout > 0) {
-        struct timeval tv = { .tv_sec = _wyn_http_timeout, .tv_usec = 0 };
-        setsockopt(sock, SOL_SOCKET, SO_RCVTIMEO, &tv, sizeof(tv));
-        setsockopt(sock, SOL_SOCKET, SO_SNDTIMEO, &tv, sizeof(tv));
+    struct pollfd pfd = { .fd = fd, .events = writable ? POLLOUT : POLLIN, .revents = 0 };
+    int timeout_ms = _wyn_http_timeout > 0 ? _wyn_http_timeout * 1000 : -1;
+    int r;
+    do { r = poll(&pfd, 1, timeout_ms); } while (r < 0 && errno == EINTR);
+    return r > 0 ? 0 : -1;
+}
+
+static int http_connect(const char* host, int port, char* err) {
+    char addrs[WYN_DNS_MAX_ADDRS][WYN_DNS_ADDRSTRLEN];
+    int count = wyn_dns_resolve(host, WYN_DNS_ANY, addrs, WYN_DNS_MAX_ADDRS);
+    if (count <= 0) {
+        snprintf(err, 256, "Host not found: %s", host);
+        return -1;
     }
-    
-    // Connect
-    if (connect(sock, (struct sockaddr*)&addr, sizeof(addr)) < 0) {
-        close(sock);
-        return NULL;
+    int fd = -1;
+    for (int i = 0; i < count; i++) {
+        struct sockaddr_storage ss;
+        socklen_t sslen;
+        if (!dns_sockaddr(addrs[i], port, &ss, &sslen)) continue;
+        fd = socket(ss.ss_family, SOCK_STREAM, 0);
+        if (fd < 0) continue;
+        fcntl(fd, F_SETFL, fcntl(fd, F_GETFL, 0) | O_NONBLOCK);
+        int one = 1;
+        setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+#ifdef SO_NOSIGPIPE
+        setsockopt(fd, SOL_SOCKET, SO_NOSIGPIPE, &one, sizeof(one));
+#endif
+        int rc = connect(fd, (struct sockaddr*)&ss, sslen);
+        if (rc < 0 && errno == EINPROGRESS) {
+            // Settled once the peer address is known (connected) or SO_ERROR
+            // is set (refused/unreachable). A coroutine with no task to park
+            // only yields, so it can come back before either - hence the loop.
+            for (;;) {
+                if (http_wait(fd, 1) < 0) break;
+                int soerr = 0;
+                socklen_t slen = sizeof(soerr);
+                if (getsockopt(fd, SOL_SOCKET, SO_ERROR, &soerr, &slen) < 0 || soerr != 0) break;
+                struct sockaddr_storage peer;
+                socklen_t plen = sizeof(peer);
+                if (getpeername(fd, (struct sockaddr*)&peer, &plen) == 0) { rc = 0; break; }
+                if (errno != ENOTCONN) break;
+            }
+        }
+        if (rc == 0) break;
+        close(fd);
+        fd = -1;
     }
-    
-    // Build request
-    char request[2048];
-    snprintf(request, sizeof(request),
-        "GET %s HTTP/1.1\r\n"
-        "Host: %s\r\n"
-        "User-Agent: Wyn/1.0\r\n"
-        "Accept: */*\r\n"
-        "Connection: close\r\n"
-        "\r\n",
-        path, host);
-    
-    // Send request
-    send(sock, request, strlen(request), 0);
-    
-    // Receive response
-    char buffer[65536] = {0};
-    int total = 0;
-    int n;
-    while ((n = recv(sock, buffer + total, sizeof(buffer) - total - 1, 0)) > 0) {
-        total += n;
-        if (total >= sizeof(buffer) - 1) break;
+    if (fd < 0) snprintf(err, 256, "Connection failed");
+    return fd;
+}
+
+static int http_send_all(int fd, const char* data, size_t len) {
+    size_t off = 0;
+    while (off < len) {
+        ssize_t n = send(fd, data + off, len - off, MSG_NOSIGNAL);
+        if (n > 0) { off += (size_t)n; continue; }
+        if (n < 0 && errno == EINTR) continue;
+        if (n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) {
+            if (http_wait(fd, 1) < 0) return -1;
+            continue;
+        }
+        return -1;
     }
-    
-    close(sock);
-    
-    return parse_http_response(buffer);
+    return 0;
 }
 
-// HTTP POST request
-HttpResponse* Http_post(const char* url, const char* body, const char* content_type) {
-    // Parse URL (same as GET)
-    char host[256] = {0};
-    char path[512] = "/";
-    int port = 80;
-    
-    if (strncmp(url, "http://", 7) == 0) {
-        sscanf(url + 7, "%255[^/]%511s", host, path);
+// Growable byte buffer for the request, the read side and the body.
+typedef struct { char* p; size_t len, cap; } HttpBuf;
+
+static int http_buf_reserve(HttpBuf* b, size_t extra) {
+    if (b->len + extra + 1 <= b->cap) return 0;
+    size_t cap = b->cap ? b->cap : 4096;
+    while (cap < b->len + extra + 1) cap *= 2;
+    char* np = realloc(b->p, cap);
+    if (!np) return -1;
+    b->p = np;
+    b->cap = cap;
+    return 0;
+}
+
+static int http_buf_append(HttpBuf* b, const char* s, size_t n) {
+    if (http_buf_reserve(b, n) < 0) return -1;
+    memcpy(b->p + b->len, s, n);
+    b->len += n;
+    b->p[b->len] = '\0';
+    return 0;
+}
+
+// Streaming reader: raw bytes in in.p[pos..in.len).
+typedef struct { int fd; HttpBuf in; size_t pos; size_t total; } HttpReader;
+
+// Read more from the socket. Returns >0 bytes read, 0 on EOF, -1 on error.
+static ssize_t http_fill(HttpReader* r) {
+    if (r->pos > 0 && r->pos == r->in.len) {
+        r->in.len = r->pos = 0;
+    } else if (r->pos > 65536 && r->pos * 2 > r->in.len) {
+        memmove(r->in.p, r->in.p + r->pos, r->in.len - r->pos);
+        r->in.len -= r->pos;
+        r->pos = 0;
+    }
+    if (http_buf_reserve(&r->in, 16384) < 0) return -1;
+    for (;;) {
+        ssize_t n = recv(r->fd, r->in.p + r->in.len, r->in.cap - r->in.len - 1, 0);
+        if (n > 0) { r->in.len += (size_t)n; r->total += (size_t)n; return n; }
+        if (n == 0) return 0;
+        if (errno == EINTR) continue;
+        if (errno == EAGAIN || errno == EWOULDBLOCK) {
+            if (http_wait(r->fd, 0) < 0) return -1;
+            continue;
+        }
+        return -1;
+    }
+}
+
+// Find "\r\n" at or after from; returns its offset or -1.
+static long http_find_crlf(const HttpReader* r, size_t from) {
+    for (size_t i = from; i + 1 < r->in.len; i++)
+        if (r->in.p[i] == '\r' && r->in.p[i + 1] == '\n') return (long)i;
+    return -1;
+}
+
+// Next CRLF-terminated line; *line points into the reader buffer and is valid
+// until the next http_fill. Returns 0, or -1 on EOF/error.
+static int http_read_line(HttpReader* r, const char** line, size_t* len) {
+    long at;
+    while ((at = http_find_crlf(r, r->pos)) < 0) {
+        if (http_fill(r) <= 0) return -1;
+    }
+    *line = r->in.p + r->pos;
+    *len = (size_t)at - r->pos;
+    r->pos = (size_t)at + 2;
+    return 0;
+}
+
+// Move exactly n bytes (or up to EOF when n == (size_t)-1) into body.
+static int http_read_body(HttpReader* r, HttpBuf* body, size_t n) {
+    int to_eof = n == (size_t)-1;
+    while (to_eof || n > 0) {
+        size_t avail = r->in.len - r->pos;
+        if (avail == 0) {
+            ssize_t got = http_fill(r);
+            if (got == 0 && to_eof) return 0;
+            if (got <= 0) return -1;
+            continue;
+        }
+        size_t take = (!to_eof && avail > n) ? n : avail;
+        if (http_buf_append(body, r->in.p + r->pos, take) < 0) return -1;
+        r->pos += take;
+        if (!to_eof) n -= take;
+    }
+    return 0;
+}
+
+// Value of header name in the raw header block (case-insensitive), or NULL.
+static const char* http_header_value(const char* hdrs, const char* name, size_t* vlen) {
+    size_t nlen = strlen(name);
+    const char* line = strstr(hdrs, "\r\n");
+    while (line) {
+        line += 2;
+        const char* end = strstr(line, "\r\n");
+        size_t llen = end ? (size_t)(end - line) : strlen(line);
+        if (llen > nlen && line[nlen] == ':' && strncasecmp(line, name, nlen) == 0) {
+            const char* v = line + nlen + 1;
+            while (*v == ' ' || *v == '\t') v++;
+            size_t n = (size_t)(line + llen - v);
+            while (n > 0 && (v[n - 1] == ' ' || v[n - 1] == '\t')) n--;
+            *vlen = n;
+            return v;
+        }
+        line = end;
+    }
+    return NULL;
+}
+
+static int http_value_has(const char* v, size_t vlen, const char* token) {
+    size_t tlen = strlen(token);
+    for (size_t i = 0; i + tlen <= vlen; i++)
+        if (strncasecmp(v + i, token, tlen) == 0) return 1;
+    return 0;
+}
+
+// One request/response on fd. *keep is set when the connection may be
+// reused; *got_bytes when any response byte arrived (no retry after that).
+static int http_exchange(int fd, const char* method, const HttpBuf* req,
+                         WynHttpResult* out, int* keep, int* got_bytes) {
+    *keep = 0;
+    *got_bytes = 0;
+    if (http_send_all(fd, req->p, req->len) < 0) {
+        snprintf(out->error, sizeof(out->error), "Send failed");
+        return -1;
+    }
+    HttpReader r = { .fd = fd };
+    HttpBuf body = {0};
+    int rc = -1;
+    const char* line;
+    size_t llen;
+
+    // Status line + headers. 1xx interim responses (100 Continue) are skipped.
+    HttpBuf hdrs = {0};
+    for (;;) {
+        hdrs.len = 0;
+        if (http_read_line(&r, &line, &llen) < 0) {
+            *got_bytes = r.total > 0;
+            snprintf(out->error, sizeof(out->error), r.total ? "Malformed response" : "Empty response");
+            goto done;
+        }
+        *got_bytes = 1;
+        if (llen < 12 || strncmp(line, "HTTP/1.", 7) != 0) {
+            snprintf(out->error, sizeof(out->error), "Malformed response");
+            goto done;
+        }
+        int minor = line[7] - '0';
+        out->status = atoi(line + 9);
+        if (http_buf_append(&hdrs, line, llen) < 0 || http_buf_append(&hdrs, "\r\n", 2) < 0) goto oom;
+        for (;;) {
+            if (http_read_line(&r, &line, &llen) < 0) {
+                snprintf(out->error, sizeof(out->error), "Truncated response headers");
+                goto done;
+            }
+            if (llen == 0) break;
+            if (http_buf_append(&hdrs, line, llen) < 0 || http_buf_append(&hdrs, "\r\n", 2) < 0) goto oom;
+        }
+        if (out->status >= 200 || out->status < 100) {
+            // HTTP/1.1 keeps the connection unless told otherwise; 1.0 closes
+            // unless told otherwise.
+            size_t vlen;
+            const char* conn = http_header_value(hdrs.p, "Connection", &vlen);
+            *keep = minor >= 1 ? !(conn && http_value_has(conn, vlen, "close"))
+                               : (conn && http_value_has(conn, vlen, "keep-alive"));
+            break;
+        }
+    }
+
+    size_t vlen;
+    const char* te = http_header_value(hdrs.p, "Transfer-Encoding", &vlen);
+    const char* cl;
+    if (strcmp(method, "HEAD") == 0 || out->status == 204 || out->status == 304) {
+        // No body by definition.
+    } else if (te && http_value_has(te, vlen, "chunked")) {
+        for (;;) {
+            if (http_read_line(&r, &line, &llen) < 0) goto truncated;
+            size_t chunk = (size_t)strtoull(line, NULL, 16);
+            if (chunk == 0) {
+                // Trailer section ends with an empty line.
+                do {
+                    if (http_read_line(&r, &line, &llen) < 0) goto truncated;
+                } while (llen > 0);
+                break;
+            }
+            if (http_read_body(&r, &body, chunk) < 0) goto truncated;
+            if (http_read_line(&r, &line, &llen) < 0 || llen != 0) goto truncated;
+        }
+    } else if ((cl = http_header_value(hdrs.p, "Content-Length", &vlen)) != NULL) {
+        if (http_read_body(&r, &body, (size_t)strtoull(cl, NULL, 10)) < 0) goto truncated;
     } else {
-        sscanf(url, "%255[^/]%511s", host, path);
+        // Delimited by close: read to EOF, and the socket is spent.
+        *keep = 0;
+        if (http_read_body(&r, &body, (size_t)-1) < 0) goto truncated;
     }
-    
-    char* colon = strchr(host, ':');
-    if (colon) {
-        *colon = '\0';
-        port = atoi(colon + 1);
+    // Bytes past the response mean we lost sync with the server; don't reuse.
+    if (r.pos != r.in.len) *keep = 0;
+    if (!body.p && http_buf_reserve(&body, 0) < 0) goto oom;
+    if (body.len == 0) body.p[0] = '\0';
+    out->headers = hdrs.p;
+    hdrs.p = NULL;
+    out->body = body.p;
+    out->body_len = body.len;
+    body.p = NULL;
+    rc = 0;
+    goto done;
+truncated:
+    snprintf(out->error, sizeof(out->error), "Truncated response body");
+    goto done;
+oom:
+    snprintf(out->error, sizeof(out->error), "Out of memory");
+done:
+    if (rc < 0) *keep = 0;
+    free(hdrs.p);
+    free(body.p);
+    free(r.in.p);
+    return rc;
+}
+
+int wyn_http_fetch(const char* method, const char* url,
+                   const char* const* extra_headers, int extra_count,
+                   const char* body, size_t body_len, const char* content_type,
+                   WynHttpResult* out) {
+    memset(out, 0, sizeof(*out));
+    if (strncmp(url, "https://", 8) == 0) {
+        snprintf(out->error, sizeof(out->error), "HTTPS not supported by this client - use http://");
+        return -1;
     }
-    
-    struct hostent* he = gethostbyname(host);
-    if (!he) return NULL;
-    
-    int sock = socket(AF_INET, SOCK_STREAM, 0);
-    if (sock < 0) return NULL;
-    
-    struct sockaddr_in addr;
-    addr.sin_family = AF_INET;
-    addr.sin_port = htons(port);
-    memcpy(&addr.sin_addr, he->h_addr_list[0], he->h_length);
-    
-    if (connect(sock, (struct sockaddr*)&addr, sizeof(addr)) < 0) {
-        close(sock);
-        return NULL;
+    if (strncmp(url, "http://", 7) == 0) url += 7;
+
+    char host[256];
+    const char* path = strchr(url, '/');
+    size_t hlen = path ? (size_t)(path - url) : strlen(url);
+    if (hlen == 0 || hlen >= sizeof(host)) {
+        snprintf(out->error, sizeof(out->error), "Invalid URL");
+        return -1;
     }
-    
-    // Build request
-    char request[4096];
-    snprintf(request, sizeof(request),
-        "POST %s HTTP/1.1\r\n"
-        "Host: %s\r\n"
-        "User-Agent: Wyn/1.0\r\n"
-        "Content-Type: %s\r\n"
-        "Content-Length: %zu\r\n"
-        "Connection: close\r\n"
-        "\r\n"
-        "%s",
-        path, host, content_type ? content_type : "application/json",
-        strlen(body), body);
-    
-    send(sock, request, strlen(request), 0);
-    
-    char buffer[65536] = {0};
-    int total = 0;
-    int n;
-    while ((n = recv(sock, buffer + total, sizeof(buffer) - total - 1, 0)) > 0) {
-        total += n;
-        if (total >= sizeof(buffer) - 1) break;
+    memcpy(host, url, hlen);
+    host[hlen] = '\0';
+    if (!path) path = "/";
+    int port = 80;
+    char* colon = strrchr(host, ':');
+    if (colon && !strchr(colon, ']')) { *colon = '\0'; port = atoi(colon + 1); }
+
+    int pooled = http_pooling_enabled();
+    HttpBuf req = {0};
+    char line[320];
+    int ok = http_buf_append(&req, method, strlen(method)) == 0 &&
+             http_buf_append(&req, " ", 1) == 0 &&
+             http_buf_append(&req, path, strlen(path)) == 0 &&
+             http_buf_append(&req, " HTTP/1.1\r\n", 11) == 0;
+    int n = port == 80 ? snprintf(line, sizeof(line), "Host: %s\r\n", host)
+                       : snprintf(line, sizeof(line), "Host: %s:%d\r\n", host, port);
+    ok = ok && http_buf_append(&req, line, (size_t)n) == 0;
+    const char* fixed = "User-Agent: Wyn/1.4\r\nAccept: */*\r\n";
+    ok = ok && http_buf_append(&req, fixed, strlen(fixed)) == 0;
+    for (int i = 0; ok && i < extra_count; i++) {
+        if (!extra_headers[i]) continue;
+        ok = http_buf_append(&req, extra_headers[i], strlen(extra_headers[i])) == 0 &&
+             http_buf_append(&req, "\r\n", 2) == 0;
     }
-    
-    close(sock);
-    
-    return parse_http_response(buffer);
+    if (ok && body) {
+        const char* ct = content_type ? content_type : "application/octet-stream";
+        n = snprintf(line, sizeof(line), "Content-Length: %zu\r\n", body_len);
+        ok = http_buf_append(&req, "Content-Type: ", 14) == 0 &&
+             http_buf_append(&req, ct, strlen(ct)) == 0 &&
+             http_buf_append(&req, "\r\n", 2) == 0 &&
+             http_buf_append(&req, line, (size_t)n) == 0;
+    }
+    if (ok && !pooled) ok = http_buf_append(&req, "Connection: close\r\n", 19) == 0;
+    ok = ok && http_buf_append(&req, "\r\n", 2) == 0;
+    if (ok && body) ok = http_buf_append(&req, body, body_len) == 0;
+    if (!ok) {
+        free(req.p);
+        snprintf(out->error, sizeof(out->error), "Out of memory");
+        return -1;
+    }
+
+    char key[300];
+    snprintf(key, sizeof(key), "%s:%d", host, port);
+    int rc = -1;
+    for (int attempt = 0; attempt < 2; attempt++) {
+        int fd = pooled ? http_pool_checkout(key) : -1;
+        int reused = fd >= 0;
+        if (fd < 0) fd = http_connect(host, port, out->error);
+        if (fd < 0) break;
+        int keep, got_bytes;
+        out->error[0] = '\0';
+        out->status = 0;
+        if (http_exchange(fd, method, &req, out, &keep, &got_bytes) == 0) {
+            if (keep && pooled) http_pool_checkin(key, fd);
+            else close(fd);
+            rc = 0;
+            break;
+        }
+        close(fd);
+        if (!reused || got_bytes) break;
+    }
+    free(req.p);
+    return rc;
+}
+
+void wyn_http_result_free(WynHttpResult* r) {
+    if (!r) return;
+    free(r->headers);
+    free(r->body);
+    r->headers = r->body = NULL;
+}
+
+static HttpResponse* http_response_from(WynHttpResult* r) {
+    HttpResponse* resp = malloc(sizeof(HttpResponse));
+    if (!resp) { wyn_http_result_free(r); return NULL; }
+    resp->status_code = r->status;
+    resp->headers = r->headers;
+    resp->body = r->body;
+    resp->body_len = (int)r->body_len;
+    return resp;
+}
+
+// HTTP GET request
+HttpResponse* Http_get(const char* url) {
+    WynHttpResult r;
+    if (wyn_http_fetch("GET", url, NULL, 0, NULL, 0, NULL, &r) != 0) return NULL;
+    return http_response_from(&r);
+}
+
+// HTTP POST request
+HttpResponse* Http_post(const char* url, const char* body, const char* content_type) {
+    WynHttpResult r;
+    if (!body) body = "";
+    if (wyn_http_fetch("POST", url, NULL, 0, body, strlen(body),
+                       content_type ? content_type : "application/json", &r) != 0) return NULL;
+    return http_response_from(&r);
 }
 
 // Get response status
@@ -333,17 +1334,18 @@ void TcpServer_close(TcpServer* server) {
 
 // Connect to host:port, returns socket fd or -1
 int Socket_connect(const char* host, int port) {
-    struct hostent* he = gethostbyname(host);
-    if (!he) return -1;
-    int sock = socket(AF_INET, SOCK_STREAM, 0);
-    if (sock < 0) return -1;
-    struct sockaddr_in addr;
-    memset(&addr, 0, sizeof(addr));
-    addr.sin_family = AF_INET;
-    addr.sin_port = htons(port);
-    memcpy(&addr.sin_addr, he->h_addr_list[0], he->h_length);
-    if (connect(sock, (struct sockaddr*)&addr, sizeof(addr)) < 0) { close(sock); return -1; }
-    return sock;
+    char addrs[WYN_DNS_MAX_ADDRS][WYN_DNS_ADDRSTRLEN];
+    int count = wyn_dns_resolve(host, WYN_DNS_ANY, addrs, WYN_DNS_MAX_ADDRS);
+    for (int i = 0; i < count; i++) {
+        struct sockaddr_storage ss;
+        socklen_t len;
+        if (!dns_sockaddr(addrs[i], port, &ss, &len)) continue;
+        int sock = socket(ss.ss_family, SOCK_STREAM, 0);
+        if (sock < 0) continue;
+        if (connect(sock, (struct sockaddr*)&ss, len) == 0) return sock;
+        close(sock);
+    }
+    return -1;
 }
 
 // Send raw bytes, returns bytes sent or -1
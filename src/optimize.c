@@ -1,86 +1,1359 @@
+// AST optimizer - runs between check_program() and codegen.
+//
+// WHY THIS EXISTS: `wyn run` compiles through TCC, which does no optimization
+// of its own, and even gcc only sees what codegen hands it - `wyn_safe_div()`
+// calls, `(bool)` casts and mixed-type promotions that hide constants behind
+// casts. So everything here works on the typed AST where the facts are still
+// visible:
+//
+//   O1 (default)  constant folding, propagation of variables bound once to a
+//                 literal, and removal of `if`/`while`/ternary branches whose
+//                 condition folded to a constant.
+//   O2 (-O2, --release)
+//                 O1 + inlining of small pure int/float/bool functions at
+//                 call sites + hoisting of loop-invariant `var`s out of
+//                 while/for bodies.
+//
+// SOUNDNESS RULES - every pass refuses rather than guesses:
+//   - Nothing is folded that could trap or overflow at runtime (division by
+//     zero, LLONG_MIN / -1, shifts outside 0..63, signed overflow); those are
+//     left for the runtime so the program behaves identically at -O0.
+//   - A name is only treated as a constant if it is bound exactly ONCE in the
+//     whole program (vars, params, fns, pattern bindings, loop variables...),
+//     is never the target of an assignment and is never passed bare to a call
+//     (mut params are C pointers, so `f(x)` can change x with no EXPR_ASSIGN
+//     in sight). Name-based, so shadowing can never bite.
+//   - If the walker meets a node kind it does not model, propagation, inlining
+//     and LICM are switched off for the whole program (folding is local and
+//     stays on).
+//   - Rewrites happen in place (`*node = replacement`), keeping the checker's
+//     expr_type and the is_implicit_return / _codegen_temp_id flags codegen
+//     keys off, and never introduce C braces: STMT_BLOCK codegen emits none,
+//     so a hoisted declaration is spliced into the parent statement array -
+//     codegen's lookahead reads current_block_stmts.
+
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <limits.h>
+#include <math.h>
 #include "optimize.h"
 #include "ast.h"
 
+Type* make_type(TypeKind kind);
+
 OptLevel opt_level = OPT_NONE;
 
 void init_optimizer(OptLevel level) {
     opt_level = level;
 }
 
-// Dead code elimination
-bool is_dead_code(Stmt* stmt) {
-    if (!stmt) return true;
-    
-    // Simple dead code detection - remove standalone literals
-    if (stmt->type == STMT_EXPR) {
-        if (stmt->expr && stmt->expr->type == EXPR_INT) {
-            return true; // Remove standalone integer literals
+OptLevel opt_level_from_args(int argc, char** argv) {
+    OptLevel level = OPT_O1;
+    for (int i = 2; i < argc; i++) {
+        if (strcmp(argv[i], "--") == 0) break;
+        if (strcmp(argv[i], "-O0") == 0 || strcmp(argv[i], "--fast") == 0) level = OPT_NONE;
+        else if (strcmp(argv[i], "-O1") == 0) level = OPT_O1;
+        else if (strcmp(argv[i], "-O2") == 0 || strcmp(argv[i], "--release") == 0) level = OPT_O2;
+    }
+    return level;
+}
+
+// ---------------------------------------------------------------------------
+// Generic AST walker
+// ---------------------------------------------------------------------------
+// Children are visited before their parent (post-order) so a callback sees
+// already-simplified operands. on_bind fires for every token that introduces
+// a name; `decl` is the owning STMT_VAR/STMT_CONST or NULL.
+
+typedef struct OptWalk OptWalk;
+struct OptWalk {
+    void (*on_expr)(OptWalk* w, Expr* e);
+    void (*on_stmt)(OptWalk* w, Stmt* s);
+    void (*on_bind)(OptWalk* w, Token name, Stmt* decl);
+    void (*on_fn)(OptWalk* w, FnStmt* fn);
+    const void* unit;    // top-level fn (FnStmt*) or statement being walked
+    int fn_depth;        // > 0 inside a fn nested in the unit
+    int spawn_depth;     // > 0 under spawn: the call must stay a call
+    bool opaque;         // met a construct the walker does not model
+    int changes;
+    void* ctx;
+};
+
+static void walk_expr(OptWalk* w, Expr* e);
+static void walk_stmt(OptWalk* w, Stmt* s);
+
+static void walk_bind(OptWalk* w, Token name, Stmt* decl) {
+    if (w->on_bind && name.length > 0) w->on_bind(w, name, decl);
+}
+
+static void walk_pattern(OptWalk* w, Pattern* p) {
+    if (!p) return;
+    switch (p->type) {
+        case PATTERN_LITERAL: case PATTERN_WILDCARD: break;
+        case PATTERN_IDENT: walk_bind(w, p->ident.name, NULL); break;
+        case PATTERN_STRUCT:
+            for (int i = 0; i < p->struct_pat.field_count; i++) {
+                // Shorthand `Point{x, y}` binds the field names themselves
+                walk_bind(w, p->struct_pat.field_names[i], NULL);
+                if (p->struct_pat.field_patterns) walk_pattern(w, p->struct_pat.field_patterns[i]);
+            }
+            break;
+        case PATTERN_ARRAY:
+            for (int i = 0; i < p->array.element_count; i++) walk_pattern(w, p->array.elements[i]);
+            if (p->array.has_rest) walk_bind(w, p->array.rest_name, NULL);
+            break;
+        case PATTERN_TUPLE:
+            for (int i = 0; i < p->tuple.element_count; i++) walk_pattern(w, p->tuple.elements[i]);
+            break;
+        case PATTERN_RANGE:
+            walk_expr(w, p->range.start);
+            walk_expr(w, p->range.end);
+            break;
+        case PATTERN_OPTION:
+            walk_pattern(w, p->option.inner);
+            for (int i = 0; i < p->option.inner_count; i++) walk_pattern(w, p->option.inners[i]);
+            break;
+        case PATTERN_GUARD:
+            walk_pattern(w, p->guard.pattern);
+            walk_expr(w, p->guard.guard);
+            break;
+        case PATTERN_OR:
+            for (int i = 0; i < p->or_pat.pattern_count; i++) walk_pattern(w, p->or_pat.patterns[i]);
+            break;
+        default: w->opaque = true; break;
+    }
+}
+
+static void walk_fn(OptWalk* w, FnStmt* fn) {
+    if (!fn) return;
+    if (w->on_fn) w->on_fn(w, fn);
+    walk_bind(w, fn->name, NULL);
+    bool nested = (w->unit != fn);
+    if (nested) w->fn_depth++;
+    for (int i = 0; i < fn->param_count; i++) {
+        walk_bind(w, fn->params[i], NULL);
+        if (fn->param_defaults) walk_expr(w, fn->param_defaults[i]);
+    }
+    walk_stmt(w, fn->body);
+    if (nested) w->fn_depth--;
+}
+
+static void walk_exprs(OptWalk* w, Expr** es, int n) {
+    for (int i = 0; es && i < n; i++) walk_expr(w, es[i]);
+}
+
+static void walk_stmts(OptWalk* w, Stmt** ss, int n) {
+    for (int i = 0; ss && i < n; i++) walk_stmt(w, ss[i]);
+}
+
+static void walk_expr(OptWalk* w, Expr* e) {
+    if (!e) return;
+    switch (e->type) {
+        case EXPR_INT: case EXPR_FLOAT: case EXPR_STRING: case EXPR_CHAR:
+        case EXPR_IDENT: case EXPR_BOOL: case EXPR_NONE:
+        case EXPR_OPTIONAL_TYPE: case EXPR_UNION_TYPE: case EXPR_RESULT_TYPE:
+        case EXPR_FN_TYPE:
+            break;
+        case EXPR_BINARY: walk_expr(w, e->binary.left); walk_expr(w, e->binary.right); break;
+        case EXPR_CALL:
+            walk_expr(w, e->call.callee);
+            walk_exprs(w, e->call.args, e->call.arg_count);
+            break;
+        case EXPR_METHOD_CALL:
+            walk_expr(w, e->method_call.object);
+            walk_exprs(w, e->method_call.args, e->method_call.arg_count);
+            break;
+        case EXPR_ARRAY: case EXPR_HASHMAP_LITERAL: case EXPR_HASHSET_LITERAL:
+            walk_exprs(w, e->array.elements, e->array.count);
+            break;
+        case EXPR_INDEX: walk_expr(w, e->index.array); walk_expr(w, e->index.index); break;
+        case EXPR_ASSIGN: walk_expr(w, e->assign.value); break;
+        case EXPR_STRUCT_INIT:
+            walk_exprs(w, e->struct_init.field_values, e->struct_init.field_count);
+            break;
+        case EXPR_FIELD_ACCESS: walk_expr(w, e->field_access.object); break;
+        case EXPR_OPT_CHAIN: walk_expr(w, e->opt_chain.object); break;
+        case EXPR_UNARY: walk_expr(w, e->unary.operand); break;
+        case EXPR_AWAIT: walk_expr(w, e->await.expr); break;
+        case EXPR_MATCH:
+            walk_expr(w, e->match.value);
+            for (int i = 0; i < e->match.arm_count; i++) {
+                walk_pattern(w, e->match.arms[i].pattern);
+                walk_expr(w, e->match.arms[i].result);
+            }
+            break;
+        case EXPR_TERNARY:
+            walk_expr(w, e->ternary.condition);
+            walk_expr(w, e->ternary.then_expr);
+            walk_expr(w, e->ternary.else_expr);
+            break;
+        case EXPR_SOME: case EXPR_OK: case EXPR_ERR: walk_expr(w, e->option.value); break;
+        case EXPR_TRY: walk_expr(w, e->try_expr.value); break;
+        case EXPR_IF_EXPR:
+            walk_expr(w, e->if_expr.condition);
+            walk_expr(w, e->if_expr.then_expr);
+            walk_expr(w, e->if_expr.else_expr);
+            break;
+        case EXPR_STRING_INTERP:
+            walk_exprs(w, e->string_interp.expressions, e->string_interp.count);
+            break;
+        case EXPR_RANGE: walk_expr(w, e->range.start); walk_expr(w, e->range.end); break;
+        case EXPR_LAMBDA:
+            for (int i = 0; i < e->lambda.param_count; i++) walk_bind(w, e->lambda.params[i], NULL);
+            walk_stmts(w, e->lambda.body_stmts, e->lambda.body_stmt_count);
+            walk_expr(w, e->lambda.body);
+            break;
+        case EXPR_MAP:
+            walk_exprs(w, e->map.keys, e->map.count);
+            walk_exprs(w, e->map.values, e->map.count);
+            break;
+        case EXPR_TUPLE: walk_exprs(w, e->tuple.elements, e->tuple.count); break;
+        case EXPR_TUPLE_INDEX: walk_expr(w, e->tuple_index.tuple); break;
+        case EXPR_INDEX_ASSIGN:
+            walk_expr(w, e->index_assign.object);
+            walk_expr(w, e->index_assign.index);
+            walk_expr(w, e->index_assign.value);
+            break;
+        case EXPR_FIELD_ASSIGN:
+            walk_expr(w, e->field_assign.object);
+            walk_expr(w, e->field_assign.value);
+            break;
+        case EXPR_BLOCK:
+            walk_stmts(w, e->block.stmts, e->block.stmt_count);
+            walk_expr(w, e->block.result);
+            break;
+        case EXPR_SPAWN:
+            w->spawn_depth++;
+            walk_expr(w, e->spawn.call);
+            w->spawn_depth--;
+            break;
+        case EXPR_LIST_COMP:
+            walk_bind(w, e->list_comp.var_name, NULL);
+            walk_expr(w, e->list_comp.iter_start);
+            walk_expr(w, e->list_comp.iter_end);
+            walk_expr(w, e->list_comp.condition);
+            walk_expr(w, e->list_comp.body);
+            break;
+        case EXPR_CHANNEL: walk_expr(w, e->channel.capacity); break;
+        default: w->opaque = true; return;
+    }
+    if (w->on_expr) w->on_expr(w, e);
+}
+
+static void walk_stmt(OptWalk* w, Stmt* s) {
+    if (!s) return;
+    switch (s->type) {
+        case STMT_EXPR: case STMT_DEFER: walk_expr(w, s->expr); break;
+        case STMT_VAR: case STMT_CONST:
+            walk_expr(w, s->var.init);
+            if (s->var.uses_pattern) walk_pattern(w, s->var.pattern);
+            else walk_bind(w, s->var.name, s);
+            break;
+        case STMT_RETURN: walk_expr(w, s->ret.value); break;
+        case STMT_YIELD: walk_expr(w, s->yield_stmt.value); break;
+        case STMT_BLOCK: case STMT_PARALLEL:
+            // `timeout` is only meaningful on parallel: the parser turns some
+            // var statements into blocks in place, leaving stale union bytes
+            if (s->type == STMT_PARALLEL) walk_expr(w, s->block.timeout);
+            walk_stmts(w, s->block.stmts, s->block.count);
+            break;
+        case STMT_FN: walk_fn(w, &s->fn); break;
+        case STMT_EXTERN: walk_bind(w, s->extern_fn.name, NULL); break;
+        case STMT_STRUCT:
+            walk_bind(w, s->struct_decl.name, NULL);
+            for (int i = 0; i < s->struct_decl.method_count; i++) walk_fn(w, s->struct_decl.methods[i]);
+            break;
+        case STMT_IMPL:
+            for (int i = 0; i < s->impl.method_count; i++) walk_fn(w, s->impl.methods[i]);
+            break;
+        case STMT_TRAIT:
+            walk_bind(w, s->trait_decl.name, NULL);
+            for (int i = 0; i < s->trait_decl.method_count; i++) walk_fn(w, s->trait_decl.methods[i]);
+            break;
+        case STMT_IF:
+            walk_expr(w, s->if_stmt.condition);
+            walk_stmt(w, s->if_stmt.then_branch);
+            walk_stmt(w, s->if_stmt.else_branch);
+            break;
+        case STMT_WHILE:
+            walk_expr(w, s->while_stmt.condition);
+            walk_stmt(w, s->while_stmt.body);
+            break;
+        case STMT_FOR:
+            walk_stmt(w, s->for_stmt.init);
+            walk_expr(w, s->for_stmt.array_expr);
+            walk_bind(w, s->for_stmt.loop_var, NULL);
+            if (s->for_stmt.has_index) walk_bind(w, s->for_stmt.index_var, NULL);
+            walk_expr(w, s->for_stmt.condition);
+            walk_expr(w, s->for_stmt.increment);
+            walk_stmt(w, s->for_stmt.body);
+            break;
+        case STMT_BREAK: case STMT_CONTINUE: break;
+        case STMT_ENUM:
+            walk_bind(w, s->enum_decl.name, NULL);
+            for (int i = 0; i < s->enum_decl.variant_count; i++) walk_bind(w, s->enum_decl.variants[i], NULL);
+            break;
+        case STMT_TYPE_ALIAS: walk_bind(w, s->type_alias.name, NULL); break;
+        case STMT_IMPORT:
+            walk_bind(w, s->import.module, NULL);
+            walk_bind(w, s->import.alias, NULL);
+            for (int i = 0; i < s->import.item_count; i++) walk_bind(w, s->import.items[i], NULL);
+            break;
+        case STMT_EXPORT: walk_stmt(w, s->export.stmt); break;
+        case STMT_TRY:
+            walk_stmt(w, s->try_stmt.try_block);
+            for (int i = 0; i < s->try_stmt.catch_count; i++) {
+                if (s->try_stmt.exception_vars) walk_bind(w, s->try_stmt.exception_vars[i], NULL);
+                walk_stmt(w, s->try_stmt.catch_blocks[i]);
+            }
+            walk_stmt(w, s->try_stmt.finally_block);
+            break;
+        case STMT_THROW: walk_expr(w, s->throw_stmt.value); break;
+        case STMT_TEST: walk_stmt(w, s->test_stmt.body); break;
+        case STMT_MATCH:
+            walk_expr(w, s->match_stmt.value);
+            for (int i = 0; i < s->match_stmt.case_count; i++) {
+                walk_pattern(w, s->match_stmt.cases[i].pattern);
+                walk_expr(w, s->match_stmt.cases[i].guard);
+                walk_stmt(w, s->match_stmt.cases[i].body);
+            }
+            break;
+        case STMT_SPAWN:
+            w->spawn_depth++;
+            walk_expr(w, s->spawn.call);
+            w->spawn_depth--;
+            break;
+        case STMT_SELECT:
+            for (int i = 0; i < s->select_stmt.arm_count; i++) {
+                walk_expr(w, s->select_stmt.channels[i]);
+                walk_bind(w, s->select_stmt.bind_names[i], NULL);
+                walk_stmt(w, s->select_stmt.bodies[i]);
+            }
+            break;
+        default: w->opaque = true; return;
+    }
+    if (w->on_stmt) w->on_stmt(w, s);
+}
+
+// Walks the whole program one unit at a time. Every top-level fn and every
+// struct/impl/trait method is its own unit; any other top-level statement is
+// a unit by itself.
+static void walk_program(OptWalk* w, Program* prog) {
+    for (int i = 0; i < prog->count; i++) {
+        Stmt* s = prog->stmts[i];
+        if (!s) continue;
+        Stmt* inner = (s->type == STMT_EXPORT && s->export.stmt) ? s->export.stmt : s;
+        w->fn_depth = 0;
+        w->spawn_depth = 0;
+        if (inner->type == STMT_FN) {
+            w->unit = &inner->fn;
+            walk_stmt(w, s);
+        } else if (inner->type == STMT_STRUCT || inner->type == STMT_IMPL || inner->type == STMT_TRAIT) {
+            FnStmt** methods = inner->type == STMT_STRUCT ? inner->struct_decl.methods
+                             : inner->type == STMT_IMPL ? inner->impl.methods : inner->trait_decl.methods;
+            int n = inner->type == STMT_STRUCT ? inner->struct_decl.method_count
+                  : inner->type == STMT_IMPL ? inner->impl.method_count : inner->trait_decl.method_count;
+            if (inner->type == STMT_STRUCT) walk_bind(w, inner->struct_decl.name, NULL);
+            if (inner->type == STMT_TRAIT) walk_bind(w, inner->trait_decl.name, NULL);
+            for (int m = 0; m < n; m++) {
+                w->unit = methods[m];
+                walk_fn(w, methods[m]);
+            }
+        } else {
+            w->unit = s;
+            walk_stmt(w, s);
         }
-        if (stmt->expr && stmt->expr->type == EXPR_STRING) {
-            return true; // Remove standalone string literals
+    }
+}
+
+// ---------------------------------------------------------------------------
+// Program-wide name facts
+// ---------------------------------------------------------------------------
+
+typedef struct {
+    const char* name;
+    int len;
+    int binds;          // declarations of this name anywhere in the program
+    bool assigned;      // target of an EXPR_ASSIGN somewhere
+    bool escapes;       // passed bare to a call or used as a method receiver
+    Stmt* decl;         // the STMT_VAR/STMT_CONST when it is the only binding
+    const void* scope;  // unit the decl is visible in; NULL = whole program
+    bool nested;        // declared inside a fn nested in its unit
+} OptName;
+
+static OptName* opt_names = NULL;
+static int opt_names_cap = 0;
+static int opt_names_used = 0;
+static bool opt_opaque = false;
+
+static unsigned opt_hash(const char* s, int len) {
+    unsigned h = 2166136261u;
+    for (int i = 0; i < len; i++) h = (h ^ (unsigned char)s[i]) * 16777619u;
+    return h;
+}
+
+static OptName* opt_name_slot(const char* s, int len, bool create) {
+    if (opt_names_cap == 0) {
+        if (!create) return NULL;
+        opt_names_cap = 256;
+        opt_names = calloc(opt_names_cap, sizeof(OptName));
+    } else if (create && (opt_names_used + 1) * 10 > opt_names_cap * 7) {
+        OptName* old = opt_names;
+        int old_cap = opt_names_cap;
+        opt_names_cap *= 2;
+        opt_names = calloc(opt_names_cap, sizeof(OptName));
+        for (int i = 0; i < old_cap; i++) {
+            if (!old[i].name) continue;
+            unsigned j = opt_hash(old[i].name, old[i].len) & (opt_names_cap - 1);
+            while (opt_names[j].name) j = (j + 1) & (opt_names_cap - 1);
+            opt_names[j] = old[i];
         }
+        free(old);
+    }
+    unsigned j = opt_hash(s, len) & (opt_names_cap - 1);
+    while (opt_names[j].name) {
+        if (opt_names[j].len == len && memcmp(opt_names[j].name, s, len) == 0) return &opt_names[j];
+        j = (j + 1) & (opt_names_cap - 1);
     }
-    
+    if (!create) return NULL;
+    opt_names[j].name = s;
+    opt_names[j].len = len;
+    opt_names_used++;
+    return &opt_names[j];
+}
+
+static OptName* opt_name(Token t) {
+    return opt_name_slot(t.start, t.length, false);
+}
+
+static void facts_bind(OptWalk* w, Token name, Stmt* decl) {
+    OptName* n = opt_name_slot(name.start, name.length, true);
+    n->binds++;
+    n->decl = decl;
+    n->nested = w->fn_depth > 0;
+    // A top-level var/const is a global: visible in every unit
+    n->scope = (decl && w->unit == (const void*)decl) ? NULL : w->unit;
+}
+
+static void facts_escape(Expr* arg) {
+    if (arg && arg->type == EXPR_IDENT)
+        opt_name_slot(arg->token.start, arg->token.length, true)->escapes = true;
+}
+
+// Names of fns/methods with a `mut` parameter (any position, any owner). A
+// bare variable passed to anything else - println, a user fn without mut
+// params, a builtin method - cannot be written through.
+typedef struct {
+    Token* names;
+    int count;
+    int cap;
+} NameSet;
+
+static void nameset_add(NameSet* s, Token t) {
+    if (s->count == s->cap) {
+        s->cap = s->cap ? s->cap * 2 : 16;
+        s->names = realloc(s->names, sizeof(Token) * s->cap);
+    }
+    s->names[s->count++] = t;
+}
+
+static bool nameset_has(const NameSet* s, Token t) {
+    for (int i = 0; i < s->count; i++)
+        if (s->names[i].length == t.length && memcmp(s->names[i].start, t.start, t.length) == 0)
+            return true;
     return false;
 }
 
-void eliminate_dead_code(Program* prog) {
-    if (opt_level == OPT_NONE || !prog) return;
-    
-    // Remove dead statements from program
-    int write_idx = 0;
-    for (int i = 0; i < prog->count; i++) {
-        if (!is_dead_code(prog->stmts[i])) {
-            prog->stmts[write_idx++] = prog->stmts[i];
-        }
+static NameSet mut_fns;
+
+static void facts_fn(OptWalk* w, FnStmt* fn) {
+    (void)w;
+    for (int i = 0; fn->param_mutable && i < fn->param_count; i++)
+        if (fn->param_mutable[i]) { nameset_add(&mut_fns, fn->name); return; }
+}
+
+static void facts_expr(OptWalk* w, Expr* e) {
+    (void)w;
+    if (e->type == EXPR_ASSIGN) {
+        opt_name_slot(e->assign.name.start, e->assign.name.length, true)->assigned = true;
+    } else if (e->type == EXPR_CALL) {
+        if (e->call.callee && e->call.callee->type == EXPR_IDENT &&
+            !nameset_has(&mut_fns, e->call.callee->token)) return;
+        for (int i = 0; i < e->call.arg_count; i++) facts_escape(e->call.args[i]);
+    } else if (e->type == EXPR_METHOD_CALL) {
+        if (!nameset_has(&mut_fns, e->method_call.method)) return;
+        facts_escape(e->method_call.object);
+        for (int i = 0; i < e->method_call.arg_count; i++) facts_escape(e->method_call.args[i]);
+    } else if (e->type == EXPR_UNARY && e->unary.op.type == TOKEN_AMP) {
+        facts_escape(e->unary.operand);
     }
-    prog->count = write_idx;
 }
 
+static void collect_facts(Program* prog) {
+    if (opt_names) memset(opt_names, 0, sizeof(OptName) * opt_names_cap);
+    opt_names_used = 0;
+    mut_fns.count = 0;
+    OptWalk pre = {0};
+    pre.on_fn = facts_fn;
+    walk_program(&pre, prog);
+    OptWalk w = {0};
+    w.on_expr = facts_expr;
+    w.on_bind = facts_bind;
+    walk_program(&w, prog);
+    opt_opaque = w.opaque;
+}
+
+// A name whose value can never change after its single binding
+static bool name_is_stable(Token t) {
+    OptName* n = opt_name(t);
+    return n && n->binds == 1 && !n->assigned && !n->escapes;
+}
+
+// ---------------------------------------------------------------------------
+// Literals
+// ---------------------------------------------------------------------------
+
+typedef struct {
+    TypeKind kind;      // TYPE_INT, TYPE_FLOAT or TYPE_BOOL
+    long long i;
+    double f;
+    bool b;
+} OptLit;
+
+// Parses an int literal the way codegen emits it: 0x/0b prefixes, `_`
+// separators, and leading zeros are decimal (Wyn has no octal).
+static bool parse_int_token(Token t, long long* out) {
+    char buf[80];
+    int n = 0;
+    for (int i = 0; i < t.length && n < (int)sizeof(buf) - 1; i++)
+        if (t.start[i] != '_') buf[n++] = t.start[i];
+    buf[n] = '\0';
+    int base = 10;
+    const char* p = buf;
+    if (n > 2 && p[0] == '0' && (p[1] == 'x' || p[1] == 'X')) { base = 16; p += 2; }
+    else if (n > 2 && p[0] == '0' && (p[1] == 'b' || p[1] == 'B')) { base = 2; p += 2; }
+    char* end;
+    unsigned long long v = strtoull(p, &end, base);
+    if (*end != '\0' || end == p || v > (unsigned long long)LLONG_MAX) return false;
+    *out = (long long)v;
+    return true;
+}
+
+static bool parse_float_token(Token t, double* out) {
+    char buf[80];
+    int n = 0;
+    for (int i = 0; i < t.length && n < (int)sizeof(buf) - 1; i++)
+        if (t.start[i] != '_') buf[n++] = t.start[i];
+    buf[n] = '\0';
+    char* end;
+    double v = strtod(buf, &end);
+    if (*end != '\0' || end == buf || !isfinite(v)) return false;
+    *out = v;
+    return true;
+}
+
+static TypeKind expr_kind(const Expr* e) {
+    return e && e->expr_type ? e->expr_type->kind : (TypeKind)-1;
+}
+
+// Literal value of `e`: an int/float/bool literal, or `-` applied to a
+// numeric literal (the parser's and this pass's spelling of negatives).
+static bool literal_value(const Expr* e, OptLit* out) {
+    if (!e) return false;
+    switch (e->type) {
+        case EXPR_INT:
+            out->kind = TYPE_INT;
+            return parse_int_token(e->token, &out->i);
+        case EXPR_FLOAT:
+            out->kind = TYPE_FLOAT;
+            return parse_float_token(e->token, &out->f);
+        case EXPR_BOOL:
+            out->kind = TYPE_BOOL;
+            out->b = e->token.type == TOKEN_TRUE ||
+                     (e->token.length == 4 && memcmp(e->token.start, "true", 4) == 0);
+            return true;
+        case EXPR_UNARY:
+            if (e->unary.op.type != TOKEN_MINUS) return false;
+            if (e->unary.operand->type == EXPR_INT) {
+                if (!literal_value(e->unary.operand, out)) return false;
+                out->i = -out->i;
+                return true;
+            }
+            if (e->unary.operand->type == EXPR_FLOAT) {
+                if (!literal_value(e->unary.operand, out)) return false;
+                out->f = -out->f;
+                return true;
+            }
+            return false;
+        default:
+            return false;
+    }
+}
+
+static Expr* new_expr(void) {
+    Expr* e = calloc(1, sizeof(Expr));
+    e->_codegen_temp_id = -1;
+    return e;
+}
+
+// Overwrites `dst` with `src`, keeping the flags codegen attached to the slot.
+// The replacement's own type wins: the checker types comparisons and
+// `and`/`or` as int ("bools are ints"), but codegen prints and declares a
+// folded `true` by its bool type.
+static void replace_expr(Expr* dst, const Expr* src) {
+    bool implicit = dst->is_implicit_return;
+    int temp_id = dst->_codegen_temp_id;
+    struct Type* type = dst->expr_type;
+    int line = dst->token.line;
+    *dst = *src;
+    dst->is_implicit_return = implicit;
+    dst->_codegen_temp_id = temp_id;
+    if (!dst->expr_type) dst->expr_type = type;
+    if (dst->token.line == 0) dst->token.line = line;
+}
+
+// Rewrites `e` into the literal `lit`. Negative numbers become `-(literal)`
+// so codegen's own EXPR_INT/EXPR_FLOAT paths never see a sign.
+static bool set_literal(Expr* e, OptLit lit) {
+    Expr v = {0};
+    v._codegen_temp_id = -1;
+    v.token.line = e->token.line;
+    char buf[64];
+    bool negative = false;
+    if (lit.kind == TYPE_INT) {
+        if (lit.i == LLONG_MIN) return false;
+        negative = lit.i < 0;
+        snprintf(buf, sizeof(buf), "%lld", negative ? -lit.i : lit.i);
+        v.type = EXPR_INT;
+        v.token.type = TOKEN_INT;
+    } else if (lit.kind == TYPE_FLOAT) {
+        if (!isfinite(lit.f)) return false;
+        negative = signbit(lit.f);
+        snprintf(buf, sizeof(buf), "%.17g", negative ? -lit.f : lit.f);
+        if (!strpbrk(buf, ".e")) strcat(buf, ".0");
+        v.type = EXPR_FLOAT;
+        v.token.type = TOKEN_FLOAT;
+    } else {
+        v.type = EXPR_BOOL;
+        v.token.type = lit.b ? TOKEN_TRUE : TOKEN_FALSE;
+        v.token.start = lit.b ? "true" : "false";
+        v.token.length = lit.b ? 4 : 5;
+        if (expr_kind(e) != TYPE_BOOL) v.expr_type = make_type(TYPE_BOOL);
+        replace_expr(e, &v);
+        return true;
+    }
+    v.token.start = strdup(buf);
+    v.token.length = (int)strlen(buf);
+    if (!negative) {
+        replace_expr(e, &v);
+        return true;
+    }
+    Expr* operand = new_expr();
+    *operand = v;
+    operand->expr_type = e->expr_type;
+    Expr u = {0};
+    u.type = EXPR_UNARY;
+    u._codegen_temp_id = -1;
+    u.token.line = e->token.line;
+    u.unary.op.type = TOKEN_MINUS;
+    u.unary.op.start = "-";
+    u.unary.op.length = 1;
+    u.unary.op.line = e->token.line;
+    u.unary.operand = operand;
+    replace_expr(e, &u);
+    return true;
+}
+
+// ---------------------------------------------------------------------------
 // Constant folding
+// ---------------------------------------------------------------------------
+
+static bool is_logic_op(WynTokenType op) {
+    return op == TOKEN_AND || op == TOKEN_OR || op == TOKEN_AMPAMP || op == TOKEN_PIPEPIPE;
+}
+
+static bool is_compare_op(WynTokenType op) {
+    return op == TOKEN_EQEQ || op == TOKEN_BANGEQ || op == TOKEN_LT || op == TOKEN_GT ||
+           op == TOKEN_LTEQ || op == TOKEN_GTEQ;
+}
+
+static bool is_arith_op(WynTokenType op) {
+    return op == TOKEN_PLUS || op == TOKEN_MINUS || op == TOKEN_STAR || op == TOKEN_SLASH ||
+           op == TOKEN_PERCENT || op == TOKEN_AMP || op == TOKEN_PIPE || op == TOKEN_CARET ||
+           op == TOKEN_LSHIFT || op == TOKEN_RSHIFT;
+}
+
+// Operators whose operands are plain values - the only binary positions the
+// optimizer substitutes into or folds (not `in`, `??`, `|>`, ...).
+static bool is_value_op(WynTokenType op) {
+    return is_arith_op(op) || is_compare_op(op) || is_logic_op(op);
+}
+
+static bool fold_int_op(WynTokenType op, long long a, long long b, long long* r) {
+    switch (op) {
+        case TOKEN_PLUS: return !__builtin_add_overflow(a, b, r);
+        case TOKEN_MINUS: return !__builtin_sub_overflow(a, b, r);
+        case TOKEN_STAR: return !__builtin_mul_overflow(a, b, r);
+        case TOKEN_SLASH:
+            if (b == 0 || (a == LLONG_MIN && b == -1)) return false;
+            *r = a / b; return true;
+        case TOKEN_PERCENT:
+            if (b == 0 || (a == LLONG_MIN && b == -1)) return false;
+            *r = a % b; return true;
+        case TOKEN_AMP: *r = a & b; return true;
+        case TOKEN_PIPE: *r = a | b; return true;
+        case TOKEN_CARET: *r = a ^ b; return true;
+        case TOKEN_LSHIFT:
+            if (b < 0 || b > 63 || a < 0 || (b > 0 && a > (LLONG_MAX >> b))) return false;
+            *r = a << b; return true;
+        case TOKEN_RSHIFT:
+            if (b < 0 || b > 63 || a < 0) return false;
+            *r = a >> b; return true;
+        default: return false;
+    }
+}
+
+static bool fold_float_op(WynTokenType op, double a, double b, double* r) {
+    switch (op) {
+        case TOKEN_PLUS: *r = a + b; break;
+        case TOKEN_MINUS: *r = a - b; break;
+        case TOKEN_STAR: *r = a * b; break;
+        case TOKEN_SLASH: if (b == 0.0) return false; *r = a / b; break;
+        default: return false;
+    }
+    return isfinite(*r);
+}
+
+static bool compare_values(WynTokenType op, double a, double b) {
+    switch (op) {
+        case TOKEN_EQEQ: return a == b;
+        case TOKEN_BANGEQ: return a != b;
+        case TOKEN_LT: return a < b;
+        case TOKEN_GT: return a > b;
+        case TOKEN_LTEQ: return a <= b;
+        default: return a >= b;
+    }
+}
+
+static bool fold_binary(Expr* e) {
+    WynTokenType op = e->binary.op.type;
+    if (!is_value_op(op)) return false;
+    TypeKind want = expr_kind(e);
+    OptLit l, r, out = {0};
+    bool lk = literal_value(e->binary.left, &l);
+
+    // `true && x` / `false || x` -> x ; `false && x` / `true || x` -> constant
+    if (is_logic_op(op)) {
+        if (!lk || l.kind != TYPE_BOOL) return false;
+        bool is_and = (op == TOKEN_AND || op == TOKEN_AMPAMP);
+        if (l.b != is_and) {
+            out.kind = TYPE_BOOL;
+            out.b = l.b;
+            return set_literal(e, out);
+        }
+        Expr* right = e->binary.right;
+        bool right_is_bool = expr_kind(right) == TYPE_BOOL ||
+            (right->type == EXPR_BINARY && (is_compare_op(right->binary.op.type) ||
+                                            is_logic_op(right->binary.op.type)));
+        if (!right_is_bool) return false;
+        replace_expr(e, right);
+        return true;
+    }
+
+    if (!lk || !literal_value(e->binary.right, &r)) return false;
+    if (is_compare_op(op)) {
+        if ((int)want != -1 && want != TYPE_BOOL && want != TYPE_INT) return false;
+        out.kind = TYPE_BOOL;
+        if (l.kind == TYPE_BOOL && r.kind == TYPE_BOOL) {
+            if (op != TOKEN_EQEQ && op != TOKEN_BANGEQ) return false;
+            out.b = (op == TOKEN_EQEQ) == (l.b == r.b);
+        } else if (l.kind == TYPE_INT && r.kind == TYPE_INT) {
+            // Exact: no detour through double for large values
+            long long a = l.i, b = r.i;
+            out.b = op == TOKEN_EQEQ ? a == b : op == TOKEN_BANGEQ ? a != b :
+                    op == TOKEN_LT ? a < b : op == TOKEN_GT ? a > b :
+                    op == TOKEN_LTEQ ? a <= b : a >= b;
+        } else if (l.kind != TYPE_BOOL && r.kind != TYPE_BOOL) {
+            double a = l.kind == TYPE_INT ? (double)l.i : l.f;
+            double b = r.kind == TYPE_INT ? (double)r.i : r.f;
+            out.b = compare_values(op, a, b);
+        } else {
+            return false;
+        }
+        return set_literal(e, out);
+    }
+
+    if (l.kind == TYPE_INT && r.kind == TYPE_INT) {
+        if ((int)want != -1 && want != TYPE_INT) return false;
+        out.kind = TYPE_INT;
+        if (!fold_int_op(op, l.i, r.i, &out.i)) return false;
+        return set_literal(e, out);
+    }
+    if (l.kind == TYPE_BOOL || r.kind == TYPE_BOOL) return false;
+    // Mixed int/float promotes to float, like codegen's (double) casts
+    if ((int)want != -1 && want != TYPE_FLOAT) return false;
+    double a = l.kind == TYPE_INT ? (double)l.i : l.f;
+    double b = r.kind == TYPE_INT ? (double)r.i : r.f;
+    out.kind = TYPE_FLOAT;
+    if (!fold_float_op(op, a, b, &out.f)) return false;
+    return set_literal(e, out);
+}
+
+static bool fold_unary(Expr* e) {
+    Expr* operand = e->unary.operand;
+    OptLit v;
+    if (!literal_value(operand, &v)) return false;
+    WynTokenType op = e->unary.op.type;
+    if (op == TOKEN_MINUS) {
+        // `-5` is already canonical; only `-(-5)` has something to fold
+        if (operand->type != EXPR_UNARY) return false;
+        if (v.kind == TYPE_INT) { v.i = -v.i; return set_literal(e, v); }
+        if (v.kind == TYPE_FLOAT) { v.f = -v.f; return set_literal(e, v); }
+        return false;
+    }
+    if ((op == TOKEN_NOT || op == TOKEN_BANG) && v.kind == TYPE_BOOL) {
+        v.b = !v.b;
+        return set_literal(e, v);
+    }
+    if (op == TOKEN_TILDE && v.kind == TYPE_INT) {
+        v.i = ~v.i;
+        return set_literal(e, v);
+    }
+    return false;
+}
+
+static bool fold_one(Expr* e) {
+    if (e->type == EXPR_BINARY) return fold_binary(e);
+    if (e->type == EXPR_UNARY) return fold_unary(e);
+    return false;
+}
+
+static void fold_expr_cb(OptWalk* w, Expr* e) {
+    if (fold_one(e)) w->changes++;
+}
+
 Expr* fold_constants(Expr* expr) {
     if (opt_level == OPT_NONE || !expr) return expr;
-    
-    if (expr->type == EXPR_BINARY) {
-        BinaryExpr* bin = (BinaryExpr*)expr;
-        
-        // Fold both operands first
-        bin->left = fold_constants(bin->left);
-        bin->right = fold_constants(bin->right);
-        
-        // Check if both operands are integer literals
-        if (bin->left->type == EXPR_INT && bin->right->type == EXPR_INT) {
-            // For simplicity, we'll just mark that folding would happen here
-            // Full implementation would require creating new literal expressions
-            printf("// Constant folding opportunity detected\n");
+    OptWalk w = {0};
+    w.on_expr = fold_expr_cb;
+    walk_expr(&w, expr);
+    return expr;
+}
+
+// ---------------------------------------------------------------------------
+// Constant propagation + dead-branch elimination (O1)
+// ---------------------------------------------------------------------------
+
+// The literal a stable, visible name is bound to, or NULL
+static Expr* propagated_value(OptWalk* w, const Expr* ident) {
+    if (opt_opaque || ident->type != EXPR_IDENT) return NULL;
+    OptName* n = opt_name(ident->token);
+    if (!n || n->binds != 1 || n->assigned || n->escapes || !n->decl || n->nested) return NULL;
+    VarStmt* v = &n->decl->var;
+    if (v->from_bare_assign || v->uses_pattern || !v->init) return NULL;
+    if (n->scope && (n->scope != w->unit || w->fn_depth > 0)) return NULL;
+    OptLit lit;
+    if (!literal_value(v->init, &lit)) return NULL;
+    // The use must have the literal's type: no int->float conversion through
+    // a `var x: float = 1` annotation, no enum/struct lookalikes.
+    if (expr_kind(ident) != lit.kind) return NULL;
+    if (v->type && (v->type->type != EXPR_IDENT ||
+        !((lit.kind == TYPE_INT && v->type->token.length == 3 && memcmp(v->type->token.start, "int", 3) == 0) ||
+          (lit.kind == TYPE_FLOAT && v->type->token.length == 5 && memcmp(v->type->token.start, "float", 5) == 0) ||
+          (lit.kind == TYPE_BOOL && v->type->token.length == 4 && memcmp(v->type->token.start, "bool", 4) == 0))))
+        return NULL;
+    return v->init;
+}
+
+static Expr* copy_expr(const Expr* e);
+
+static void substitute(OptWalk* w, Expr* slot) {
+    if (!slot) return;
+    Expr* value = propagated_value(w, slot);
+    if (!value) return;
+    replace_expr(slot, copy_expr(value));
+    w->changes++;
+}
+
+// A subtree codegen treats specially: bare-assign declarations are hoisted
+// to function scope, implicit returns become `return`, and defers are scoped
+// to their block - none of them may be moved or dropped.
+static void pinned_expr(OptWalk* w, Expr* e) { if (e->is_implicit_return) w->opaque = true; }
+static void pinned_stmt(OptWalk* w, Stmt* s) {
+    if (s->type == STMT_DEFER) w->opaque = true;
+    if ((s->type == STMT_VAR || s->type == STMT_CONST) && s->var.from_bare_assign) w->opaque = true;
+}
+
+static bool is_pinned(Stmt* s) {
+    if (!s) return false;
+    OptWalk p = {0};
+    p.on_expr = pinned_expr;
+    p.on_stmt = pinned_stmt;
+    walk_stmt(&p, s);
+    return p.opaque;
+}
+
+// True when flattening `s` into the enclosing statement list cannot clash:
+// no declarations at its top level (STMT_BLOCK emits no C braces).
+static bool flattenable(Stmt* s) {
+    if (s->type == STMT_IF) return true;
+    if (s->type != STMT_BLOCK) return false;
+    for (int i = 0; i < s->block.count; i++) {
+        Stmt* c = s->block.stmts[i];
+        if (!c) continue;
+        if (c->type == STMT_VAR || c->type == STMT_CONST || c->type == STMT_FN ||
+            c->type == STMT_STRUCT || c->type == STMT_ENUM) return false;
+    }
+    return true;
+}
+
+static void make_empty_block(Stmt* s) {
+    memset(s, 0, sizeof(*s));
+    s->type = STMT_BLOCK;
+}
+
+static void dbe_stmt(OptWalk* w, Stmt* s) {
+    OptLit c;
+    if (s->type == STMT_IF) {
+        substitute(w, s->if_stmt.condition);
+        if (fold_one(s->if_stmt.condition)) w->changes++;
+        if (!literal_value(s->if_stmt.condition, &c) || c.kind != TYPE_BOOL) return;
+        Stmt* then_b = s->if_stmt.then_branch;
+        Stmt* else_b = s->if_stmt.else_branch;
+        if (is_pinned(then_b) || is_pinned(else_b)) return;
+        if (c.b) {
+            if (flattenable(then_b)) { *s = *then_b; w->changes++; }
+            else if (else_b) { s->if_stmt.else_branch = NULL; w->changes++; }
+        } else if (!else_b) {
+            make_empty_block(s);
+            w->changes++;
+        } else if (flattenable(else_b)) {
+            *s = *else_b;
+            w->changes++;
+        } else {
+            OptLit t = { .kind = TYPE_BOOL, .b = true };
+            set_literal(s->if_stmt.condition, t);
+            s->if_stmt.then_branch = else_b;
+            s->if_stmt.else_branch = NULL;
+            w->changes++;
+        }
+    } else if (s->type == STMT_WHILE) {
+        substitute(w, s->while_stmt.condition);
+        if (fold_one(s->while_stmt.condition)) w->changes++;
+        if (literal_value(s->while_stmt.condition, &c) && c.kind == TYPE_BOOL && !c.b &&
+            !is_pinned(s->while_stmt.body)) {
+            make_empty_block(s);
+            w->changes++;
         }
     }
-    
-    return expr;
 }
 
-// Function inlining
-bool should_inline_function(Stmt* func_stmt) {
-    if (opt_level < OPT_O2 || !func_stmt || func_stmt->type != STMT_FN) return false;
-    
-    // Simple heuristic: inline functions with short names (likely small)
-    if (func_stmt->fn.name.length <= 15) {
-        return true;
+static void select_branch(OptWalk* w, Expr* e, Expr* cond, Expr* then_e, Expr* else_e) {
+    substitute(w, cond);
+    if (fold_one(cond)) w->changes++;
+    OptLit c;
+    if (!literal_value(cond, &c) || c.kind != TYPE_BOOL) return;
+    Expr* pick = c.b ? then_e : else_e;
+    if (!pick || pick->type == EXPR_BLOCK || expr_kind(pick) != expr_kind(e)) return;
+    replace_expr(e, pick);
+    w->changes++;
+}
+
+static void propagate_expr(OptWalk* w, Expr* e) {
+    switch (e->type) {
+        case EXPR_BINARY:
+            if (!is_value_op(e->binary.op.type)) return;
+            substitute(w, e->binary.left);
+            substitute(w, e->binary.right);
+            break;
+        case EXPR_UNARY:
+            substitute(w, e->unary.operand);
+            break;
+        case EXPR_TERNARY:
+            select_branch(w, e, e->ternary.condition, e->ternary.then_expr, e->ternary.else_expr);
+            return;
+        case EXPR_IF_EXPR:
+            select_branch(w, e, e->if_expr.condition, e->if_expr.then_expr, e->if_expr.else_expr);
+            return;
+        default:
+            return;
     }
-    
-    return false;
+    if (fold_one(e)) w->changes++;
+}
+
+static int propagate_round(Program* prog) {
+    collect_facts(prog);
+    OptWalk w = {0};
+    w.on_expr = propagate_expr;
+    w.on_stmt = dbe_stmt;
+    walk_program(&w, prog);
+    return w.changes;
+}
+
+void eliminate_dead_code(Program* prog) {
+    if (opt_level == OPT_NONE || !prog) return;
+    // Each round can expose more: a folded condition kills a branch, which
+    // removes the only assignment keeping a variable from being constant.
+    for (int round = 0; round < 4; round++)
+        if (propagate_round(prog) == 0) break;
+}
+
+// ---------------------------------------------------------------------------
+// Inlining of small pure functions (O2)
+// ---------------------------------------------------------------------------
+// Candidates are top-level `fn f(a: int, ...) -> int` whose body is a single
+// returned expression over literals, params, arithmetic, comparisons and
+// ternaries - no calls, so no recursion and no side effects. A call is
+// replaced by the body with the arguments substituted, which then folds.
+
+#define INLINE_MAX_NODES 12
+
+static Expr* copy_expr(const Expr* e) {
+    if (!e) return NULL;
+    Expr* c = new_expr();
+    *c = *e;
+    switch (e->type) {
+        case EXPR_BINARY:
+            c->binary.left = copy_expr(e->binary.left);
+            c->binary.right = copy_expr(e->binary.right);
+            break;
+        case EXPR_UNARY:
+            c->unary.operand = copy_expr(e->unary.operand);
+            break;
+        case EXPR_TERNARY:
+            c->ternary.condition = copy_expr(e->ternary.condition);
+            c->ternary.then_expr = copy_expr(e->ternary.then_expr);
+            c->ternary.else_expr = copy_expr(e->ternary.else_expr);
+            break;
+        case EXPR_IF_EXPR:
+            c->if_expr.condition = copy_expr(e->if_expr.condition);
+            c->if_expr.then_expr = copy_expr(e->if_expr.then_expr);
+            c->if_expr.else_expr = copy_expr(e->if_expr.else_expr);
+            break;
+        default:
+            break;
+    }
+    c->is_implicit_return = false;
+    c->_codegen_temp_id = -1;
+    return c;
+}
+
+static TypeKind primitive_type_name(const Expr* t) {
+    if (!t || t->type != EXPR_IDENT) return (TypeKind)-1;
+    if (t->token.length == 3 && memcmp(t->token.start, "int", 3) == 0) return TYPE_INT;
+    if (t->token.length == 5 && memcmp(t->token.start, "float", 5) == 0) return TYPE_FLOAT;
+    if (t->token.length == 4 && memcmp(t->token.start, "bool", 4) == 0) return TYPE_BOOL;
+    return (TypeKind)-1;
+}
+
+static int param_index(const FnStmt* fn, Token t) {
+    for (int i = 0; i < fn->param_count; i++)
+        if (fn->params[i].length == t.length && memcmp(fn->params[i].start, t.start, t.length) == 0)
+            return i;
+    return -1;
+}
+
+// Pure and cannot trap: safe to evaluate zero times, once, or (literals and
+// idents only) more than once.
+static bool is_pure_value(const Expr* e, const FnStmt* fn, int* nodes) {
+    if (!e) return false;
+    if (nodes && ++*nodes > INLINE_MAX_NODES) return false;
+    switch (e->type) {
+        case EXPR_INT: case EXPR_FLOAT: case EXPR_BOOL:
+            return true;
+        case EXPR_IDENT:
+            return !fn || param_index(fn, e->token) >= 0;
+        case EXPR_UNARY:
+            if (e->unary.op.type != TOKEN_MINUS && e->unary.op.type != TOKEN_NOT &&
+                e->unary.op.type != TOKEN_BANG && e->unary.op.type != TOKEN_TILDE) return false;
+            return is_pure_value(e->unary.operand, fn, nodes);
+        case EXPR_BINARY: {
+            WynTokenType op = e->binary.op.type;
+            if (!is_value_op(op)) return false;
+            if (op == TOKEN_SLASH || op == TOKEN_PERCENT || op == TOKEN_LSHIFT || op == TOKEN_RSHIFT) {
+                // Division traps on zero; shifts are UB out of range
+                OptLit d;
+                bool is_float = expr_kind(e) == TYPE_FLOAT;
+                if (!(op == TOKEN_SLASH && is_float) &&
+                    !(literal_value(e->binary.right, &d) && d.kind == TYPE_INT &&
+                      (op == TOKEN_SLASH || op == TOKEN_PERCENT ? d.i != 0 && d.i != -1
+                                                                : d.i >= 0 && d.i < 64)))
+                    return false;
+            }
+            return is_pure_value(e->binary.left, fn, nodes) && is_pure_value(e->binary.right, fn, nodes);
+        }
+        case EXPR_TERNARY:
+            return is_pure_value(e->ternary.condition, fn, nodes) &&
+                   is_pure_value(e->ternary.then_expr, fn, nodes) &&
+                   is_pure_value(e->ternary.else_expr, fn, nodes);
+        case EXPR_IF_EXPR:
+            return is_pure_value(e->if_expr.condition, fn, nodes) &&
+                   is_pure_value(e->if_expr.then_expr, fn, nodes) &&
+                   is_pure_value(e->if_expr.else_expr, fn, nodes);
+        default:
+            return false;
+    }
+}
+
+static Expr* inline_body(const FnStmt* fn) {
+    Stmt* body = fn->body;
+    if (!body || body->type != STMT_BLOCK || body->block.count != 1 || !body->block.stmts[0]) return NULL;
+    Stmt* only = body->block.stmts[0];
+    if (only->type == STMT_RETURN) return only->ret.value;
+    if (only->type == STMT_EXPR && only->expr && only->expr->is_implicit_return) return only->expr;
+    return NULL;
+}
+
+static bool is_inline_candidate(const FnStmt* fn) {
+    if (fn->type_param_count > 0 || fn->is_async || fn->is_extension) return false;
+    if (!name_is_stable(fn->name)) return false;
+    TypeKind ret = primitive_type_name(fn->return_type);
+    if ((int)ret == -1) return false;
+    for (int i = 0; i < fn->param_count; i++) {
+        if (fn->param_mutable && fn->param_mutable[i]) return false;
+        if (fn->param_defaults && fn->param_defaults[i]) return false;
+        if ((int)primitive_type_name(fn->param_types ? fn->param_types[i] : NULL) == -1) return false;
+    }
+    Expr* value = inline_body(fn);
+    int nodes = 0;
+    return value && expr_kind(value) == ret && is_pure_value(value, fn, &nodes);
+}
+
+typedef struct {
+    FnStmt** fns;
+    int count;
+} InlineSet;
+
+static const FnStmt* find_inline_candidate(const InlineSet* set, Token name) {
+    for (int i = 0; i < set->count; i++)
+        if (set->fns[i]->name.length == name.length &&
+            memcmp(set->fns[i]->name.start, name.start, name.length) == 0)
+            return set->fns[i];
+    return NULL;
+}
+
+static int count_param_uses(const Expr* e, const FnStmt* fn, int param) {
+    if (!e) return 0;
+    switch (e->type) {
+        case EXPR_IDENT: return param_index(fn, e->token) == param;
+        case EXPR_BINARY: return count_param_uses(e->binary.left, fn, param) + count_param_uses(e->binary.right, fn, param);
+        case EXPR_UNARY: return count_param_uses(e->unary.operand, fn, param);
+        case EXPR_TERNARY:
+            return count_param_uses(e->ternary.condition, fn, param) +
+                   count_param_uses(e->ternary.then_expr, fn, param) +
+                   count_param_uses(e->ternary.else_expr, fn, param);
+        case EXPR_IF_EXPR:
+            return count_param_uses(e->if_expr.condition, fn, param) +
+                   count_param_uses(e->if_expr.then_expr, fn, param) +
+                   count_param_uses(e->if_expr.else_expr, fn, param);
+        default: return 0;
+    }
+}
+
+static void bind_params(Expr* e, const FnStmt* fn, Expr** args) {
+    if (!e) return;
+    switch (e->type) {
+        case EXPR_IDENT: {
+            int p = param_index(fn, e->token);
+            if (p >= 0) replace_expr(e, copy_expr(args[p]));
+            break;
+        }
+        case EXPR_BINARY: bind_params(e->binary.left, fn, args); bind_params(e->binary.right, fn, args); break;
+        case EXPR_UNARY: bind_params(e->unary.operand, fn, args); break;
+        case EXPR_TERNARY:
+            bind_params(e->ternary.condition, fn, args);
+            bind_params(e->ternary.then_expr, fn, args);
+            bind_params(e->ternary.else_expr, fn, args);
+            break;
+        case EXPR_IF_EXPR:
+            bind_params(e->if_expr.condition, fn, args);
+            bind_params(e->if_expr.then_expr, fn, args);
+            bind_params(e->if_expr.else_expr, fn, args);
+            break;
+        default: break;
+    }
+}
+
+static void inline_call(OptWalk* w, Expr* e) {
+    if (e->type != EXPR_CALL || w->spawn_depth > 0) return;
+    if (!e->call.callee || e->call.callee->type != EXPR_IDENT) return;
+    const FnStmt* fn = find_inline_candidate((const InlineSet*)w->ctx, e->call.callee->token);
+    if (!fn || e->call.arg_count != fn->param_count) return;
+    if (expr_kind(e) != primitive_type_name(fn->return_type)) return;
+    for (int i = 0; i < e->call.arg_count; i++) {
+        Expr* arg = e->call.args[i];
+        if (e->call.arg_names && e->call.arg_names[i].length > 0) return;
+        if (expr_kind(arg) != primitive_type_name(fn->param_types[i])) return;
+        if (!is_pure_value(arg, NULL, NULL)) return;
+        // Duplicating anything but a literal or a variable repeats work
+        OptLit lit;
+        if (count_param_uses(inline_body(fn), fn, i) > 1 &&
+            arg->type != EXPR_IDENT && !literal_value(arg, &lit)) return;
+    }
+    Expr* body = copy_expr(inline_body(fn));
+    bind_params(body, fn, e->call.args);
+    replace_expr(e, body);
+    fold_constants(e);
+    w->changes++;
 }
 
 void inline_small_functions(Program* prog) {
     if (opt_level < OPT_O2 || !prog) return;
-    
-    // Mark functions for inlining
+    collect_facts(prog);
+    if (opt_opaque) return;
+    InlineSet set = {0};
     for (int i = 0; i < prog->count; i++) {
-        if (prog->stmts[i]->type == STMT_FN && should_inline_function(prog->stmts[i])) {
-            printf("// Function marked for inlining\n");
-        }
+        Stmt* s = prog->stmts[i];
+        if (s && s->type == STMT_EXPORT) s = s->export.stmt;
+        if (!s || s->type != STMT_FN || !is_inline_candidate(&s->fn)) continue;
+        set.fns = realloc(set.fns, sizeof(FnStmt*) * (set.count + 1));
+        set.fns[set.count++] = &s->fn;
+    }
+    if (set.count == 0) return;
+    OptWalk w = {0};
+    w.on_expr = inline_call;
+    w.ctx = &set;
+    walk_program(&w, prog);
+    free(set.fns);
+}
+
+// ---------------------------------------------------------------------------
+// Loop-invariant code motion (O2)
+// ---------------------------------------------------------------------------
+// A `var v = <pure expr>` at the top level of a while/for body is moved in
+// front of the loop when everything it reads is stable program-wide and not
+// (re)bound inside the loop. Only int/float/bool values move - they need no
+// release at scope exit - and only inside fn bodies, where the parent list
+// is a block (top-level script statements become C globals).
+
+static void loop_bind(OptWalk* w, Token name, Stmt* decl) {
+    (void)decl;
+    nameset_add((NameSet*)w->ctx, name);
+}
+
+typedef struct {
+    const NameSet* bound_in_loop;
+    const NameSet* hoisted;
+} InvariantCtx;
+
+static bool is_invariant(const Expr* e, const InvariantCtx* ctx) {
+    if (!e) return true;
+    switch (e->type) {
+        case EXPR_INT: case EXPR_FLOAT: case EXPR_BOOL: return true;
+        case EXPR_IDENT:
+            if (nameset_has(ctx->hoisted, e->token)) return true;
+            return name_is_stable(e->token) && !nameset_has(ctx->bound_in_loop, e->token);
+        case EXPR_UNARY: return is_invariant(e->unary.operand, ctx);
+        case EXPR_BINARY: return is_invariant(e->binary.left, ctx) && is_invariant(e->binary.right, ctx);
+        case EXPR_TERNARY:
+            return is_invariant(e->ternary.condition, ctx) && is_invariant(e->ternary.then_expr, ctx) &&
+                   is_invariant(e->ternary.else_expr, ctx);
+        case EXPR_IF_EXPR:
+            return is_invariant(e->if_expr.condition, ctx) && is_invariant(e->if_expr.then_expr, ctx) &&
+                   is_invariant(e->if_expr.else_expr, ctx);
+        default: return false;
     }
-}
\ No newline at end of file
+}
+
+static bool is_primitive_kind(TypeKind k) {
+    return k == TYPE_INT || k == TYPE_FLOAT || k == TYPE_BOOL;
+}
+
+// Hoists invariants out of `loop` into (*list)[*index...]; returns how many
+// statements were inserted in front of the loop.
+static int hoist_from_loop(Stmt*** list, int* count, int index) {
+    Stmt* loop = (*list)[index];
+    Stmt* body = loop->type == STMT_WHILE ? loop->while_stmt.body : loop->for_stmt.body;
+    if (!body || body->type != STMT_BLOCK || body->block.count == 0) return 0;
+
+    NameSet bound = {0}, hoisted = {0};
+    OptWalk w = {0};
+    w.on_bind = loop_bind;
+    w.ctx = &bound;
+    w.unit = loop;
+    walk_stmt(&w, loop);
+    if (w.opaque) { free(bound.names); return 0; }
+    InvariantCtx ctx = { &bound, &hoisted };
+
+    Stmt** moved = NULL;
+    int moved_count = 0;
+    for (int k = 0; k < body->block.count; k++) {
+        Stmt* s = body->block.stmts[k];
+        if (!s || (s->type != STMT_VAR && s->type != STMT_CONST)) continue;
+        VarStmt* v = &s->var;
+        if (v->uses_pattern || v->from_bare_assign || !v->init) continue;
+        if (!name_is_stable(v->name) || !is_primitive_kind(expr_kind(v->init))) continue;
+        if (!is_pure_value(v->init, NULL, NULL) || !is_invariant(v->init, &ctx)) continue;
+        nameset_add(&hoisted, v->name);
+        moved = realloc(moved, sizeof(Stmt*) * (moved_count + 1));
+        moved[moved_count++] = s;
+        memmove(&body->block.stmts[k], &body->block.stmts[k + 1], sizeof(Stmt*) * (body->block.count - k - 1));
+        body->block.count--;
+        k--;
+    }
+    free(bound.names);
+    free(hoisted.names);
+    if (moved_count == 0) return 0;
+
+    *list = realloc(*list, sizeof(Stmt*) * (*count + moved_count));
+    memmove(&(*list)[index + moved_count], &(*list)[index], sizeof(Stmt*) * (*count - index));
+    memcpy(&(*list)[index], moved, sizeof(Stmt*) * moved_count);
+    *count += moved_count;
+    free(moved);
+    return moved_count;
+}
+
+static void licm_stmt(Stmt* s);
+
+static void licm_list(Stmt*** list, int* count) {
+    for (int i = 0; i < *count; i++) {
+        Stmt* s = (*list)[i];
+        if (!s) continue;
+        licm_stmt(s);   // inner loops first: their invariants may move further out
+        if (s->type == STMT_WHILE || s->type == STMT_FOR)
+            i += hoist_from_loop(list, count, i);
+    }
+}
+
+static void licm_stmt(Stmt* s) {
+    if (!s) return;
+    switch (s->type) {
+        case STMT_BLOCK: licm_list(&s->block.stmts, &s->block.count); break;
+        case STMT_IF: licm_stmt(s->if_stmt.then_branch); licm_stmt(s->if_stmt.else_branch); break;
+        case STMT_WHILE: licm_stmt(s->while_stmt.body); break;
+        case STMT_FOR: licm_stmt(s->for_stmt.body); break;
+        case STMT_MATCH:
+            for (int i = 0; i < s->match_stmt.case_count; i++) licm_stmt(s->match_stmt.cases[i].body);
+            break;
+        default: break;
+    }
+}
+
+void hoist_loop_invariants(Program* prog) {
+    if (opt_level < OPT_O2 || !prog) return;
+    collect_facts(prog);
+    if (opt_opaque) return;
+    for (int i = 0; i < prog->count; i++) {
+        Stmt* s = prog->stmts[i];
+        if (s && s->type == STMT_EXPORT) s = s->export.stmt;
+        if (!s) continue;
+        if (s->type == STMT_FN) licm_stmt(s->fn.body);
+        else if (s->type == STMT_STRUCT)
+            for (int m = 0; m < s->struct_decl.method_count; m++) licm_stmt(s->struct_decl.methods[m]->body);
+        else if (s->type == STMT_IMPL)
+            for (int m = 0; m < s->impl.method_count; m++) licm_stmt(s->impl.methods[m]->body);
+    }
+}
+
+// ---------------------------------------------------------------------------
+
+void optimize_program(Program* prog) {
+    if (opt_level == OPT_NONE || !prog) return;
+    eliminate_dead_code(prog);
+    if (opt_level >= OPT_O2) {
+        inline_small_functions(prog);
+        eliminate_dead_code(prog);   // inlined bodies expose new constants
+        hoist_loop_invariants(prog);
+    }
+}
@@ -5,6 +5,9 @@
 #include "ast.h"
 
 // Optimization levels
+//   OPT_NONE  -O0 / --fast: the AST reaches codegen exactly as the checker left it
+//   OPT_O1    default: constant folding + propagation, dead-branch elimination
+//   OPT_O2    -O2 / --release: O1 + inlining of small pure functions + LICM
 typedef enum {
     OPT_NONE = 0,
     OPT_O1 = 1,
@@ -14,18 +17,22 @@ typedef enum {
 // Global optimization settings
 extern OptLevel opt_level;
 
-// Dead code elimination
-bool is_dead_code(Stmt* stmt);
-void eliminate_dead_code(Program* prog);
+// Optimization initialization
+void init_optimizer(OptLevel level);
 
-// Constant folding
-Expr* fold_constants(Expr* expr);
+// Level requested on a `wyn build/run/cross/compile` command line (-O0/-O1/-O2,
+// --fast, --release). Scanning stops at `--` so program arguments are ignored.
+OptLevel opt_level_from_args(int argc, char** argv);
 
-// Function inlining
-bool should_inline_function(Stmt* func_stmt);
-void inline_small_functions(Program* prog);
+// Runs every pass enabled by opt_level over a type-checked program. Must be
+// called after check_program() succeeded and before codegen: the passes read
+// the checker's expr_type annotations and rewrite the AST in place.
+void optimize_program(Program* prog);
 
-// Optimization initialization
-void init_optimizer(OptLevel level);
+// Individual passes (optimize_program runs them in the right order)
+Expr* fold_constants(Expr* expr);        // fold literal subtrees of one expression
+void eliminate_dead_code(Program* prog); // propagate + fold + drop dead branches
+void inline_small_functions(Program* prog);
+void hoist_loop_invariants(Program* prog);
 
-#endif
\ No newline at end of file
+#endif
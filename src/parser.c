@@ -3355,6 +3355,54 @@ static Stmt* statement_impl() {
             }
             return blk;
         }
+        // `Db.transaction(db) { ... }` - the block runs inside one transaction
+        // (a nested one becomes a savepoint). Lowered right here to
+        //     { var __wyn_txN = Db.begin(db)  ...body...  Db.end(__wyn_txN) }
+        // block.tx_end points at that closing call so codegen also emits it
+        // on a `return` out of the block, the way `defer` calls are.
+        if (first_target->type == EXPR_METHOD_CALL && check(TOKEN_LBRACE) &&
+            first_target->method_call.object->type == EXPR_IDENT &&
+            first_target->method_call.object->token.length == 2 &&
+            memcmp(first_target->method_call.object->token.start, "Db", 2) == 0 &&
+            first_target->method_call.method.length == 11 &&
+            memcmp(first_target->method_call.method.start, "transaction", 11) == 0) {
+            static int tx_counter = 0;
+            int line = first.line;
+            if (first_target->method_call.arg_count != 1) {
+                fprintf(stderr, "Error at line %d: Db.transaction takes one argument, the database handle\n", line);
+                parser.had_error = true;
+            }
+            advance(); // consume '{'
+            char* nm = malloc(24); snprintf(nm, 24, "__wyn_tx%d", tx_counter++);
+            Token tx_name = (Token){TOKEN_IDENT, nm, (int)strlen(nm), line};
+            Stmt* blk = alloc_stmt();
+            blk->type = STMT_BLOCK;
+            int cap = 256;
+            blk->block.stmts = malloc(sizeof(Stmt*) * cap);
+            blk->block.count = 0;
+            first_target->method_call.method = (Token){TOKEN_IDENT, "begin", 5, line};
+            Stmt* tv = alloc_stmt(); tv->type = STMT_VAR;
+            tv->var.is_const = false; tv->var.is_mutable = false;
+            tv->var.name = tx_name;
+            tv->var.init = first_target; tv->var.type = NULL;
+            blk->block.stmts[blk->block.count++] = tv;
+            while (!check(TOKEN_RBRACE) && !check(TOKEN_EOF)) {
+                if (blk->block.count + 1 >= cap) { cap *= 2; blk->block.stmts = realloc(blk->block.stmts, sizeof(Stmt*) * cap); }
+                const char* __sp = parser.current.start; blk->block.stmts[blk->block.count++] = statement(); if (stmt_made_no_progress(__sp)) break;
+            }
+            expect(TOKEN_RBRACE, "Expected '}' after Db.transaction block");
+            Expr* tx_ref = alloc_expr(); tx_ref->type = EXPR_IDENT; tx_ref->token = tx_name;
+            Expr* end_call = alloc_expr(); end_call->type = EXPR_METHOD_CALL;
+            end_call->method_call.object = first_target->method_call.object;
+            end_call->method_call.method = (Token){TOKEN_IDENT, "end", 3, parser.previous.line};
+            end_call->method_call.arg_count = 1;
+            end_call->method_call.args = malloc(sizeof(Expr*));
+            end_call->method_call.args[0] = tx_ref;
+            Stmt* es = alloc_stmt(); es->type = STMT_EXPR; es->expr = end_call;
+            blk->block.stmts[blk->block.count++] = es;
+            blk->block.tx_end = end_call;
+            return blk;
+        }
         // Annotated bare assignment: `x: int = 5`, `xs: [int] = []`. Parses
         // identically to the `var`-prefixed form (`var x: int = 5`). We detect
         // a bare identifier immediately followed by `:` at statement start.
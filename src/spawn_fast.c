@@ -10,6 +10,7 @@
 #include "future.h"
 #include "coroutine.h"
 #include "io_loop.h"
+#include "wyn_rc.h"
 
 #ifdef _WIN32
 // Windows: stub implementation - spawn runs synchronously
@@ -49,6 +50,7 @@ _Atomic int ws_blocked = 0;
 int pool_try_run_one(void) { return 0; }
 int wyn_sched_pump_one(void) { return 0; }  // no scheduler on Windows (spawns run inline)
 long wyn_sched_inflight(void) { return 0; } // spawns run inline - nothing in flight
+void* wyn_blocking_run(TaskFuncWithReturn func, void* arg) { return func(arg); }  // no pool: nothing to free up
 #else
 #include <pthread.h>
 #ifdef _WIN32
@@ -407,6 +409,10 @@ static void* processor_loop(void* arg) {
         task = try_steal(p->id);
         if (task) { p->idle_rounds = 0; p->steal_hits = (p->steal_hits < 8) ? p->steal_hits + 1 : 8; execute_task(task); continue; }
 
+        // Out of work: merge strings other threads released on this worker's
+        // behalf (biased RC, wyn_rc.c) - a busy worker does it on allocation.
+        wyn_rc_drain();
+
         // Poll I/O loop - re-enqueues tasks whose fds are ready
         wyn_io_poll();
         
@@ -970,4 +976,143 @@ Future* wyn_spawn_inline(TaskFuncWithReturn func, void* arg) {
     return wyn_spawn_async(func, arg);
 }
 
+// ---------------------------------------------------------------------------
+// Blocking-task pool (wyn_blocking_run, Task.blocking)
+// ---------------------------------------------------------------------------
+// WHY: the processors above are few (one per core) and a coroutine runs on one
+// until it yields. File reads, popen, sqlite3_step and stderr writes never
+// yield - they block in the kernel or in a C library - so one slow disk read or
+// SQL query took a whole Processor out of the pool, and on a 1-2 core box that
+// was every coroutine in the program stalled behind it.
+//
+// wyn_blocking_run hands such a call to a SEPARATE, bounded set of plain
+// threads and parks the calling coroutine (wyn_io_park + yield, same as an fd
+// wait) until a pool thread has run it and re-enqueued the task with
+// wyn_sched_enqueue. The processor moves on to other coroutines meanwhile.
+//   - The job lives on the parked coroutine's stack: no allocation per call.
+//   - Threads start lazily, one per queued job with no idle thread, up to
+//     WYN_BLOCKING_THREADS (default 64); past that jobs queue FIFO. A thread
+//     idle for 10s exits, so a burst does not pin 64 threads forever.
+//     WYN_BLOCKING_THREADS=0 turns the pool off (every call inline, the old
+//     behaviour).
+//   - Outside a coroutine (main, legacy pool threads, TCC builds) there is
+//     nothing to free up, so the call just runs inline.
+// A completion that lands before the coroutine has finished yielding is safe:
+// execute_task's `running` CAS re-enqueues it until the yield is done, the same
+// window future_set already relies on.
+
+typedef struct BlockingJob {
+    TaskFuncWithReturn func;
+    void* arg;
+    void* result;
+    void* task;
+    _Atomic int done;
+    struct BlockingJob* next;
+} BlockingJob;
+
+static pthread_mutex_t blocking_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t blocking_cond = PTHREAD_COND_INITIALIZER;
+static BlockingJob* blocking_head = NULL;
+static BlockingJob* blocking_tail = NULL;
+static int blocking_threads = 0;    // alive
+static int blocking_idle = 0;       // alive and waiting for a job
+static int blocking_max = -1;       // -1 = env not read yet, 0 = pool off
+
+static void* blocking_worker(void* unused) {
+    (void)unused;
+    pthread_mutex_lock(&blocking_lock);
+    for (;;) {
+        while (!blocking_head) {
+            struct timespec deadline;
+            clock_gettime(CLOCK_REALTIME, &deadline);
+            deadline.tv_sec += 10;
+            blocking_idle++;
+            int rc = pthread_cond_timedwait(&blocking_cond, &blocking_lock, &deadline);
+            blocking_idle--;
+            if (rc != 0 && !blocking_head) {
+                blocking_threads--;
+                pthread_mutex_unlock(&blocking_lock);
+                return NULL;
+            }
+        }
+        BlockingJob* job = blocking_head;
+        blocking_head = job->next;
+        if (!blocking_head) blocking_tail = NULL;
+        pthread_mutex_unlock(&blocking_lock);
+
+        job->result = job->func(job->arg);
+        void* task = job->task;
+        // After `done` the owner may return and its stack frame - the job - is
+        // gone: read everything first, touch nothing after.
+        atomic_store_explicit(&job->done, 1, memory_order_release);
+        wyn_sched_enqueue(task);
+
+        pthread_mutex_lock(&blocking_lock);
+    }
+}
+
+void* wyn_blocking_run(TaskFuncWithReturn func, void* arg) {
+#ifdef __TINYC__
+    return func(arg);
+#else
+    void* task = wyn_coro_current() ? wyn_current_task() : NULL;
+    if (!task) return func(arg);
+
+    BlockingJob job = { func, arg, NULL, task, 0, NULL };
+    pthread_mutex_lock(&blocking_lock);
+    if (blocking_max < 0) {
+        const char* e = getenv("WYN_BLOCKING_THREADS");
+        blocking_max = e && *e ? atoi(e) : 64;
+        if (blocking_max < 0) blocking_max = 0;
+    }
+    if (blocking_max == 0) {
+        pthread_mutex_unlock(&blocking_lock);
+        return func(arg);
+    }
+    if (blocking_tail) blocking_tail->next = &job;
+    else blocking_head = &job;
+    blocking_tail = &job;
+    int spawn_thread = blocking_idle == 0 && blocking_threads < blocking_max;
+    if (spawn_thread) blocking_threads++;
+    else pthread_cond_signal(&blocking_cond);
+    pthread_mutex_unlock(&blocking_lock);
+
+    if (spawn_thread) {
+        pthread_t t;
+        pthread_attr_t attr;
+        pthread_attr_init(&attr);
+        pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_DETACHED);
+        int rc = pthread_create(&t, &attr, blocking_worker, NULL);
+        pthread_attr_destroy(&attr);
+        if (rc != 0) {
+            // No thread to be had: take the job back and run it here, unless
+            // an existing pool thread already picked it up.
+            pthread_mutex_lock(&blocking_lock);
+            blocking_threads--;
+            BlockingJob** link = &blocking_head;
+            while (*link && *link != &job) link = &(*link)->next;
+            int reclaimed = *link == &job;
+            if (reclaimed) {
+                *link = job.next;
+                if (blocking_tail == &job) {
+                    blocking_tail = NULL;
+                    for (BlockingJob* j = blocking_head; j; j = j->next) blocking_tail = j;
+                }
+            }
+            pthread_mutex_unlock(&blocking_lock);
+            if (reclaimed) return func(arg);
+        }
+    }
+    // Park until the pool thread's wyn_sched_enqueue resumes us. Always park
+    // at least once, even if the job already finished: that enqueue is coming
+    // regardless, and left unconsumed it would resume some later, unrelated
+    // park. Only it resumes a parked task, so the loop is a guard, not a spin.
+    do {
+        wyn_io_park();
+        wyn_coro_yield();
+    } while (!atomic_load_explicit(&job.done, memory_order_acquire));
+    return job.result;
+#endif
+}
+
 #endif // !_WIN32
@@ -227,6 +227,7 @@ static const MethodSignature method_signatures[] = {
     {"set", "is_subset", "bool", 1},
     {"set", "is_superset", "bool", 1},
     {"set", "is_disjoint", "bool", 1},
+    {"set", "reserve", "void", 1},              // reserve(n): size for n elements up front
     {"set", "symmetric_difference", "set", 1},  // Elements in either but not both
     {"set", "to_array", "array", 0},            // Convert to array
     {"set", "from_array", "set", 1},            // Create from array
@@ -933,6 +934,9 @@ bool dispatch_method(const char* receiver_type, const char* method_name, int arg
         if (strcmp(method_name, "contains") == 0 && arg_count == 1) {
             out->c_function = "hashset_contains"; return true;
         }
+        if (strcmp(method_name, "reserve") == 0 && arg_count == 1) {
+            out->c_function = "hashset_reserve"; return true;
+        }
         if (strcmp(method_name, "contains_int") == 0 && arg_count == 1) {
             out->c_function = "wyn_hashset_contains_int"; return true;
         }
@@ -1066,12 +1070,19 @@ const char* lookup_module_fn_return_type(const char* fn_name) {
         {"Os_hostname", "string"}, {"Os_home_dir", "string"}, {"Os_temp_dir", "string"},
         {"Uuid_generate", "string"}, {"Uuid_v4", "string"}, {"Process_exec_capture", "string"},
         {"Csv_get", "string"}, {"Csv_get_field", "string"}, {"Csv_header", "string"},
+        {"Csv_next", "bool"}, {"Csv_get_text", "string"}, {"Csv_get_float", "float"},
+        {"Deque_is_empty", "bool"},
+        {"PriorityQueue_float_pop", "float"}, {"PriorityQueue_float_peek", "float"},
+        {"PriorityQueue_string_pop", "string"}, {"PriorityQueue_string_peek", "string"},
+        {"PriorityQueue_int_is_empty", "bool"}, {"PriorityQueue_float_is_empty", "bool"},
+        {"PriorityQueue_string_is_empty", "bool"},
         {"Toml_get", "string"}, {"Toml_parse", "int"}, {"Toml_parse_file", "int"},
         {"Bcrypt_hash", "string"}, {"Bcrypt_verify", "bool"},
         {"Path_basename", "string"}, {"Path_dirname", "string"}, {"Path_extension", "string"}, {"Path_join", "string"},
         {"DateTime_to_iso", "string"}, {"DateTime_format_duration", "string"},
         {"Regex_replace", "string"}, {"Regex_find_all", "string"},
-        {"Regex_match", "bool"},
+        {"Regex_match", "bool"}, {"Regex_is_match", "bool"},
+        {"Regex_replace_in", "string"}, {"Regex_find_all_in", "string"}, {"Regex_split_in", "string"},
         {"File_read", "string"}, {"File_temp_file", "string"}, {"File_read_line", "string"},
         {"System_exec", "string"}, {"System_env", "string"},
         {"System_shell_escape", "string"},
@@ -1086,6 +1097,9 @@ const char* lookup_module_fn_return_type(const char* fn_name) {
         {"Random_string", "string"}, {"Random_hex", "string"}, {"Random_uuid", "string"},
         {"Random_bool", "bool"}, {"Random_choice_str", "string"},
         {"Web_render", "string"},
+        {"Db_next", "bool"}, {"Db_get_float", "float"}, {"Db_get_text", "string"},
+        {"Db_is_null", "bool"}, {"Db_column_name", "string"},
+        {"Db_end", "bool"}, {"Db_set_import_mode", "bool"},
         {NULL, NULL}
     };
     for (int i = 0; fns[i].name; i++) {
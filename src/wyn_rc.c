@@ -1,8 +1,21 @@
+#if !defined(_WIN32) && !defined(_DEFAULT_SOURCE)
+#define _DEFAULT_SOURCE  // MAP_ANONYMOUS / MAP_NORESERVE under -std=c11
+#endif
 #include "wyn_rc.h"
 #include <stdlib.h>
 #include <string.h>
 #include <stdio.h>
 
+// Small blocks come from a per-thread size-class slab allocator; anything
+// bigger, and every block on targets without mmap/TLS, still goes to malloc.
+// AddressSanitizer builds keep malloc too, so a use-after-free of an RC block
+// is still reported rather than landing in a recycled slab slot.
+#if !defined(_WIN32) && !defined(__TINYC__) && !defined(__SANITIZE_ADDRESS__)
+#define WYN_RC_SLAB 1
+#include <pthread.h>
+#include <sys/mman.h>
+#endif
+
 // RC header with dual magic sentinel for heap detection.
 // Layout: [magic(4)][refcount(4)][capacity(4)][length(4)][magic2(4)][user data...]
 // Two independent sentinels (magic and its complement) bracket the numeric
@@ -18,7 +31,10 @@ typedef struct {
     _Atomic int32_t refcount;
     uint32_t capacity;  // Allocated bytes (for realloc-in-place)
     uint32_t length;    // Cached string length (avoids O(n) strlen)
-    uint32_t magic2;    // Complement sentinel; must equal ~magic
+    union {
+        uint32_t magic2;        // malloc'd blocks: complement sentinel, ~magic
+        _Atomic uint32_t bias;  // slab blocks: owner id + local count (below)
+    };
 } WynRcHeaderFull;
 
 // Track the heap range to avoid reading before string literals
@@ -29,8 +45,466 @@ static inline WynRcHeaderFull* rc_full_header(const void* ptr) {
     return (WynRcHeaderFull*)((char*)ptr - sizeof(WynRcHeaderFull));
 }
 
+#ifdef WYN_RC_SLAB
+// --- Size-class slab allocator ---------------------------------------------
+// WHY THIS EXISTS: every string is an RC block, and wyn_rc_alloc used to be a
+// malloc plus two CAS loops widening the global [heap_low, heap_high] window
+// that wyn_rc_is_heap checks - so each retain/release range-checked that
+// window and then read both magic words before touching the count. Blocks
+// whose header + payload fit in 4KB now come from 64KB slab pages carved out
+// of one reserved address range:
+//   - Membership is `ptr - slab_base < slab_span` plus a read of the page
+//     header at `ptr & ~(SLAB_PAGE - 1)`: the block size there says whether
+//     ptr sits exactly on a block's payload. Only malloc'd (large) blocks
+//     still use the range window and the double magic.
+//   - Each thread owns its pages (one list per power-of-two class). Alloc
+//     and free by the owner are plain pointer pops/pushes, no atomics.
+//   - A block freed by another thread (a string handed to a spawned task or
+//     sent over a channel) is pushed onto its page's lock-free remote list;
+//     the owner drains that list when the class runs dry.
+//   - A page whose blocks are all free goes back to a global pool and can be
+//     reused for any class; pages of an exited thread are abandoned to a
+//     global list and adopted by the next thread that needs that class.
+// The RC header layout is unchanged, so every hand-mirrored RcHdr keeps
+// working. The region is reserved PROT_NONE and committed 4MB at a time, so
+// the reservation costs no memory. WYN_RC_SLAB=0 in the environment turns the
+// slab off (all blocks from malloc) for comparison.
+#define SLAB_PAGE_SHIFT 16
+#define SLAB_PAGE ((uintptr_t)1 << SLAB_PAGE_SHIFT)
+#define SLAB_RESERVE ((uintptr_t)1 << 34)   // 16GB of address space
+#define SLAB_COMMIT ((uintptr_t)4 << 20)    // committed in 4MB steps
+#define SLAB_MIN_SHIFT 5                    // 32-byte blocks
+#define SLAB_CLASSES 8                      // 32 .. 4096
+#define SLAB_MAX_BLOCK ((size_t)1 << (SLAB_MIN_SHIFT + SLAB_CLASSES - 1))
+#define SLAB_MAGIC 0x534C4142u             // "SLAB"
+
+typedef struct SlabHeap SlabHeap;
+typedef struct SlabPage {
+    uint32_t magic;            // SLAB_MAGIC once the page has been handed out
+    uint32_t bsize;            // block size, a power of two
+    uint32_t first;            // offset of the first block
+    int32_t used;              // live blocks, maintained by the owner
+    _Atomic(SlabHeap*) owner;  // NULL while pooled or abandoned
+    void* free;                // owner-only free list
+    char* bump;                // next never-used block
+    _Atomic(void*) remote;     // blocks freed by other threads
+    struct SlabPage* prev;     // owner's avail/full list, or a global list
+    struct SlabPage* next;
+    int cls;
+    int in_full;               // on the owner's full list
+} SlabPage;
+
+// Heaps are never freed - an exited thread's heap is recycled for the next
+// thread - so a remote free can always poke its owner's remote_hint.
+struct SlabHeap {
+    SlabPage* cur[SLAB_CLASSES];    // page allocations are served from
+    SlabPage* avail[SLAB_CLASSES];  // pages that may have room
+    SlabPage* full[SLAB_CLASSES];   // pages that had none at the last look
+    _Atomic unsigned remote_hint;   // bit c: a remote free hit a class-c page
+    // The fields below survive recycling: a block's bias word names its
+    // owner by id, and releases queued for that owner may still arrive.
+    uint32_t id;                         // bias owner id, 0 if out of ids
+    _Atomic(struct RcQueued*) brc_queue; // blocks awaiting a merge (below)
+    SlabHeap* next_free;
+};
+
+// --- Biased reference counting ---------------------------------------------
+// WHY THIS EXISTS: retain/release were an atomic RMW (a lock-prefixed add on
+// x86) on every call, yet almost every string lives and dies on the thread
+// that allocated it. A slab block now carries two counts:
+//   - bias (the magic2 word, unused by slab membership): the owner's heap id
+//     in the top 12 bits and a LOCAL count in the low 20. Only the owner
+//     changes it, with plain loads and stores - no lock prefix.
+//   - refcount: a SHARED count (in units of RC_SHARED_ONE) that every other
+//     thread updates atomically, plus the MERGED and QUEUED flags.
+// The block is alive while local + shared > 0. When the owner's local count
+// reaches 0 it merges: sets MERGED and clears the owner id, after which every
+// thread, the old owner included, uses the shared count alone and the block
+// is freed when it reaches 0. A reference can still cross threads without
+// an RC operation (a spawn result, a coroutine resumed on another worker),
+// so a non-owner release can drive the shared count below 0 while the local
+// count holds the matching +1: that block is queued to its owner (QUEUED
+// stops everyone else freeing it), and the owner merges it on its next
+// allocation, between tasks (wyn_rc_drain), or at thread exit - where every
+// block it still owns is merged so nothing waits on a dead thread. Codegen
+// promotes strings that it knows cross a spawn or channel (wyn_rc_share), so
+// the common handoffs never need the queue. malloc'd blocks (> 4KB) keep the
+// single atomic count, as does every block when WYN_RC_BIAS=0 (the baseline
+// for benchmarks/biasedrc.sh).
+#define RC_BIAS_SHIFT 20
+#define RC_BIAS_LOCAL ((1u << RC_BIAS_SHIFT) - 1)   // local count mask
+#define RC_BIAS_MAX_ID ((1u << (32 - RC_BIAS_SHIFT)) - 1)
+#define RC_SHARED_MERGED 1
+#define RC_SHARED_QUEUED 2
+#define RC_SHARED_SHIFT 2
+#define RC_SHARED_ONE (1 << RC_SHARED_SHIFT)
+
+typedef struct RcQueued {
+    WynRcHeaderFull* hdr;
+    struct RcQueued* next;
+} RcQueued;
+
+// A free block links through the capacity/length words; magic is zeroed so a
+// stale pointer never passes wyn_rc_is_heap.
+#define SLAB_NEXT(b) (*(void**)((char*)(b) + 8))
+
+static uintptr_t slab_base = 0, slab_span = 0;
+static uintptr_t slab_top = 0, slab_committed = 0;  // guarded by slab_lock
+static SlabPage* slab_pool = NULL;                  // empty pages, any class
+static SlabPage* slab_abandoned = NULL;             // pages of exited threads
+static SlabHeap* slab_free_heaps = NULL;
+static SlabHeap* slab_heap_by_id[RC_BIAS_MAX_ID + 1];  // guarded by slab_lock
+static uint32_t slab_heap_ids = 0;
+static int rc_bias_on = 1;  // WYN_RC_BIAS=0: every block uses the shared count
+static pthread_mutex_t slab_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_once_t slab_once = PTHREAD_ONCE_INIT;
+static pthread_key_t slab_key;
+static __thread SlabHeap* slab_heap = NULL;
+
+static void slab_thread_exit(void* arg);
+static int rc_merge(WynRcHeaderFull* hdr, uint32_t local, int queued);
+static void rc_drain(SlabHeap* h);
+
+static void slab_init(void) {
+    const char* env = getenv("WYN_RC_SLAB");
+    if (env && env[0] == '0') return;
+    const char* bias = getenv("WYN_RC_BIAS");
+    rc_bias_on = !(bias && bias[0] == '0');
+    void* p = mmap(NULL, SLAB_RESERVE + SLAB_PAGE, PROT_NONE,
+                   MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+    if (p == MAP_FAILED) return;  // no address space: everything uses malloc
+    if (pthread_key_create(&slab_key, slab_thread_exit) != 0) return;
+    slab_base = ((uintptr_t)p + SLAB_PAGE - 1) & ~(SLAB_PAGE - 1);
+    slab_top = slab_committed = slab_base;
+    slab_span = SLAB_RESERVE;
+}
+
+static inline int slab_class(size_t total) {
+    int c = 0;
+    size_t b = (size_t)1 << SLAB_MIN_SHIFT;
+    while (b < total) { b <<= 1; c++; }
+    return c;
+}
+
+static inline int slab_owns(const void* p) {
+    return (uintptr_t)p - slab_base < slab_span;
+}
+
+static inline SlabPage* slab_page_of(const void* p) {
+    return (SlabPage*)((uintptr_t)p & ~(SLAB_PAGE - 1));
+}
+
+static void slab_push(SlabPage** list, SlabPage* pg) {
+    pg->prev = NULL;
+    pg->next = *list;
+    if (*list) (*list)->prev = pg;
+    *list = pg;
+}
+
+static void slab_remove(SlabPage** list, SlabPage* pg) {
+    if (pg->prev) pg->prev->next = pg->next; else *list = pg->next;
+    if (pg->next) pg->next->prev = pg->prev;
+}
+
+// Under slab_lock: a page from the pool, or a fresh one from the reservation.
+static SlabPage* slab_new_page_locked(void) {
+    if (slab_pool) {
+        SlabPage* pg = slab_pool;
+        slab_remove(&slab_pool, pg);
+        return pg;
+    }
+    if (slab_top + SLAB_PAGE > slab_base + slab_span) return NULL;
+    if (slab_top + SLAB_PAGE > slab_committed) {
+        if (mprotect((void*)slab_committed, SLAB_COMMIT, PROT_READ | PROT_WRITE) != 0) return NULL;
+        slab_committed += SLAB_COMMIT;
+    }
+    SlabPage* pg = (SlabPage*)slab_top;
+    slab_top += SLAB_PAGE;
+    return pg;
+}
+
+// Move blocks other threads freed onto the owner's list.
+static void slab_drain_remote(SlabPage* pg) {
+    void* b = atomic_exchange_explicit(&pg->remote, NULL, memory_order_acquire);
+    while (b) {
+        void* nx = SLAB_NEXT(b);
+        SLAB_NEXT(b) = pg->free;
+        pg->free = b;
+        pg->used--;
+        b = nx;
+    }
+}
+
+static inline int slab_has_room(SlabPage* pg) {
+    return pg->free || (uintptr_t)pg->bump + pg->bsize <= (uintptr_t)pg + SLAB_PAGE;
+}
+
+// The current page of class c is full: take another page with room (parking
+// full ones on the full list), revisit full pages that other threads freed
+// into, adopt an abandoned page, or start a new one.
+static SlabPage* slab_refill(SlabHeap* h, int c) {
+    for (;;) {
+        SlabPage* pg;
+        while ((pg = h->avail[c])) {
+            if (atomic_load_explicit(&pg->remote, memory_order_relaxed)) slab_drain_remote(pg);
+            if (slab_has_room(pg)) return h->cur[c] = pg;
+            slab_remove(&h->avail[c], pg);
+            slab_push(&h->full[c], pg);
+            pg->in_full = 1;
+        }
+        unsigned bit = 1u << c;
+        if (!(atomic_load_explicit(&h->remote_hint, memory_order_relaxed) & bit)) break;
+        atomic_fetch_and_explicit(&h->remote_hint, ~bit, memory_order_acquire);
+        for (pg = h->full[c]; pg; ) {
+            SlabPage* nx = pg->next;
+            if (atomic_load_explicit(&pg->remote, memory_order_relaxed)) {
+                slab_remove(&h->full[c], pg);
+                slab_push(&h->avail[c], pg);
+                pg->in_full = 0;
+            }
+            pg = nx;
+        }
+        if (!h->avail[c]) break;
+    }
+    uint32_t bsize = (uint32_t)1 << (SLAB_MIN_SHIFT + c);
+    SlabPage* pg;
+    for (;;) {
+        pg = NULL;
+        pthread_mutex_lock(&slab_lock);
+        for (SlabPage* a = slab_abandoned; a; a = a->next)
+            if (a->bsize == bsize) { slab_remove(&slab_abandoned, a); pg = a; break; }
+        pthread_mutex_unlock(&slab_lock);
+        if (!pg) break;
+        // An abandoned page may still be full: it is ours now either way, but
+        // only one with room can become the current page.
+        atomic_store_explicit(&pg->owner, h, memory_order_release);
+        slab_drain_remote(pg);
+        if (slab_has_room(pg)) {
+            pg->in_full = 0;
+            slab_push(&h->avail[c], pg);
+            return h->cur[c] = pg;
+        }
+        pg->in_full = 1;
+        slab_push(&h->full[c], pg);
+    }
+    pthread_mutex_lock(&slab_lock);
+    pg = slab_new_page_locked();
+    pthread_mutex_unlock(&slab_lock);
+    if (!pg) return NULL;
+    pg->bsize = bsize;
+    pg->first = bsize < sizeof(SlabPage) ? (uint32_t)((sizeof(SlabPage) + bsize - 1) & ~(bsize - 1)) : bsize;
+    pg->used = 0;
+    pg->free = NULL;
+    pg->bump = (char*)pg + pg->first;
+    pg->cls = c;
+    atomic_store_explicit(&pg->remote, NULL, memory_order_relaxed);
+    pg->magic = SLAB_MAGIC;
+    pg->in_full = 0;
+    atomic_store_explicit(&pg->owner, h, memory_order_release);
+    slab_push(&h->avail[c], pg);
+    return h->cur[c] = pg;
+}
+
+static SlabHeap* slab_thread_heap(void) {
+    pthread_mutex_lock(&slab_lock);
+    SlabHeap* h = slab_free_heaps;
+    if (h) slab_free_heaps = h->next_free;
+    pthread_mutex_unlock(&slab_lock);
+    if (h) {
+        memset(h, 0, offsetof(SlabHeap, id));
+    } else {
+        if (!(h = calloc(1, sizeof(SlabHeap)))) return NULL;
+        pthread_mutex_lock(&slab_lock);
+        if (rc_bias_on && slab_heap_ids < RC_BIAS_MAX_ID) {
+            h->id = ++slab_heap_ids;
+            slab_heap_by_id[h->id] = h;
+        }
+        pthread_mutex_unlock(&slab_lock);
+    }
+    pthread_setspecific(slab_key, h);
+    return slab_heap = h;
+}
+
+// Thread exit: empty pages go back to the pool, the rest are abandoned for
+// another thread to adopt (blocks still alive in them keep being freed onto
+// the remote lists meanwhile).
+static void slab_thread_exit(void* arg) {
+    SlabHeap* h = arg;
+    // Hand every block this thread still owns over to the shared count, then
+    // settle the queue (which may free blocks, and so must precede the page
+    // walk below).
+    if (h->id) {
+        for (int c = 0; c < SLAB_CLASSES; c++)
+            for (int l = 0; l < 2; l++)
+                for (SlabPage* pg = l ? h->full[c] : h->avail[c]; pg; pg = pg->next)
+                    for (char* b = (char*)pg + pg->first; b < pg->bump; b += pg->bsize) {
+                        WynRcHeaderFull* hdr = (WynRcHeaderFull*)b;
+                        uint32_t bias = atomic_load_explicit(&hdr->bias, memory_order_relaxed);
+                        if (bias >> RC_BIAS_SHIFT == h->id) rc_merge(hdr, bias & RC_BIAS_LOCAL, 0);
+                    }
+        rc_drain(h);
+    }
+    pthread_mutex_lock(&slab_lock);
+    for (int c = 0; c < SLAB_CLASSES; c++) {
+        for (int l = 0; l < 2; l++) {
+            SlabPage* pg = l ? h->full[c] : h->avail[c];
+            while (pg) {
+                SlabPage* nx = pg->next;
+                atomic_store_explicit(&pg->owner, NULL, memory_order_release);
+                slab_drain_remote(pg);
+                slab_push(pg->used == 0 ? &slab_pool : &slab_abandoned, pg);
+                pg = nx;
+            }
+        }
+    }
+    h->next_free = slab_free_heaps;
+    slab_free_heaps = h;
+    pthread_mutex_unlock(&slab_lock);
+    slab_heap = NULL;
+}
+
+static void* slab_alloc(size_t total) {
+    SlabHeap* h = slab_heap;
+    if (!h && !(h = slab_thread_heap())) return NULL;
+    if (atomic_load_explicit(&h->brc_queue, memory_order_relaxed)) rc_drain(h);
+    int c = slab_class(total);
+    SlabPage* pg = h->cur[c];
+    if (!pg || !slab_has_room(pg)) {
+        pg = slab_refill(h, c);
+        if (!pg) return NULL;
+    }
+    void* b;
+    if (pg->free) {
+        b = pg->free;
+        pg->free = SLAB_NEXT(b);
+    } else {
+        b = pg->bump;
+        pg->bump += pg->bsize;
+    }
+    pg->used++;
+    return b;
+}
+
+static void slab_free(void* b) {
+    SlabPage* pg = slab_page_of(b);
+    SlabHeap* h = slab_heap;
+    SlabHeap* owner = atomic_load_explicit(&pg->owner, memory_order_acquire);
+    if (h && owner == h) {
+        int c = pg->cls;
+        SLAB_NEXT(b) = pg->free;
+        pg->free = b;
+        if (--pg->used == 0 && h->cur[c] != pg) {
+            // Whole page free and not the one being allocated from: pool it.
+            slab_remove(pg->in_full ? &h->full[c] : &h->avail[c], pg);
+            atomic_store_explicit(&pg->owner, NULL, memory_order_relaxed);
+            pthread_mutex_lock(&slab_lock);
+            slab_push(&slab_pool, pg);
+            pthread_mutex_unlock(&slab_lock);
+        } else if (pg->in_full) {
+            slab_remove(&h->full[c], pg);
+            slab_push(&h->avail[c], pg);
+            pg->in_full = 0;
+        }
+        return;
+    }
+    void* head = atomic_load_explicit(&pg->remote, memory_order_relaxed);
+    do {
+        SLAB_NEXT(b) = head;
+    } while (!atomic_compare_exchange_weak_explicit(&pg->remote, &head, b,
+                 memory_order_release, memory_order_relaxed));
+    if (owner) atomic_fetch_or_explicit(&owner->remote_hint, 1u << pg->cls, memory_order_release);
+}
+
+static void rc_free(WynRcHeaderFull* hdr) {
+    hdr->magic = 0;
+    atomic_store_explicit(&hdr->bias, 0, memory_order_relaxed);
+    slab_free(hdr);
+}
+
+// Fold `local` owner references into the shared count and mark the block
+// MERGED (from_queue also settles its QUEUED flag). Only the owner calls
+// this. Returns 1 when the block is now dead and the caller must free it.
+static int rc_merge(WynRcHeaderFull* hdr, uint32_t local, int from_queue) {
+    int32_t old = atomic_load_explicit(&hdr->refcount, memory_order_relaxed), nw;
+    do {
+        nw = (int32_t)((uint32_t)old + local * RC_SHARED_ONE) | RC_SHARED_MERGED;
+        if (from_queue) nw &= ~RC_SHARED_QUEUED;
+    } while (!atomic_compare_exchange_weak_explicit(&hdr->refcount, &old, nw,
+                 memory_order_acq_rel, memory_order_relaxed));
+    // After the CAS: a thread that sees the cleared owner id also sees MERGED.
+    atomic_store_explicit(&hdr->bias, 0, memory_order_release);
+    return nw >> RC_SHARED_SHIFT == 0 && !(nw & RC_SHARED_QUEUED);
+}
+
+static void rc_drain(SlabHeap* h) {
+    RcQueued* q = atomic_exchange_explicit(&h->brc_queue, NULL, memory_order_acquire);
+    while (q) {
+        RcQueued* nx = q->next;
+        uint32_t bias = atomic_load_explicit(&q->hdr->bias, memory_order_relaxed);
+        uint32_t local = bias >> RC_BIAS_SHIFT == h->id ? bias & RC_BIAS_LOCAL : 0;
+        if (rc_merge(q->hdr, local, 1)) rc_free(q->hdr);
+        free(q);
+        q = nx;
+    }
+}
+
+// A release by a thread that does not own the block's local count.
+static void rc_release_shared(WynRcHeaderFull* hdr, uint32_t bias) {
+    int32_t nw = atomic_fetch_sub_explicit(&hdr->refcount, RC_SHARED_ONE, memory_order_acq_rel) - RC_SHARED_ONE;
+    if (nw & RC_SHARED_MERGED) {
+        if (nw >> RC_SHARED_SHIFT == 0 && !(nw & RC_SHARED_QUEUED)) rc_free(hdr);
+        return;
+    }
+    if (nw >> RC_SHARED_SHIFT >= 0 || (nw & RC_SHARED_QUEUED)) return;
+    // The owner's local count holds the other side of this reference.
+    int32_t old = atomic_fetch_or_explicit(&hdr->refcount, RC_SHARED_QUEUED, memory_order_acq_rel);
+    if (old & RC_SHARED_QUEUED) return;
+    if (old & RC_SHARED_MERGED) {
+        // The owner merged in between (thread exit): nobody will drain it.
+        old = atomic_fetch_and_explicit(&hdr->refcount, ~RC_SHARED_QUEUED, memory_order_acq_rel);
+        if (old >> RC_SHARED_SHIFT == 0) rc_free(hdr);
+        return;
+    }
+    SlabHeap* owner = slab_heap_by_id[bias >> RC_BIAS_SHIFT];
+    RcQueued* q = malloc(sizeof *q);
+    if (!owner || !q) { free(q); return; }  // leaks the block, never frees early
+    q->hdr = hdr;
+    q->next = atomic_load_explicit(&owner->brc_queue, memory_order_relaxed);
+    while (!atomic_compare_exchange_weak_explicit(&owner->brc_queue, &q->next, q,
+               memory_order_release, memory_order_relaxed)) {}
+}
+
+static inline int rc_is_owner(uint32_t bias) {
+    SlabHeap* h = slab_heap;
+    return h && h->id && bias >> RC_BIAS_SHIFT == h->id;
+}
+#endif
+
 void* wyn_rc_alloc(size_t size) {
-    WynRcHeaderFull* hdr = malloc(sizeof(WynRcHeaderFull) + size);
+    WynRcHeaderFull* hdr;
+#ifdef WYN_RC_SLAB
+    size_t total = sizeof(WynRcHeaderFull) + size;
+    if (total <= SLAB_MAX_BLOCK) {
+        pthread_once(&slab_once, slab_init);
+        if (slab_span && (hdr = slab_alloc(total))) {
+            hdr->magic = WYN_RC_MAGIC;
+            // The whole block is usable, so report it: an in-place append
+            // (wyn_string_append_owned) can use the rounding slack.
+            hdr->capacity = (uint32_t)(slab_page_of(hdr)->bsize - sizeof(WynRcHeaderFull));
+            hdr->length = 0;
+            uint32_t id = slab_heap->id;
+            if (id) {
+                atomic_store_explicit(&hdr->refcount, 0, memory_order_relaxed);
+                atomic_store_explicit(&hdr->bias, id << RC_BIAS_SHIFT | 1, memory_order_relaxed);
+            } else {
+                atomic_store_explicit(&hdr->refcount, RC_SHARED_ONE | RC_SHARED_MERGED, memory_order_relaxed);
+                atomic_store_explicit(&hdr->bias, 0, memory_order_relaxed);
+            }
+            return (char*)hdr + sizeof(WynRcHeaderFull);
+        }
+    }
+#endif
+    hdr = malloc(sizeof(WynRcHeaderFull) + size);
     if (!hdr) return NULL;
     hdr->magic = WYN_RC_MAGIC;
     atomic_store(&hdr->refcount, 1);
@@ -56,6 +530,16 @@ void* wyn_rc_alloc(size_t size) {
 
 int wyn_rc_is_heap(const void* ptr) {
     if (!ptr) return 0;
+#ifdef WYN_RC_SLAB
+    if (slab_owns(ptr)) {
+        // Page header lookup: ptr must be the payload of a block on a page
+        // that has been handed out, and that block must be live.
+        SlabPage* pg = slab_page_of(ptr);
+        uintptr_t off = (uintptr_t)ptr - (uintptr_t)pg - sizeof(WynRcHeaderFull);
+        return pg->magic == SLAB_MAGIC && off >= pg->first && (off & (pg->bsize - 1)) == 0 &&
+               rc_full_header(ptr)->magic == WYN_RC_MAGIC;
+    }
+#endif
     void* lo = atomic_load_explicit(&heap_low, memory_order_relaxed);
     if (!lo) return 0;
     void* hi = atomic_load_explicit(&heap_high, memory_order_relaxed);
@@ -80,6 +564,16 @@ uint32_t wyn_rc_get_length(const void* ptr) {
 void wyn_rc_retain(const void* ptr) {
     if (!ptr || !wyn_rc_is_heap(ptr)) return;
     WynRcHeaderFull* hdr = rc_full_header(ptr);
+#ifdef WYN_RC_SLAB
+    if (slab_owns(hdr)) {
+        uint32_t bias = atomic_load_explicit(&hdr->bias, memory_order_acquire);
+        if (rc_is_owner(bias) && (bias & RC_BIAS_LOCAL) != RC_BIAS_LOCAL)
+            atomic_store_explicit(&hdr->bias, bias + 1, memory_order_relaxed);
+        else
+            atomic_fetch_add_explicit(&hdr->refcount, RC_SHARED_ONE, memory_order_relaxed);
+        return;
+    }
+#endif
     int32_t rc = atomic_load_explicit(&hdr->refcount, memory_order_relaxed);
     if (rc == WYN_RC_IMMORTAL) return;
     atomic_fetch_add_explicit(&hdr->refcount, 1, memory_order_relaxed);
@@ -88,6 +582,15 @@ void wyn_rc_retain(const void* ptr) {
 void wyn_rc_release(const void* ptr) {
     if (!ptr || !wyn_rc_is_heap(ptr)) return;
     WynRcHeaderFull* hdr = rc_full_header(ptr);
+#ifdef WYN_RC_SLAB
+    if (slab_owns(hdr)) {
+        uint32_t bias = atomic_load_explicit(&hdr->bias, memory_order_acquire);
+        if (!rc_is_owner(bias)) rc_release_shared(hdr, bias);
+        else if ((bias & RC_BIAS_LOCAL) > 1) atomic_store_explicit(&hdr->bias, bias - 1, memory_order_relaxed);
+        else if (rc_merge(hdr, 0, 0)) rc_free(hdr);
+        return;
+    }
+#endif
     int32_t rc = atomic_load_explicit(&hdr->refcount, memory_order_relaxed);
     if (rc == WYN_RC_IMMORTAL) return;
     if (atomic_fetch_sub_explicit(&hdr->refcount, 1, memory_order_acq_rel) == 1) {
@@ -98,9 +601,56 @@ void wyn_rc_release(const void* ptr) {
     }
 }
 
+// Promote a block to the shared count before it is handed to another thread
+// (spawn arguments and results, channel sends): called by the owner, it
+// merges the local count so the receiver's release never needs the owner.
+// Returns ptr so codegen can wrap the value in place.
+const void* wyn_rc_share(const void* ptr) {
+#ifdef WYN_RC_SLAB
+    if (ptr && wyn_rc_is_heap(ptr) && slab_owns(ptr)) {
+        WynRcHeaderFull* hdr = rc_full_header(ptr);
+        uint32_t bias = atomic_load_explicit(&hdr->bias, memory_order_relaxed);
+        if (rc_is_owner(bias)) rc_merge(hdr, bias & RC_BIAS_LOCAL, 0);
+    }
+#endif
+    return ptr;
+}
+
+// 1 when the caller's reference is the only one (wyn_string_append_owned may
+// then write in place).
+int wyn_rc_is_unique(const void* ptr) {
+    if (!ptr || !wyn_rc_is_heap(ptr)) return 0;
+    WynRcHeaderFull* hdr = rc_full_header(ptr);
+    int32_t rc = atomic_load_explicit(&hdr->refcount, memory_order_acquire);
+#ifdef WYN_RC_SLAB
+    if (slab_owns(hdr)) {
+        uint32_t bias = atomic_load_explicit(&hdr->bias, memory_order_relaxed);
+        if (rc_is_owner(bias)) return (bias & RC_BIAS_LOCAL) == 1 && rc == 0;
+        return rc == (RC_SHARED_ONE | RC_SHARED_MERGED);
+    }
+#endif
+    return rc == 1;
+}
+
+// Merge the blocks other threads queued for this one. The scheduler calls
+// it between tasks so a worker that stops allocating still settles them.
+void wyn_rc_drain(void) {
+#ifdef WYN_RC_SLAB
+    SlabHeap* h = slab_heap;
+    if (h && atomic_load_explicit(&h->brc_queue, memory_order_relaxed)) rc_drain(h);
+#endif
+}
+
 int wyn_rc_count(const void* ptr) {
     if (!ptr || !wyn_rc_is_heap(ptr)) return -1;
     WynRcHeaderFull* hdr = rc_full_header(ptr);
+#ifdef WYN_RC_SLAB
+    if (slab_owns(hdr)) {
+        uint32_t bias = atomic_load_explicit(&hdr->bias, memory_order_relaxed);
+        int32_t shared = atomic_load_explicit(&hdr->refcount, memory_order_relaxed) >> RC_SHARED_SHIFT;
+        return shared + (bias >> RC_BIAS_SHIFT ? (int)(bias & RC_BIAS_LOCAL) : 0);
+    }
+#endif
     return atomic_load(&hdr->refcount);
 }
 
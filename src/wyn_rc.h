@@ -9,7 +9,8 @@
 // Layout: [magic(4)][refcount(4)][capacity(4)][length(4)][magic2(4)][user data...]
 // The pointer returned to user code points to user data, not the header.
 // This MUST stay byte-identical to WynRcHeaderFull (wyn_rc.c) and the RcHdr
-// mirror in wyn_runtime.h. magic2 = ~magic is the complement sentinel.
+// mirror in wyn_runtime.h. magic2 = ~magic is the complement sentinel on
+// malloc'd blocks; slab blocks use that word for biased counting (wyn_rc.c).
 
 // Sentinel refcount for immortal objects (string literals, stack values)
 #define WYN_RC_IMMORTAL INT32_MAX
@@ -41,6 +42,16 @@ int wyn_rc_count(const void* ptr);
 
 // Check if a pointer is refcounted (heap-allocated via wyn_rc_alloc)
 int wyn_rc_is_heap(const void* ptr);
+
+// Move a block from its owner's local count to the shared count before it
+// is handed to another thread. Returns ptr.
+const void* wyn_rc_share(const void* ptr);
+
+// 1 if the caller holds the only reference.
+int wyn_rc_is_unique(const void* ptr);
+
+// Merge blocks other threads released on this thread's behalf.
+void wyn_rc_drain(void);
 void wyn_rc_set_length(const void* ptr, uint32_t len);
 uint32_t wyn_rc_get_length(const void* ptr);
 
@@ -1,10 +1,18 @@
 // wyn_regex.h - Portable regex engine for Wyn
 // Implements POSIX Extended Regular Expressions (ERE) without platform dependencies.
-// Used on Windows where <regex.h> is unavailable. On POSIX systems, the native
-// regex is used instead (faster, battle-tested).
+// This is the matcher behind Regex.* on every platform. A pattern is compiled once
+// into a Thompson NFA, and a DFA is built from it lazily, one transition at a
+// time, while matching. Most lines are then scanned with one table lookup per byte.
+// On POSIX systems the runtime compiles with WRE_STRICT. Any pattern whose glibc
+// meaning the engine does not reproduce is declined, and the runtime hands it to
+// regcomp instead. Examples are GNU escapes, collating elements and huge bounds.
 //
-// Supports: . [] [^] ^ $ * + ? {n,m} () | \ escapes
+// Supports: . [] [^] [:class:] ^ $ * + ? {n,m} () | \ escapes
 // Does NOT support: backreferences, lookahead/lookbehind, non-greedy (these are PCRE, not ERE)
+//
+// Matching is POSIX leftmost-longest. Every run is O(n) in the input. The DFA
+// cache is bounded, and once it is full the rest of that call falls back to
+// plain NFA simulation, so there is no exponential blowup in time or memory.
 
 #ifndef WYN_REGEX_H
 #define WYN_REGEX_H
@@ -12,20 +20,34 @@
 #include <string.h>
 #include <stdlib.h>
 #include <stdbool.h>
-
-// --- NFA-based regex engine ---
-// We compile the pattern to an NFA (Thompson's construction), then simulate it.
-// This guarantees O(n*m) worst case (no exponential backtracking).
-
-#define WRE_MAX_STATES 512
-#define WRE_MAX_GROUPS 10
+#include <stdatomic.h>
+#if defined(__SSE2__) && !defined(__TINYC__)
+#include <emmintrin.h>
+#define WRE_SSE2 1
+#endif
+#ifdef _WIN32
+#include <windows.h>
+#define wre_yield() SwitchToThread()
+#else
+#include <sched.h>
+#define wre_yield() sched_yield()
+#endif
+
+#define WRE_MAX_STATES 100000  // NFA size cap; bigger patterns are declined
+#define WRE_MAX_REPEAT 255     // largest {n,m} bound the compiler expands
+#define WRE_DFA_MAX 4096       // DFA states cached per table before a call falls back to the NFA
+#define WRE_DFA_BLK 64         // transition rows are allocated this many states at a time
+#define WRE_DFA_BUCKETS 1024
+#define WRE_PREFIX_MAX 32
+
+// Compile flags
+#define WRE_NEWLINE 1  // like REG_NEWLINE: . and [^..] skip '\n', ^ and $ also match at line breaks
+#define WRE_STRICT  2  // decline what glibc reads differently (\d, \b, [.x.]) so the caller can fall back
 
 enum wre_op {
-    WRE_LITERAL,    // match exact char
-    WRE_DOT,        // match any char (except \n)
-    WRE_CLASS,      // character class [...]
-    WRE_NCLASS,     // negated class [^...]
-    WRE_SPLIT,      // fork: try out1, then out2
+    WRE_LITERAL,    // match exact byte
+    WRE_CLASS,      // match any byte in cls[] (., [...], [^...], \w and friends)
+    WRE_SPLIT,      // fork: out1 and out2
     WRE_JMP,        // unconditional jump to out1
     WRE_MATCH,      // accept state
     WRE_BOL,        // ^ anchor
@@ -33,408 +55,899 @@ enum wre_op {
 };
 
 struct wre_state {
-    enum wre_op op;
-    int ch;                // for LITERAL
-    unsigned char cls[32]; // bitmap for CLASS/NCLASS (256 bits)
+    unsigned char op;
+    unsigned char ch;      // for LITERAL
+    int cls;               // for CLASS: index into wre_prog.cls
     int out1, out2;        // next states (-1 = none)
 };
 
-struct wre_nfa {
-    struct wre_state states[WRE_MAX_STATES];
-    int nstates;
-    int start;
+// Scratch sets for closure computation, each sized to the NFA.
+struct wre_scratch {
+    int *a, *b, *c, *stack;
+    unsigned* mark;
+    unsigned gen;
+};
+
+// Lazy DFA over one NFA. A state is the set of NFA states live at a position
+// plus whether that position is a line start. $ is left unresolved in the set,
+// because it depends on the byte that follows. Transitions are published with
+// release stores, so concurrent matchers read the table without the lock. Only
+// building a missing transition takes it.
+// A transition cell holds 0 (not built yet) or state<<3 | dead<<2 | accept_eol<<1 | accept.
+struct wre_dstate { int off, n, enc, chain; unsigned hash; unsigned char bol; };
+struct wre_dfa {
+    _Atomic int* rows[WRE_DFA_MAX / WRE_DFA_BLK];
+    _Atomic int start[2];          // encoded start state, by bol
+    int unanch;                    // 1 = a new match may begin at every position
+    struct wre_dstate* st;
+    int nst, st_cap;
+    int* pool;
+    long pool_n, pool_cap;
+    int buckets[WRE_DFA_BUCKETS];
+};
+
+struct wre_prog {
+    struct wre_state* states;
+    int nstates, cap;
+    unsigned char (*cls)[32];
+    int ncls, cls_cap;
+    int start, flags;
+    unsigned char bytemap[256];    // byte -> equivalence class
+    int nbytes;
+    unsigned char first[32];       // bytes that can begin a match
+    int skip_first;                // 1 when no match is empty, so first[] can skip ahead
+    unsigned char first_bytes[3];  // first[] spelled out when it has at most 3 members
+    int first_n;
+    unsigned char prefix[WRE_PREFIX_MAX];  // literal every match begins with
+    int prefix_len;
+    struct wre_dfa* _Atomic dfa[2];        // [0] anchored, [1] unanchored; built on first use
+    atomic_flag lock;
+    struct wre_scratch w;          // used under lock
 };
 
 // --- Character class bitmap helpers ---
 static void wre_cls_set(unsigned char cls[32], int c) { if (c >= 0 && c < 256) cls[c/8] |= (1 << (c%8)); }
-static bool wre_cls_test(unsigned char cls[32], int c) { return c >= 0 && c < 256 && (cls[c/8] & (1 << (c%8))); }
+static bool wre_cls_test(const unsigned char cls[32], int c) { return c >= 0 && c < 256 && (cls[c/8] & (1 << (c%8))); }
+static void wre_cls_range(unsigned char cls[32], int lo, int hi) { for (int c = lo; c <= hi; c++) wre_cls_set(cls, c); }
+
+// Named classes, bytewise as in the C locale (the runtime never calls setlocale).
+static bool wre_cls_named(unsigned char cls[32], const char* name, int len) {
+    #define WRE_IS(s) (len == (int)sizeof(s) - 1 && memcmp(name, s, len) == 0)
+    bool alpha = WRE_IS("alpha"), digit = WRE_IS("digit"), alnum = WRE_IS("alnum");
+    if (alpha || alnum || WRE_IS("upper")) wre_cls_range(cls, 'A', 'Z');
+    if (alpha || alnum || WRE_IS("lower")) wre_cls_range(cls, 'a', 'z');
+    if (digit || alnum) wre_cls_range(cls, '0', '9');
+    if (WRE_IS("xdigit")) { wre_cls_range(cls, '0', '9'); wre_cls_range(cls, 'a', 'f'); wre_cls_range(cls, 'A', 'F'); }
+    if (WRE_IS("space")) { wre_cls_range(cls, '\t', '\r'); wre_cls_set(cls, ' '); }
+    if (WRE_IS("blank")) { wre_cls_set(cls, ' '); wre_cls_set(cls, '\t'); }
+    if (WRE_IS("cntrl")) { wre_cls_range(cls, 0, 31); wre_cls_set(cls, 127); }
+    if (WRE_IS("print")) wre_cls_range(cls, 32, 126);
+    if (WRE_IS("graph")) wre_cls_range(cls, 33, 126);
+    if (WRE_IS("punct")) { wre_cls_range(cls, 33, 47); wre_cls_range(cls, 58, 64); wre_cls_range(cls, 91, 96); wre_cls_range(cls, 123, 126); }
+    bool known = alpha || digit || alnum || WRE_IS("upper") || WRE_IS("lower") || WRE_IS("xdigit") ||
+                 WRE_IS("space") || WRE_IS("blank") || WRE_IS("cntrl") || WRE_IS("print") ||
+                 WRE_IS("graph") || WRE_IS("punct");
+    #undef WRE_IS
+    return known;
+}
 
-// --- Compiler: pattern string -> NFA ---
+// \w \s \d and their negations. \d is only reached in non-strict mode:
+// glibc reads it as a plain 'd'.
+static bool wre_cls_escape(unsigned char cls[32], int c, bool* negate) {
+    *negate = (c >= 'A' && c <= 'Z');
+    switch (c | 0x20) {
+        case 'w': wre_cls_named(cls, "alnum", 5); wre_cls_set(cls, '_'); return true;
+        case 's': wre_cls_named(cls, "space", 5); return true;
+        case 'd': wre_cls_named(cls, "digit", 5); return true;
+        default: return false;
+    }
+}
 
-typedef struct { int start, end; } wre_frag;
+static void wre_cls_finish(unsigned char cls[32], bool negate, int flags) {
+    if (negate) {
+        for (int i = 0; i < 32; i++) cls[i] = (unsigned char)~cls[i];
+        if (flags & WRE_NEWLINE) cls['\n'/8] &= (unsigned char)~(1 << ('\n'%8));
+    }
+    cls[0] &= (unsigned char)~1;  // NUL ends the string
+}
 
-static int wre_add(struct wre_nfa* nfa, enum wre_op op, int ch) {
-    if (nfa->nstates >= WRE_MAX_STATES - 1) return -1;
-    int id = nfa->nstates++;
-    nfa->states[id].op = op;
-    nfa->states[id].ch = ch;
-    nfa->states[id].out1 = -1;
-    nfa->states[id].out2 = -1;
-    memset(nfa->states[id].cls, 0, 32);
+// --- Compiler: pattern string -> NFA ---
+// Recursive descent over alt := branch ('|' branch)*, branch := piece*,
+// piece := atom quantifier*. Every fragment owns the contiguous state range
+// [lo, nstates) and has one dangling exit, end.out1, which is how {n,m}
+// copies an atom: the range is cloned before any of the copies are wired.
+
+typedef struct { int start, end, lo; } wre_frag;
+
+struct wre_parser {
+    struct wre_prog* p;
+    const char* s;
+    int pos, flags, depth;
+    bool fail;
+};
+
+static int wre_add(struct wre_parser* P, int op) {
+    struct wre_prog* p = P->p;
+    if (P->fail) return 0;
+    if (p->nstates >= WRE_MAX_STATES) { P->fail = true; return 0; }
+    if (p->nstates == p->cap) {
+        int ncap = p->cap ? p->cap * 2 : 64;
+        struct wre_state* ns = realloc(p->states, sizeof(struct wre_state) * ncap);
+        if (!ns) { P->fail = true; return 0; }
+        p->states = ns; p->cap = ncap;
+    }
+    int id = p->nstates++;
+    p->states[id].op = (unsigned char)op;
+    p->states[id].ch = 0;
+    p->states[id].cls = -1;
+    p->states[id].out1 = -1;
+    p->states[id].out2 = -1;
     return id;
 }
 
-static void wre_patch(struct wre_nfa* nfa, int state, int target) {
-    if (state < 0) return;
-    if (nfa->states[state].out1 == -1) nfa->states[state].out1 = target;
-    else if (nfa->states[state].out2 == -1) nfa->states[state].out2 = target;
-}
-
-// Parse a character class [...] and return the state id
-static int wre_parse_class(struct wre_nfa* nfa, const char* p, int* advance) {
-    bool negated = false;
-    int i = 0;
-    if (p[i] == '^') { negated = true; i++; }
-    int id = wre_add(nfa, negated ? WRE_NCLASS : WRE_CLASS, 0);
-    if (id < 0) { *advance = 1; return -1; }
-    // Handle ] as first char in class
-    if (p[i] == ']') { wre_cls_set(nfa->states[id].cls, ']'); i++; }
-    while (p[i] && p[i] != ']') {
-        if (p[i] == '\\' && p[i+1]) {
-            i++;
-            if (p[i] == 'd') { for (int c = '0'; c <= '9'; c++) wre_cls_set(nfa->states[id].cls, c); }
-            else if (p[i] == 'w') { for (int c = 'a'; c <= 'z'; c++) wre_cls_set(nfa->states[id].cls, c); for (int c = 'A'; c <= 'Z'; c++) wre_cls_set(nfa->states[id].cls, c); for (int c = '0'; c <= '9'; c++) wre_cls_set(nfa->states[id].cls, c); wre_cls_set(nfa->states[id].cls, '_'); }
-            else if (p[i] == 's') { wre_cls_set(nfa->states[id].cls, ' '); wre_cls_set(nfa->states[id].cls, '\t'); wre_cls_set(nfa->states[id].cls, '\n'); wre_cls_set(nfa->states[id].cls, '\r'); }
-            else wre_cls_set(nfa->states[id].cls, (unsigned char)p[i]);
-            i++;
-        } else if (p[i+1] == '-' && p[i+2] && p[i+2] != ']') {
-            for (int c = (unsigned char)p[i]; c <= (unsigned char)p[i+2]; c++)
-                wre_cls_set(nfa->states[id].cls, c);
-            i += 3;
-        } else {
-            wre_cls_set(nfa->states[id].cls, (unsigned char)p[i]);
-            i++;
-        }
+static int wre_add_cls(struct wre_parser* P, const unsigned char cls[32]) {
+    struct wre_prog* p = P->p;
+    if (P->fail) return 0;
+    if (p->ncls == p->cls_cap) {
+        int ncap = p->cls_cap ? p->cls_cap * 2 : 8;
+        unsigned char (*nc)[32] = realloc(p->cls, 32 * (size_t)ncap);
+        if (!nc) { P->fail = true; return 0; }
+        p->cls = nc; p->cls_cap = ncap;
     }
-    if (p[i] == ']') i++;
-    *advance = i;
+    memcpy(p->cls[p->ncls], cls, 32);
+    int c = p->ncls++;
+    int id = wre_add(P, WRE_CLASS);
+    if (!P->fail) p->states[id].cls = c;
     return id;
 }
 
-// Compile pattern to NFA. Returns start state, or -1 on error.
-static bool wre_compile(struct wre_nfa* nfa, const char* pattern) {
-    nfa->nstates = 0;
+static wre_frag wre_one(int id) { return (wre_frag){id, id, id}; }
 
-    // Fragment stack for building NFA
-    wre_frag stack[256];
-    int sp = 0;
+static void wre_link(struct wre_parser* P, int from, int to) {
+    if (!P->fail) P->p->states[from].out1 = to;
+}
 
-    // Alternation tracking
-    wre_frag alt_stack[64];
-    int alt_sp = 0;
-    int paren_alt_sp[32];
-    int paren_sp = 0;
-    int paren_frag_sp[32];
-
-    const char* p = pattern;
-    while (*p) {
-        wre_frag frag;
-        bool have_atom = false;
-
-        // Parse one atom
-        if (*p == '(') {
-            paren_alt_sp[paren_sp] = alt_sp;
-            paren_frag_sp[paren_sp] = sp;
-            paren_sp++;
-            p++;
+// Copy the pristine fragment f (states [lo, hi)) to the end of the NFA.
+static wre_frag wre_clone(struct wre_parser* P, wre_frag f, int hi) {
+    struct wre_prog* p = P->p;
+    int off = p->nstates - f.lo;
+    for (int i = f.lo; i < hi; i++) {
+        int id = wre_add(P, WRE_JMP);
+        if (P->fail) return f;
+        struct wre_state st = p->states[i];
+        if (st.out1 >= f.lo && st.out1 < hi) st.out1 += off;
+        if (st.out2 >= f.lo && st.out2 < hi) st.out2 += off;
+        p->states[id] = st;
+    }
+    return (wre_frag){f.start + off, f.end + off, f.lo + off};
+}
+
+// x{n,m}; m < 0 means unbounded. *, + and ? are the clone-free special cases.
+static wre_frag wre_repeat(struct wre_parser* P, wre_frag f, int n, int m) {
+    struct wre_prog* p = P->p;
+    int lo = f.lo;
+    if (n == 0 && m == 0) { wre_frag e = wre_one(wre_add(P, WRE_JMP)); e.lo = lo; return e; }
+    if (n <= 1 && (m < 0 || m == 1)) {
+        int x = wre_add(P, WRE_SPLIT), j = wre_add(P, WRE_JMP);
+        if (P->fail) return f;
+        p->states[x].out1 = f.start;
+        p->states[x].out2 = j;
+        wre_link(P, f.end, m < 0 ? x : j);
+        return (wre_frag){n == 1 ? f.start : x, j, lo};
+    }
+    int hi = p->nstates;
+    int copies = m < 0 ? n : m;
+    if ((long)(hi - lo) * copies + p->nstates > WRE_MAX_STATES) { P->fail = true; return f; }
+    wre_frag* c = malloc(sizeof(wre_frag) * copies);
+    if (!c) { P->fail = true; return f; }
+    c[0] = f;
+    for (int k = 1; k < copies && !P->fail; k++) c[k] = wre_clone(P, f, hi);
+    int j = wre_add(P, WRE_JMP);
+    if (P->fail) { free(c); return f; }
+    int start = -1, end = -1;
+    for (int k = 0; k < copies; k++) {
+        int entry = c[k].start;
+        if (k >= n) {                      // optional copy: split around it to the exit
+            entry = wre_add(P, WRE_SPLIT);
+            if (P->fail) break;
+            p->states[entry].out1 = c[k].start;
+            p->states[entry].out2 = j;
+        }
+        if (start < 0) start = entry; else wre_link(P, end, entry);
+        end = c[k].end;
+    }
+    if (m < 0 && !P->fail) {               // the last required copy loops: x{n,} = x{n-1}x+
+        int x = wre_add(P, WRE_SPLIT);
+        if (!P->fail) {
+            p->states[x].out1 = c[copies - 1].start;
+            p->states[x].out2 = j;
+            wre_link(P, end, x);
+        }
+    } else {
+        wre_link(P, end, j);
+    }
+    free(c);
+    return (wre_frag){start, j, lo};
+}
+
+static wre_frag wre_parse_alt(struct wre_parser* P);
+
+static wre_frag wre_parse_bracket(struct wre_parser* P) {
+    const char* s = P->s;
+    unsigned char set[32];
+    memset(set, 0, sizeof(set));
+    bool negate = false, first = true;
+    P->pos++;                                  // '['
+    if (s[P->pos] == '^') { negate = true; P->pos++; }
+    for (;;) {
+        int c = (unsigned char)s[P->pos];
+        if (!c) { P->fail = true; return wre_one(0); }
+        if (c == ']' && !first) { P->pos++; break; }
+        first = false;
+        if (c == '[' && (s[P->pos+1] == '.' || s[P->pos+1] == '=')) { P->fail = true; return wre_one(0); }
+        if (c == '[' && s[P->pos+1] == ':') {
+            const char* name = s + P->pos + 2;
+            const char* close = strstr(name, ":]");
+            if (!close || !wre_cls_named(set, name, (int)(close - name))) { P->fail = true; return wre_one(0); }
+            P->pos = (int)(close - s) + 2;
             continue;
-        } else if (*p == ')') {
-            // Close group: concat everything since open paren, handle alternation
-            if (paren_sp > 0) {
-                paren_sp--;
-                // Concat fragments on stack since paren open
-                int base = paren_frag_sp[paren_sp];
-                while (sp > base + 1) {
-                    wre_frag f2 = stack[--sp];
-                    wre_frag f1 = stack[--sp];
-                    wre_patch(nfa, f1.end, f2.start);
-                    stack[sp++] = (wre_frag){f1.start, f2.end};
-                }
-                // Handle alternations within parens
-                int abase = paren_alt_sp[paren_sp];
-                while (alt_sp > abase && sp > 0) {
-                    alt_sp--;
-                    wre_frag cur = stack[--sp];
-                    wre_frag alt = alt_stack[alt_sp];
-                    int s = wre_add(nfa, WRE_SPLIT, 0);
-                    nfa->states[s].out1 = alt.start;
-                    nfa->states[s].out2 = cur.start;
-                    int e = wre_add(nfa, WRE_JMP, 0);
-                    wre_patch(nfa, alt.end, e);
-                    wre_patch(nfa, cur.end, e);
-                    stack[sp++] = (wre_frag){s, e};
-                }
-            }
-            p++;
-            // Pop the group result as our atom, then fall through to quantifier check
-            if (sp > 0) {
-                frag = stack[--sp];
-                have_atom = true;
+        }
+        if (c == '\\' && !(P->flags & WRE_STRICT) && s[P->pos+1]) {
+            // Non-strict (Windows) keeps its old reading of escapes inside brackets.
+            bool neg;
+            unsigned char esc[32];
+            memset(esc, 0, sizeof(esc));
+            if (wre_cls_escape(esc, (unsigned char)s[P->pos+1], &neg)) {
+                wre_cls_finish(esc, neg, 0);
+                for (int i = 0; i < 32; i++) set[i] |= esc[i];
             } else {
-                continue;
-            }
-        } else if (*p == '|') {
-            // Concat everything on stack first
-            while (sp > 1) {
-                wre_frag f2 = stack[--sp];
-                wre_frag f1 = stack[--sp];
-                wre_patch(nfa, f1.end, f2.start);
-                stack[sp++] = (wre_frag){f1.start, f2.end};
+                wre_cls_set(set, (unsigned char)s[P->pos+1]);
             }
-            if (sp > 0) alt_stack[alt_sp++] = stack[--sp];
-            p++;
+            P->pos += 2;
             continue;
-        } else if (*p == '.') {
-            int id = wre_add(nfa, WRE_DOT, 0);
-            frag = (wre_frag){id, id};
-            have_atom = true;
-            p++;
-        } else if (*p == '^') {
-            int id = wre_add(nfa, WRE_BOL, 0);
-            frag = (wre_frag){id, id};
-            have_atom = true;
-            p++;
-        } else if (*p == '$') {
-            int id = wre_add(nfa, WRE_EOL, 0);
-            frag = (wre_frag){id, id};
-            have_atom = true;
-            p++;
-        } else if (*p == '[') {
-            p++;
-            int adv = 0;
-            int id = wre_parse_class(nfa, p, &adv);
-            if (id < 0) return false;
-            frag = (wre_frag){id, id};
-            have_atom = true;
-            p += adv;
-        } else if (*p == '\\' && p[1]) {
-            p++;
-            int ch = (unsigned char)*p;
-            // Shorthand classes
-            if (*p == 'd' || *p == 'w' || *p == 's' || *p == 'D' || *p == 'W' || *p == 'S') {
-                bool neg = (*p >= 'A' && *p <= 'Z');
-                int id = wre_add(nfa, neg ? WRE_NCLASS : WRE_CLASS, 0);
-                char lower = neg ? (*p + 32) : *p;
-                if (lower == 'd') { for (int c = '0'; c <= '9'; c++) wre_cls_set(nfa->states[id].cls, c); }
-                else if (lower == 'w') { for (int c = 'a'; c <= 'z'; c++) wre_cls_set(nfa->states[id].cls, c); for (int c = 'A'; c <= 'Z'; c++) wre_cls_set(nfa->states[id].cls, c); for (int c = '0'; c <= '9'; c++) wre_cls_set(nfa->states[id].cls, c); wre_cls_set(nfa->states[id].cls, '_'); }
-                else if (lower == 's') { wre_cls_set(nfa->states[id].cls, ' '); wre_cls_set(nfa->states[id].cls, '\t'); wre_cls_set(nfa->states[id].cls, '\n'); wre_cls_set(nfa->states[id].cls, '\r'); }
-                frag = (wre_frag){id, id};
-            } else {
-                int id = wre_add(nfa, WRE_LITERAL, ch);
-                frag = (wre_frag){id, id};
-            }
-            have_atom = true;
-            p++;
+        }
+        P->pos++;
+        if (s[P->pos] == '-' && s[P->pos+1] && s[P->pos+1] != ']') {
+            int hi = (unsigned char)s[P->pos+1];
+            if (hi < c || hi == '[') { P->fail = true; return wre_one(0); }
+            wre_cls_range(set, c, hi);
+            P->pos += 2;
+            // "[a-c-e]" is an error in glibc; leave it to regcomp.
+            if (s[P->pos] == '-' && s[P->pos+1] != ']') { P->fail = true; return wre_one(0); }
         } else {
-            // Literal character
-            int id = wre_add(nfa, WRE_LITERAL, (unsigned char)*p);
-            frag = (wre_frag){id, id};
-            have_atom = true;
-            p++;
+            wre_cls_set(set, c);
         }
+    }
+    wre_cls_finish(set, negate, P->flags);
+    return wre_one(wre_add_cls(P, set));
+}
 
-        if (!have_atom) continue;
-
-        // Apply quantifiers
-        if (*p == '*') {
-            // a* = split(->atom, ->next); atom loops back to split
-            int s = wre_add(nfa, WRE_SPLIT, 0);
-            nfa->states[s].out1 = frag.start;  // try atom
-            nfa->states[s].out2 = -1;           // or skip (dangling = frag end)
-            wre_patch(nfa, frag.end, s);         // atom loops back to split
-            frag = (wre_frag){s, s};             // end is split (out2 is dangling)
-            p++;
-        } else if (*p == '+') {
-            // a+ = atom -> split(->atom, ->next)
-            int s = wre_add(nfa, WRE_SPLIT, 0);
-            nfa->states[s].out1 = frag.start;  // loop back
-            nfa->states[s].out2 = -1;           // or continue (dangling)
-            wre_patch(nfa, frag.end, s);         // atom -> split
-            frag = (wre_frag){frag.start, s};    // start at atom, end at split (out2 dangling)
-            p++;
-        } else if (*p == '?') {
-            // a? = split(->atom, ->next); atom -> next
-            int s = wre_add(nfa, WRE_SPLIT, 0);
-            nfa->states[s].out1 = frag.start;  // try atom
-            nfa->states[s].out2 = -1;           // or skip (dangling)
-            // Both split.out2 and frag.end need to go to next state
-            // Use a JMP to merge them
-            int j = wre_add(nfa, WRE_JMP, 0);
-            nfa->states[s].out2 = j;
-            wre_patch(nfa, frag.end, j);
-            frag = (wre_frag){s, j};
-            p++;
-        } else if (*p == '{') {
-            // {n}, {n,}, {n,m}
-            p++;
-            int n = 0, m = -1;
-            while (*p >= '0' && *p <= '9') { n = n * 10 + (*p - '0'); p++; }
-            if (*p == ',') {
-                p++;
-                if (*p >= '0' && *p <= '9') {
-                    m = 0;
-                    while (*p >= '0' && *p <= '9') { m = m * 10 + (*p - '0'); p++; }
-                }
-                // else m = -1 means unbounded
-            } else {
-                m = n; // {n} means exactly n
+static wre_frag wre_parse_atom(struct wre_parser* P) {
+    const char* s = P->s;
+    int c = (unsigned char)s[P->pos];
+    int lo = P->p->nstates;
+    switch (c) {
+        case '(': {
+            P->pos++;
+            if (++P->depth > 1000) { P->fail = true; return wre_one(0); }
+            wre_frag f = wre_parse_alt(P);
+            if (P->fail || s[P->pos] != ')') { P->fail = true; return f; }
+            P->pos++;
+            P->depth--;
+            f.lo = lo;
+            return f;
+        }
+        case '[':
+            return wre_parse_bracket(P);
+        case '.': {
+            unsigned char set[32];
+            memset(set, 0, sizeof(set));
+            wre_cls_finish(set, true, P->flags);
+            P->pos++;
+            return wre_one(wre_add_cls(P, set));
+        }
+        case '^': P->pos++; return wre_one(wre_add(P, WRE_BOL));
+        case '$': P->pos++; return wre_one(wre_add(P, WRE_EOL));
+        case '*': case '+': case '?': case '{':
+            P->fail = true;                    // quantifier with nothing to repeat
+            return wre_one(0);
+        case '\\': {
+            int e = (unsigned char)s[P->pos+1];
+            if (!e) { P->fail = true; return wre_one(0); }
+            P->pos += 2;
+            unsigned char set[32];
+            memset(set, 0, sizeof(set));
+            bool neg;
+            bool is_digit = (e | 0x20) == 'd';
+            if ((!is_digit || !(P->flags & WRE_STRICT)) && wre_cls_escape(set, e, &neg)) {
+                wre_cls_finish(set, neg, 0);   // \W takes '\n' even under REG_NEWLINE
+                return wre_one(wre_add_cls(P, set));
             }
-            if (*p == '}') p++;
-            // For simplicity, we handle {n,m} by expanding:
-            // Repeat the atom n times (required), then up to (m-n) optional times
-            // This is correct but can create many states for large counts
-            // We cap at reasonable values
-            if (n > 20) n = 20;
-            if (m > 20) m = 20;
-            // We already have one copy of the atom in frag. We need n-1 more required + optional.
-            // Rebuild: just push frag and let the concat handle it
-            // Actually, simplest: push frag n times, then push optional copies
-            // But we only have one frag. We need to "clone" the atom.
-            // For now, just push the single frag - this handles {1} and {0,1} correctly.
-            // Full {n,m} expansion would require cloning NFA fragments.
-            // This is a known simplification.
-            (void)n; (void)m;
+            bool alnum = (e >= 'a' && e <= 'z') || (e >= 'A' && e <= 'Z') || (e >= '0' && e <= '9');
+            if (alnum && (P->flags & WRE_STRICT)) { P->fail = true; return wre_one(0); }
+            int id = wre_add(P, WRE_LITERAL);
+            if (!P->fail) P->p->states[id].ch = (unsigned char)e;
+            return wre_one(id);
         }
+        default: {
+            P->pos++;
+            int id = wre_add(P, WRE_LITERAL);
+            if (!P->fail) P->p->states[id].ch = (unsigned char)c;
+            return wre_one(id);
+        }
+    }
+}
 
-        stack[sp++] = frag;
+static int wre_parse_int(struct wre_parser* P, bool* any) {
+    int v = 0;
+    *any = false;
+    while (P->s[P->pos] >= '0' && P->s[P->pos] <= '9') {
+        if (v <= WRE_MAX_REPEAT) v = v * 10 + (P->s[P->pos] - '0');
+        P->pos++;
+        *any = true;
     }
+    return v;
+}
 
-    // Concat remaining fragments
-    while (sp > 1) {
-        wre_frag f2 = stack[--sp];
-        wre_frag f1 = stack[--sp];
-        wre_patch(nfa, f1.end, f2.start);
-        stack[sp++] = (wre_frag){f1.start, f2.end};
+static wre_frag wre_parse_piece(struct wre_parser* P) {
+    int lo = P->p->nstates;
+    wre_frag f = wre_parse_atom(P);
+    if (P->fail) return f;
+    f.lo = lo;
+    int op = P->p->states[f.start].op;
+    bool anchor = f.start == f.end && (op == WRE_BOL || op == WRE_EOL);
+    for (;;) {
+        int c = P->s[P->pos];
+        int n, m;
+        if (c == '*') { n = 0; m = -1; }
+        else if (c == '+') { n = 1; m = -1; }
+        else if (c == '?') { n = 0; m = 1; }
+        else if (c == '{') {
+            bool has_n, has_m;
+            P->pos++;
+            n = wre_parse_int(P, &has_n);
+            if (P->s[P->pos] == ',') {
+                P->pos++;
+                m = wre_parse_int(P, &has_m);
+                if (!has_m) m = -1;
+                if (!has_n && !has_m) { P->fail = true; return f; }
+            } else {
+                if (!has_n) { P->fail = true; return f; }
+                m = n;
+            }
+            if (P->s[P->pos] != '}' || n > WRE_MAX_REPEAT || m > WRE_MAX_REPEAT || (m >= 0 && m < n)) {
+                P->fail = true;
+                return f;
+            }
+        } else {
+            break;
+        }
+        P->pos++;
+        if (anchor) { P->fail = true; return f; }
+        f = wre_repeat(P, f, n, m);
+        if (P->fail) return f;
     }
+    return f;
+}
 
-    // Handle top-level alternation
-    while (alt_sp > 0 && sp > 0) {
-        alt_sp--;
-        wre_frag cur = stack[--sp];
-        wre_frag alt = alt_stack[alt_sp];
-        int s = wre_add(nfa, WRE_SPLIT, 0);
-        nfa->states[s].out1 = alt.start;
-        nfa->states[s].out2 = cur.start;
-        int e = wre_add(nfa, WRE_JMP, 0);
-        wre_patch(nfa, alt.end, e);
-        wre_patch(nfa, cur.end, e);
-        stack[sp++] = (wre_frag){s, e};
+static wre_frag wre_parse_branch(struct wre_parser* P) {
+    int lo = P->p->nstates;
+    wre_frag acc = {-1, -1, lo};
+    while (!P->fail && P->s[P->pos] && P->s[P->pos] != '|' && P->s[P->pos] != ')') {
+        wre_frag f = wre_parse_piece(P);
+        if (P->fail) return acc;
+        // glibc gives a ^ or $ inside a group or in the middle of a branch a
+        // line-break reading of its own, so strict mode only takes them at the
+        // edges of a top-level branch.
+        int op = P->p->states[f.start].op;
+        if ((P->flags & WRE_STRICT) && f.start == f.end && (op == WRE_BOL || op == WRE_EOL) &&
+            (P->depth > 0 || (op == WRE_BOL && acc.start >= 0) ||
+             (op == WRE_EOL && P->s[P->pos] && P->s[P->pos] != '|' && P->s[P->pos] != ')'))) {
+            P->fail = true;
+            return acc;
+        }
+        if (acc.start < 0) acc.start = f.start; else wre_link(P, acc.end, f.start);
+        acc.end = f.end;
     }
+    if (acc.start < 0) acc = wre_one(wre_add(P, WRE_JMP));   // empty branch, as in "a|" or "()"
+    acc.lo = lo;
+    return acc;
+}
+
+static wre_frag wre_parse_alt(struct wre_parser* P) {
+    int lo = P->p->nstates;
+    wre_frag f = wre_parse_branch(P);
+    if (P->fail || P->s[P->pos] != '|') return f;
+    int j = wre_add(P, WRE_JMP);
+    wre_link(P, f.end, j);
+    int top = f.start, tail = -1, prev = f.start;
+    while (!P->fail && P->s[P->pos] == '|') {
+        P->pos++;
+        wre_frag g = wre_parse_branch(P);
+        int x = wre_add(P, WRE_SPLIT);
+        if (P->fail) break;
+        wre_link(P, g.end, j);
+        P->p->states[x].out1 = prev;
+        P->p->states[x].out2 = g.start;
+        if (tail < 0) top = x; else P->p->states[tail].out2 = x;
+        tail = x;
+        prev = g.start;
+    }
+    return (wre_frag){top, j, lo};
+}
 
-    if (sp != 1) return false;
+// --- Closures and set stepping (shared by the DFA builder and the NFA fallback) ---
 
-    // Add match state
-    int match_id = wre_add(nfa, WRE_MATCH, 0);
-    wre_patch(nfa, stack[0].end, match_id);
-    nfa->start = stack[0].start;
-    return true;
+static bool wre_scratch_init(struct wre_scratch* w, int n) {
+    w->a = malloc(sizeof(int) * n);
+    w->b = malloc(sizeof(int) * n);
+    w->c = malloc(sizeof(int) * n);
+    w->stack = malloc(sizeof(int) * (2 * n + 2));
+    w->mark = calloc(n, sizeof(unsigned));
+    w->gen = 0;
+    return w->a && w->b && w->c && w->stack && w->mark;
 }
 
-// --- NFA simulation (Thompson's algorithm) ---
+static void wre_scratch_free(struct wre_scratch* w) {
+    free(w->a); free(w->b); free(w->c); free(w->stack); free(w->mark);
+}
 
-static bool wre_state_matches(struct wre_state* s, int ch) {
-    switch (s->op) {
-        case WRE_LITERAL: return ch == s->ch;
-        case WRE_DOT: return ch != '\n' && ch != '\0';
-        case WRE_CLASS: return wre_cls_test(s->cls, ch);
-        case WRE_NCLASS: return ch != '\n' && ch != '\0' && !wre_cls_test(s->cls, ch);
-        default: return false;
+static unsigned wre_gen(struct wre_scratch* w, int n) {
+    if (++w->gen == 0) { memset(w->mark, 0, sizeof(unsigned) * n); w->gen = 1; }
+    return w->gen;
+}
+
+// Add the epsilon closure of sid to ids. ^ is followed when bol is set, $ when
+// eol is set; an unresolved $ stays in the set. States already marked with the
+// current generation are skipped, so several closures can union into one set.
+static void wre_closure(const struct wre_prog* p, struct wre_scratch* w, int sid, int bol, int eol, int* ids, int* n) {
+    int sp = 0;
+    unsigned g = w->gen;
+    if (sid < 0) return;
+    w->stack[sp++] = sid;
+    while (sp) {
+        int id = w->stack[--sp];
+        if (id < 0 || w->mark[id] == g) continue;
+        w->mark[id] = g;
+        const struct wre_state* st = &p->states[id];
+        switch (st->op) {
+            case WRE_SPLIT: w->stack[sp++] = st->out2; w->stack[sp++] = st->out1; break;
+            case WRE_JMP: w->stack[sp++] = st->out1; break;
+            case WRE_BOL: if (bol) w->stack[sp++] = st->out1; break;
+            case WRE_EOL: if (eol) w->stack[sp++] = st->out1; else ids[(*n)++] = id; break;
+            default: ids[(*n)++] = id; break;
+        }
+    }
+}
+
+static bool wre_consumes(const struct wre_prog* p, const struct wre_state* st, int c) {
+    return st->op == WRE_LITERAL ? st->ch == c : st->op == WRE_CLASS && wre_cls_test(p->cls[st->cls], c);
+}
+
+// Whether the set accepts here; with eol, after resolving its pending $ states.
+static bool wre_accepts(const struct wre_prog* p, struct wre_scratch* w, const int* set, int n, int bol, int eol) {
+    if (eol) {
+        int m = 0;
+        wre_gen(w, p->nstates);
+        for (int i = 0; i < n; i++) wre_closure(p, w, set[i], bol, 1, w->c, &m);
+        set = w->c;
+        n = m;
     }
+    for (int i = 0; i < n; i++) if (p->states[set[i]].op == WRE_MATCH) return true;
+    return false;
 }
 
-// Add state (and epsilon-reachable states) to set
-static void wre_addstate(struct wre_nfa* nfa, int* set, int* nset, bool* inset, int sid, const char* str, int pos) {
-    if (sid < 0 || sid >= nfa->nstates || inset[sid]) return;
-    struct wre_state* s = &nfa->states[sid];
-    if (s->op == WRE_SPLIT) {
-        inset[sid] = true;
-        wre_addstate(nfa, set, nset, inset, s->out1, str, pos);
-        wre_addstate(nfa, set, nset, inset, s->out2, str, pos);
-        return;
+// The set after consuming byte c at a position whose line-start flag is bol.
+static int wre_step(const struct wre_prog* p, struct wre_scratch* w, const int* src, int n, int bol, int c, int unanch, int* out) {
+    int nl = (p->flags & WRE_NEWLINE) && c == '\n';
+    if (nl) {                      // the '\n' satisfies every pending $ at this position
+        int m = 0;
+        wre_gen(w, p->nstates);
+        for (int i = 0; i < n; i++) wre_closure(p, w, src[i], bol, 1, w->c, &m);
+        src = w->c;
+        n = m;
+    }
+    int k = 0;
+    wre_gen(w, p->nstates);
+    for (int i = 0; i < n; i++) {
+        const struct wre_state* st = &p->states[src[i]];
+        if (wre_consumes(p, st, c)) wre_closure(p, w, st->out1, nl, 0, out, &k);
     }
-    if (s->op == WRE_JMP) {
-        inset[sid] = true;
-        wre_addstate(nfa, set, nset, inset, s->out1, str, pos);
-        return;
+    if (unanch) wre_closure(p, w, p->start, nl, 0, out, &k);
+    return k;
+}
+
+static int wre_bol_at(const struct wre_prog* p, const unsigned char* s, long pos) {
+    return pos == 0 || ((p->flags & WRE_NEWLINE) && s[pos-1] == '\n');
+}
+
+static int wre_eol_at(const struct wre_prog* p, const unsigned char* s, long len, long pos) {
+    return pos == len || ((p->flags & WRE_NEWLINE) && s[pos] == '\n');
+}
+
+// --- Prefilters ---
+
+// Next position >= from where the literal prefix occurs, or -1. SSE2 checks 16
+// candidate starts at once by comparing both the first and the last prefix
+// byte, then confirms the middle with memcmp.
+static long wre_find_prefix(const struct wre_prog* p, const unsigned char* s, long len, long from) {
+    int m = p->prefix_len;
+    const unsigned char* n = p->prefix;
+    long last = len - m;
+    if (from > last) return -1;
+    if (m == 1) {
+        const unsigned char* r = memchr(s + from, n[0], (size_t)(len - from));
+        return r ? (long)(r - s) : -1;
     }
-    if (s->op == WRE_BOL) {
-        if (pos == 0 || (pos > 0 && str[pos-1] == '\n')) {
-            inset[sid] = true;
-            wre_addstate(nfa, set, nset, inset, s->out1, str, pos);
+    long i = from;
+#ifdef WRE_SSE2
+    __m128i vf = _mm_set1_epi8((char)n[0]), vl = _mm_set1_epi8((char)n[m-1]);
+    for (; i + 15 <= last; i += 16) {
+        __m128i bf = _mm_loadu_si128((const __m128i*)(s + i));
+        __m128i bl = _mm_loadu_si128((const __m128i*)(s + i + m - 1));
+        unsigned mask = (unsigned)_mm_movemask_epi8(_mm_and_si128(_mm_cmpeq_epi8(vf, bf), _mm_cmpeq_epi8(vl, bl)));
+        while (mask) {
+            int b = __builtin_ctz(mask);
+            if (memcmp(s + i + b + 1, n + 1, (size_t)(m - 2)) == 0) return i + b;
+            mask &= mask - 1;
         }
-        return;
     }
-    if (s->op == WRE_EOL) {
-        if (str[pos] == '\0' || str[pos] == '\n') {
-            inset[sid] = true;
-            wre_addstate(nfa, set, nset, inset, s->out1, str, pos);
+#endif
+    while (i <= last) {
+        const unsigned char* r = memchr(s + i, n[0], (size_t)(last - i + 1));
+        if (!r) return -1;
+        i = (long)(r - s);
+        if (s[i + m - 1] == n[m-1] && memcmp(s + i + 1, n + 1, (size_t)(m - 2)) == 0) return i;
+        i++;
+    }
+    return -1;
+}
+
+// Next position >= from whose byte can begin a match, or -1. Alternations of
+// literals ("GET|POST") have few distinct first bytes; those are compared 16
+// positions at a time.
+static long wre_find_first(const struct wre_prog* p, const unsigned char* s, long len, long from) {
+    if (p->first_n == 1) {
+        const unsigned char* r = from < len ? memchr(s + from, p->first_bytes[0], (size_t)(len - from)) : NULL;
+        return r ? (long)(r - s) : -1;
+    }
+#ifdef WRE_SSE2
+    if (p->first_n > 1) {
+        __m128i b0 = _mm_set1_epi8((char)p->first_bytes[0]);
+        __m128i b1 = _mm_set1_epi8((char)p->first_bytes[1]);
+        __m128i b2 = _mm_set1_epi8((char)p->first_bytes[p->first_n - 1]);
+        for (; from + 16 <= len; from += 16) {
+            __m128i v = _mm_loadu_si128((const __m128i*)(s + from));
+            __m128i eq = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(v, b0), _mm_cmpeq_epi8(v, b1)), _mm_cmpeq_epi8(v, b2));
+            unsigned mask = (unsigned)_mm_movemask_epi8(eq);
+            if (mask) return from + __builtin_ctz(mask);
         }
-        return;
     }
-    inset[sid] = true;
-    set[(*nset)++] = sid;
+#endif
+    while (from < len && !wre_cls_test(p->first, s[from])) from++;
+    return from < len ? from : -1;
 }
 
-// Try to match starting at str[pos]. Returns length of match, or -1.
-static int wre_exec_at(struct wre_nfa* nfa, const char* str, int pos) {
-    int cset[WRE_MAX_STATES], nset[WRE_MAX_STATES];
-    int cn = 0, nn = 0;
-    bool cinset[WRE_MAX_STATES], ninset[WRE_MAX_STATES];
-    memset(cinset, 0, sizeof(cinset));
+static long wre_candidate(const struct wre_prog* p, const unsigned char* s, long len, long from) {
+    if (p->prefix_len) return wre_find_prefix(p, s, len, from);
+    if (p->skip_first) return wre_find_first(p, s, len, from);
+    return from;
+}
 
-    wre_addstate(nfa, cset, &cn, cinset, nfa->start, str, pos);
+// --- Lazy DFA ---
 
-    int last_match = -1;
-    // Check if start state already matches (empty pattern)
-    for (int i = 0; i < cn; i++) {
-        if (nfa->states[cset[i]].op == WRE_MATCH) { last_match = 0; break; }
+static void wre_lock(struct wre_prog* p) {
+    while (atomic_flag_test_and_set_explicit(&p->lock, memory_order_acquire)) wre_yield();
+}
+static void wre_unlock(struct wre_prog* p) { atomic_flag_clear_explicit(&p->lock, memory_order_release); }
+
+static int wre_int_cmp(const void* a, const void* b) { return *(const int*)a - *(const int*)b; }
+
+// Find or add the DFA state for (set, bol). Caller holds the lock. Returns the
+// encoded state, or -1 when the table is full or out of memory.
+static int wre_intern(struct wre_prog* p, struct wre_dfa* d, int* set, int n, int bol) {
+    if (n > 1) qsort(set, (size_t)n, sizeof(int), wre_int_cmp);
+    unsigned h = 2166136261u ^ (unsigned)bol;
+    for (int i = 0; i < n; i++) h = (h ^ (unsigned)set[i]) * 16777619u;
+    int* bucket = &d->buckets[h % WRE_DFA_BUCKETS];
+    for (int t = *bucket; t; t = d->st[t].chain) {
+        struct wre_dstate* ds = &d->st[t];
+        if (ds->hash == h && ds->n == n && ds->bol == bol && memcmp(d->pool + ds->off, set, sizeof(int) * n) == 0)
+            return ds->enc;
+    }
+    int t = d->nst;
+    if (t >= WRE_DFA_MAX) return -1;
+    if (t == d->st_cap) {
+        int ncap = d->st_cap * 2;
+        struct wre_dstate* ns = realloc(d->st, sizeof(struct wre_dstate) * ncap);
+        if (!ns) return -1;
+        d->st = ns; d->st_cap = ncap;
     }
+    if (d->pool_n + n > d->pool_cap) {
+        long ncap = (d->pool_cap + n) * 2;
+        int* np = realloc(d->pool, sizeof(int) * ncap);
+        if (!np) return -1;
+        d->pool = np; d->pool_cap = ncap;
+    }
+    if (!d->rows[t / WRE_DFA_BLK]) {
+        d->rows[t / WRE_DFA_BLK] = calloc((size_t)WRE_DFA_BLK * p->nbytes, sizeof(_Atomic int));
+        if (!d->rows[t / WRE_DFA_BLK]) return -1;
+    }
+    memcpy(d->pool + d->pool_n, set, sizeof(int) * n);
+    struct wre_dstate* ds = &d->st[t];
+    ds->off = (int)d->pool_n;
+    ds->n = n;
+    ds->hash = h;
+    ds->bol = (unsigned char)bol;
+    ds->chain = *bucket;
+    d->pool_n += n;
+    // An empty set can never match again, except in line mode where an
+    // unanchored scan restarts after the next '\n'.
+    int dead = n == 0 && !(d->unanch && (p->flags & WRE_NEWLINE));
+    int acc = wre_accepts(p, &p->w, d->pool + ds->off, n, bol, 0);
+    int acc_eol = acc || wre_accepts(p, &p->w, d->pool + ds->off, n, bol, 1);
+    ds->enc = t << 3 | dead << 2 | acc_eol << 1 | acc;
+    *bucket = t;
+    d->nst++;
+    return ds->enc;
+}
 
-    int i = pos;
-    while (str[i] != '\0') {
-        nn = 0;
-        memset(ninset, 0, sizeof(ninset));
-        int ch = (unsigned char)str[i];
-        for (int j = 0; j < cn; j++) {
-            struct wre_state* s = &nfa->states[cset[j]];
-            if (wre_state_matches(s, ch)) {
-                wre_addstate(nfa, nset, &nn, ninset, s->out1, str, i + 1);
-            }
+static struct wre_dfa* wre_get_dfa(struct wre_prog* p, int unanch) {
+    struct wre_dfa* d = atomic_load_explicit(&p->dfa[unanch], memory_order_acquire);
+    if (d) return d;
+    wre_lock(p);
+    d = atomic_load_explicit(&p->dfa[unanch], memory_order_relaxed);
+    if (!d) {
+        d = calloc(1, sizeof(struct wre_dfa));
+        if (d) {
+            d->unanch = unanch;
+            d->nst = 1;                        // 0 stays free: a zero cell means "not built"
+            d->st_cap = 64;
+            d->st = calloc((size_t)d->st_cap, sizeof(struct wre_dstate));
+            if (!d->st) { free(d); d = NULL; }
         }
-        // Check for match in new set
-        for (int j = 0; j < nn; j++) {
-            if (nfa->states[nset[j]].op == WRE_MATCH) {
-                last_match = (i + 1) - pos;
-                break;
-            }
+        if (d) atomic_store_explicit(&p->dfa[unanch], d, memory_order_release);
+    }
+    wre_unlock(p);
+    return d;
+}
+
+static int wre_dfa_start(struct wre_prog* p, struct wre_dfa* d, int bol) {
+    int v = atomic_load_explicit(&d->start[bol], memory_order_acquire);
+    if (v) return v;
+    wre_lock(p);
+    v = atomic_load_explicit(&d->start[bol], memory_order_relaxed);
+    if (!v) {
+        int n = 0;
+        wre_gen(&p->w, p->nstates);
+        wre_closure(p, &p->w, p->start, bol, 0, p->w.b, &n);
+        v = wre_intern(p, d, p->w.b, n, bol);
+        if (v > 0) atomic_store_explicit(&d->start[bol], v, memory_order_release);
+    }
+    wre_unlock(p);
+    return v;
+}
+
+// Build the transition out of encoded state v on byte c.
+static int wre_dfa_fill(struct wre_prog* p, struct wre_dfa* d, int v, int c) {
+    int t = v >> 3;
+    _Atomic int* cell = &d->rows[t / WRE_DFA_BLK][(t % WRE_DFA_BLK) * p->nbytes + p->bytemap[c]];
+    wre_lock(p);
+    int nv = atomic_load_explicit(cell, memory_order_relaxed);
+    if (!nv) {
+        struct wre_dstate ds = d->st[t];
+        int nl = (p->flags & WRE_NEWLINE) && c == '\n';
+        // wre_step reads the source set while writing b; copy it out of the pool
+        // first, because interning the result may move the pool.
+        memcpy(p->w.a, d->pool + ds.off, sizeof(int) * ds.n);
+        int n = wre_step(p, &p->w, p->w.a, ds.n, ds.bol, c, d->unanch, p->w.b);
+        nv = wre_intern(p, d, p->w.b, n, nl);
+        if (nv > 0) atomic_store_explicit(cell, nv, memory_order_release);
+    }
+    wre_unlock(p);
+    return nv;
+}
+
+// Run the DFA from `from`. Anchored: end of the longest match starting there.
+// Unanchored: end of the earliest-ending match anywhere after it.
+// -1 = no match, -2 = the DFA is full (the caller reruns on the NFA).
+static long wre_dfa_run(struct wre_prog* p, const unsigned char* s, long len, long from, int unanch) {
+    struct wre_dfa* d = wre_get_dfa(p, unanch);
+    if (!d) return -2;
+    int v = wre_dfa_start(p, d, wre_bol_at(p, s, from));
+    if (v < 0) return -2;
+    int idle0 = 0, idle1 = 0;
+    if (unanch && (p->prefix_len || p->skip_first)) {
+        idle0 = wre_dfa_start(p, d, 0);
+        idle1 = wre_dfa_start(p, d, 1);
+        if (idle0 < 0 || idle1 < 0) return -2;
+    }
+    const unsigned char* map = p->bytemap;
+    int nb = p->nbytes;
+    long last = -1, pos = from;
+    for (;;) {
+        if ((v & 1) || ((v & 2) && wre_eol_at(p, s, len, pos))) {
+            if (unanch) return pos;
+            last = pos;
         }
-        if (nn == 0) break;
-        memcpy(cset, nset, nn * sizeof(int));
-        cn = nn;
-        memcpy(cinset, ninset, sizeof(cinset));
-        i++;
+        if (pos >= len || (v & 4)) break;
+        if (idle0 && (v == idle0 || v == idle1)) {
+            // Nothing in flight: jump to the next place a match can begin.
+            long c = wre_candidate(p, s, len, pos);
+            if (c < 0) break;
+            if (c != pos) { pos = c; v = wre_bol_at(p, s, pos) ? idle1 : idle0; }
+        }
+        int t = v >> 3;
+        int nv = atomic_load_explicit(&d->rows[t / WRE_DFA_BLK][(t % WRE_DFA_BLK) * nb + map[s[pos]]], memory_order_acquire);
+        if (!nv) {
+            nv = wre_dfa_fill(p, d, v, s[pos]);
+            if (nv < 0) return -2;
+        }
+        v = nv;
+        pos++;
+    }
+    return unanch ? -1 : last;
+}
+
+// Same contract as wre_dfa_run, simulating the NFA set by set with private scratch.
+static long wre_nfa_run(const struct wre_prog* p, const unsigned char* s, long len, long from, int unanch) {
+    struct wre_scratch w;
+    long last = -1, pos = from;
+    if (!wre_scratch_init(&w, p->nstates)) { wre_scratch_free(&w); return -1; }
+    int* cur = w.a;
+    int* nxt = w.b;
+    int bol = wre_bol_at(p, s, from), n = 0;
+    wre_gen(&w, p->nstates);
+    wre_closure(p, &w, p->start, bol, 0, cur, &n);
+    for (;;) {
+        if (wre_accepts(p, &w, cur, n, bol, wre_eol_at(p, s, len, pos))) {
+            last = pos;
+            if (unanch) break;
+        }
+        if (pos >= len || (n == 0 && !unanch)) break;
+        int c = s[pos];
+        int k = wre_step(p, &w, cur, n, bol, c, unanch, nxt);
+        int* tmp = cur; cur = nxt; nxt = tmp;
+        n = k;
+        bol = (p->flags & WRE_NEWLINE) && c == '\n';
+        pos++;
     }
-    return last_match;
+    wre_scratch_free(&w);
+    return last;
 }
 
-// --- Public API (matches POSIX regex API used by Wyn) ---
+static long wre_run(struct wre_prog* p, const unsigned char* s, long len, long from, int unanch) {
+    long r = wre_dfa_run(p, s, len, from, unanch);
+    return r == -2 ? wre_nfa_run(p, s, len, from, unanch) : r;
+}
 
-static bool wre_match_full(const char* str, const char* pattern) {
-    struct wre_nfa nfa;
-    if (!wre_compile(&nfa, pattern)) return false;
-    // Try match at every position (unanchored)
-    for (int i = 0; str[i] || i == 0; i++) {
-        int len = wre_exec_at(&nfa, str, i);
-        if (len >= 0) return true;
-        if (str[i] == '\0') break;
+// --- Analysis done once at compile time ---
+
+// Partition bytes into classes no state can tell apart, so DFA rows are
+// nbytes wide instead of 256.
+static void wre_refine(unsigned char map[256], int* n, const unsigned char set[32]) {
+    int remap[512];
+    int cnt = 0;
+    for (int i = 0; i < 512; i++) remap[i] = -1;
+    for (int b = 0; b < 256; b++) {
+        int key = map[b] * 2 + wre_cls_test(set, b);
+        if (remap[key] < 0) remap[key] = cnt++;
+        map[b] = (unsigned char)remap[key];
     }
-    return false;
+    *n = cnt;
 }
 
-// Find first match, return {start, end} or {-1, -1}
-static void wre_find(const char* str, const char* pattern, int* out_start, int* out_end) {
-    struct wre_nfa nfa;
-    *out_start = -1; *out_end = -1;
-    if (!wre_compile(&nfa, pattern)) return;
-    for (int i = 0; str[i] || i == 0; i++) {
-        int len = wre_exec_at(&nfa, str, i);
-        if (len >= 0) {
-            *out_start = i;
-            *out_end = i + len;
-            return;
+static void wre_analyze(struct wre_prog* p) {
+    unsigned char lits[32], one[32];
+    memset(lits, 0, sizeof(lits));
+    memset(p->bytemap, 0, sizeof(p->bytemap));
+    p->nbytes = 1;
+    for (int i = 0; i < p->nstates; i++)
+        if (p->states[i].op == WRE_LITERAL) wre_cls_set(lits, p->states[i].ch);
+    for (int c = 0; c < 256; c++) {
+        if (!wre_cls_test(lits, c) && !(c == '\n' && (p->flags & WRE_NEWLINE))) continue;
+        memset(one, 0, sizeof(one));
+        wre_cls_set(one, c);
+        wre_refine(p->bytemap, &p->nbytes, one);
+    }
+    for (int i = 0; i < p->ncls; i++) wre_refine(p->bytemap, &p->nbytes, p->cls[i]);
+
+    // With ^ and $ read as always true, the sets below over-approximate every
+    // real run, so what they prove holds for all matches.
+    struct wre_scratch* w = &p->w;
+    int n = 0;
+    wre_gen(w, p->nstates);
+    wre_closure(p, w, p->start, 1, 1, w->a, &n);
+    memset(p->first, 0, sizeof(p->first));
+    p->skip_first = 1;
+    for (int i = 0; i < n; i++) {
+        const struct wre_state* st = &p->states[w->a[i]];
+        if (st->op == WRE_MATCH) p->skip_first = 0;
+        else if (st->op == WRE_LITERAL) wre_cls_set(p->first, st->ch);
+        else for (int k = 0; k < 32; k++) p->first[k] |= p->cls[st->cls][k];
+    }
+    p->first_n = 0;
+    for (int c = 1; c < 256 && p->first_n <= 3; c++)
+        if (wre_cls_test(p->first, c) && p->first_n++ < 3) p->first_bytes[p->first_n - 1] = (unsigned char)c;
+    if (p->first_n > 3) p->first_n = 0;
+    int* cur = w->a;
+    int* nxt = w->b;
+    p->prefix_len = 0;
+    while (p->skip_first && n > 0 && p->prefix_len < WRE_PREFIX_MAX) {
+        int ch = -1;
+        for (int i = 0; i < n && ch != -2; i++) {
+            const struct wre_state* st = &p->states[cur[i]];
+            if (st->op != WRE_LITERAL || (ch >= 0 && st->ch != ch)) ch = -2;
+            else ch = st->ch;
         }
-        if (str[i] == '\0') break;
+        if (ch < 0) break;
+        p->prefix[p->prefix_len++] = (unsigned char)ch;
+        int k = 0;
+        wre_gen(w, p->nstates);
+        for (int i = 0; i < n; i++) wre_closure(p, w, p->states[cur[i]].out1, 1, 1, nxt, &k);
+        int* tmp = cur; cur = nxt; nxt = tmp;
+        n = k;
+        for (int i = 0; i < n; i++) if (p->states[cur[i]].op == WRE_MATCH) n = 0;
     }
 }
 
+// --- Public API ---
+
+static void wre_free(struct wre_prog* p) {
+    if (!p) return;
+    for (int u = 0; u < 2; u++) {
+        struct wre_dfa* d = atomic_load_explicit(&p->dfa[u], memory_order_relaxed);
+        if (!d) continue;
+        for (int i = 0; i < WRE_DFA_MAX / WRE_DFA_BLK; i++) free((void*)d->rows[i]);
+        free(d->st);
+        free(d->pool);
+        free(d);
+    }
+    wre_scratch_free(&p->w);
+    free(p->states);
+    free(p->cls);
+    free(p);
+}
+
+// Compile pattern with WRE_* flags. NULL when it is invalid or, under
+// WRE_STRICT, declined.
+static struct wre_prog* wre_compile(const char* pattern, int flags) {
+    struct wre_prog* p = calloc(1, sizeof(struct wre_prog));
+    if (!p) return NULL;
+    atomic_flag_clear(&p->lock);
+    p->flags = flags;
+    struct wre_parser P = {p, pattern, 0, flags, 0, false};
+    wre_frag f = wre_parse_alt(&P);
+    if (!P.fail && pattern[P.pos] != '\0') P.fail = true;   // unmatched ')'
+    int m = wre_add(&P, WRE_MATCH);
+    if (P.fail) { wre_free(p); return NULL; }
+    p->states[f.end].out1 = m;
+    p->start = f.start;
+    if (!wre_scratch_init(&p->w, p->nstates)) { wre_free(p); return NULL; }
+    wre_analyze(p);
+    return p;
+}
+
+// Whether s[0..len) contains a match.
+static bool wre_test(struct wre_prog* p, const char* s, long len) {
+    return wre_run(p, (const unsigned char*)s, len, 0, 1) >= 0;
+}
+
+// Leftmost-longest match starting at or after `from`, as [*ms, *me).
+// The unanchored pass finds where the earliest match ends. The leftmost match
+// starts no later than that, so only candidates up to it get an anchored
+// longest-match run.
+static bool wre_search(struct wre_prog* p, const char* str, long len, long from, long* ms, long* me) {
+    const unsigned char* s = (const unsigned char*)str;
+    long e = wre_run(p, s, len, from, 1);
+    if (e < 0) return false;
+    for (long i = from; i <= e; i++) {
+        i = wre_candidate(p, s, len, i);
+        if (i < 0 || i > e) break;
+        long end = wre_run(p, s, len, i, 0);
+        if (end >= 0) { *ms = i; *me = end; return true; }
+    }
+    return false;
+}
+
 #endif // WYN_REGEX_H
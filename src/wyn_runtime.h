@@ -10,6 +10,8 @@ void wyn_rc_retain(const void* ptr);
 void wyn_rc_release(const void* ptr);
 void wyn_rc_set_length(const void* ptr, unsigned int len);
 unsigned int wyn_rc_get_length(const void* ptr);
+const void* wyn_rc_share(const void* ptr);
+int wyn_rc_is_unique(const void* ptr);
 
 // Inline spawn for non-yielding functions (spawn_fast.c)
 struct Future;
@@ -173,6 +175,8 @@ static inline char* wyn_sb_finish(WynStrBuf* sb) {
 #include "future.h"
 #include "coroutine.h"
 #include "io_loop.h"
+#include "http_client.h"
+#include "dns.h"
 #include "optional.h"
 #include "result.h"
 #include "hashmap.h"
@@ -245,6 +249,57 @@ const char* wyn_string_concat_safe(const char* left, const char* right) {
     return r;
 }
 
+// `s = s + a + ...` / `s += a` where codegen has established that s is a string
+// the current function owns (not a parameter or a local aliased from one) and
+// that no piece mentions s - see string_append_pieces in codegen_expr.c.
+// UNLIKE wyn_string_concat_safe this MAY return `left` itself: when left is an
+// RC heap string whose only counted reference is the variable being assigned
+// (wyn_rc_is_unique - the same fact the assignment already relies on when it
+// releases the old value) and the pieces fit its spare capacity, they are
+// written in place. Otherwise the result is a fresh buffer rounded up to a
+// power of two, so a build-up loop grows geometrically and copies each byte
+// O(1) times amortized instead of re-copying the whole prefix per iteration.
+// A piece that points into left's buffer (an uncounted alias) forces the copy
+// path, so an in-place write never reads bytes it is overwriting. The caller
+// releases `left` only when the returned pointer differs.
+const char* wyn_string_append_owned(const char* left, const char** parts, const size_t* lens, int n) {
+    extern int wyn_rc_is_heap(const void*);
+    typedef struct { unsigned int magic; _Atomic int refcount; unsigned int capacity; unsigned int length; unsigned int magic2; } RcHdr;
+    if (!left) left = "";
+    size_t add = 0;
+    for (int i = 0; i < n; i++) add += lens[i];
+    RcHdr* h = NULL;
+    size_t l1;
+    if (wyn_rc_is_heap(left)) {
+        h = (RcHdr*)((char*)left - sizeof(RcHdr));
+        l1 = h->length ? h->length : strlen(left);
+    } else {
+        l1 = strlen(left);
+    }
+    size_t need = l1 + add + 1;
+    if (h && need <= h->capacity && wyn_rc_is_unique(left)) {
+        int aliased = 0;
+        for (int i = 0; i < n; i++)
+            if (parts[i] >= left && parts[i] < left + h->capacity) { aliased = 1; break; }
+        if (!aliased) {
+            char* w = (char*)left + l1;
+            for (int i = 0; i < n; i++) { memcpy(w, parts[i], lens[i]); w += lens[i]; }
+            *w = 0;
+            h->length = (unsigned int)(l1 + add);
+            return left;
+        }
+    }
+    size_t cap = need < 64 ? 64 : need;
+    cap--; cap |= cap >> 1; cap |= cap >> 2; cap |= cap >> 4; cap |= cap >> 8; cap |= cap >> 16; cap |= cap >> 32; cap++;
+    char* r = wyn_str_alloc(cap);
+    memcpy(r, left, l1);
+    char* w = r + l1;
+    for (int i = 0; i < n; i++) { memcpy(w, parts[i], lens[i]); w += lens[i]; }
+    *w = 0;
+    if (wyn_rc_is_heap(r)) ((RcHdr*)((char*)r - sizeof(RcHdr)))->length = (unsigned int)(l1 + add);
+    return r;
+}
+
 // Test module
 void Test_init(const char* suite_name);
 void Test_assert(int condition, const char* message);
@@ -325,126 +380,349 @@ void json_set_string(WynJson* json, const char* key, const char* value);
 void json_set_int(WynJson* json, const char* key, int value);
 char* json_stringify(WynJson* json);
 
-// Regex module - portable regex
-#ifdef _WIN32
+// Regex module. Both APIs run on one compiled WynRegex:
+//   - Regex.match/replace/find/find_all/split(str, pattern) look the pattern up
+//     in an LRU of compiled regexes (WYN_REGEX_CACHE entries, default 64, 0 = off).
+//     A loop matching millions of lines against one pattern compiles it once,
+//     where it used to pay regcomp + regfree on every call.
+//   - Regex.compile(pattern) returns a handle (-1 if the pattern is invalid) for
+//     Regex.is_match/find_in/replace_in/find_all_in/split_in. Regex.free releases it.
+// Matching runs on the wre lazy DFA (wyn_regex.h). On POSIX the engine runs
+// strict, and any pattern it declines goes to regcomp, so results stay glibc's
+// ERE. Windows keeps the line mode it has always had: ., ^ and $ stop at '\n'.
+// Repeated matches walk offsets into the original string. That way ^ only
+// matches at the real start, and an empty match advances one byte instead of
+// looping forever.
 #include "wyn_regex.h"
-bool regex_match(const char* str, const char* pattern) { return wre_match_full(str, pattern); }
-char* regex_replace(const char* str, const char* pattern, const char* replacement) {
-    struct wre_nfa nfa;
-    if (!wre_compile(&nfa, pattern)) return wyn_strdup(str);
-    int slen = (int)strlen(str);
-    int rlen = (int)strlen(replacement);
-    size_t cap = slen + rlen * 4 + 64;
-    char* result = wyn_str_alloc(cap);
-    size_t ri = 0;
-    int pos = 0;
-    while (pos <= slen) {
-        int ms, me;
-        wre_find(str + pos, pattern, &ms, &me);
-        if (ms < 0 || me <= ms) { size_t tail = slen - pos; if (ri + tail >= cap) { cap = (ri + tail) * 2; char* nr = wyn_str_alloc(cap); memcpy(nr, result, ri); wyn_rc_release(result); result = nr; } memcpy(result + ri, str + pos, tail); ri += tail; break; }
-        size_t needed = ri + ms + rlen;
-        if (needed >= cap) { cap = needed * 2; char* nr = wyn_str_alloc(cap); memcpy(nr, result, ri); wyn_rc_release(result); result = nr; }
-        memcpy(result + ri, str + pos, ms); ri += ms;
-        memcpy(result + ri, replacement, rlen); ri += rlen;
-        pos += ms + (me - ms);
-        if (me == ms) { if (str[pos]) { if (ri >= cap) { cap *= 2; char* nr = wyn_str_alloc(cap); memcpy(nr, result, ri); wyn_rc_release(result); result = nr; } result[ri++] = str[pos++]; } else break; }
-    }
-    result[ri] = '\0';
-    wyn_rc_set_length(result, (unsigned int)ri);
-    return result;
+#ifndef _WIN32
+#include <regex.h>
+#define WYN_WRE_FLAGS WRE_STRICT
+#else
+#define WYN_WRE_FLAGS WRE_NEWLINE
+#endif
+
+typedef struct WynRegex {
+    char* pattern;
+    unsigned hash;
+    struct wre_prog* prog;          // NULL when the engine declined the pattern
+#ifndef _WIN32
+    regex_t posix;                  // regcomp fallback, valid when has_posix
+    int has_posix;
+#endif
+    _Atomic int refs;               // cache entry + handles + calls in flight
+    struct WynRegex *lru_prev, *lru_next, *chain;  // under regex_cache_busy
+} WynRegex;
+
+#define WYN_REGEX_BUCKETS 256
+static atomic_flag regex_cache_busy = ATOMIC_FLAG_INIT;
+static WynRegex* regex_buckets[WYN_REGEX_BUCKETS];
+static WynRegex* regex_lru_head = NULL;    // most recently used
+static WynRegex* regex_lru_tail = NULL;
+static int regex_cache_n = 0;
+static int regex_cache_max = -1;          // -1 = WYN_REGEX_CACHE not read yet
+static WynRegex** regex_handles = NULL;   // Regex.compile handles, under regex_cache_busy
+static long long regex_handle_cap = 0;
+static long long regex_handle_hint = 1;   // lowest handle that may be free
+
+static void regex_cache_lock(void) {
+    while (atomic_flag_test_and_set_explicit(&regex_cache_busy, memory_order_acquire)) wre_yield();
+}
+static void regex_cache_unlock(void) { atomic_flag_clear_explicit(&regex_cache_busy, memory_order_release); }
+
+static void regex_release(WynRegex* re) {
+    if (!re || atomic_fetch_sub_explicit(&re->refs, 1, memory_order_acq_rel) != 1) return;
+    wre_free(re->prog);
+#ifndef _WIN32
+    if (re->has_posix) regfree(&re->posix);
+#endif
+    free(re->pattern);
+    free(re);
 }
-bool Regex_match(const char* s, const char* p) { return regex_match(s, p); }
-char* Regex_replace(const char* s, const char* p, const char* r) { return regex_replace(s, p, r); }
-int Regex_find(const char* s, const char* p) { int ms, me; wre_find(s, p, &ms, &me); return ms; }
-char* regex_find_all(const char* str, const char* pattern) {
-    struct wre_nfa nfa;
-    if (!wre_compile(&nfa, pattern)) return wyn_strdup("");
-    size_t cap = 1024, len = 0;
-    char* result = wyn_str_alloc(cap);
-    int pos = 0, slen = (int)strlen(str);
-    while (pos <= slen) {
-        int ms, me;
-        wre_find(str + pos, pattern, &ms, &me);
-        if (ms < 0 || me <= ms) break;
-        size_t match_len = me - ms;
-        size_t needed = len + match_len + 1; // +1 for newline
-        if (needed >= cap) {
-            cap = needed * 2;
-            char* nr = wyn_str_alloc(cap);
-            memcpy(nr, result, len);
-            wyn_rc_release(result);
-            result = nr;
+
+static bool regex_valid(const WynRegex* re) {
+#ifndef _WIN32
+    if (re->has_posix) return true;
+#endif
+    return re->prog != NULL;
+}
+
+static WynRegex* regex_compile_new(const char* pattern, unsigned h) {
+    WynRegex* re = wyn_calloc(1, sizeof(WynRegex));
+    size_t n = strlen(pattern);
+    re->pattern = wyn_malloc(n + 1);
+    memcpy(re->pattern, pattern, n + 1);
+    re->hash = h;
+    atomic_init(&re->refs, 1);
+    re->prog = wre_compile(pattern, WYN_WRE_FLAGS);
+#ifndef _WIN32
+    if (!re->prog) re->has_posix = regcomp(&re->posix, pattern, REG_EXTENDED) == 0;
+#endif
+    return re;
+}
+
+static void regex_lru_unlink(WynRegex* re) {
+    if (re->lru_prev) re->lru_prev->lru_next = re->lru_next; else regex_lru_head = re->lru_next;
+    if (re->lru_next) re->lru_next->lru_prev = re->lru_prev; else regex_lru_tail = re->lru_prev;
+    re->lru_prev = re->lru_next = NULL;
+}
+
+static void regex_lru_push_front(WynRegex* re) {
+    re->lru_prev = NULL;
+    re->lru_next = regex_lru_head;
+    if (regex_lru_head) regex_lru_head->lru_prev = re; else regex_lru_tail = re;
+    regex_lru_head = re;
+}
+
+// Caller holds the cache lock. A hit gains a reference and moves to the front.
+static WynRegex* regex_cache_find(const char* pattern, unsigned h) {
+    for (WynRegex* re = regex_buckets[h % WYN_REGEX_BUCKETS]; re; re = re->chain) {
+        if (re->hash != h || strcmp(re->pattern, pattern) != 0) continue;
+        atomic_fetch_add_explicit(&re->refs, 1, memory_order_relaxed);
+        regex_lru_unlink(re);
+        regex_lru_push_front(re);
+        return re;
+    }
+    return NULL;
+}
+
+// Compiled regex for pattern, with a reference the caller drops through
+// regex_release. Invalid patterns are cached too, so a bad pattern in a loop
+// is rejected once rather than recompiled every time.
+static WynRegex* regex_lookup(const char* pattern) {
+    if (!pattern) pattern = "";
+    if (regex_cache_max < 0) {
+        const char* env = getenv("WYN_REGEX_CACHE");
+        int v = env ? atoi(env) : 64;
+        regex_cache_max = v < 0 ? 0 : v;
+    }
+    unsigned h = 2166136261u;
+    for (const unsigned char* c = (const unsigned char*)pattern; *c; c++) h = (h ^ *c) * 16777619u;
+    if (regex_cache_max == 0) return regex_compile_new(pattern, h);
+    regex_cache_lock();
+    WynRegex* re = regex_cache_find(pattern, h);
+    regex_cache_unlock();
+    if (re) return re;
+    // Compile outside the lock; if another thread cached the pattern meanwhile, use theirs.
+    WynRegex* fresh = regex_compile_new(pattern, h);
+    regex_cache_lock();
+    re = regex_cache_find(pattern, h);
+    if (!re) {
+        re = fresh;
+        fresh = NULL;
+        atomic_fetch_add_explicit(&re->refs, 1, memory_order_relaxed);   // the cache's reference
+        re->chain = regex_buckets[h % WYN_REGEX_BUCKETS];
+        regex_buckets[h % WYN_REGEX_BUCKETS] = re;
+        regex_lru_push_front(re);
+        regex_cache_n++;
+        while (regex_cache_n > regex_cache_max) {
+            WynRegex* old = regex_lru_tail;
+            WynRegex** link = &regex_buckets[old->hash % WYN_REGEX_BUCKETS];
+            while (*link != old) link = &(*link)->chain;
+            *link = old->chain;
+            regex_lru_unlink(old);
+            regex_cache_n--;
+            regex_release(old);   // freed here unless a call or handle still holds it
         }
-        memcpy(result + len, str + pos + ms, match_len);
-        len += match_len;
-        result[len++] = '\n';
-        pos += ms + (me - ms);
     }
-    result[len] = 0;
-    wyn_rc_set_length(result, (unsigned int)len);
-    return result;
+    regex_cache_unlock();
+    regex_release(fresh);
+    return re;
 }
-char* regex_split(const char* str, const char* pattern) {
-    struct wre_nfa nfa;
-    if (!wre_compile(&nfa, pattern)) return wyn_strdup(str);
-    size_t slen = strlen(str);
-    size_t cap = slen * 2 + 256, rpos = 0;
-    char* result = wyn_str_alloc(cap);
-    size_t pos = 0;
-    while (pos <= slen) {
-        int ms, me;
-        wre_find(str + pos, pattern, &ms, &me);
-        if (ms < 0 || me <= ms) {
-            size_t tail = slen - pos;
-            if (rpos + tail >= cap) { cap = (rpos + tail) * 2; char* nr = wyn_str_alloc(cap); memcpy(nr, result, rpos); wyn_rc_release(result); result = nr; }
-            memcpy(result + rpos, str + pos, tail); rpos += tail;
-            break;
+
+static bool regex_search_at(WynRegex* re, const char* s, long len, long from, long* ms, long* me) {
+    if (re->prog) return wre_search(re->prog, s, len, from, ms, me);
+#ifndef _WIN32
+    if (re->has_posix) {
+        regmatch_t m;
+        if (regexec(&re->posix, s + from, 1, &m, from > 0 ? REG_NOTBOL : 0) != 0) return false;
+        *ms = from + m.rm_so;
+        *me = from + m.rm_eo;
+        return true;
+    }
+#endif
+    return false;
+}
+
+static bool regex_test(WynRegex* re, const char* s) {
+    if (!s) s = "";
+    if (re->prog) return wre_test(re->prog, s, (long)strlen(s));
+#ifndef _WIN32
+    if (re->has_posix) return regexec(&re->posix, s, 0, NULL, 0) == 0;
+#endif
+    return false;
+}
+
+static long long regex_find_re(WynRegex* re, const char* s) {
+    long ms, me;
+    if (!s) s = "";
+    return regex_search_at(re, s, (long)strlen(s), 0, &ms, &me) ? ms : -1;
+}
+
+// Replace every match. An empty match directly after the previous match is
+// skipped, as sed does, so "a*" over "baaac" gives "-b-c-".
+static char* regex_replace_re(WynRegex* re, const char* str, const char* rep) {
+    if (!str) str = "";
+    if (!rep) rep = "";
+    long len = (long)strlen(str), pos = 0, prev_end = -1, ms, me;
+    size_t rlen = strlen(rep);
+    WynStrBuf sb;
+    wyn_sb_init(&sb);
+    while (pos <= len && regex_search_at(re, str, len, pos, &ms, &me)) {
+        if (me == ms && ms == prev_end) {
+            if (ms >= len) break;
+            wyn_sb_append_n(&sb, str + pos, (size_t)(ms + 1 - pos));
+            pos = ms + 1;
+            continue;
         }
-        size_t needed = rpos + ms + 1;
-        if (needed >= cap) { cap = needed * 2; char* nr = wyn_str_alloc(cap); memcpy(nr, result, rpos); wyn_rc_release(result); result = nr; }
-        memcpy(result + rpos, str + pos, ms); rpos += ms;
-        result[rpos++] = '\n';
-        pos += ms + (me - ms);
-        if (me == ms) pos++;
-    }
-    result[rpos] = 0;
-    wyn_rc_set_length(result, (unsigned int)rpos);
-    return result;
+        wyn_sb_append_n(&sb, str + pos, (size_t)(ms - pos));
+        wyn_sb_append_n(&sb, rep, rlen);
+        prev_end = me;
+        if (me > ms) { pos = me; continue; }
+        if (ms < len) wyn_sb_append_n(&sb, str + ms, 1);
+        pos = ms + 1;
+    }
+    if (pos < len) wyn_sb_append_n(&sb, str + pos, (size_t)(len - pos));
+    return wyn_sb_finish(&sb);
 }
-#else
-#include <regex.h>
+
+// Non-empty matches, each followed by '\n'.
+static char* regex_find_all_re(WynRegex* re, const char* str) {
+    if (!str) str = "";
+    long len = (long)strlen(str), pos = 0, ms, me;
+    WynStrBuf sb;
+    wyn_sb_init(&sb);
+    while (pos <= len && regex_search_at(re, str, len, pos, &ms, &me)) {
+        if (me == ms) { pos = ms + 1; continue; }
+        wyn_sb_append_n(&sb, str + ms, (size_t)(me - ms));
+        wyn_sb_append_n(&sb, "\n", 1);
+        pos = me;
+    }
+    return wyn_sb_finish(&sb);
+}
+
+// The pieces between non-empty matches, joined by '\n'.
+static char* regex_split_re(WynRegex* re, const char* str) {
+    if (!str) str = "";
+    long len = (long)strlen(str), start = 0, pos = 0, ms, me;
+    WynStrBuf sb;
+    wyn_sb_init(&sb);
+    while (pos <= len && regex_search_at(re, str, len, pos, &ms, &me)) {
+        if (me == ms) { pos = ms + 1; continue; }
+        wyn_sb_append_n(&sb, str + start, (size_t)(ms - start));
+        wyn_sb_append_n(&sb, "\n", 1);
+        start = pos = me;
+    }
+    wyn_sb_append_n(&sb, str + start, (size_t)(len - start));
+    return wyn_sb_finish(&sb);
+}
+
 bool regex_match(const char* str, const char* pattern) {
-    regex_t re;
-    if (regcomp(&re, pattern, REG_EXTENDED | REG_NOSUB) != 0) return false;
-    bool result = regexec(&re, str, 0, NULL, 0) == 0;
-    regfree(&re);
-    return result;
+    WynRegex* re = regex_lookup(pattern);
+    bool r = regex_test(re, str);
+    regex_release(re);
+    return r;
 }
 char* regex_replace(const char* str, const char* pattern, const char* replacement) {
-    regex_t re;
-    if (regcomp(&re, pattern, REG_EXTENDED) != 0) return wyn_strdup(str);
-    int rlen = strlen(replacement);
-    size_t cap = strlen(str) + rlen * 4 + 64;
-    char* result = wyn_str_alloc(cap);
-    size_t ri = 0;
-    const char* p = str;
-    regmatch_t match;
-    while (regexec(&re, p, 1, &match, 0) == 0) {
-        size_t needed = ri + match.rm_so + rlen;
-        if (needed >= cap) { cap = needed * 2; char* nr = wyn_str_alloc(cap); memcpy(nr, result, ri); wyn_rc_release(result); result = nr; }
-        memcpy(result + ri, p, match.rm_so); ri += match.rm_so;
-        memcpy(result + ri, replacement, rlen); ri += rlen;
-        p += match.rm_eo;
-    }
-    size_t remaining = strlen(p);
-    if (ri + remaining >= cap) { cap = (ri + remaining) * 2; char* nr = wyn_str_alloc(cap); memcpy(nr, result, ri); wyn_rc_release(result); result = nr; }
-    memcpy(result + ri, p, remaining); ri += remaining;
-    result[ri] = '\0';
-    wyn_rc_set_length(result, (unsigned int)ri);
-    regfree(&re);
-    return result;
+    WynRegex* re = regex_lookup(pattern);
+    char* r = regex_replace_re(re, str, replacement);
+    regex_release(re);
+    return r;
+}
+long long regex_find(const char* str, const char* pattern) {
+    WynRegex* re = regex_lookup(pattern);
+    long long r = regex_find_re(re, str);
+    regex_release(re);
+    return r;
+}
+char* regex_find_all(const char* str, const char* pattern) {
+    WynRegex* re = regex_lookup(pattern);
+    char* r = regex_find_all_re(re, str);
+    regex_release(re);
+    return r;
+}
+char* regex_split(const char* str, const char* pattern) {
+    WynRegex* re = regex_lookup(pattern);
+    char* r = regex_split_re(re, str);
+    regex_release(re);
+    return r;
+}
+bool Regex_match(const char* s, const char* p) { return regex_match(s, p); }
+char* Regex_replace(const char* s, const char* p, const char* r) { return regex_replace(s, p, r); }
+int Regex_find(const char* s, const char* p) { return (int)regex_find(s, p); }
+char* Regex_find_all(const char* s, const char* p) { return regex_find_all(s, p); }
+char* Regex_split(const char* s, const char* p) { return regex_split(s, p); }
+
+// Compiled handles. A handle holds its own reference, so it stays valid after
+// the pattern is evicted from the LRU.
+long long regex_compile(const char* pattern) {
+    WynRegex* re = regex_lookup(pattern);
+    if (!regex_valid(re)) { regex_release(re); return -1; }
+    regex_cache_lock();
+    long long h = regex_handle_hint;
+    while (h < regex_handle_cap && regex_handles[h]) h++;
+    if (h >= regex_handle_cap) {
+        long long ncap = regex_handle_cap ? regex_handle_cap * 2 : 16;
+        regex_handles = wyn_realloc(regex_handles, sizeof(WynRegex*) * (size_t)ncap);
+        memset(regex_handles + regex_handle_cap, 0, sizeof(WynRegex*) * (size_t)(ncap - regex_handle_cap));
+        regex_handle_cap = ncap;
+    }
+    regex_handles[h] = re;
+    regex_handle_hint = h + 1;
+    regex_cache_unlock();
+    return h;
+}
+
+static WynRegex* regex_handle_get(long long h) {
+    WynRegex* re = NULL;
+    regex_cache_lock();
+    if (h > 0 && h < regex_handle_cap) re = regex_handles[h];
+    if (re) atomic_fetch_add_explicit(&re->refs, 1, memory_order_relaxed);
+    regex_cache_unlock();
+    return re;
+}
+
+void regex_free(long long h) {
+    WynRegex* re = NULL;
+    regex_cache_lock();
+    if (h > 0 && h < regex_handle_cap) {
+        re = regex_handles[h];
+        regex_handles[h] = NULL;
+        if (re && h < regex_handle_hint) regex_handle_hint = h;
+    }
+    regex_cache_unlock();
+    regex_release(re);
+}
+
+bool regex_is_match(long long h, const char* s) {
+    WynRegex* re = regex_handle_get(h);
+    bool r = re && regex_test(re, s);
+    regex_release(re);
+    return r;
+}
+long long regex_find_in(long long h, const char* s) {
+    WynRegex* re = regex_handle_get(h);
+    long long r = re ? regex_find_re(re, s) : -1;
+    regex_release(re);
+    return r;
+}
+char* regex_replace_in(long long h, const char* s, const char* replacement) {
+    WynRegex* re = regex_handle_get(h);
+    char* r = re ? regex_replace_re(re, s, replacement) : wyn_strdup(s ? s : "");
+    regex_release(re);
+    return r;
+}
+char* regex_find_all_in(long long h, const char* s) {
+    WynRegex* re = regex_handle_get(h);
+    char* r = re ? regex_find_all_re(re, s) : wyn_strdup("");
+    regex_release(re);
+    return r;
+}
+char* regex_split_in(long long h, const char* s) {
+    WynRegex* re = regex_handle_get(h);
+    char* r = re ? regex_split_re(re, s) : wyn_strdup(s ? s : "");
+    regex_release(re);
+    return r;
 }
-#endif // _WIN32 regex guard
 
 // Time module wrappers
 long Time_now();
@@ -803,6 +1081,24 @@ static inline const char* array_get_str_impl(WynArray arr, int index, const char
     return "";
 }
 #define array_get_struct(arr, idx, T) (*(T*)arr.data[idx].data.struct_val)
+// Unchecked element reads (`_nc` = no check). Codegen emits these only where
+// it has proven the index in [0, count) - see the bounds-check elimination
+// block in codegen_lambda.c - so they skip the negative-index adjust and the
+// range check but keep the tag dispatch of the checked getters above.
+long long array_get_int_nc(WynArray arr, int index) {
+    WynValue v = arr.data[index];
+    if (v.type == WYN_TYPE_FLOAT) return (long long)v.data.float_val;
+    return (v.type == WYN_TYPE_INT || v.type == WYN_TYPE_BOOL) ? v.data.int_val : 0;
+}
+double array_get_float_nc(WynArray arr, int index) {
+    WynValue v = arr.data[index];
+    if (v.type == WYN_TYPE_FLOAT) return v.data.float_val;
+    return v.type == WYN_TYPE_INT ? (double)v.data.int_val : 0.0;
+}
+bool array_get_bool_nc(WynArray arr, int index) { return arr.data[index].data.int_val ? true : false; }
+const char* array_get_str_nc(WynArray arr, int index) {
+    return arr.data[index].type == WYN_TYPE_STRING ? arr.data[index].data.string_val : "";
+}
 WynValue array_get(WynArray arr, int index) {
     WynValue val = {0};
     if (index < 0) index += arr.count;   // Python-style negative index
@@ -898,8 +1194,12 @@ long long int_array_get(WynIntArray a, int i) {
     return a.data[i];
 }
 int int_array_len(WynIntArray a) { return a.count; }
-static int _int_array_cmp(const void* a, const void* b) { long long x = *(const long long*)a, y = *(const long long*)b; return (x > y) - (x < y); }
-void int_array_sort(WynIntArray* a) { if (a->count > 1) qsort(a->data, a->count, sizeof(long long), _int_array_cmp); }
+static void _wyn_qsort_ll(long long* d, int n, int depth);
+void int_array_sort(WynIntArray* a) {
+    if (a->count <= 1) return;
+    int depth = 0; for (int t = a->count; t > 1; t >>= 1) depth++;
+    _wyn_qsort_ll(a->data, a->count, depth * 2);
+}
 
 void array_push(WynArray* arr, long long value) {
     WYN_ARR_WRITE_ENTER(arr);
@@ -1067,6 +1367,123 @@ static int _wyn_cmp_float(const void* a, const void* b) {
 void array_sort_float(WynArray* arr) {
     if (arr->count > 1) qsort(arr->data, arr->count, sizeof(WynValue), _wyn_cmp_float);
 }
+
+// --- Packed (unboxed) arrays ------------------------------------------------
+//
+// WynArray stores every element as a 16-byte tagged WynValue: [int] and
+// [float] use twice the memory they need, [bool] sixteen times, and a [Struct]
+// is an array of pointers to one heap box per element. Every read goes through
+// the tag. For locals whose element type the checker knows statically, codegen
+// picks one of these monomorphic layouts instead (see the "packed-array" block
+// in codegen.c for when it may): a contiguous long long* / double* / uint8_t* /
+// struct-by-value buffer the C compiler can keep in registers and vectorize.
+//
+// WynIntArray (above) is the int member of the family. Semantics mirror the
+// boxed helpers exactly - negative indices count from the end on reads, an
+// out-of-range read panics through wyn_oob_panic, and an out-of-range store is
+// ignored like the boxed `xs[i] = v` lowering - so switching layouts never
+// changes what a program prints.
+typedef struct { double* data; int count; int capacity; } WynFloatArray;
+typedef struct { uint8_t* data; int count; int capacity; } WynBoolArray;
+typedef struct { void* data; int count; int capacity; } WynStructArray;
+
+#define WYN_PACKED_GROW(a, elem_size) do { \
+    if ((a)->count >= (a)->capacity) { \
+        (a)->capacity = (a)->capacity == 0 ? 8 : (a)->capacity * 2; \
+        (a)->data = wyn_realloc((a)->data, (size_t)(elem_size) * (a)->capacity); \
+    } \
+} while (0)
+
+#define int_array_at(arr, idx) int_array_at_impl(arr, idx, __FILE__, __LINE__)
+long long int_array_at_impl(WynIntArray a, int i, const char* file, int line) {
+    if (i < 0) i += a.count;
+    if (i < 0 || i >= a.count) { wyn_oob_panic(i, a.count, file, line); return 0; }
+    return a.data[i];
+}
+void int_array_set(WynIntArray* a, int i, long long v) {
+    if (i >= 0 && i < a->count) a->data[i] = v;
+}
+long long int_array_sum(WynIntArray a) {
+    long long s = 0;
+    for (int i = 0; i < a.count; i++) s += a.data[i];
+    return s;
+}
+void int_array_free(WynIntArray* a) { free(a->data); a->data = NULL; a->count = a->capacity = 0; }
+
+WynFloatArray float_array_new() { WynFloatArray a = {0}; return a; }
+void float_array_push(WynFloatArray* a, double v) { WYN_PACKED_GROW(a, sizeof(double)); a->data[a->count++] = v; }
+#define float_array_get(arr, idx) float_array_get_impl(arr, idx, __FILE__, __LINE__)
+double float_array_get_impl(WynFloatArray a, int i, const char* file, int line) {
+    if (i < 0) i += a.count;
+    if (i < 0 || i >= a.count) { wyn_oob_panic(i, a.count, file, line); return 0.0; }
+    return a.data[i];
+}
+void float_array_set(WynFloatArray* a, int i, double v) {
+    if (i >= 0 && i < a->count) a->data[i] = v;
+}
+int float_array_len(WynFloatArray a) { return a.count; }
+double float_array_sum(WynFloatArray a) {
+    double s = 0.0;
+    for (int i = 0; i < a.count; i++) s += a.data[i];
+    return s;
+}
+static int _wyn_cmp_double(const void* a, const void* b) {
+    double x = *(const double*)a, y = *(const double*)b;
+    return (x > y) - (x < y);
+}
+void float_array_sort(WynFloatArray* a) { if (a->count > 1) qsort(a->data, a->count, sizeof(double), _wyn_cmp_double); }
+void float_array_free(WynFloatArray* a) { free(a->data); a->data = NULL; a->count = a->capacity = 0; }
+
+WynBoolArray bool_array_new() { WynBoolArray a = {0}; return a; }
+void bool_array_push(WynBoolArray* a, int v) { WYN_PACKED_GROW(a, 1); a->data[a->count++] = v ? 1 : 0; }
+// Returns `bool` for the same reason array_get_bool does: to_string()'s
+// _Generic must print true/false, not 1/0.
+#define bool_array_get(arr, idx) bool_array_get_impl(arr, idx, __FILE__, __LINE__)
+bool bool_array_get_impl(WynBoolArray a, int i, const char* file, int line) {
+    if (i < 0) i += a.count;
+    if (i < 0 || i >= a.count) { wyn_oob_panic(i, a.count, file, line); return false; }
+    return a.data[i] != 0;
+}
+void bool_array_set(WynBoolArray* a, int i, int v) {
+    if (i >= 0 && i < a->count) a->data[i] = v ? 1 : 0;
+}
+int bool_array_len(WynBoolArray a) { return a.count; }
+void bool_array_free(WynBoolArray* a) { free(a->data); a->data = NULL; a->count = a->capacity = 0; }
+
+// Structs are stored by value, elem_size bytes apart. The macros take the C
+// struct type so the element is copied in and read back without a heap box;
+// struct_array_get is an lvalue, so `xs[i].hp = 3` writes the element in place.
+WynStructArray struct_array_new() { WynStructArray a = {0}; return a; }
+void* struct_array_slot(WynStructArray* a, int i, size_t elem_size, const char* file, int line) {
+    if (i < 0) i += a->count;
+    if (i < 0 || i >= a->count) {
+        wyn_oob_panic(i, a->count, file, line);
+        // Lenient mode continues: hand back a scratch slot, never wild memory.
+        static void* scratch = NULL;
+        scratch = realloc(scratch, elem_size);
+        memset(scratch, 0, elem_size);
+        return scratch;
+    }
+    return (char*)a->data + (size_t)i * elem_size;
+}
+// Grows by one element and returns the new (uninitialised) slot.
+void* struct_array_push_slot(WynStructArray* a, size_t elem_size) {
+    WYN_PACKED_GROW(a, elem_size);
+    return (char*)a->data + (size_t)(a->count++) * elem_size;
+}
+// push/set are statement expressions (not do/while) so they can stand
+// wherever codegen puts a call, e.g. the value of a match arm.
+#define struct_array_push(arr, value, T) ({ \
+    T __sa_tmp = (value); \
+    *(T*)struct_array_push_slot((arr), sizeof(T)) = __sa_tmp; (void)0; \
+})
+#define struct_array_get(arr, idx, T) (*(T*)struct_array_slot(&(arr), (idx), sizeof(T), __FILE__, __LINE__))
+#define struct_array_set(arr, idx, value, T) ({ \
+    T __sa_val = (value); WynStructArray* __sa_a = (arr); int __sa_i = (idx); \
+    if (__sa_i >= 0 && __sa_i < __sa_a->count) ((T*)__sa_a->data)[__sa_i] = __sa_val; (void)0; \
+})
+int struct_array_len(WynStructArray a) { return a.count; }
+void struct_array_free(WynStructArray* a) { free(a->data); a->data = NULL; a->count = a->capacity = 0; }
 // arr.sorted() / sorted(arr): non-mutating sibling of .sort() (Python sorted).
 // Dispatches on the runtime value tag, so one function covers [int]/[float]/
 // [string]/[bool]; strings are retained via wyn_strdup so the copy owns its
@@ -1931,9 +2348,29 @@ char http_last_error[256] = {0};
 char last_error[256] = {0};
 
 char* http_request(const char* method, const char* url, const char* body) {
+    http_last_error[0] = 0;
+#ifndef _WIN32
+    // POSIX: the pooled, coroutine-aware client in net_advanced.c (keep-alive
+    // reuse, unbounded Content-Length/chunked bodies, parks instead of
+    // blocking a scheduler worker). The socket code below is the Windows path.
+    if (strncmp(url, "https://", 8) != 0) {
+        WynHttpResult r;
+        if (wyn_http_fetch(method, url, (const char* const*)http_headers, http_header_count,
+                           body, body ? strlen(body) : 0,
+                           "application/x-www-form-urlencoded", &r) != 0) {
+            snprintf(http_last_error, 256, "%s", r.error);
+            return NULL;
+        }
+        http_last_status = r.status;
+        char* result = wyn_str_alloc(r.body_len + 1);
+        memcpy(result, r.body, r.body_len);
+        result[r.body_len] = 0;
+        wyn_http_result_free(&r);
+        return result;
+    }
+#endif
     char hostname[256], path[1024];
     int port = 80, is_https = 0;
-    http_last_error[0] = 0;
     
     // Parse URL
     if(strncmp(url, "https://", 8) == 0) { url += 8; port = 443; is_https = 1; }
@@ -2373,6 +2810,84 @@ static inline int wyn_format_float(char* buf, size_t cap, double x) {
     }
     return n;
 }
+// Allocation-free number formatting for string interpolation (and
+// int_to_string / float_to_string). The caller provides the buffer; nothing
+// is NUL-terminated and the length is returned.
+//
+// wyn_fmt_i64 writes decimal text two digits per step from a 200-byte pair
+// table after sizing the number against a powers-of-ten table, so it does no
+// libc format parsing. out needs 20 bytes for any value.
+//
+// wyn_fmt_f64 prints exactly what wyn_format_float prints (shortest round-trip,
+// ".0" on integral values). Fast path: for 1e-4 <= |x| < 1e15, the output has
+// the fewest fraction digits k such that m / 10^k == |x| for m = round(|x| *
+// 10^k) with at most 15 digits. m and 10^k are both exact doubles there, so
+// the division is correctly rounded and equals strtod of the text (Clinger's
+// fast path). At most 15 significant digits means %.15g - the first precision
+// wyn_format_float tries - gives the same digits, and that range is where %g
+// uses fixed notation. Everything else (tiny, huge, 16-17 digit values,
+// inf/nan) falls back to wyn_format_float. out needs 40 bytes.
+static const char wyn_digit_pairs[201] =
+    "00010203040506070809101112131415161718192021222324252627282930313233343536373839"
+    "40414243444546474849505152535455565758596061626364656667686970717273747576777879"
+    "8081828384858687888990919293949596979899";
+static inline int wyn_fmt_u64(char* out, unsigned long long v) {
+    static const unsigned long long p10[20] = {
+        1ULL, 10ULL, 100ULL, 1000ULL, 10000ULL, 100000ULL, 1000000ULL, 10000000ULL,
+        100000000ULL, 1000000000ULL, 10000000000ULL, 100000000000ULL, 1000000000000ULL,
+        10000000000000ULL, 100000000000000ULL, 1000000000000000ULL, 10000000000000000ULL,
+        100000000000000000ULL, 1000000000000000000ULL, 10000000000000000000ULL };
+    int n = 1;
+    while (n < 20 && v >= p10[n]) n++;
+    char* p = out + n;
+    while (v >= 100) {
+        unsigned idx = (unsigned)(v % 100) * 2;
+        v /= 100;
+        *--p = wyn_digit_pairs[idx + 1];
+        *--p = wyn_digit_pairs[idx];
+    }
+    if (v >= 10) { *--p = wyn_digit_pairs[v * 2 + 1]; *--p = wyn_digit_pairs[v * 2]; }
+    else *--p = (char)('0' + v);
+    return n;
+}
+static inline int wyn_fmt_i64(char* out, long long v) {
+    if (v < 0) { out[0] = '-'; return 1 + wyn_fmt_u64(out + 1, 0ULL - (unsigned long long)v); }
+    return wyn_fmt_u64(out, (unsigned long long)v);
+}
+static inline int wyn_fmt_f64(char* out, double x) {
+    static const double p10[18] = { 1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8,
+                                    1e9, 1e10, 1e11, 1e12, 1e13, 1e14, 1e15, 1e16, 1e17 };
+    double a = x < 0 ? -x : x;
+    if (x == 0) {
+        if (signbit(x)) { memcpy(out, "-0.0", 4); return 4; }
+        memcpy(out, "0.0", 3); return 3;
+    }
+    if (a >= 1e-4 && a < 1e15) {
+        for (int k = 0; k < 18; k++) {
+            double s = a * p10[k];
+            if (s >= 1e15) break;
+            unsigned long long m = (unsigned long long)(s + 0.5);
+            if ((double)m / p10[k] != a) continue;
+            char d[20];
+            int nd = wyn_fmt_u64(d, m), n = 0;
+            if (x < 0) out[n++] = '-';
+            if (k == 0) {
+                memcpy(out + n, d, nd); n += nd;
+                out[n++] = '.'; out[n++] = '0';
+            } else if (nd > k) {
+                memcpy(out + n, d, nd - k); n += nd - k;
+                out[n++] = '.';
+                memcpy(out + n, d + nd - k, k); n += k;
+            } else {
+                out[n++] = '0'; out[n++] = '.';
+                for (int z = nd; z < k; z++) out[n++] = '0';
+                memcpy(out + n, d, nd); n += nd;
+            }
+            return n;
+        }
+    }
+    return wyn_format_float(out, 40, x);
+}
 void print_float(double x) { char b[40]; wyn_format_float(b, sizeof(b), x); printf("%s\n", b); }
 void print_str(const char* s) { printf("%s", s); fflush(stdout); }
 void print_bool(bool b) { printf("%s", b ? "true" : "false"); }
@@ -2571,8 +3086,8 @@ const char* Fs_read_file(const char* path) {
 }
 char* str_repeat(const char* s, int count) { size_t len = string_length(s); size_t total = len * count; char* r = wyn_str_alloc(total + 1); for(int i = 0; i < count; i++) memcpy(r + i * len, s, len); r[total] = 0; wyn_rc_set_length(r, (unsigned int)total); return r; }
 char* str_reverse(const char* s) { int len = string_length(s); char* r = wyn_str_alloc(len + 1); for(int i = 0; i < len; i++) r[i] = s[len-1-i]; r[len] = 0; wyn_rc_set_length(r, len); return r; }
-char* int_to_string(long long x) { char* r = wyn_str_alloc(32); int n = snprintf(r, 32, "%lld", x); wyn_rc_set_length(r, (unsigned int)n); return r; }
-char* float_to_string(double x) { char* r = wyn_str_alloc(40); int n = wyn_format_float(r, 40, x); wyn_rc_set_length(r, (unsigned int)n); return r; }
+char* int_to_string(long long x) { char* r = wyn_str_alloc(32); int n = wyn_fmt_i64(r, x); r[n] = 0; wyn_rc_set_length(r, (unsigned int)n); return r; }
+char* float_to_string(double x) { char* r = wyn_str_alloc(40); int n = wyn_fmt_f64(r, x); r[n] = 0; wyn_rc_set_length(r, (unsigned int)n); return r; }
 char* bool_to_string(bool x) { return (char*)(x ? "true" : "false"); }
 int bool_to_int(bool x) { return x ? 1 : 0; }
 bool bool_not(bool x) { return !x; }
@@ -2658,6 +3173,28 @@ char* array_to_string(WynArray arr) {
     WynArray: array_to_string, \
     default: int_to_string)(x)
 
+// Interpolation pieces: "${x}" formats x by its C type with the same mapping as
+// to_string(), but ints/floats land in the caller's stack buffer `b` (>= 40
+// bytes) and strings/bools are returned as-is, so no piece allocates. *n gets
+// the byte length. Only an array is rendered through array_to_string(); that
+// string is handed back in *o for the caller to release after copying.
+static inline const char* wyn_interp_i64(long long v, char* b, size_t* n, const char** o) { (void)o; *n = (size_t)wyn_fmt_i64(b, v); return b; }
+static inline const char* wyn_interp_f64(double v, char* b, size_t* n, const char** o) { (void)o; *n = (size_t)wyn_fmt_f64(b, v); return b; }
+static inline const char* wyn_interp_bool(bool v, char* b, size_t* n, const char** o) { (void)b; (void)o; *n = v ? 4 : 5; return v ? "true" : "false"; }
+static inline const char* wyn_interp_str(const char* s, char* b, size_t* n, const char** o) { (void)b; (void)o; if (!s) s = ""; *n = strlen(s); return s; }
+static inline const char* wyn_interp_arr(WynArray a, char* b, size_t* n, const char** o) { (void)b; const char* s = array_to_string(a); *o = s; if (!s) s = ""; *n = strlen(s); return s; }
+#define wyn_interp_piece(x, b, n, o) _Generic((x), \
+    int: wyn_interp_i64, \
+    long: wyn_interp_i64, \
+    long long: wyn_interp_i64, \
+    float: wyn_interp_f64, \
+    double: wyn_interp_f64, \
+    char*: wyn_interp_str, \
+    const char*: wyn_interp_str, \
+    bool: wyn_interp_bool, \
+    WynArray: wyn_interp_arr, \
+    default: wyn_interp_i64)(x, b, n, o)
+
 typedef struct { const char* message; const char* type; } WynError;
 WynError Error(const char* msg) { WynError e = {msg, "Error"}; return e; }
 WynError TypeError(const char* msg) { WynError e = {msg, "TypeError"}; return e; }
@@ -2732,7 +3269,12 @@ int clamp(int x, int min_val, int max_val) { return x < min_val ? min_val : (x >
 int sign(int x) { return x < 0 ? -1 : (x > 0 ? 1 : 0); }
 int gcd(int a, int b) { while(b) { int t = b; b = a % b; a = t; } return a; }
 int lcm(int a, int b) { return a * b / gcd(a, b); }
-char* file_read(const char* path) {
+// file_read and the File/Process/Db/Log calls below can block in the kernel
+// or in SQLite for as long as the disk or query takes. Called from a coroutine
+// they run on the blocking-task pool (wyn_blocking_run, spawn_fast.c) while the
+// coroutine parks, instead of holding a scheduler worker; elsewhere they run
+// inline as before. Each is a *_now body plus a one-line job thunk.
+static char* file_read_now(const char* path) {
     last_error[0] = 0;
     FILE* f = fopen(path, "r");
     if(!f) { snprintf(last_error, 256, "Cannot open file: %s", path); return ""; }
@@ -2746,6 +3288,8 @@ char* file_read(const char* path) {
     fclose(f);
     return buf;
 }
+static void* file_read_job(void* path) { return file_read_now((const char*)path); }
+char* file_read(const char* path) { return (char*)wyn_blocking_run(file_read_job, (void*)path); }
 WynArray file_list_dir(const char* path) {
     WynArray arr = array_new();
     DIR* dir = opendir(path);
@@ -2988,7 +3532,7 @@ long long File_open(const char* path, const char* mode) {
     fclose(f);
     return -1;
 }
-char* File_read_line(long long handle) {
+static char* file_read_line_now(long long handle) {
     if (handle <= 0 || handle >= MAX_FILE_HANDLES || !file_handles[handle]) return "";
     char* buf = wyn_str_alloc(4096);
     if (fgets(buf, 4096, file_handles[handle])) {
@@ -3007,6 +3551,10 @@ char* File_read_line(long long handle) {
     wyn_rc_release(buf);
     return "";
 }
+static void* file_read_line_job(void* h) { return file_read_line_now((long long)(intptr_t)h); }
+char* File_read_line(long long handle) {
+    return (char*)wyn_blocking_run(file_read_line_job, (void*)(intptr_t)handle);
+}
 int File_write_line(long long handle, const char* data) {
     if (handle <= 0 || handle >= MAX_FILE_HANDLES || !file_handles[handle]) return 0;
     return fputs(data, file_handles[handle]) >= 0;
@@ -3675,21 +4223,6 @@ void Terminal_progress(int row, int col, int width, int percent) {
 // Http: Http.get() maps to http_get() (lowercase, returns string)
 // Note: Http_get in net_advanced.c returns HttpResponse* (different API)
 
-// Forward declarations for regex functions defined later
-#ifndef _WIN32
-char* regex_find_all(const char* str, const char* pattern);
-char* regex_split(const char* str, const char* pattern);
-#endif
-
-// Regex namespace aliases
-#ifndef _WIN32
-bool Regex_match(const char* s, const char* p) { return regex_match(s, p); }
-char* Regex_replace(const char* s, const char* p, const char* r) { return regex_replace(s, p, r); }
-int Regex_find(const char* s, const char* p) { regex_t re; if (regcomp(&re, p, REG_EXTENDED) != 0) return -1; regmatch_t m; int r2 = regexec(&re, s, 1, &m, 0) == 0 ? m.rm_so : -1; regfree(&re); return r2; }
-char* Regex_find_all(const char* s, const char* p) { return regex_find_all(s, p); }
-char* Regex_split(const char* s, const char* p) { return regex_split(s, p); }
-#endif
-
 int file_size(const char* path) {
     FILE* f = fopen(path, "rb");
     if(!f) return 0;
@@ -4031,83 +4564,159 @@ void Time_sleep(long long ms) {
 #endif
 }
 
-typedef struct { WynArray arr; } Queue;
-
-Queue* Queue_new() {
-    Queue* q = wyn_malloc(sizeof(Queue));
-    q->arr = (WynArray){0};  // zero `writing` flag too
-    return q;
-}
-
-void Queue_push(Queue* q, int value) {
-    if (q->arr.count >= q->arr.capacity) {
-        q->arr.capacity = q->arr.capacity == 0 ? 4 : q->arr.capacity * 2;
-        q->arr.data = wyn_realloc(q->arr.data, sizeof(WynValue) * q->arr.capacity);
-    }
-    q->arr.data[q->arr.count].type = WYN_TYPE_INT;
-    q->arr.data[q->arr.count].data.int_val = value;
-    q->arr.count++;
-}
-
-int Queue_pop(Queue* q) {
-    if (q->arr.count == 0) return 0;
-    int value = q->arr.data[0].data.int_val;
-    for (int i = 1; i < q->arr.count; i++) {
-        q->arr.data[i-1] = q->arr.data[i];
-    }
-    q->arr.count--;
-    return value;
-}
-
-int Queue_peek(Queue* q) {
-    if (q->arr.count == 0) return 0;
-    return q->arr.data[0].data.int_val;
-}
-
-int Queue_len(Queue* q) {
-    return q->arr.count;
-}
-
-int Queue_is_empty(Queue* q) {
-    return q->arr.count == 0;
-}
-
-typedef struct { WynArray arr; } Stack;
-
-Stack* Stack_new() {
-    Stack* s = wyn_malloc(sizeof(Stack));
-    s->arr = (WynArray){0};  // zero `writing` flag too
-    return s;
-}
-
-void Stack_push(Stack* s, int value) {
-    if (s->arr.count >= s->arr.capacity) {
-        s->arr.capacity = s->arr.capacity == 0 ? 4 : s->arr.capacity * 2;
-        s->arr.data = wyn_realloc(s->arr.data, sizeof(WynValue) * s->arr.capacity);
-    }
-    s->arr.data[s->arr.count].type = WYN_TYPE_INT;
-    s->arr.data[s->arr.count].data.int_val = value;
-    s->arr.count++;
-}
-
-int Stack_pop(Stack* s) {
-    if (s->arr.count == 0) return 0;
-    s->arr.count--;
-    return s->arr.data[s->arr.count].data.int_val;
-}
-
-int Stack_peek(Stack* s) {
-    if (s->arr.count == 0) return 0;
-    return s->arr.data[s->arr.count - 1].data.int_val;
-}
-
-int Stack_len(Stack* s) {
-    return s->arr.count;
-}
-
-int Stack_is_empty(Stack* s) {
-    return s->arr.count == 0;
-}
+// === Deque, Queue, Stack, PriorityQueue ===
+// Deque is a growable ring of Wyn ints: a power-of-two buffer with a head index
+// and a length, so push and pop are O(1) at both ends (indexing is
+// `(head + i) & mask`), and growing copies the ring out in order once per
+// doubling. Queue and Stack are the same ring used from one end or both. Queue
+// used to be a WynArray whose pop shifted every remaining element down, so
+// draining N items cost O(N^2); both also kept each int in a 16-byte WynValue.
+typedef struct { long long* buf; long long head, len, mask; } WynDeque;
+
+WynDeque* Deque_new(void) {
+    WynDeque* d = wyn_malloc(sizeof(WynDeque));
+    memset(d, 0, sizeof(WynDeque));
+    return d;
+}
+
+static void deque_grow(WynDeque* d) {
+    long long cap = d->mask ? (d->mask + 1) * 2 : 8;
+    long long* nb = wyn_malloc(sizeof(long long) * cap);
+    long long first = d->mask ? d->mask + 1 - d->head : 0;   // slots before the wrap
+    if (first > d->len) first = d->len;
+    if (d->len) {
+        memcpy(nb, d->buf + d->head, sizeof(long long) * first);
+        memcpy(nb + first, d->buf, sizeof(long long) * (d->len - first));
+    }
+    free(d->buf);
+    d->buf = nb;
+    d->head = 0;
+    d->mask = cap - 1;
+}
+
+void Deque_push_back(WynDeque* d, long long v) {
+    if (!d) return;
+    if (!d->mask || d->len == d->mask + 1) deque_grow(d);
+    d->buf[(d->head + d->len) & d->mask] = v;
+    d->len++;
+}
+void Deque_push_front(WynDeque* d, long long v) {
+    if (!d) return;
+    if (!d->mask || d->len == d->mask + 1) deque_grow(d);
+    d->head = (d->head - 1) & d->mask;
+    d->buf[d->head] = v;
+    d->len++;
+}
+// Pops and peeks on an empty deque return 0, like Queue.pop always has.
+long long Deque_pop_front(WynDeque* d) {
+    if (!d || !d->len) return 0;
+    long long v = d->buf[d->head];
+    d->head = (d->head + 1) & d->mask;
+    d->len--;
+    return v;
+}
+long long Deque_pop_back(WynDeque* d) {
+    if (!d || !d->len) return 0;
+    d->len--;
+    return d->buf[(d->head + d->len) & d->mask];
+}
+long long Deque_front(WynDeque* d) { return d && d->len ? d->buf[d->head] : 0; }
+long long Deque_back(WynDeque* d) { return d && d->len ? d->buf[(d->head + d->len - 1) & d->mask] : 0; }
+long long Deque_get(WynDeque* d, long long i) {
+    if (!d || i < 0 || i >= d->len) return 0;
+    return d->buf[(d->head + i) & d->mask];
+}
+void Deque_set(WynDeque* d, long long i, long long v) {
+    if (d && i >= 0 && i < d->len) d->buf[(d->head + i) & d->mask] = v;
+}
+long long Deque_len(WynDeque* d) { return d ? d->len : 0; }
+bool Deque_is_empty(WynDeque* d) { return !d || d->len == 0; }
+void Deque_clear(WynDeque* d) { if (d) { d->head = 0; d->len = 0; } }
+
+typedef WynDeque Queue;
+
+Queue* Queue_new() { return Deque_new(); }
+void Queue_push(Queue* q, long long value) { Deque_push_back(q, value); }
+long long Queue_pop(Queue* q) { return Deque_pop_front(q); }
+long long Queue_peek(Queue* q) { return Deque_front(q); }
+int Queue_len(Queue* q) { return (int)Deque_len(q); }
+int Queue_is_empty(Queue* q) { return Deque_is_empty(q); }
+
+typedef WynDeque Stack;
+
+Stack* Stack_new() { return Deque_new(); }
+void Stack_push(Stack* s, long long value) { Deque_push_back(s, value); }
+long long Stack_pop(Stack* s) { return Deque_pop_back(s); }
+long long Stack_peek(Stack* s) { return Deque_back(s); }
+int Stack_len(Stack* s) { return (int)Deque_len(s); }
+int Stack_is_empty(Stack* s) { return Deque_is_empty(s); }
+
+// PriorityQueue is a binary min-heap, monomorphized per element type the way
+// generic structs are (Box<int> -> Box_int): WYN_HEAP_DEFINE stamps out
+// PriorityQueue_int, PriorityQueue_float and PriorityQueue_string, each with
+// its own push/pop/peek/len/is_empty. The checker picks the instance - from the
+// comparator's parameter type for PriorityQueue::new_by(cmp), from the heap's
+// type for every later call - and rewrites PriorityQueue::op to the instance's
+// function, so there is no tag test or boxing per element.
+// `before(a, b)` true means a comes out first; NULL is natural ascending order.
+// PriorityQueue::new() is an int min-heap. A string heap keeps its own copy of
+// each pushed string and hands it to the caller on pop; peek returns a copy.
+#define WYN_HEAP_DEFINE(NAME, T, LESS, KEEP, SHOW, NONE)                          \
+typedef struct NAME { T* v; long long len, cap; bool (*before)(T, T); } NAME;   \
+NAME* NAME##_new(bool (*before)(T, T)) {                                        \
+    NAME* h = wyn_malloc(sizeof(NAME));                                         \
+    memset(h, 0, sizeof(NAME));                                                 \
+    h->before = before;                                                         \
+    return h;                                                                   \
+}                                                                               \
+static inline bool NAME##_first(NAME* h, T a, T b) {                            \
+    return h->before ? h->before(a, b) : LESS(a, b);                            \
+}                                                                               \
+void NAME##_push(NAME* h, T x) {                                                \
+    if (!h) return;                                                             \
+    if (h->len == h->cap) {                                                     \
+        h->cap = h->cap ? h->cap * 2 : 16;                                      \
+        h->v = wyn_realloc(h->v, sizeof(T) * h->cap);                           \
+    }                                                                           \
+    x = KEEP(x);                                                                \
+    long long i = h->len++;                                                     \
+    while (i > 0) {                                                             \
+        long long p = (i - 1) / 2;                                              \
+        if (!NAME##_first(h, x, h->v[p])) break;                                \
+        h->v[i] = h->v[p];                                                      \
+        i = p;                                                                  \
+    }                                                                           \
+    h->v[i] = x;                                                                \
+}                                                                               \
+T NAME##_pop(NAME* h) {                                                         \
+    if (!h || !h->len) return NONE;                                             \
+    T top = h->v[0];                                                            \
+    T x = h->v[--h->len];                                                       \
+    long long i = 0, n = h->len;                                                \
+    for (;;) {                                                                  \
+        long long c = 2 * i + 1;                                                \
+        if (c >= n) break;                                                      \
+        if (c + 1 < n && NAME##_first(h, h->v[c + 1], h->v[c])) c++;            \
+        if (!NAME##_first(h, h->v[c], x)) break;                                \
+        h->v[i] = h->v[c];                                                      \
+        i = c;                                                                  \
+    }                                                                           \
+    if (n) h->v[i] = x;                                                         \
+    return top;                                                                 \
+}                                                                               \
+T NAME##_peek(NAME* h) { return h && h->len ? SHOW(h->v[0]) : NONE; }          \
+long long NAME##_len(NAME* h) { return h ? h->len : 0; }                        \
+bool NAME##_is_empty(NAME* h) { return !h || h->len == 0; }
+
+#define WYN_HEAP_LESS(a, b) ((a) < (b))
+#define WYN_HEAP_STR_LESS(a, b) (strcmp((a), (b)) < 0)
+#define WYN_HEAP_SAME(x) (x)
+#define WYN_HEAP_STR_COPY(x) ((const char*)wyn_strdup(x))
+WYN_HEAP_DEFINE(PriorityQueue_int, long long, WYN_HEAP_LESS, WYN_HEAP_SAME, WYN_HEAP_SAME, 0)
+WYN_HEAP_DEFINE(PriorityQueue_float, double, WYN_HEAP_LESS, WYN_HEAP_SAME, WYN_HEAP_SAME, 0.0)
+WYN_HEAP_DEFINE(PriorityQueue_string, const char*, WYN_HEAP_STR_LESS, WYN_HEAP_STR_COPY, WYN_HEAP_STR_COPY, "")
+
+PriorityQueue_int* PriorityQueue_new(void) { return PriorityQueue_int_new(NULL); }
 
 int Net_listen(int port) {
     int sockfd = socket(AF_INET, SOCK_STREAM, 0);
@@ -4130,6 +4739,24 @@ int Net_listen(int port) {
 }
 
 int Net_connect(const char* host, int port) {
+#ifndef _WIN32
+    // Built-in resolver (dns.h): cached, and it parks a calling coroutine
+    // instead of blocking its worker in getaddrinfo.
+    char addrs[WYN_DNS_MAX_ADDRS][WYN_DNS_ADDRSTRLEN];
+    int count = wyn_dns_resolve(host, WYN_DNS_V4, addrs, WYN_DNS_MAX_ADDRS);
+    for (int i = 0; i < count; i++) {
+        struct sockaddr_in addr;
+        memset(&addr, 0, sizeof(addr));
+        addr.sin_family = AF_INET;
+        addr.sin_port = htons(port);
+        if (inet_pton(AF_INET, addrs[i], &addr.sin_addr) != 1) continue;
+        int sockfd = socket(AF_INET, SOCK_STREAM, 0);
+        if (sockfd < 0) return -1;
+        if (connect(sockfd, (struct sockaddr*)&addr, sizeof(addr)) == 0) return sockfd;
+        close(sockfd);
+    }
+    return -1;
+#else
     struct addrinfo hints, *res;
     memset(&hints, 0, sizeof(hints));
     hints.ai_family = AF_INET;
@@ -4146,6 +4773,7 @@ int Net_connect(const char* host, int port) {
     }
     freeaddrinfo(res);
     return sockfd;
+#endif
 }
 
 int Net_send(int sockfd, const char* data) {
@@ -4655,6 +5283,21 @@ static inline long long Task_is_cancelled(void) { return 0; }
 #define MAX_TASKS 64
 static WynTask* task_registry[MAX_TASKS] = {0};
 
+// Task.blocking(f): run f - typically an FFI call that blocks - on the
+// blocking-task pool, parking the calling coroutine instead of its scheduler
+// worker (see wyn_blocking_run in spawn_fast.c). Inline outside a coroutine.
+typedef struct { long long (*fn)(void); long long result; } WynBlockingCall;
+static void* task_blocking_job(void* p) {
+    WynBlockingCall* c = (WynBlockingCall*)p;
+    c->result = c->fn();
+    return NULL;
+}
+long long Task_blocking(long long (*fn)(void)) {
+    WynBlockingCall c = { fn, 0 };
+    wyn_blocking_run(task_blocking_job, &c);
+    return c.result;
+}
+
 long long Task_channel(long long capacity) {
     // Reject capacity < 1. A capacity-0 (unbuffered/rendezvous) channel can
     // never satisfy `size < capacity`, so every send blocks forever and recv
@@ -4987,8 +5630,119 @@ void Ptr_free(void* cell) {
 #ifdef WYN_USE_SQLITE
 #include <sqlite3.h>
 
-#define MAX_DB_HANDLES 16
-static sqlite3* db_handles[MAX_DB_HANDLES] = {0};
+// Connections live in a growable handle table; it used to be a fixed 16-slot
+// array, so the 16th Db.open failed. Each connection keeps an LRU cache of
+// prepared statements keyed by SQL text. Every Db.query/Db.query_p/Db.exec_p
+// used to pay sqlite3_prepare_v2 + sqlite3_finalize per call; the same SQL -
+// the normal case for a parameterized statement in a loop - now reuses the
+// compiled statement (sqlite3_reset + sqlite3_clear_bindings).
+// WYN_DB_STMT_CACHE sets the per-connection capacity (default 64, 0 = off).
+// Db.exec keeps sqlite3_exec: it may carry several statements.
+//
+// Db.cursor/Db.cursor_p return a row cursor over a cached statement. Db.next
+// steps one row, and Db.get_int/get_float/get_text/is_null read a column in
+// its SQLite type - no stringify-then-split round trip through the "a|b\nc|d"
+// text Db.query returns, and no whole result set in memory. The statement a
+// cursor holds is not handed to anyone else until Db.close_cursor; the same
+// SQL meanwhile prepares a second statement.
+//
+// Db.batch runs one cached statement over a whole array of rows in a single
+// blocking-pool job, committing every Db.set_batch_size rows; it used to take
+// one Db.exec_p per row, each its own autocommit transaction and so its own
+// fsync. Db.begin/Db.end (and the `Db.transaction(db) { }` block the parser
+// lowers onto them) nest through savepoints. A statement that fails inside a
+// transaction - or Db.rollback - marks the innermost level, and Db.end then
+// rolls it back instead of committing.
+//
+// Pool threads (Db calls offload from coroutines, see file_read) may share a
+// connection, so each cache sits behind the connection's own mutex; the
+// handle tables take a spinlock held only for a lookup or an insert.
+
+typedef struct {
+    char* sql;
+    unsigned hash;
+    sqlite3_stmt* stmt;
+    unsigned long long last_used;
+    int in_use;                 // borrowed by a call or a cursor
+} WynDbStmt;
+
+typedef struct {
+    unsigned serial;            // Db.begin's token carries it, so a stale Db.end is a no-op
+    int savepoint;              // SAVEPOINT inside an outer transaction, else BEGIN
+    int failed;                 // a statement failed or Db.rollback: roll back at Db.end
+} WynDbTx;
+
+typedef struct {
+    sqlite3* db;
+    pthread_mutex_t lock;
+    WynDbStmt* stmts;           // db_stmt_cache_max slots, allocated on first use
+    int stmt_count;
+    unsigned long long tick;
+    int cursors;                // open cursors; the connection outlives Db.close until 0
+    int closed;
+    WynDbTx* tx;                // open Db.begin levels, innermost last
+    int tx_depth;
+    int tx_cap;
+    unsigned tx_serial;
+    long long batch_size;       // Db.batch rows per commit, 0 = one transaction
+    char err[256];              // Db.batch failure, kept past its ROLLBACK
+} WynDbConn;
+
+typedef struct {
+    WynDbConn* conn;
+    sqlite3_stmt* stmt;
+    int slot;                   // cache slot, -1 = uncached (finalize on close)
+    int started;
+    int on_row;
+} WynDbCursor;
+
+static atomic_flag db_table_busy = ATOMIC_FLAG_INIT;
+static WynDbConn** db_conns = NULL;
+static long long db_conn_cap = 0;
+static long long db_conn_hint = 1;      // lowest handle that may be free
+static WynDbCursor** db_cursors = NULL;
+static long long db_cursor_cap = 0;
+static long long db_cursor_hint = 1;
+static int db_stmt_cache_max = -1;      // -1 = env not read yet
+
+static void db_table_lock(void) {
+    while (atomic_flag_test_and_set_explicit(&db_table_busy, memory_order_acquire)) sched_yield();
+}
+static void db_table_unlock(void) { atomic_flag_clear_explicit(&db_table_busy, memory_order_release); }
+
+// Caller holds the table lock. Stores p at the lowest free handle >= *hint,
+// growing the table as needed. Returns the handle, or -1 when out of memory.
+static long long db_table_put(void*** table, long long* cap, long long* hint, void* p) {
+    long long h = *hint;
+    while (h < *cap && (*table)[h]) h++;
+    if (h >= *cap) {
+        long long ncap = *cap ? *cap * 2 : 16;
+        void** n = realloc(*table, ncap * sizeof(void*));
+        if (!n) return -1;
+        memset(n + *cap, 0, (ncap - *cap) * sizeof(void*));
+        *table = n;
+        *cap = ncap;
+    }
+    (*table)[h] = p;
+    *hint = h + 1;
+    return h;
+}
+
+static WynDbConn* db_conn(long long handle) {
+    WynDbConn* c = NULL;
+    db_table_lock();
+    if (handle > 0 && handle < db_conn_cap) c = db_conns[handle];
+    db_table_unlock();
+    return c;
+}
+
+static WynDbCursor* db_cursor(long long handle) {
+    WynDbCursor* k = NULL;
+    db_table_lock();
+    if (handle > 0 && handle < db_cursor_cap) k = db_cursors[handle];
+    db_table_unlock();
+    return k;
+}
 
 long long Db_open(const char* path) {
     sqlite3* db;
@@ -4996,30 +5750,137 @@ long long Db_open(const char* path) {
         if (db) sqlite3_close(db);
         return -1;
     }
-    for (int i = 1; i < MAX_DB_HANDLES; i++) {
-        if (!db_handles[i]) { db_handles[i] = db; return i; }
+    WynDbConn* c = calloc(1, sizeof(WynDbConn));
+    if (!c) {
+        sqlite3_close(db);
+        return -1;
+    }
+    c->db = db;
+    c->batch_size = 50000;
+    pthread_mutex_init(&c->lock, NULL);
+    db_table_lock();
+    long long h = db_table_put((void***)&db_conns, &db_conn_cap, &db_conn_hint, c);
+    db_table_unlock();
+    if (h < 0) {
+        pthread_mutex_destroy(&c->lock);
+        free(c);
+        sqlite3_close(db);
+    }
+    return h;
+}
+
+static void db_conn_free(WynDbConn* c) {
+    for (int i = 0; i < c->stmt_count; i++) {
+        sqlite3_finalize(c->stmts[i].stmt);
+        free(c->stmts[i].sql);
+    }
+    free(c->stmts);
+    free(c->tx);
+    sqlite3_close(c->db);
+    pthread_mutex_destroy(&c->lock);
+    free(c);
+}
+
+// Borrow a prepared statement for sql: the cached one when it is idle, else a
+// fresh one that takes the least recently used idle slot. *slot is its cache
+// slot, or -1 when it is not cached (cache off or every slot borrowed).
+static sqlite3_stmt* db_stmt_acquire(WynDbConn* c, const char* sql, int* slot) {
+    if (db_stmt_cache_max < 0) {
+        const char* e = getenv("WYN_DB_STMT_CACHE");
+        int n = e && *e ? atoi(e) : 64;
+        db_stmt_cache_max = n < 0 ? 0 : n;
+    }
+    unsigned h = 2166136261u;
+    for (const char* p = sql; *p; p++) h = (h ^ (unsigned char)*p) * 16777619u;
+    *slot = -1;
+    pthread_mutex_lock(&c->lock);
+    for (int i = 0; i < c->stmt_count; i++) {
+        WynDbStmt* s = &c->stmts[i];
+        if (s->hash == h && !s->in_use && strcmp(s->sql, sql) == 0) {
+            s->in_use = 1;
+            s->last_used = ++c->tick;
+            *slot = i;
+            pthread_mutex_unlock(&c->lock);
+            return s->stmt;
+        }
     }
-    sqlite3_close(db);
-    return -1;
+    pthread_mutex_unlock(&c->lock);
+
+    sqlite3_stmt* stmt = NULL;
+    if (sqlite3_prepare_v2(c->db, sql, -1, &stmt, NULL) != SQLITE_OK) {
+        sqlite3_finalize(stmt);
+        return NULL;
+    }
+    if (!stmt || db_stmt_cache_max == 0) return stmt;    // !stmt: empty SQL
+    char* key = strdup(sql);
+    if (!key) return stmt;
+    pthread_mutex_lock(&c->lock);
+    if (!c->stmts) c->stmts = calloc(db_stmt_cache_max, sizeof(WynDbStmt));
+    int victim = -1;
+    if (c->stmts && c->stmt_count < db_stmt_cache_max) {
+        victim = c->stmt_count++;
+    } else if (c->stmts) {
+        for (int i = 0; i < c->stmt_count; i++)
+            if (!c->stmts[i].in_use && (victim < 0 || c->stmts[i].last_used < c->stmts[victim].last_used))
+                victim = i;
+    }
+    if (victim >= 0) {
+        WynDbStmt* s = &c->stmts[victim];
+        if (s->stmt) {
+            sqlite3_finalize(s->stmt);
+            free(s->sql);
+        }
+        s->sql = key;
+        s->hash = h;
+        s->stmt = stmt;
+        s->last_used = ++c->tick;
+        s->in_use = 1;
+        *slot = victim;
+        key = NULL;
+    }
+    pthread_mutex_unlock(&c->lock);
+    free(key);
+    return stmt;
 }
 
-int Db_exec(long long handle, const char* sql) {
-    if (handle <= 0 || handle >= MAX_DB_HANDLES || !db_handles[handle]) return -1;
-    char* err = NULL;
-    int rc = sqlite3_exec(db_handles[handle], sql, NULL, NULL, &err);
-    if (err) sqlite3_free(err);
-    return rc == SQLITE_OK ? 0 : -1;
+static void db_stmt_release(WynDbConn* c, sqlite3_stmt* stmt, int slot) {
+    if (slot < 0) {
+        sqlite3_finalize(stmt);
+        return;
+    }
+    sqlite3_reset(stmt);
+    sqlite3_clear_bindings(stmt);
+    pthread_mutex_lock(&c->lock);
+    c->stmts[slot].in_use = 0;
+    pthread_mutex_unlock(&c->lock);
 }
 
-char* Db_query(long long handle, const char* sql) {
-    if (handle <= 0 || handle >= MAX_DB_HANDLES || !db_handles[handle]) return "";
-    sqlite3_stmt* stmt;
-    if (sqlite3_prepare_v2(db_handles[handle], sql, -1, &stmt, NULL) != SQLITE_OK) return "";
-    
+static void db_bind_value(sqlite3_stmt* stmt, int i, const WynValue* v, sqlite3_destructor_type text) {
+    if (v->type == WYN_TYPE_STRING)
+        sqlite3_bind_text(stmt, i, v->data.string_val, -1, text);
+    else if (v->type == WYN_TYPE_FLOAT)
+        sqlite3_bind_double(stmt, i, v->data.float_val);
+    else
+        sqlite3_bind_int64(stmt, i, v->data.int_val);
+}
+
+static void db_bind_params(sqlite3_stmt* stmt, WynArray params) {
+    for (int i = 0; i < params.count; i++)
+        db_bind_value(stmt, i + 1, &params.data[i], SQLITE_TRANSIENT);
+}
+
+// A statement failed: the innermost open Db.begin level will roll back.
+static void db_tx_fail(WynDbConn* c) {
+    pthread_mutex_lock(&c->lock);
+    if (c->tx_depth > 0) c->tx[c->tx_depth - 1].failed = 1;
+    pthread_mutex_unlock(&c->lock);
+}
+
+// Rows as "a|b\nc|d", Db.query's result format. *rc is the last step's result.
+static char* db_rows_text(sqlite3_stmt* stmt, int* rc) {
     WynStrBuf sb; wyn_sb_init(&sb);
     int first_row = 1;
-
-    while (sqlite3_step(stmt) == SQLITE_ROW) {
+    while ((*rc = sqlite3_step(stmt)) == SQLITE_ROW) {
         if (!first_row) wyn_sb_append(&sb, "\n");
         first_row = 0;
         int cols = sqlite3_column_count(stmt);
@@ -5029,78 +5890,461 @@ char* Db_query(long long handle, const char* sql) {
             if (val) wyn_sb_append(&sb, val);
         }
     }
-    sqlite3_finalize(stmt);
     return wyn_sb_finish(&sb);
 }
 
-char* Db_query_one(long long handle, const char* sql) {
-    if (handle <= 0 || handle >= MAX_DB_HANDLES || !db_handles[handle]) return "";
-    sqlite3_stmt* stmt;
-    if (sqlite3_prepare_v2(db_handles[handle], sql, -1, &stmt, NULL) != SQLITE_OK) return "";
+static int db_exec_sql(WynDbConn* c, const char* sql) {
+    char* err = NULL;
+    int rc = sqlite3_exec(c->db, sql, NULL, NULL, &err);
+    if (err) sqlite3_free(err);
+    return rc == SQLITE_OK ? 0 : -1;
+}
+
+static int db_exec_now(long long handle, const char* sql) {
+    WynDbConn* c = db_conn(handle);
+    if (!c) return -1;
+    int rc = db_exec_sql(c, sql);
+    if (rc != 0) db_tx_fail(c);
+    return rc;
+}
+
+static char* db_query_p_now(long long handle, const char* sql, WynArray params) {
+    WynDbConn* c = db_conn(handle);
+    if (!c) return "";
+    int slot;
+    sqlite3_stmt* stmt = db_stmt_acquire(c, sql, &slot);
+    if (!stmt) {
+        db_tx_fail(c);
+        return "";
+    }
+    db_bind_params(stmt, params);
+    int rc;
+    char* out = db_rows_text(stmt, &rc);
+    db_stmt_release(c, stmt, slot);
+    if (rc != SQLITE_DONE) db_tx_fail(c);
+    return out;
+}
+
+static char* db_query_now(long long handle, const char* sql) {
+    WynArray none = {0};
+    return db_query_p_now(handle, sql, none);
+}
+
+static char* db_query_one_now(long long handle, const char* sql) {
+    WynDbConn* c = db_conn(handle);
+    if (!c) return "";
+    int slot;
+    sqlite3_stmt* stmt = db_stmt_acquire(c, sql, &slot);
+    if (!stmt) {
+        db_tx_fail(c);
+        return "";
+    }
     char* result = "";
-    if (sqlite3_step(stmt) == SQLITE_ROW) {
+    int rc = sqlite3_step(stmt);
+    if (rc == SQLITE_ROW) {
         const char* val = (const char*)sqlite3_column_text(stmt, 0);
         result = val ? strdup(val) : "";
+    } else if (rc != SQLITE_DONE) {
+        db_tx_fail(c);
     }
-    sqlite3_finalize(stmt);
+    db_stmt_release(c, stmt, slot);
     return result;
 }
 
 // Parameterized queries - prevent SQL injection
-int Db_exec_p(long long handle, const char* sql, WynArray params) {
-    if (handle <= 0 || handle >= MAX_DB_HANDLES || !db_handles[handle]) return -1;
-    sqlite3_stmt* stmt;
-    if (sqlite3_prepare_v2(db_handles[handle], sql, -1, &stmt, NULL) != SQLITE_OK) return -1;
-    for (int i = 0; i < params.count; i++) {
-        if (params.data[i].type == WYN_TYPE_STRING)
-            sqlite3_bind_text(stmt, i+1, params.data[i].data.string_val, -1, SQLITE_TRANSIENT);
-        else
-            sqlite3_bind_int64(stmt, i+1, params.data[i].data.int_val);
+static int db_exec_p_now(long long handle, const char* sql, WynArray params) {
+    WynDbConn* c = db_conn(handle);
+    if (!c) return -1;
+    int slot;
+    sqlite3_stmt* stmt = db_stmt_acquire(c, sql, &slot);
+    if (!stmt) {
+        db_tx_fail(c);
+        return -1;
     }
+    db_bind_params(stmt, params);
     int rc = sqlite3_step(stmt);
-    sqlite3_finalize(stmt);
-    return (rc == SQLITE_DONE || rc == SQLITE_OK) ? 0 : -1;
+    db_stmt_release(c, stmt, slot);
+    if (rc == SQLITE_DONE || rc == SQLITE_OK || rc == SQLITE_ROW) return 0;
+    db_tx_fail(c);
+    return -1;
 }
 
-char* Db_query_p(long long handle, const char* sql, WynArray params) {
-    if (handle <= 0 || handle >= MAX_DB_HANDLES || !db_handles[handle]) return "";
-    sqlite3_stmt* stmt;
-    if (sqlite3_prepare_v2(db_handles[handle], sql, -1, &stmt, NULL) != SQLITE_OK) return "";
-    for (int i = 0; i < params.count; i++) {
-        if (params.data[i].type == WYN_TYPE_STRING)
-            sqlite3_bind_text(stmt, i+1, params.data[i].data.string_val, -1, SQLITE_TRANSIENT);
-        else
-            sqlite3_bind_int64(stmt, i+1, params.data[i].data.int_val);
+// Db.batch: sql once per row. rows is either an array of row arrays or one
+// flat array holding the rows back to back (its length a multiple of the
+// statement's parameter count). Values bind in their Wyn type, text without a
+// copy (the array outlives the step). Outside a transaction every batch_size
+// rows commit; inside one nothing commits and a failure marks it. Returns the
+// rows inserted, or -1 (rows of already committed chunks stay).
+static long long db_batch_now(long long handle, const char* sql, WynArray rows) {
+    WynDbConn* c = db_conn(handle);
+    if (!c) return -1;
+    c->err[0] = '\0';
+    int slot;
+    sqlite3_stmt* stmt = db_stmt_acquire(c, sql, &slot);
+    if (!stmt) {
+        snprintf(c->err, sizeof(c->err), "%s", sqlite3_errmsg(c->db));
+        db_tx_fail(c);
+        return -1;
     }
-    WynStrBuf sb; wyn_sb_init(&sb);
-    int first_row = 1;
-    while (sqlite3_step(stmt) == SQLITE_ROW) {
-        if (!first_row) wyn_sb_append(&sb, "\n"); first_row = 0;
-        int cols = sqlite3_column_count(stmt);
-        for (int c = 0; c < cols; c++) {
-            if (c > 0) wyn_sb_append(&sb, "|");
-            const char* val = (const char*)sqlite3_column_text(stmt, c);
-            if (val) wyn_sb_append(&sb, val);
+    int np = sqlite3_bind_parameter_count(stmt);
+    int nested = rows.count > 0 && rows.data[0].type == WYN_TYPE_ARRAY;
+    long long nrows = nested ? rows.count : (np > 0 ? rows.count / np : 0);
+    int own = sqlite3_get_autocommit(c->db);
+    long long chunk = c->batch_size;
+    long long done = 0, in_chunk = 0;
+    int ok = 1;
+    if (!nested && rows.count > 0 && (np == 0 || rows.count % np != 0)) {
+        snprintf(c->err, sizeof(c->err), "Db.batch: %d values do not make rows of %d parameters", rows.count, np);
+        ok = 0;
+    }
+    for (long long r = 0; ok && r < nrows; r++) {
+        const WynValue* v = rows.data + r * np;
+        if (nested) {
+            WynArray* row = rows.data[r].type == WYN_TYPE_ARRAY ? rows.data[r].data.array_val : NULL;
+            if (!row || row->count != np) {
+                snprintf(c->err, sizeof(c->err), "Db.batch: row %lld has %d values, the statement takes %d",
+                         r, row ? row->count : 0, np);
+                ok = 0;
+                break;
+            }
+            v = row->data;
+        }
+        if (own && in_chunk == 0 && db_exec_sql(c, "BEGIN") != 0) {
+            snprintf(c->err, sizeof(c->err), "%s", sqlite3_errmsg(c->db));
+            ok = 0;
+            break;
+        }
+        for (int i = 0; i < np; i++) db_bind_value(stmt, i + 1, &v[i], SQLITE_STATIC);
+        int rc = sqlite3_step(stmt);
+        sqlite3_reset(stmt);
+        in_chunk++;
+        if (rc != SQLITE_DONE && rc != SQLITE_ROW) {
+            snprintf(c->err, sizeof(c->err), "Db.batch: row %lld: %s", r, sqlite3_errmsg(c->db));
+            ok = 0;
+            break;
+        }
+        done++;
+        if (own && in_chunk == chunk) {
+            if (db_exec_sql(c, "COMMIT") != 0) {
+                snprintf(c->err, sizeof(c->err), "%s", sqlite3_errmsg(c->db));
+                ok = 0;
+                break;
+            }
+            in_chunk = 0;
         }
     }
-    sqlite3_finalize(stmt);
-    return wyn_sb_finish(&sb);
+    if (own && in_chunk > 0 && ok && db_exec_sql(c, "COMMIT") != 0) {
+        snprintf(c->err, sizeof(c->err), "%s", sqlite3_errmsg(c->db));
+        ok = 0;
+    }
+    if (own && !sqlite3_get_autocommit(c->db)) db_exec_sql(c, "ROLLBACK");
+    db_stmt_release(c, stmt, slot);
+    if (!ok) {
+        if (!own) db_tx_fail(c);
+        return -1;
+    }
+    return done;
+}
+
+// Transactions. BEGIN/SAVEPOINT is cheap and runs inline; the COMMIT at
+// Db.end is where SQLite syncs, so that goes through the blocking pool.
+static int db_end_now(WynDbConn* c, unsigned serial, int savepoint, int failed) {
+    char sql[96];
+    if (savepoint) {
+        if (!failed) {
+            snprintf(sql, sizeof(sql), "RELEASE wyn_tx%u", serial);
+            if (db_exec_sql(c, sql) == 0) return 1;
+        }
+        snprintf(sql, sizeof(sql), "ROLLBACK TO wyn_tx%u; RELEASE wyn_tx%u", serial, serial);
+        db_exec_sql(c, sql);
+        return 0;
+    }
+    if (!failed && db_exec_sql(c, "COMMIT") == 0) return 1;
+    if (!sqlite3_get_autocommit(c->db)) db_exec_sql(c, "ROLLBACK");
+    return 0;
+}
+
+// sqlite3_step can take as long as the query does: from a coroutine every
+// statement runs on the blocking pool (see file_read). SQLite's default
+// serialized threading mode makes a handle safe to use from any pool thread.
+enum { WYN_DB_EXEC, WYN_DB_QUERY, WYN_DB_QUERY_ONE, WYN_DB_EXEC_P, WYN_DB_QUERY_P, WYN_DB_BATCH, WYN_DB_END };
+typedef struct {
+    int op;
+    long long handle;
+    const char* sql;
+    WynArray params;
+    int rc;
+    char* out;
+    long long n;
+    WynDbConn* conn;            // WYN_DB_END: the level to close
+    WynDbTx tx;
+} WynDbCall;
+
+static void* db_call_job(void* p) {
+    WynDbCall* c = (WynDbCall*)p;
+    switch (c->op) {
+        case WYN_DB_EXEC:      c->rc = db_exec_now(c->handle, c->sql); break;
+        case WYN_DB_QUERY:     c->out = db_query_now(c->handle, c->sql); break;
+        case WYN_DB_QUERY_ONE: c->out = db_query_one_now(c->handle, c->sql); break;
+        case WYN_DB_EXEC_P:    c->rc = db_exec_p_now(c->handle, c->sql, c->params); break;
+        case WYN_DB_QUERY_P:   c->out = db_query_p_now(c->handle, c->sql, c->params); break;
+        case WYN_DB_BATCH:     c->n = db_batch_now(c->handle, c->sql, c->params); break;
+        case WYN_DB_END:       c->rc = db_end_now(c->conn, c->tx.serial, c->tx.savepoint, c->tx.failed); break;
+    }
+    return NULL;
+}
+
+static WynDbCall db_call(int op, long long handle, const char* sql, WynArray params) {
+    WynDbCall c;
+    memset(&c, 0, sizeof(c));
+    c.op = op;
+    c.handle = handle;
+    c.sql = sql;
+    c.params = params;
+    wyn_blocking_run(db_call_job, &c);
+    return c;
+}
+
+int Db_exec(long long handle, const char* sql) {
+    WynArray none = {0};
+    return db_call(WYN_DB_EXEC, handle, sql, none).rc;
+}
+char* Db_query(long long handle, const char* sql) {
+    WynArray none = {0};
+    return db_call(WYN_DB_QUERY, handle, sql, none).out;
+}
+char* Db_query_one(long long handle, const char* sql) {
+    WynArray none = {0};
+    return db_call(WYN_DB_QUERY_ONE, handle, sql, none).out;
+}
+int Db_exec_p(long long handle, const char* sql, WynArray params) {
+    return db_call(WYN_DB_EXEC_P, handle, sql, params).rc;
+}
+char* Db_query_p(long long handle, const char* sql, WynArray params) {
+    return db_call(WYN_DB_QUERY_P, handle, sql, params).out;
+}
+long long Db_batch(long long handle, const char* sql, WynArray rows) {
+    return db_call(WYN_DB_BATCH, handle, sql, rows).n;
+}
+
+void Db_set_batch_size(long long handle, long long rows) {
+    WynDbConn* c = db_conn(handle);
+    if (c) c->batch_size = rows < 0 ? 0 : rows;
+}
+
+// Import mode: WAL journal and synchronous=NORMAL - commits stop waiting for
+// an fsync of the main database, and a crash still cannot corrupt it (at worst
+// the last commits are lost). Off restores SQLite's defaults.
+bool Db_set_import_mode(long long handle, bool on) {
+    WynDbConn* c = db_conn(handle);
+    if (!c) return false;
+    return db_exec_sql(c, on ? "PRAGMA journal_mode=WAL; PRAGMA synchronous=NORMAL"
+                             : "PRAGMA synchronous=FULL; PRAGMA journal_mode=DELETE") == 0;
+}
+
+// Db.begin returns a token naming the level it opened (serial << 32 | handle);
+// -1 when no transaction could start.
+long long Db_begin(long long handle) {
+    WynDbConn* c = db_conn(handle);
+    if (!c || handle >= (1LL << 32)) return -1;
+    pthread_mutex_lock(&c->lock);
+    if (c->tx_depth == c->tx_cap) {
+        int ncap = c->tx_cap ? c->tx_cap * 2 : 4;
+        WynDbTx* n = realloc(c->tx, ncap * sizeof(WynDbTx));
+        if (!n) {
+            pthread_mutex_unlock(&c->lock);
+            return -1;
+        }
+        c->tx = n;
+        c->tx_cap = ncap;
+    }
+    WynDbTx t = { ++c->tx_serial, c->tx_depth > 0 || !sqlite3_get_autocommit(c->db), 0 };
+    pthread_mutex_unlock(&c->lock);
+    char sql[48];
+    if (t.savepoint) snprintf(sql, sizeof(sql), "SAVEPOINT wyn_tx%u", t.serial);
+    else snprintf(sql, sizeof(sql), "BEGIN");
+    if (db_exec_sql(c, sql) != 0) return -1;
+    pthread_mutex_lock(&c->lock);
+    c->tx[c->tx_depth++] = t;
+    pthread_mutex_unlock(&c->lock);
+    return ((long long)t.serial << 32) | handle;
+}
+
+// Close the level tx opened - and any inner ones left open - committing it
+// unless something inside failed. True when it committed.
+bool Db_end(long long tx) {
+    if (tx < 0) return false;
+    WynDbConn* c = db_conn(tx & 0xffffffffLL);
+    if (!c) return false;
+    unsigned serial = (unsigned)(tx >> 32);
+    pthread_mutex_lock(&c->lock);
+    int i = c->tx_depth - 1;
+    while (i >= 0 && c->tx[i].serial != serial) i--;
+    if (i < 0) {
+        pthread_mutex_unlock(&c->lock);
+        return false;
+    }
+    WynDbTx t = c->tx[i];
+    for (int j = i + 1; j < c->tx_depth; j++) t.failed |= c->tx[j].failed;
+    c->tx_depth = i;
+    pthread_mutex_unlock(&c->lock);
+    WynDbCall call;
+    memset(&call, 0, sizeof(call));
+    call.op = WYN_DB_END;
+    call.conn = c;
+    call.tx = t;
+    wyn_blocking_run(db_call_job, &call);
+    return call.rc == 1;
+}
+
+void Db_rollback(long long handle) {
+    WynDbConn* c = db_conn(handle);
+    if (c) db_tx_fail(c);
+}
+
+// Row cursors. Db.next steps the statement in place; only the FIRST step goes
+// through the blocking pool - that is where SQLite sorts, aggregates or scans
+// up to the first match - while later steps are usually microseconds and a
+// thread handoff per row would cost more than the row.
+static long long db_cursor_open(long long handle, const char* sql, WynArray params) {
+    WynDbConn* c = db_conn(handle);
+    if (!c) return -1;
+    WynDbCursor* k = calloc(1, sizeof(WynDbCursor));
+    if (!k) return -1;
+    k->stmt = db_stmt_acquire(c, sql, &k->slot);
+    if (!k->stmt) {
+        free(k);
+        return -1;
+    }
+    db_bind_params(k->stmt, params);
+    k->conn = c;
+    pthread_mutex_lock(&c->lock);
+    c->cursors++;
+    pthread_mutex_unlock(&c->lock);
+    db_table_lock();
+    long long h = db_table_put((void***)&db_cursors, &db_cursor_cap, &db_cursor_hint, k);
+    db_table_unlock();
+    if (h < 0) {
+        db_stmt_release(c, k->stmt, k->slot);
+        pthread_mutex_lock(&c->lock);
+        c->cursors--;
+        pthread_mutex_unlock(&c->lock);
+        free(k);
+    }
+    return h;
+}
+
+long long Db_cursor(long long handle, const char* sql) {
+    WynArray none = {0};
+    return db_cursor_open(handle, sql, none);
+}
+long long Db_cursor_p(long long handle, const char* sql, WynArray params) {
+    return db_cursor_open(handle, sql, params);
+}
+
+static void* db_cursor_step_job(void* p) {
+    return (void*)(intptr_t)sqlite3_step(((WynDbCursor*)p)->stmt);
+}
+
+bool Db_next(long long cursor) {
+    WynDbCursor* k = db_cursor(cursor);
+    if (!k || (k->started && !k->on_row)) return 0;
+    int rc = k->started ? sqlite3_step(k->stmt)
+                        : (int)(intptr_t)wyn_blocking_run(db_cursor_step_job, k);
+    k->started = 1;
+    k->on_row = rc == SQLITE_ROW;
+    if (rc != SQLITE_ROW && rc != SQLITE_DONE) db_tx_fail(k->conn);
+    return k->on_row;
+}
+
+// Column readers. Outside a row (before the first Db.next, after the last) or
+// past the last column they return 0 / 0.0 / "" rather than touch the statement.
+static sqlite3_stmt* db_cursor_col(long long cursor, long long col) {
+    WynDbCursor* k = db_cursor(cursor);
+    if (!k || !k->on_row || col < 0 || col >= sqlite3_column_count(k->stmt)) return NULL;
+    return k->stmt;
+}
+long long Db_get_int(long long cursor, long long col) {
+    sqlite3_stmt* s = db_cursor_col(cursor, col);
+    return s ? (long long)sqlite3_column_int64(s, (int)col) : 0;
+}
+double Db_get_float(long long cursor, long long col) {
+    sqlite3_stmt* s = db_cursor_col(cursor, col);
+    return s ? sqlite3_column_double(s, (int)col) : 0.0;
+}
+char* Db_get_text(long long cursor, long long col) {
+    sqlite3_stmt* s = db_cursor_col(cursor, col);
+    const char* v = s ? (const char*)sqlite3_column_text(s, (int)col) : NULL;
+    if (!v) return "";
+    int n = sqlite3_column_bytes(s, (int)col);
+    char* out = wyn_str_alloc(n);
+    memcpy(out, v, n);
+    wyn_rc_set_length(out, (unsigned int)n);
+    return out;
+}
+bool Db_is_null(long long cursor, long long col) {
+    sqlite3_stmt* s = db_cursor_col(cursor, col);
+    return s ? sqlite3_column_type(s, (int)col) == SQLITE_NULL : 1;
+}
+long long Db_columns(long long cursor) {
+    WynDbCursor* k = db_cursor(cursor);
+    return k ? sqlite3_column_count(k->stmt) : 0;
+}
+char* Db_column_name(long long cursor, long long col) {
+    WynDbCursor* k = db_cursor(cursor);
+    if (!k || col < 0 || col >= sqlite3_column_count(k->stmt)) return "";
+    const char* name = sqlite3_column_name(k->stmt, (int)col);
+    return name ? wyn_strdup(name) : "";
+}
+
+void Db_close_cursor(long long cursor) {
+    WynDbCursor* k = NULL;
+    db_table_lock();
+    if (cursor > 0 && cursor < db_cursor_cap && db_cursors[cursor]) {
+        k = db_cursors[cursor];
+        db_cursors[cursor] = NULL;
+        if (cursor < db_cursor_hint) db_cursor_hint = cursor;
+    }
+    db_table_unlock();
+    if (!k) return;
+    WynDbConn* c = k->conn;
+    db_stmt_release(c, k->stmt, k->slot);
+    pthread_mutex_lock(&c->lock);
+    int last = --c->cursors == 0 && c->closed;
+    pthread_mutex_unlock(&c->lock);
+    if (last) db_conn_free(c);
+    free(k);
 }
 
 long long Db_last_insert_id(long long handle) {
-    if (handle <= 0 || handle >= MAX_DB_HANDLES || !db_handles[handle]) return 0;
-    return (long long)sqlite3_last_insert_rowid(db_handles[handle]);
+    WynDbConn* c = db_conn(handle);
+    return c ? (long long)sqlite3_last_insert_rowid(c->db) : 0;
 }
 
 char* Db_error(long long handle) {
-    if (handle <= 0 || handle >= MAX_DB_HANDLES || !db_handles[handle]) return "invalid handle";
-    return (char*)sqlite3_errmsg(db_handles[handle]);
+    WynDbConn* c = db_conn(handle);
+    if (!c) return "invalid handle";
+    if (sqlite3_errcode(c->db) == SQLITE_OK && c->err[0]) return c->err;
+    return (char*)sqlite3_errmsg(c->db);
 }
 
+// A connection with cursors still open is only unlinked here; the last
+// Db.close_cursor closes it.
 void Db_close(long long handle) {
-    if (handle <= 0 || handle >= MAX_DB_HANDLES || !db_handles[handle]) return;
-    sqlite3_close(db_handles[handle]);
-    db_handles[handle] = NULL;
+    WynDbConn* c = NULL;
+    db_table_lock();
+    if (handle > 0 && handle < db_conn_cap && db_conns[handle]) {
+        c = db_conns[handle];
+        db_conns[handle] = NULL;
+        if (handle < db_conn_hint) db_conn_hint = handle;
+    }
+    db_table_unlock();
+    if (!c) return;
+    pthread_mutex_lock(&c->lock);
+    c->closed = 1;
+    int last = c->cursors == 0;
+    pthread_mutex_unlock(&c->lock);
+    if (last) db_conn_free(c);
 }
 
 #else
@@ -5112,6 +6356,22 @@ char* Db_query_one(long long h, const char* sql) { (void)h;(void)sql; return "";
 long long Db_last_insert_id(long long h) { (void)h; return 0; }
 char* Db_error(long long h) { (void)h; return "sqlite not available"; }
 void Db_close(long long h) { (void)h; }
+long long Db_cursor(long long h, const char* sql) { (void)h;(void)sql; return -1; }
+long long Db_cursor_p(long long h, const char* sql, WynArray p) { (void)h;(void)sql;(void)p; return -1; }
+bool Db_next(long long c) { (void)c; return false; }
+long long Db_get_int(long long c, long long i) { (void)c;(void)i; return 0; }
+double Db_get_float(long long c, long long i) { (void)c;(void)i; return 0.0; }
+char* Db_get_text(long long c, long long i) { (void)c;(void)i; return ""; }
+bool Db_is_null(long long c, long long i) { (void)c;(void)i; return true; }
+long long Db_columns(long long c) { (void)c; return 0; }
+char* Db_column_name(long long c, long long i) { (void)c;(void)i; return ""; }
+void Db_close_cursor(long long c) { (void)c; }
+long long Db_batch(long long h, const char* sql, WynArray rows) { (void)h;(void)sql;(void)rows; return -1; }
+void Db_set_batch_size(long long h, long long n) { (void)h;(void)n; }
+bool Db_set_import_mode(long long h, bool on) { (void)h;(void)on; return false; }
+long long Db_begin(long long h) { (void)h; return -1; }
+bool Db_end(long long tx) { (void)tx; return false; }
+void Db_rollback(long long h) { (void)h; }
 #endif // WYN_USE_SQLITE
 
 // === StringBuilder - O(1) amortized append ===
@@ -5711,46 +6971,6 @@ char* DateTime_to_iso(long long timestamp) {
     return buf;
 }
 
-// === Regex extensions ===
-#ifndef _WIN32
-long long regex_find(const char* str, const char* pattern) {
-    regex_t re;
-    if (regcomp(&re, pattern, REG_EXTENDED) != 0) return -1;
-    regmatch_t match;
-    int result = regexec(&re, str, 1, &match, 0) == 0 ? match.rm_so : -1;
-    regfree(&re);
-    return result;
-}
-
-char* regex_find_all(const char* str, const char* pattern) {
-    regex_t re;
-    if (regcomp(&re, pattern, REG_EXTENDED) != 0) return "";
-    size_t cap = 1024, rlen = 0;
-    char* result = wyn_str_alloc(cap);
-    const char* p = str;
-    regmatch_t match;
-    while (regexec(&re, p, 1, &match, 0) == 0) {
-        size_t mlen = match.rm_eo - match.rm_so;
-        size_t needed = rlen + mlen + 1;
-        if (needed >= cap) {
-            cap = needed * 2;
-            char* nr = wyn_str_alloc(cap);
-            memcpy(nr, result, rlen);
-            wyn_rc_release(result);
-            result = nr;
-        }
-        memcpy(result + rlen, p + match.rm_so, mlen);
-        rlen += mlen;
-        result[rlen++] = '\n';
-        p += match.rm_eo;
-    }
-    result[rlen] = 0;
-    wyn_rc_set_length(result, (unsigned int)rlen);
-    regfree(&re);
-    return result;
-}
-#endif
-
 // === File extensions ===
 int File_rename(const char* old_path, const char* new_path) { return rename(old_path, new_path) == 0; }
 
@@ -5764,6 +6984,13 @@ void Test_assert_eq_float(double actual, double expected, double epsilon, const
 
 // === Net extensions ===
 char* Net_resolve(const char* hostname) {
+#ifndef _WIN32
+    char addrs[1][WYN_DNS_ADDRSTRLEN];
+    if (wyn_dns_resolve(hostname, WYN_DNS_V4, addrs, 1) < 1) return "";
+    char* ip = wyn_malloc(INET_ADDRSTRLEN);
+    snprintf(ip, INET_ADDRSTRLEN, "%s", addrs[0]);
+    return ip;
+#else
     struct addrinfo hints = {0}, *res;
     hints.ai_family = AF_INET;
     if (getaddrinfo(hostname, NULL, &hints, &res) != 0) return "";
@@ -5772,6 +6999,7 @@ char* Net_resolve(const char* hostname) {
     inet_ntop(AF_INET, &addr->sin_addr, ip, INET_ADDRSTRLEN);
     freeaddrinfo(res);
     return ip;
+#endif
 }
 
 // === Db extensions ===
@@ -5791,12 +7019,27 @@ char* Db_escape(const char* str) {
 static int log_level = 0; // 0=debug, 1=info, 2=warn, 3=error
 void Log_set_level(long long level) { log_level = (int)level; }
 
-static void log_with_timestamp(const char* level, const char* color, const char* msg) {
+typedef struct { const char* level; const char* color; const char* msg; } WynLogLine;
+
+static void* log_line_job(void* p) {
+    WynLogLine* l = (WynLogLine*)p;
     time_t now = time(NULL);
-    struct tm* t = localtime(&now);
+    struct tm tmv;
+#ifdef _WIN32
+    localtime_s(&tmv, &now);
+#else
+    localtime_r(&now, &tmv);    // pool threads log concurrently
+#endif
     char timestamp[32];
-    strftime(timestamp, sizeof(timestamp), "%Y-%m-%dT%H:%M:%S", t);
-    fprintf(stderr, "%s[%s] %s %s\x1b[0m\n", color, level, timestamp, msg);
+    strftime(timestamp, sizeof(timestamp), "%Y-%m-%dT%H:%M:%S", &tmv);
+    fprintf(stderr, "%s[%s] %s %s\x1b[0m\n", l->color, l->level, timestamp, l->msg);
+    return NULL;
+}
+
+// stderr may be a pipe nobody is draining fast enough; see file_read.
+static void log_with_timestamp(const char* level, const char* color, const char* msg) {
+    WynLogLine l = { level, color, msg };
+    wyn_blocking_run(log_line_job, &l);
 }
 
 void Log_debug(const char* msg) { if (log_level <= 0) log_with_timestamp("DEBUG", "\x1b[90m", msg); }
@@ -5805,7 +7048,7 @@ void Log_warn(const char* msg)  { if (log_level <= 2) log_with_timestamp("WARN",
 void Log_error(const char* msg) { if (log_level <= 3) log_with_timestamp("ERROR", "\x1b[31m", msg); }
 
 // === Process Module ===
-char* Process_exec_capture(const char* cmd) {
+static char* process_exec_capture_now(const char* cmd) {
 #ifdef WYN_MOBILE
     return "";
 #else
@@ -5822,6 +7065,10 @@ char* Process_exec_capture(const char* cmd) {
     return result;
 #endif
 }
+static void* process_exec_capture_job(void* cmd) { return process_exec_capture_now((const char*)cmd); }
+char* Process_exec_capture(const char* cmd) {
+    return (char*)wyn_blocking_run(process_exec_capture_job, (void*)cmd);
+}
 
 long long Process_exec_status(const char* cmd) {
 #if defined(WYN_MOBILE)
@@ -5996,25 +7243,6 @@ long long DateTime_hour(long long timestamp) { time_t t = (time_t)timestamp; str
 long long DateTime_minute(long long timestamp) { time_t t = (time_t)timestamp; struct tm* tm = localtime(&t); return tm ? tm->tm_min : 0; }
 long long DateTime_second(long long timestamp) { time_t t = (time_t)timestamp; struct tm* tm = localtime(&t); return tm ? tm->tm_sec : 0; }
 
-// === Regex extensions round 2 ===
-#ifndef _WIN32
-char* regex_split(const char* str, const char* pattern) {
-    regex_t re;
-    if (regcomp(&re, pattern, REG_EXTENDED) != 0) return wyn_strdup(str);
-    char* result = wyn_malloc(strlen(str) + 256); result[0] = 0;
-    const char* p = str;
-    regmatch_t match;
-    while (regexec(&re, p, 1, &match, 0) == 0) {
-        strncat(result, p, match.rm_so);
-        strcat(result, "\n");
-        p += match.rm_eo;
-    }
-    strcat(result, p);
-    regfree(&re);
-    return result;
-}
-#endif
-
 // === Encoding extensions round 2 ===
 char* Encoding_hex_decode(const char* hex) {
     int len = strlen(hex) / 2;
@@ -6189,62 +7417,259 @@ char* Json_to_pretty_string(WynJson* j) {
 }
 
 // === CSV MODULE ===
+// Two ways in. Csv.parse(text) builds an in-memory document from a string;
+// Csv.open(path) streams a file row by row and is what to use for exports that
+// do not fit in memory.
+//
+// Both run the same scanner. A reader holds a window of the file (4MB, grown
+// only when a single row is longer; each refill from a spawned task is one
+// blocking-pool handoff, and at 1MB those handoffs doubled the time of a
+// reader inside a task). A row is found in one SSE2 pass, 16 bytes
+// at a time, over ',', '"' and '\n' together: each '"' flips the quote state,
+// and outside quotes a ',' starts a field and a '\n' ends the row, so commas
+// and newlines inside quoted fields stay in the field. Then quoted fields are
+// unescaped in place ("" -> ") and every field is NUL-terminated where its
+// delimiter was. Fields are slices of the window rather than one allocation each, and
+// they stay valid until the next Csv.next. Csv.get_int/get_float parse straight
+// from the slice; only Csv.get_text copies.
+//
+// Csv.parse used to copy every field into its own allocation, kept a fixed
+// 4096-row table and 128 fields per row, and overran both. It now grows both,
+// and its fields point into one copy of the text.
+//
+// Csv.open_part(path, part, parts) opens the part-th of `parts` byte ranges of
+// the file, moved forward to row boundaries, so `parts` spawned workers can
+// each stream their share. Every row starts in exactly one part; the header
+// row belongs to part 0. Part boundaries are found by looking for the next
+// '\n', so this assumes no quoted field in the file contains a newline
+// (Csv.open on the whole file has no such restriction). Csv.column(r, name)
+// looks the name up in the file's first row, in every part.
+//
+// Reader handles come from a growable table like the Db handles. Refills go
+// through the blocking-task pool (see file_read), so a reader inside a spawned
+// task parks its coroutine rather than a scheduler worker while the disk reads.
 typedef struct { char** fields; int field_count; } CsvRow;
-typedef struct { CsvRow* rows; int row_count; char** headers; int header_count; } CsvDoc;
+typedef struct { CsvRow* rows; int row_count; char** headers; int header_count; char* text; } CsvDoc;
 
-static CsvRow csv_parse_row(const char* line) {
-    CsvRow row = {0};
-    row.fields = wyn_malloc(sizeof(char*) * 128);
-    const char* p = line;
-    while (*p) {
-        if (*p == '"') {
-            p++;
-            int cap = 256; char* f = wyn_malloc(cap); int len = 0;
-            while (*p) {
-                if (*p == '"' && *(p+1) == '"') { f[len++] = '"'; p += 2; }
-                else if (*p == '"') { p++; break; }
-                else { f[len++] = *p++; }
-                if (len >= cap - 1) { cap *= 2; f = wyn_realloc(f, cap); }
+#if defined(__SSE2__) && !defined(__TINYC__)
+#include <emmintrin.h>
+#define WYN_CSV_SSE2 1
+#endif
+#define WYN_CSV_WINDOW (4 << 20)
+
+#ifdef _WIN32
+#define wyn_csv_seek(f, off, whence) _fseeki64((f), (off), (whence))
+#define wyn_csv_tell(f) (long long)_ftelli64(f)
+#else
+#define wyn_csv_seek(f, off, whence) fseeko((f), (off_t)(off), (whence))
+#define wyn_csv_tell(f) (long long)ftello(f)
+#endif
+
+typedef struct {
+    FILE* f;
+    char* buf;
+    long cap, len, pos;       // buf[pos, len) is not consumed yet
+    int eof;
+    long long base;           // file offset of buf[0]
+    long long stop;           // rows starting at or past this offset belong to the next part; -1 = none
+    char** fields;
+    int nfields, fcap;
+    char** header;            // the file's first row, for Csv.column
+    int nheader;
+    int has_header;
+    char* path;
+} WynCsvReader;
+
+static void csv_push_field(WynCsvReader* r, char* f) {
+    if (r->nfields == r->fcap) {
+        int nc = r->fcap ? r->fcap * 2 : 16;
+        char** nf = realloc(r->fields, sizeof(char*) * nc);
+        if (!nf) return;
+        r->fields = nf; r->fcap = nc;
+    }
+    r->fields[r->nfields++] = f;
+}
+
+// Scan the row starting at s[i]: record where each field starts, and return
+// the index of the '\n' that ends the row, or -1 if s[i, n) has no complete
+// row yet. Nothing is written, so after a refill the row is simply scanned
+// again from its start.
+static long csv_scan_row(WynCsvReader* r, long i, long n) {
+    const char* s = r->buf;
+    int q = 0;
+    r->nfields = 0;
+    csv_push_field(r, r->buf + i);
+#ifdef WYN_CSV_SSE2
+    const __m128i cm = _mm_set1_epi8(','), dq = _mm_set1_epi8('"'), nl = _mm_set1_epi8('\n');
+    while (i + 16 <= n) {
+        __m128i v = _mm_loadu_si128((const __m128i*)(s + i));
+        unsigned m = (unsigned)_mm_movemask_epi8(_mm_or_si128(_mm_or_si128(
+            _mm_cmpeq_epi8(v, cm), _mm_cmpeq_epi8(v, dq)), _mm_cmpeq_epi8(v, nl)));
+        while (m) {
+            long k = i + __builtin_ctz(m);
+            if (s[k] == '"') q ^= 1;
+            else if (!q) {
+                if (s[k] == '\n') return k;
+                csv_push_field(r, r->buf + k + 1);
             }
-            f[len] = 0;
-            row.fields[row.field_count++] = f;
-            if (*p == ',') p++;
+            m &= m - 1;
+        }
+        i += 16;
+    }
+#endif
+    for (; i < n; i++) {
+        if (s[i] == '"') q ^= 1;
+        else if (!q && s[i] == ',') csv_push_field(r, r->buf + i + 1);
+        else if (!q && s[i] == '\n') return i;
+    }
+    return -1;
+}
+
+// Terminate the fields of a scanned row that ends at buf[e] (the '\n', a
+// '\r', or the spare byte past the data at EOF). A field that opens with a
+// quote is unescaped toward its start - the write cursor never passes the
+// read one - dropping single quotes and turning "" into ".
+static void csv_finish_row(WynCsvReader* r, long e) {
+    for (int k = 0; k < r->nfields; k++) {
+        char* f = r->fields[k];
+        char* end = k + 1 < r->nfields ? r->fields[k + 1] - 1 : r->buf + e;
+        if (f < end && *f == '"') {
+            char* w = f;
+            char* rd = f + 1;
+            for (;;) {
+                char* qp = memchr(rd, '"', end - rd);
+                char* stop = qp ? qp : end;
+                memmove(w, rd, stop - rd);
+                w += stop - rd;
+                if (!qp) break;
+                if (qp + 1 < end && qp[1] == '"') { *w++ = '"'; rd = qp + 2; }
+                else rd = qp + 1;
+            }
+            *w = 0;
         } else {
-            const char* start = p;
-            while (*p && *p != ',' && *p != '\n' && *p != '\r') p++;
-            int len = p - start;
-            char* f = wyn_malloc(len + 1); memcpy(f, start, len); f[len] = 0;
-            row.fields[row.field_count++] = f;
-            if (*p == ',') p++;
+            *end = 0;
         }
     }
-    return row;
+}
+
+typedef struct { WynCsvReader* r; size_t want; } CsvFill;
+static void* csv_fill_job(void* p) {
+    CsvFill* c = (CsvFill*)p;
+    return (void*)(intptr_t)fread(c->r->buf + c->r->len, 1, c->want, c->r->f);
+}
+
+// Slide the unread bytes to the front, grow if the window is already one
+// unfinished row, and read more. Returns 0 at EOF or on OOM.
+static int csv_refill(WynCsvReader* r) {
+    if (r->eof || !r->f) return 0;
+    if (r->pos > 0) {
+        memmove(r->buf, r->buf + r->pos, r->len - r->pos);
+        r->base += r->pos;
+        r->len -= r->pos;
+        r->pos = 0;
+    }
+    if (r->len >= r->cap - 1) {
+        char* nb = realloc(r->buf, r->cap * 2);
+        if (!nb) return 0;
+        r->buf = nb; r->cap *= 2;
+    }
+    CsvFill c = { r, (size_t)(r->cap - 1 - r->len) };
+    size_t got = (size_t)(intptr_t)wyn_blocking_run(csv_fill_job, &c);
+    if (got == 0) { r->eof = 1; return 0; }
+    r->len += (long)got;
+    return 1;
+}
+
+// Copy the current row into one block as the header.
+static void csv_keep_header(WynCsvReader* r) {
+    size_t bytes = 0;
+    for (int i = 0; i < r->nfields; i++) bytes += strlen(r->fields[i]) + 1;
+    char** h = malloc(sizeof(char*) * (r->nfields + 1) + bytes);
+    if (!h) return;
+    char* o = (char*)(h + r->nfields + 1);
+    for (int i = 0; i < r->nfields; i++) {
+        size_t n = strlen(r->fields[i]) + 1;
+        memcpy(o, r->fields[i], n);
+        h[i] = o; o += n;
+    }
+    r->header = h;
+    r->nheader = r->nfields;
+    r->has_header = 1;
+}
+
+// Advance to the next non-empty row. 0 at the end of the data or of the part.
+static int csv_next_row(WynCsvReader* r) {
+    for (;;) {
+        if (r->stop >= 0 && r->base + r->pos >= r->stop) return 0;
+        long eol = csv_scan_row(r, r->pos, r->len);
+        if (eol < 0) {
+            if (csv_refill(r)) continue;
+            if (r->pos >= r->len) return 0;
+            eol = r->len;             // last row without a trailing newline
+        }
+        long start = r->pos, e = eol;
+        if (e > start && r->buf[e - 1] == '\r') e--;
+        r->pos = eol < r->len ? eol + 1 : r->len;
+        if (e == start) continue;     // blank line
+        csv_finish_row(r, e);
+        if (!r->has_header && r->base + start == 0) csv_keep_header(r);
+        return 1;
+    }
+}
+
+// Over `text` (len bytes plus a NUL) if given, else over f with a len-byte window.
+static WynCsvReader* csv_reader_new(FILE* f, char* text, long len) {
+    WynCsvReader* r = calloc(1, sizeof(WynCsvReader));
+    if (!r) return NULL;
+    r->f = f;
+    r->stop = -1;
+    if (text) {
+        // In-memory: the text is the whole window, with its spare byte.
+        r->buf = text; r->len = len; r->cap = len + 1; r->eof = 1;
+    } else {
+        r->cap = len;                 // the window size
+        r->buf = malloc(r->cap);
+        if (!r->buf) { free(r); return NULL; }
+    }
+    return r;
+}
+
+static void csv_reader_free(WynCsvReader* r) {
+    if (!r) return;
+    if (r->f) { fclose(r->f); free(r->buf); }
+    free(r->path);
+    free(r->fields);
+    free(r->header);
+    free(r);
 }
 
 long long Csv_parse(const char* text) {
     CsvDoc* doc = wyn_malloc(sizeof(CsvDoc));
-    doc->rows = wyn_malloc(sizeof(CsvRow) * 4096);
-    doc->row_count = 0; doc->headers = NULL; doc->header_count = 0;
-    const char* p = text;
-    while (*p) {
-        const char* eol = p;
-        while (*eol && *eol != '\n') eol++;
-        int len = eol - p;
-        if (len > 0 && p[len-1] == '\r') len--;
-        if (len > 0) {
-            char* line = wyn_malloc(len + 1); memcpy(line, p, len); line[len] = 0;
-            CsvRow row = csv_parse_row(line);
-            free(line);
-            if (doc->row_count == 0) {
-                doc->headers = row.fields; doc->header_count = row.field_count;
-            }
-            doc->rows[doc->row_count++] = row;
+    memset(doc, 0, sizeof(CsvDoc));
+    long len = (long)strlen(text);
+    doc->text = wyn_malloc(len + 1);
+    memcpy(doc->text, text, len + 1);
+    WynCsvReader* r = csv_reader_new(NULL, doc->text, len);
+    int cap = 0;
+    while (r && csv_next_row(r)) {
+        if (doc->row_count == cap) {
+            cap = cap ? cap * 2 : 64;
+            doc->rows = wyn_realloc(doc->rows, sizeof(CsvRow) * cap);
         }
-        p = *eol ? eol + 1 : eol;
+        CsvRow* row = &doc->rows[doc->row_count++];
+        row->field_count = r->nfields;
+        row->fields = wyn_malloc(sizeof(char*) * (r->nfields ? r->nfields : 1));
+        memcpy(row->fields, r->fields, sizeof(char*) * r->nfields);
+    }
+    if (doc->row_count > 0) {
+        doc->headers = doc->rows[0].fields;
+        doc->header_count = doc->rows[0].field_count;
     }
+    csv_reader_free(r);
     return (long long)doc;
 }
 
+
 long long Csv_row_count(long long handle) {
     CsvDoc* d = (CsvDoc*)handle;
     return d ? d->row_count : 0;
@@ -6322,6 +7747,168 @@ void Csv_write(const char* path, WynArray rows) {
     fclose(f);
 }
 
+// Reader handle table.
+static WynCsvReader** csv_readers = NULL;
+static long long csv_reader_cap = 0, csv_reader_hint = 1;
+static atomic_flag csv_table_busy = ATOMIC_FLAG_INIT;
+static void csv_table_lock(void) {
+    while (atomic_flag_test_and_set_explicit(&csv_table_busy, memory_order_acquire)) {}
+}
+static void csv_table_unlock(void) { atomic_flag_clear_explicit(&csv_table_busy, memory_order_release); }
+
+static long long csv_reader_put(WynCsvReader* r) {
+    csv_table_lock();
+    long long h = csv_reader_hint;
+    while (h < csv_reader_cap && csv_readers[h]) h++;
+    if (h >= csv_reader_cap) {
+        long long nc = csv_reader_cap ? csv_reader_cap * 2 : 16;
+        WynCsvReader** nt = realloc(csv_readers, sizeof(WynCsvReader*) * nc);
+        if (!nt) { csv_table_unlock(); return -1; }
+        memset(nt + csv_reader_cap, 0, sizeof(WynCsvReader*) * (nc - csv_reader_cap));
+        csv_readers = nt;
+        csv_reader_cap = nc;
+    }
+    csv_readers[h] = r;
+    csv_reader_hint = h + 1;
+    csv_table_unlock();
+    return h;
+}
+static WynCsvReader* csv_reader(long long h) {
+    csv_table_lock();
+    WynCsvReader* r = h > 0 && h < csv_reader_cap ? csv_readers[h] : NULL;
+    csv_table_unlock();
+    return r;
+}
+
+long long Csv_open_part(const char* path, long long part, long long parts) {
+    if (parts < 1 || part < 0 || part >= parts) return -1;
+    FILE* f = fopen(path, "rb");
+    if (!f) return -1;
+    WynCsvReader* r = csv_reader_new(f, NULL, WYN_CSV_WINDOW);
+    if (!r) { fclose(f); return -1; }
+    r->path = strdup(path);
+    if (parts > 1) {
+        wyn_csv_seek(f, 0, SEEK_END);
+        long long size = wyn_csv_tell(f);
+        long long from = size * part / parts, to = size * (part + 1) / parts;
+        r->stop = part + 1 < parts ? to : -1;
+        wyn_csv_seek(f, from > 0 ? from - 1 : 0, SEEK_SET);
+        if (from > 0) {
+            // Start after the first '\n' at or past from-1, so a row that
+            // begins exactly at `from` is ours and not the previous part's.
+            r->base = from - 1;
+            for (;;) {
+                char* nl = memchr(r->buf + r->pos, '\n', r->len - r->pos);
+                if (nl) { r->pos = nl - r->buf + 1; break; }
+                r->pos = r->len;
+                if (!csv_refill(r)) break;
+            }
+        }
+    }
+    long long h = csv_reader_put(r);
+    if (h < 0) csv_reader_free(r);
+    return h;
+}
+
+long long Csv_open(const char* path) { return Csv_open_part(path, 0, 1); }
+
+bool Csv_next(long long reader) {
+    WynCsvReader* r = csv_reader(reader);
+    if (!r) return 0;
+    if (!csv_next_row(r)) { r->nfields = 0; return 0; }
+    return 1;
+}
+
+// Field readers. Before the first Csv.next, after the last, or past the last
+// field they return "" / 0 / 0.0.
+static const char* csv_field(long long reader, long long col) {
+    WynCsvReader* r = csv_reader(reader);
+    if (!r || col < 0 || col >= r->nfields) return NULL;
+    return r->fields[col];
+}
+long long Csv_columns(long long reader) {
+    WynCsvReader* r = csv_reader(reader);
+    return r ? r->nfields : 0;
+}
+char* Csv_get_text(long long reader, long long col) {
+    const char* f = csv_field(reader, col);
+    return f && *f ? wyn_strdup(f) : "";
+}
+long long Csv_get_int(long long reader, long long col) {
+    const char* f = csv_field(reader, col);
+    if (!f) return 0;
+    // Plain digits are the common case; anything else goes to strtoll.
+    const char* p = f;
+    int neg = *p == '-';
+    if (*p == '-' || *p == '+') p++;
+    unsigned long long v = 0;
+    const char* d = p;
+    while (*p >= '0' && *p <= '9' && p - d < 18) v = v * 10 + (unsigned)(*p++ - '0');
+    if (*p || p == d) return strtoll(f, NULL, 10);
+    return neg ? -(long long)v : (long long)v;
+}
+// Up to 15 significant digits and a plain decimal point: the integer made of
+// the digits and the power of ten are both exact doubles, so one division
+// rounds exactly as strtod would (Clinger's fast path). The rest - exponents,
+// long mantissas, inf/nan, stray text - go to strtod.
+static const double csv_pow10[] = {
+    1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11, 1e12, 1e13, 1e14, 1e15
+};
+double Csv_get_float(long long reader, long long col) {
+    const char* f = csv_field(reader, col);
+    if (!f) return 0.0;
+    const char* p = f;
+    int neg = *p == '-';
+    if (*p == '-' || *p == '+') p++;
+    unsigned long long m = 0;
+    int digits = 0, frac = 0;
+    while (*p >= '0' && *p <= '9') { m = m * 10 + (unsigned)(*p++ - '0'); digits++; }
+    if (*p == '.') {
+        p++;
+        while (*p >= '0' && *p <= '9') { m = m * 10 + (unsigned)(*p++ - '0'); digits++; frac++; }
+    }
+    if (*p || digits == 0 || digits > 15) return strtod(f, NULL);
+    double v = (double)m / csv_pow10[frac];
+    return neg ? -v : v;
+}
+// The header is kept for free when a reader passes the file's first row.
+// Asked for before that (or by a part that starts later) it is read once from
+// the start of the file by a second reader.
+static void csv_load_header(WynCsvReader* r) {
+    r->has_header = 1;
+    FILE* f = r->path ? fopen(r->path, "rb") : NULL;
+    WynCsvReader* h = f ? csv_reader_new(f, NULL, 64 * 1024) : NULL;
+    if (!h) { if (f) fclose(f); return; }
+    if (csv_next_row(h)) {
+        r->header = h->header; r->nheader = h->nheader;
+        h->header = NULL;
+    }
+    csv_reader_free(h);
+}
+
+long long Csv_column(long long reader, const char* name) {
+    WynCsvReader* r = csv_reader(reader);
+    if (!r) return -1;
+    if (!r->has_header) csv_load_header(r);
+    if (!r->header) return -1;
+    for (int i = 0; i < r->nheader; i++) {
+        if (strcmp(r->header[i], name) == 0) return i;
+    }
+    return -1;
+}
+
+void Csv_close(long long reader) {
+    WynCsvReader* r = NULL;
+    csv_table_lock();
+    if (reader > 0 && reader < csv_reader_cap && csv_readers[reader]) {
+        r = csv_readers[reader];
+        csv_readers[reader] = NULL;
+        if (reader < csv_reader_hint) csv_reader_hint = reader;
+    }
+    csv_table_unlock();
+    csv_reader_free(r);
+}
+
 // System.gc() - reset arena allocator, freeing all temporary strings
 // Call at the end of each request loop iteration in servers
 void System_gc() { wyn_arena_reset(); }
@@ -47,8 +47,9 @@ typedef struct {
 typedef struct WynArray { WynValue* restrict data; int count; int capacity; int writing; } WynArray;
 typedef struct { int start; int end; int current; } WynRange;
 typedef struct { const char* message; const char* type; } WynError;
-typedef struct { WynArray arr; } Queue;
-typedef struct { WynArray arr; } Stack;
+typedef struct { long long* buf; long long head, len, mask; } WynDeque;
+typedef WynDeque Queue;
+typedef WynDeque Stack;
 typedef struct { int tag; union { int ok_value; const char* err_value; } data; } ResultInt;
 typedef struct { int tag; union { const char* ok_value; const char* err_value; } data; } ResultString;
 typedef struct { int tag; int value; } OptionInt;
@@ -64,7 +65,7 @@ typedef struct {
 } WynStringBuilder;
 typedef struct { char type; /* o=object, a=array, s=string, n=number, b=bool, x=null */ char* key; char* str_val; double num_val; int parent; int next_sibling; int first_child; } JsonNode;
 typedef struct { char** fields; int field_count; } CsvRow;
-typedef struct { CsvRow* rows; int row_count; char** headers; int header_count; } CsvDoc;
+typedef struct { CsvRow* rows; int row_count; char** headers; int header_count; char* text; } CsvDoc;
 
 // Forward declarations
 void wyn_arena_reset();
@@ -170,6 +171,8 @@ int Env_set(const char* key, const char* val);
 WynClosure wyn_closure_new(void* fn, void* env);
 int wyn_closure_call_int(WynClosure c, int arg);
 const char* wyn_string_concat_safe(const char* left, const char* right);
+const char* wyn_string_append_owned(const char* left, const char** parts, const size_t* lens, int n);
+const void* wyn_rc_share(const void* ptr);
 int regex_match(const char* str, const char* pattern);
 char* regex_replace(const char* str, const char* pattern, const char* replacement);
 int Regex_match(const char* s, const char* p);
@@ -177,11 +180,22 @@ char* Regex_replace(const char* s, const char* p, const char* r);
 int Regex_find(const char* s, const char* p);
 char* regex_find_all(const char* str, const char* pattern);
 char* regex_split(const char* str, const char* pattern);
+long long regex_compile(const char* pattern);
+bool regex_is_match(long long h, const char* s);
+long long regex_find_in(long long h, const char* s);
+char* regex_replace_in(long long h, const char* s, const char* replacement);
+char* regex_find_all_in(long long h, const char* s);
+char* regex_split_in(long long h, const char* s);
+void regex_free(long long h);
 WynArray array_new();
 void array_push_int(WynArray* arr, long long value);
 void array_push_str(WynArray* arr, const char* value);
 void array_push_array(WynArray* arr, WynArray* nested);
 long long array_get_int(WynArray arr, int index);
+long long array_get_int_nc(WynArray arr, int index);
+double array_get_float_nc(WynArray arr, int index);
+bool array_get_bool_nc(WynArray arr, int index);
+const char* array_get_str_nc(WynArray arr, int index);
 const char* array_get_str(WynArray arr, int index);
 WynValue array_get(WynArray arr, int index);
 WynArray* array_get_array(WynArray arr, int index);
@@ -201,6 +215,47 @@ WynIntArray int_array_new();
 void int_array_push(WynIntArray* a, long long v);
 long long int_array_get(WynIntArray a, int i);
 int int_array_len(WynIntArray a);
+void int_array_sort(WynIntArray* a);
+
+// Packed (unboxed) arrays - see the block in wyn_runtime.h
+typedef struct { double* data; int count; int capacity; } WynFloatArray;
+typedef struct { uint8_t* data; int count; int capacity; } WynBoolArray;
+typedef struct { void* data; int count; int capacity; } WynStructArray;
+#define int_array_at(arr, idx) int_array_at_impl(arr, idx, __FILE__, __LINE__)
+long long int_array_at_impl(WynIntArray a, int i, const char* file, int line);
+void int_array_set(WynIntArray* a, int i, long long v);
+long long int_array_sum(WynIntArray a);
+void int_array_free(WynIntArray* a);
+WynFloatArray float_array_new();
+void float_array_push(WynFloatArray* a, double v);
+#define float_array_get(arr, idx) float_array_get_impl(arr, idx, __FILE__, __LINE__)
+double float_array_get_impl(WynFloatArray a, int i, const char* file, int line);
+void float_array_set(WynFloatArray* a, int i, double v);
+int float_array_len(WynFloatArray a);
+double float_array_sum(WynFloatArray a);
+void float_array_sort(WynFloatArray* a);
+void float_array_free(WynFloatArray* a);
+WynBoolArray bool_array_new();
+void bool_array_push(WynBoolArray* a, int v);
+#define bool_array_get(arr, idx) bool_array_get_impl(arr, idx, __FILE__, __LINE__)
+bool bool_array_get_impl(WynBoolArray a, int i, const char* file, int line);
+void bool_array_set(WynBoolArray* a, int i, int v);
+int bool_array_len(WynBoolArray a);
+void bool_array_free(WynBoolArray* a);
+WynStructArray struct_array_new();
+void* struct_array_slot(WynStructArray* a, int i, size_t elem_size, const char* file, int line);
+void* struct_array_push_slot(WynStructArray* a, size_t elem_size);
+#define struct_array_push(arr, value, T) ({ \
+    T __sa_tmp = (value); \
+    *(T*)struct_array_push_slot((arr), sizeof(T)) = __sa_tmp; (void)0; \
+})
+#define struct_array_get(arr, idx, T) (*(T*)struct_array_slot(&(arr), (idx), sizeof(T), __FILE__, __LINE__))
+#define struct_array_set(arr, idx, value, T) ({ \
+    T __sa_val = (value); WynStructArray* __sa_a = (arr); int __sa_i = (idx); \
+    if (__sa_i >= 0 && __sa_i < __sa_a->count) ((T*)__sa_a->data)[__sa_i] = __sa_val; (void)0; \
+})
+int struct_array_len(WynStructArray a);
+void struct_array_free(WynStructArray* a);
 int array_pop(WynArray* arr);
 int array_index_of(WynArray arr, int value);
 void array_reverse(WynArray* arr);
@@ -571,16 +626,50 @@ long long DateTime_millis();
 long long DateTime_micros();
 char* DateTime_format(int timestamp, const char* fmt);
 void DateTime_sleep(int seconds);
+WynDeque* Deque_new(void);
+void Deque_push_back(WynDeque* d, long long v);
+void Deque_push_front(WynDeque* d, long long v);
+long long Deque_pop_front(WynDeque* d);
+long long Deque_pop_back(WynDeque* d);
+long long Deque_front(WynDeque* d);
+long long Deque_back(WynDeque* d);
+long long Deque_get(WynDeque* d, long long i);
+void Deque_set(WynDeque* d, long long i, long long v);
+long long Deque_len(WynDeque* d);
+bool Deque_is_empty(WynDeque* d);
+void Deque_clear(WynDeque* d);
 Queue* Queue_new();
-void Queue_push(Queue* q, int value);
-int Queue_pop(Queue* q);
-int Queue_peek(Queue* q);
+void Queue_push(Queue* q, long long value);
+long long Queue_pop(Queue* q);
+long long Queue_peek(Queue* q);
 int Queue_len(Queue* q);
 int Queue_is_empty(Queue* q);
+typedef struct PriorityQueue_int PriorityQueue_int;
+typedef struct PriorityQueue_float PriorityQueue_float;
+typedef struct PriorityQueue_string PriorityQueue_string;
+PriorityQueue_int* PriorityQueue_new(void);
+PriorityQueue_int* PriorityQueue_int_new(bool (*before)(long long, long long));
+void PriorityQueue_int_push(PriorityQueue_int* h, long long x);
+long long PriorityQueue_int_pop(PriorityQueue_int* h);
+long long PriorityQueue_int_peek(PriorityQueue_int* h);
+long long PriorityQueue_int_len(PriorityQueue_int* h);
+bool PriorityQueue_int_is_empty(PriorityQueue_int* h);
+PriorityQueue_float* PriorityQueue_float_new(bool (*before)(double, double));
+void PriorityQueue_float_push(PriorityQueue_float* h, double x);
+double PriorityQueue_float_pop(PriorityQueue_float* h);
+double PriorityQueue_float_peek(PriorityQueue_float* h);
+long long PriorityQueue_float_len(PriorityQueue_float* h);
+bool PriorityQueue_float_is_empty(PriorityQueue_float* h);
+PriorityQueue_string* PriorityQueue_string_new(bool (*before)(const char*, const char*));
+void PriorityQueue_string_push(PriorityQueue_string* h, const char* x);
+const char* PriorityQueue_string_pop(PriorityQueue_string* h);
+const char* PriorityQueue_string_peek(PriorityQueue_string* h);
+long long PriorityQueue_string_len(PriorityQueue_string* h);
+bool PriorityQueue_string_is_empty(PriorityQueue_string* h);
 Stack* Stack_new();
-void Stack_push(Stack* s, int value);
-int Stack_pop(Stack* s);
-int Stack_peek(Stack* s);
+void Stack_push(Stack* s, long long value);
+long long Stack_pop(Stack* s);
+long long Stack_peek(Stack* s);
 int Stack_len(Stack* s);
 int Stack_is_empty(Stack* s);
 int Net_listen(int port);
@@ -689,11 +778,28 @@ void Task_send(long long handle, long long value);
 long long Task_recv(long long handle);
 void Task_close(long long handle);
 long long Task_try_recv(long long handle, long long* out_value);
+long long Task_blocking(long long (*fn)(void));
 long long Task_select_2(long long ch1, long long ch2);
 long long Task_select_3(long long ch1, long long ch2, long long ch3);
 // Db declared in module declarations block above
 long long Db_last_insert_id(long long handle);
 char* Db_error(long long handle);
+long long Db_cursor(long long handle, const char* sql);
+long long Db_cursor_p(long long handle, const char* sql, ...);
+bool Db_next(long long cursor);
+long long Db_get_int(long long cursor, long long col);
+double Db_get_float(long long cursor, long long col);
+char* Db_get_text(long long cursor, long long col);
+bool Db_is_null(long long cursor, long long col);
+long long Db_columns(long long cursor);
+char* Db_column_name(long long cursor, long long col);
+void Db_close_cursor(long long cursor);
+long long Db_batch(long long handle, const char* sql, ...);
+void Db_set_batch_size(long long handle, long long rows);
+bool Db_set_import_mode(long long handle, bool on);
+long long Db_begin(long long handle);
+bool Db_end(long long tx);
+void Db_rollback(long long handle);
 long long StringBuilder_new();
 void StringBuilder_append(long long handle, const char* s);
 long long StringBuilder_len(long long handle);
@@ -788,6 +894,15 @@ const char* Csv_get_field(long long handle, long long row, const char* header);
 long long Csv_col_count(long long handle, long long row);
 const char* Csv_header(long long handle, long long col);
 long long Csv_header_count(long long handle);
+long long Csv_open(const char* path);
+long long Csv_open_part(const char* path, long long part, long long parts);
+bool Csv_next(long long reader);
+long long Csv_columns(long long reader);
+long long Csv_column(long long reader, const char* name);
+char* Csv_get_text(long long reader, long long col);
+long long Csv_get_int(long long reader, long long col);
+double Csv_get_float(long long reader, long long col);
+void Csv_close(long long reader);
 void System_gc();
 void Data_save(const char* path, WynHashMap* map);
 WynHashMap* Data_load(const char* path);
@@ -796,7 +911,6 @@ char* Template_render(const char* path, WynHashMap* ctx);
 void System_load_env(const char* path);
 
 // Inline codegen helpers
-static inline char* int_to_string(long long n) { static char __buf[32]; snprintf(__buf, sizeof(__buf), "%lld", n); return __buf; }
 // Canonical float text - MUST stay byte-identical to wyn_format_float in
 // wyn_runtime.h (slim and full builds have to print the same thing). Shortest
 // round-trip: try 15/16/17 significant digits, take the first that strtod's
@@ -819,6 +933,74 @@ static inline char* float_to_string(double n) {
     }
     return __buf;
 }
+// Allocation-free number formatting for interpolation - MUST stay
+// byte-identical to wyn_fmt_i64 / wyn_fmt_f64 in wyn_runtime.h (see the
+// reasoning there); the float fallback here is float_to_string above.
+static const char wyn_digit_pairs[201] =
+    "00010203040506070809101112131415161718192021222324252627282930313233343536373839"
+    "40414243444546474849505152535455565758596061626364656667686970717273747576777879"
+    "8081828384858687888990919293949596979899";
+static inline int wyn_fmt_u64(char* out, unsigned long long v) {
+    static const unsigned long long p10[20] = {
+        1ULL, 10ULL, 100ULL, 1000ULL, 10000ULL, 100000ULL, 1000000ULL, 10000000ULL,
+        100000000ULL, 1000000000ULL, 10000000000ULL, 100000000000ULL, 1000000000000ULL,
+        10000000000000ULL, 100000000000000ULL, 1000000000000000ULL, 10000000000000000ULL,
+        100000000000000000ULL, 1000000000000000000ULL, 10000000000000000000ULL };
+    int n = 1;
+    while (n < 20 && v >= p10[n]) n++;
+    char* p = out + n;
+    while (v >= 100) {
+        unsigned idx = (unsigned)(v % 100) * 2;
+        v /= 100;
+        *--p = wyn_digit_pairs[idx + 1];
+        *--p = wyn_digit_pairs[idx];
+    }
+    if (v >= 10) { *--p = wyn_digit_pairs[v * 2 + 1]; *--p = wyn_digit_pairs[v * 2]; }
+    else *--p = (char)('0' + v);
+    return n;
+}
+static inline int wyn_fmt_i64(char* out, long long v) {
+    if (v < 0) { out[0] = '-'; return 1 + wyn_fmt_u64(out + 1, 0ULL - (unsigned long long)v); }
+    return wyn_fmt_u64(out, (unsigned long long)v);
+}
+static inline int wyn_fmt_f64(char* out, double x) {
+    static const double p10[18] = { 1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8,
+                                    1e9, 1e10, 1e11, 1e12, 1e13, 1e14, 1e15, 1e16, 1e17 };
+    double a = x < 0 ? -x : x;
+    if (x == 0) {
+        if (signbit(x)) { memcpy(out, "-0.0", 4); return 4; }
+        memcpy(out, "0.0", 3); return 3;
+    }
+    if (a >= 1e-4 && a < 1e15) {
+        for (int k = 0; k < 18; k++) {
+            double s = a * p10[k];
+            if (s >= 1e15) break;
+            unsigned long long m = (unsigned long long)(s + 0.5);
+            if ((double)m / p10[k] != a) continue;
+            char d[20];
+            int nd = wyn_fmt_u64(d, m), n = 0;
+            if (x < 0) out[n++] = '-';
+            if (k == 0) {
+                memcpy(out + n, d, nd); n += nd;
+                out[n++] = '.'; out[n++] = '0';
+            } else if (nd > k) {
+                memcpy(out + n, d, nd - k); n += nd - k;
+                out[n++] = '.';
+                memcpy(out + n, d + nd - k, k); n += k;
+            } else {
+                out[n++] = '0'; out[n++] = '.';
+                for (int z = nd; z < k; z++) out[n++] = '0';
+                memcpy(out + n, d, nd); n += nd;
+            }
+            return n;
+        }
+    }
+    const char* t = float_to_string(x);
+    int n = (int)strlen(t);
+    memcpy(out, t, n);
+    return n;
+}
+static inline char* int_to_string(long long n) { static char __buf[32]; __buf[wyn_fmt_i64(__buf, n)] = 0; return __buf; }
 static inline char* str_to_string(const char* s) { return (char*)s; }
 static inline char* bool_to_string(bool b) { return b ? "true" : "false"; }
 char* array_to_string(WynArray arr);  // defined in the runtime lib (wyn_runtime.h)
@@ -860,5 +1042,27 @@ char* array_to_string(WynArray arr);  // defined in the runtime lib (wyn_runtime
     WynArray: array_to_string, \
     default: int_to_string)(x)
 
+// Interpolation pieces: "${x}" formats x by its C type with the same mapping as
+// to_string(), but ints/floats land in the caller's stack buffer `b` (>= 40
+// bytes) and strings/bools are returned as-is, so no piece allocates. *n gets
+// the byte length. Only an array is rendered through array_to_string(); that
+// string is handed back in *o for the caller to release after copying.
+static inline const char* wyn_interp_i64(long long v, char* b, size_t* n, const char** o) { (void)o; *n = (size_t)wyn_fmt_i64(b, v); return b; }
+static inline const char* wyn_interp_f64(double v, char* b, size_t* n, const char** o) { (void)o; *n = (size_t)wyn_fmt_f64(b, v); return b; }
+static inline const char* wyn_interp_bool(bool v, char* b, size_t* n, const char** o) { (void)b; (void)o; *n = v ? 4 : 5; return v ? "true" : "false"; }
+static inline const char* wyn_interp_str(const char* s, char* b, size_t* n, const char** o) { (void)b; (void)o; if (!s) s = ""; *n = strlen(s); return s; }
+static inline const char* wyn_interp_arr(WynArray a, char* b, size_t* n, const char** o) { (void)b; const char* s = array_to_string(a); *o = s; if (!s) s = ""; *n = strlen(s); return s; }
+#define wyn_interp_piece(x, b, n, o) _Generic((x), \
+    int: wyn_interp_i64, \
+    long: wyn_interp_i64, \
+    long long: wyn_interp_i64, \
+    float: wyn_interp_f64, \
+    double: wyn_interp_f64, \
+    char*: wyn_interp_str, \
+    const char*: wyn_interp_str, \
+    bool: wyn_interp_bool, \
+    WynArray: wyn_interp_arr, \
+    default: wyn_interp_i64)(x, b, n, o)
+
 static inline void print_val(const char* s) { if(s) fputs(s, stdout); }
 #endif
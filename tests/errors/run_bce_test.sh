@@ -0,0 +1,162 @@
+#!/bin/bash
+# Bounds-check elimination gate. Inside `for i in <lit>..xs.len()` and
+# `for i, v in xs` codegen reads xs[i] without the range check when the body
+# provably keeps i and xs's length fixed (see the BCE block in
+# codegen_lambda.c). A wrong elimination is a silent out-of-bounds read, so
+# this checks both directions: the recognised loops print the right values and
+# really lose their checks, and every shape the analysis must reject keeps
+# them - including one that still panics on a bad index.
+set -uo pipefail
+WYN="${WYN:-./wyn}"
+case "$WYN" in /*) ;; *) WYN="$(pwd)/$WYN" ;; esac
+TMP=$(mktemp -d); trap 'rm -rf "$TMP"' EXIT
+PASS=0; FAIL=0
+ok(){ echo "  ok    $1"; PASS=$((PASS+1)); }
+bad(){ echo "  FAIL  $1"; FAIL=$((FAIL+1)); }
+
+run() {
+    perl -e 'alarm(60); exec @ARGV' -- "$WYN" run "$1" 2>&1 | grep -v "Compiled in"
+}
+expect() {
+    local name="$1" file="$2" want="$3" got
+    got=$(run "$file")
+    if [ "$got" = "$want" ]; then ok "$name"; else bad "$name: got=[$got] want=[$want]"; fi
+}
+gen_c() {
+    ( cd "$TMP" && "$WYN" build "$1.wyn" --debug >/dev/null 2>&1 )
+}
+
+# 1. Eligible loops over every layout: packed int/float/bool, a boxed
+#    [string] parameter, and an element store inside for-in.
+cat > "$TMP/elim.wyn" <<'EOF'
+fn sum_range(n: int) -> int {
+    var xs: [int] = []
+    var i = 0
+    while i < n {
+        xs.push(i)
+        i = i + 1
+    }
+    var t = 0
+    for k in 0..xs.len() {
+        t = t + xs[k]
+    }
+    return t
+}
+fn chars(ws: [string]) -> int {
+    var c = 0
+    for j in 1..ws.len() {
+        c = c + ws[j].len()
+    }
+    return c
+}
+fn main() {
+    println(sum_range(10))
+    var fs = [1.5, 2.5, 3.0]
+    var s = 0.0
+    for i, v in fs {
+        s = s + fs[i] * v
+        fs[i] = v * 2.0
+    }
+    println(s)
+    println(fs[2])
+    var bs = [true, false, true]
+    var n = 0
+    for i in 0..bs.len() {
+        if bs[i] {
+            n = n + 1
+        }
+    }
+    println(n)
+    println(chars(["ab", "cde", "f"]))
+}
+EOF
+expect "eligible loops compute the same values" "$TMP/elim.wyn" $'45\n17.5\n6.0\n2\n4'
+gen_c elim
+for pat in "t + ((xs).data)\[k\]" "((fs).data)\[i\] = " "((bool)((bs).data)\[i\])" "array_get_str_nc(ws, j)"; do
+    if grep -q "$pat" "$TMP/elim.wyn.c"; then ok "unchecked: $pat"; else bad "unchecked: $pat"; fi
+done
+if grep -q "float_array_get(fs, 2)" "$TMP/elim.wyn.c"; then ok "read outside the loop stays checked"
+else bad "read outside the loop stays checked"; fi
+
+# 2. Shapes the analysis must reject: length change in the body, i assigned,
+#    lambda capture, global array, mut param, nested loop re-using i, &xs
+#    passed to a mut param.
+cat > "$TMP/keep.wyn" <<'EOF'
+var gxs = [1, 2, 3]
+fn grow(mut xs: [int]) {
+    xs.push(1)
+}
+fn by_mut(mut ys: [int]) -> int {
+    var t = 0
+    for i in 0..ys.len() {
+        t = t + ys[i]
+    }
+    return t
+}
+fn main() {
+    var a = [1, 2, 3]
+    var t = 0
+    for i in 0..a.len() {
+        t = t + a[i]
+        a.push(i)
+        if i > 4 {
+            break
+        }
+    }
+    var b = [1, 2, 3]
+    for i in 0..b.len() {
+        t = t + b[i]
+        i = i + 1
+    }
+    var c = [1, 2, 3]
+    var f = (k: int) => c.len() + k
+    for i in 0..c.len() {
+        t = t + c[i]
+    }
+    for i in 0..gxs.len() {
+        t = t + gxs[i]
+    }
+    var d = [1, 2]
+    for i in 0..d.len() {
+        for i in 0..3 {
+            t = t + i
+        }
+        t = t + d[i]
+    }
+    var e = [4, 5]
+    for i in 0..e.len() {
+        grow(&e)
+        t = t + e[i]
+        if i > 3 {
+            break
+        }
+    }
+    println(t + f(0) + by_mut(&a))
+}
+EOF
+expect "rejected shapes compute the same values" "$TMP/keep.wyn" "70"
+gen_c keep
+if grep -qE "_nc\(|\.data\)\[" "$TMP/keep.wyn.c"; then bad "rejected shapes keep every check"
+else ok "rejected shapes keep every check"; fi
+
+# 3. An index the analysis cannot bound (i + 1) still panics.
+cat > "$TMP/oob.wyn" <<'EOF'
+fn main() {
+    var xs = [1, 2, 3]
+    var t = 0
+    for i in 0..xs.len() {
+        t = t + xs[i] + xs[i + 1]
+    }
+    println(t)
+}
+EOF
+out=$(run "$TMP/oob.wyn")
+if echo "$out" | grep -q "array index out of bounds: index 3, length 3"; then ok "unbounded index still panics"
+else bad "unbounded index still panics [$out]"; fi
+
+# 4. --release reports what was removed.
+out=$( cd "$TMP" && "$WYN" build elim.wyn --release 2>&1 )
+if echo "$out" | grep -q "bounds checks: 5 of 6 array index sites unchecked"; then ok "--release report"
+else bad "--release report [$out]"; fi
+
+echo ""; echo "bce: $PASS pass, $FAIL fail"; [ "$FAIL" -eq 0 ]
@@ -0,0 +1,164 @@
+#!/bin/bash
+# Biased reference counting (src/wyn_rc.c, WYN_RC_BIAS).
+# Covers: one string handed to many spawned tasks that each build on it and
+# return a new string (spawn args and results promoted with wyn_rc_share), a
+# string sent on a channel and then changed by the sender (the queued message
+# holds its own reference, so the receiver reads the old text), a local
+# aliased from a parameter and reassigned (must not release the caller's
+# reference), identical output under --release and with WYN_RC_BIAS=0, and a
+# C harness against wyn_rc.c itself: blocks released, retained and allocated
+# on other threads without promotion, settled through the owner's queue.
+set -uo pipefail
+WYN="${WYN:-./wyn}"
+case "$WYN" in /*) ;; *) WYN="$(pwd)/$WYN" ;; esac
+SRC="$(cd "$(dirname "$0")/../../src" && pwd)"
+TMP=$(mktemp -d)
+trap 'rm -rf "$TMP"' EXIT
+PASS=0; FAIL=0
+ok(){ echo "  ok    $1"; PASS=$((PASS+1)); }
+bad(){ echo "  FAIL  $1"; FAIL=$((FAIL+1)); }
+
+expect() {
+    local name="$1" file="$2" want="$3" got
+    got=$(perl -e 'alarm(120); exec @ARGV' -- "$WYN" run "$file" 2>&1 | grep -v "Compiled in")
+    if [ "$got" = "$want" ]; then ok "$name"; else bad "$name: got=[$got] want=[$want]"; fi
+}
+
+# 1. One string fans out to 8 tasks per round; each extends a copy of it and
+#    returns the result to main. base itself never changes.
+cat > "$TMP/relay.wyn" <<'WYN'
+fn stamp(s: string, id: int) -> string {
+    var out = s
+    var i = 0
+    while i < 50 {
+        out = out + "."
+        i = i + 1
+    }
+    return out + id.to_string()
+}
+fn main() {
+    var base = "shared-" + "x".repeat(40)
+    var total = 0
+    var round = 0
+    while round < 20 {
+        var fs = []
+        var w = 0
+        while w < 8 {
+            fs.push(spawn stamp(base, w))
+            w = w + 1
+        }
+        for r in await_all(fs) {
+            total = total + r.len()
+        }
+        round = round + 1
+    }
+    println(total)
+    println(base)
+}
+WYN
+RELAY_WANT=$'15680\nshared-xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx'
+expect "spawn args and results" "$TMP/relay.wyn" "$RELAY_WANT"
+
+# 2. Channel messages own a reference: the sender appending to (or replacing)
+#    its variable after send leaves the queued text alone.
+cat > "$TMP/chan.wyn" <<'WYN'
+fn main() {
+    var ch = channel(64)
+    var s = "msg-" + "x".repeat(10)
+    var i = 0
+    while i < 40 {
+        ch.send(s)
+        s = s + i.to_string()
+        i = i + 1
+    }
+    var bytes = 0
+    i = 0
+    while i < 40 {
+        var r = ch.recv()
+        bytes = bytes + r.len()
+        i = i + 1
+    }
+    println(bytes)
+    println(s.len())
+}
+WYN
+CHAN_WANT=$'1775\n84'
+expect "channel send then append" "$TMP/chan.wyn" "$CHAN_WANT"
+
+# 3. --release and WYN_RC_BIAS=0 (one atomic count for every block) print
+#    the same.
+if "$WYN" build "$TMP/relay.wyn" -o "$TMP/relay_rel" --release > "$TMP/rel.log" 2>&1 &&
+   "$WYN" build "$TMP/chan.wyn" -o "$TMP/chan_rel" --release >> "$TMP/rel.log" 2>&1; then
+    want="$RELAY_WANT"$'\n'"$CHAN_WANT"
+    got=$("$TMP/relay_rel"; "$TMP/chan_rel")
+    if [ "$got" = "$want" ]; then ok "--release output identical"; else bad "--release: got=[$got]"; fi
+    got=$(WYN_RC_BIAS=0 "$TMP/relay_rel"; WYN_RC_BIAS=0 "$TMP/chan_rel")
+    if [ "$got" = "$want" ]; then ok "WYN_RC_BIAS=0 output identical"; else bad "WYN_RC_BIAS=0: got=[$got]"; fi
+else
+    bad "--release build failed: $(head -5 "$TMP/rel.log")"
+fi
+
+# 4. Ownership transfers the runtime is not told about.
+if ! echo 'int main(void){return 0;}' | cc -x c - -o /dev/null 2>/dev/null; then
+    echo "  skip  ownership harness (no C compiler)"
+else
+cat > "$TMP/brc.c" <<'EOF'
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include "wyn_rc.h"
+static void* rel(void* p) { wyn_rc_release(p); return NULL; }
+static void* retrel(void* p) { wyn_rc_retain(p); wyn_rc_release(p); return NULL; }
+static void* mk(void* a) { (void)a; return wyn_rc_alloc(30); }
+static void* run(void* (*f)(void*), void* p) {
+    pthread_t t; void* r;
+    pthread_create(&t, NULL, f, p);
+    pthread_join(t, &r);
+    return r;
+}
+#define CHECK(c) do { if (!(c)) { printf("line %d: %s\n", __LINE__, #c); return 1; } } while (0)
+int main(void) {
+    // Last reference dropped by another thread: queued, freed by the drain
+    // (with WYN_RC_BIAS=0 the release frees it on the spot).
+    int biased = !getenv("WYN_RC_BIAS");
+    char* p = wyn_rc_alloc(30);
+    CHECK(wyn_rc_is_unique(p));
+    run(rel, p);
+    CHECK(wyn_rc_is_heap(p) == biased);
+    wyn_rc_drain();
+    CHECK(!wyn_rc_is_heap(p));
+    // Owner and foreign counts add up.
+    p = wyn_rc_alloc(30);
+    wyn_rc_retain(p);
+    CHECK(!wyn_rc_is_unique(p) && wyn_rc_count(p) == 2);
+    run(retrel, p);
+    wyn_rc_release(p);
+    CHECK(wyn_rc_is_unique(p));
+    wyn_rc_release(p);
+    CHECK(!wyn_rc_is_heap(p));
+    // Promoted first: the foreign release frees it directly.
+    p = wyn_rc_alloc(30);
+    wyn_rc_share(p);
+    CHECK(wyn_rc_is_unique(p) && wyn_rc_count(p) == 1);
+    run(rel, p);
+    CHECK(!wyn_rc_is_heap(p));
+    // Built by a thread that has exited: merged at its exit.
+    void* r = run(mk, NULL);
+    CHECK(wyn_rc_is_heap(r) && wyn_rc_is_unique(r));
+    wyn_rc_release(r);
+    CHECK(!wyn_rc_is_heap(r));
+    puts("ok");
+    return 0;
+}
+EOF
+    if ! cc -O1 -std=c11 -D_GNU_SOURCE -I "$SRC" "$TMP/brc.c" "$SRC/wyn_rc.c" -o "$TMP/brc" -lpthread 2>"$TMP/cc.txt"; then
+        bad "ownership harness does not compile: $(head -5 "$TMP/cc.txt")"
+    else
+        got=$(perl -e 'alarm(60); exec @ARGV' -- "$TMP/brc" 2>&1)
+        if [ "$got" = "ok" ]; then ok "ownership harness"; else bad "ownership harness: $got"; fi
+        got=$(WYN_RC_BIAS=0 perl -e 'alarm(60); exec @ARGV' -- "$TMP/brc" 2>&1)
+        if [ "$got" = "ok" ]; then ok "ownership harness, WYN_RC_BIAS=0"; else bad "ownership harness, WYN_RC_BIAS=0: $got"; fi
+    fi
+fi
+
+echo ""; echo "brc: $PASS pass, $FAIL fail"; [ "$FAIL" -eq 0 ]
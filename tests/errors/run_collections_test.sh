@@ -0,0 +1,191 @@
+#!/bin/bash
+# Ring-buffer Deque/Queue/Stack and the binary-heap PriorityQueue (the
+# collections section of src/wyn_runtime.h, plus the PriorityQueue instance
+# selection in check_expr).
+# Covers: both ends of a Deque across wraparound and growth, a large Queue
+# drained in linear time (the old Queue shifted the whole array on every pop),
+# 64-bit values, Stack order, PriorityQueue for int/float/string with and
+# without a comparator checked against a sort, and the checker errors for a
+# wrong push type, a bad comparator and a non-queue argument.
+set -uo pipefail
+WYN="${WYN:-./wyn}"
+case "$WYN" in /*) ;; *) WYN="$(pwd)/$WYN" ;; esac
+TMP=$(mktemp -d)
+trap 'rm -rf "$TMP"' EXIT
+PASS=0; FAIL=0
+ok(){ echo "  ok    $1"; PASS=$((PASS+1)); }
+bad(){ echo "  FAIL  $1"; FAIL=$((FAIL+1)); }
+
+expect() {
+    local name="$1" file="$2" want="$3" got
+    got=$(perl -e 'alarm(120); exec @ARGV' -- "$WYN" run "$file" 2>&1 | grep -v "Compiled in")
+    if [ "$got" = "$want" ]; then ok "$name"; else bad "$name: got=[$got] want=[$want]"; fi
+}
+
+# 1. Deque: push/pop at both ends while the ring wraps and grows.
+cat > "$TMP/deque.wyn" <<'EOF'
+fn main() {
+    var d = Deque::new()
+    var i = 0
+    while i < 5 {
+        Deque::push_back(d, i)
+        i = i + 1
+    }
+    println(Deque::pop_front(d) + Deque::pop_front(d))
+    i = 0
+    while i < 100 {
+        Deque::push_front(d, 0 - i)
+        Deque::push_back(d, 1000 + i)
+        i = i + 1
+    }
+    println(Deque::len(d))
+    println("${Deque::front(d)} ${Deque::back(d)} ${Deque::get(d, 100)} ${Deque::get(d, 101)}")
+    Deque::set(d, 0, 7)
+    var sum = 0
+    while not Deque::is_empty(d) {
+        sum = sum + Deque::pop_back(d)
+    }
+    println(sum)
+    println(Deque::pop_front(d))
+    Deque::push_back(d, 5000000000)
+    println(Deque::back(d))
+    Deque::clear(d)
+    println(Deque::len(d))
+}
+EOF
+expect "Deque ends, wraparound and growth" "$TMP/deque.wyn" \
+$'1\n203\n-99 1099 2 3\n100115\n0\n5000000000\n0'
+
+# 2. Queue: a million pushes and pops, interleaved so the ring wraps, in the
+#    time the old array-shift Queue took for a few thousand.
+cat > "$TMP/queue.wyn" <<'EOF'
+fn main() {
+    var q = Queue::new()
+    var i = 0
+    var sum = 0
+    while i < 1000000 {
+        Queue::push(q, i)
+        Queue::push(q, i)
+        sum = sum + Queue::pop(q)
+        i = i + 1
+    }
+    println(Queue::len(q))
+    println(Queue::peek(q))
+    while not Queue::is_empty(q) {
+        sum = sum + Queue::pop(q)
+    }
+    println(sum)
+    println(Queue::pop(q))
+}
+EOF
+expect "Queue FIFO at 1M in linear time" "$TMP/queue.wyn" $'1000000\n500000\n999999000000\n0'
+
+# 3. Stack order.
+cat > "$TMP/stack.wyn" <<'EOF'
+fn main() {
+    var s = Stack::new()
+    for x in [3, 1, 4, 1, 5] {
+        Stack::push(s, x)
+    }
+    var out = ""
+    while not Stack::is_empty(s) {
+        out = out + Stack::pop(s).to_string()
+    }
+    println(out)
+    println(Stack::len(s))
+}
+EOF
+expect "Stack LIFO" "$TMP/stack.wyn" $'51413\n0'
+
+# 4. PriorityQueue: pop order equals the sorted input, for each element type,
+#    with the default ordering and with a comparator.
+cat > "$TMP/pq.wyn" <<'EOF'
+fn desc(a: int, b: int) -> bool {
+    return a > b
+}
+fn fdesc(a: float, b: float) -> bool {
+    return a > b
+}
+fn shorter(a: string, b: string) -> bool {
+    return a.len() < b.len()
+}
+fn main() {
+    var xs = []
+    var seed = 12345
+    var i = 0
+    while i < 20000 {
+        seed = (seed * 1103515245 + 12345) % 2147483648
+        xs.push(seed % 100000)
+        i = i + 1
+    }
+    var h = PriorityQueue::new()
+    var g = PriorityQueue::new_by(desc)
+    for x in xs {
+        PriorityQueue::push(h, x)
+        PriorityQueue::push(g, x)
+    }
+    var sorted = xs.sort()
+    var n = sorted.len()
+    var bad = 0
+    i = 0
+    while i < n {
+        if PriorityQueue::pop(h) != sorted[i] {
+            bad = bad + 1
+        }
+        if PriorityQueue::pop(g) != sorted[n - 1 - i] {
+            bad = bad + 1
+        }
+        i = i + 1
+    }
+    println("${bad} ${PriorityQueue::len(h)} ${PriorityQueue::is_empty(g)}")
+
+    var f = PriorityQueue::new_by(fdesc)
+    for v in [0.5, 2.5, -1.0, 1.25] {
+        PriorityQueue::push(f, v)
+    }
+    println("${PriorityQueue::pop(f)} ${PriorityQueue::pop(f)} ${PriorityQueue::peek(f)}")
+
+    var w = PriorityQueue::new_by(shorter)
+    for s in ["ccc", "a", "dddd", "bb"] {
+        PriorityQueue::push(w, s)
+    }
+    var out = ""
+    while not PriorityQueue::is_empty(w) {
+        out = out + PriorityQueue::pop(w) + " "
+    }
+    println(out)
+}
+EOF
+expect "PriorityQueue int/float/string against sort" "$TMP/pq.wyn" $'0 0 true\n2.5 1.25 0.5\na bb ccc dddd '
+
+# 5. The checker picks the heap instance from the comparator or the receiver
+#    and rejects mismatches at compile time.
+cat > "$TMP/bad.wyn" <<'EOF'
+fn one(a: int) -> bool {
+    return a > 0
+}
+fn main() {
+    var h = PriorityQueue::new()
+    PriorityQueue::push(h, "x")
+    var g = PriorityQueue::new_by(one)
+    var z = PriorityQueue::pop(5)
+}
+EOF
+got=$("$WYN" run "$TMP/bad.wyn" 2>&1)
+if echo "$got" | grep -q "line 6: PriorityQueue::push value does not match" &&
+   echo "$got" | grep -q "line 7: PriorityQueue::new_by expects a function" &&
+   echo "$got" | grep -q "line 8: PriorityQueue::pop expects a queue"; then
+    ok "checker errors for push type, comparator and receiver"
+else
+    bad "checker errors: got=[$got]"
+fi
+
+# 6. The Queue/Stack example still runs unchanged.
+got=$(perl -e 'alarm(120); exec @ARGV' -- "$WYN" run examples/36_collections.wyn 2>&1)
+if echo "$got" | grep -q "Third out: 10 (first in)" && ! echo "$got" | grep -q "✗"; then
+    ok "examples/36_collections.wyn"
+else
+    bad "examples/36_collections.wyn: got=[$got]"
+fi
+
+echo ""; echo "collections: $PASS pass, $FAIL fail"; [ "$FAIL" -eq 0 ]
@@ -0,0 +1,157 @@
+#!/bin/bash
+# Db.batch, Db.begin/Db.end and the `Db.transaction(db) { }` block (src/parser.c
+# lowers it; src/wyn_runtime.h, SQLite section). Covers: nested-array and flat
+# rows binding in their Wyn types, shape errors reported by Db.error, chunked
+# commits keeping earlier chunks when a later row fails, a batch inside an
+# open transaction rolling back with it, nested blocks as savepoints, a failed
+# statement or Db.rollback undoing the block, `return` out of a block still
+# ending it, a stale Db.end being a no-op, and import mode on a file database.
+#
+# Skips cleanly where a system libsqlite3 is not linkable, like
+# run_sqlite_link_order_test.sh.
+set -uo pipefail
+WYN="${WYN:-./wyn}"
+case "$WYN" in /*) ;; *) WYN="$(pwd)/$WYN" ;; esac
+PASS=0; FAIL=0
+ok(){ echo "  ok    $1"; PASS=$((PASS+1)); }
+bad(){ echo "  FAIL  $1"; FAIL=$((FAIL+1)); }
+
+if [ ! -f ./packages/sqlite/src/sqlite3.c ] && ! echo '#include <sqlite3.h>
+int main(void){return 0;}' | cc -x c - -lsqlite3 -o /dev/null 2>/dev/null; then
+    echo "db-batch: SKIP (no sqlite3)"
+    exit 0
+fi
+TMP=$(mktemp -d)
+trap 'rm -rf "$TMP"' EXIT
+
+expect() {
+    local name="$1" file="$2" want="$3" got
+    got=$(perl -e 'alarm(60); exec @ARGV' -- "$WYN" run "$file" 2>&1 | grep -v "Compiled in")
+    if [ "$got" = "$want" ]; then ok "$name"; else bad "$name: got=[$got] want=[$want]"; fi
+}
+
+# 1. Row shapes and typed binding.
+cat > "$TMP/shapes.wyn" <<'EOF'
+fn main() {
+    var db = Db.open(":memory:")
+    Db.exec(db, "CREATE TABLE t(a, b)")
+    println(Db.batch(db, "INSERT INTO t VALUES (?, ?)", [["x", "y"], ["z", "w"]]))
+    println(Db.batch(db, "INSERT INTO t VALUES (?, ?)", [1, 2, 3, 4, 5, 6]))
+    println(Db.batch(db, "INSERT INTO t VALUES (?, ?)", [1.5, 2.25]))
+    println(Db.query(db, "SELECT typeof(a) || ':' || a FROM t WHERE typeof(a) != 'text' ORDER BY a"))
+    println(Db.batch(db, "INSERT INTO t VALUES (?, ?)", [7, 8, 9]))
+    println(Db.error(db))
+    println(Db.batch(db, "INSERT INTO t VALUES (?, ?)", [["1", "2"], ["3"]]))
+    println(Db.error(db))
+    println(Db.batch(db, "INSERT INTO t VALUES (?, ?)", []))
+    println(Db.query_one(db, "SELECT count(*) FROM t"))
+}
+EOF
+expect "row shapes and typed binding" "$TMP/shapes.wyn" $'2\n3\n1\ninteger:1\nreal:1.5\ninteger:3\ninteger:5\n-1\nDb.batch: 3 values do not make rows of 2 parameters\n-1\nDb.batch: row 1 has 1 values, the statement takes 2\n0\n6'
+
+# 2. Chunked commits: a failing row rolls back only its own chunk.
+cat > "$TMP/chunks.wyn" <<'EOF'
+fn main() {
+    var db = Db.open(":memory:")
+    Db.exec(db, "CREATE TABLE t(id INTEGER PRIMARY KEY)")
+    Db.set_batch_size(db, 3)
+    println(Db.batch(db, "INSERT INTO t VALUES (?)", [1, 2, 3, 4, 5, 6, 7, 1, 9]))
+    println(Db.error(db))
+    println(Db.query_one(db, "SELECT count(*) FROM t"))
+    Db.set_batch_size(db, 0)
+    println(Db.batch(db, "INSERT INTO t VALUES (?)", [10, 11, 12, 10]))
+    println(Db.query_one(db, "SELECT count(*) FROM t"))
+}
+EOF
+expect "chunked commits" "$TMP/chunks.wyn" $'-1\nDb.batch: row 7: UNIQUE constraint failed: t.id\n6\n-1\n6'
+
+# 3. Transactions: nesting, failure, Db.rollback, return, stale end.
+cat > "$TMP/tx.wyn" <<'EOF'
+fn add(db: int, k: int) -> int {
+    Db.transaction(db) {
+        Db.exec_p(db, "INSERT INTO t VALUES (?)", [k.to_string()])
+        if k > 50 {
+            return 1
+        }
+        Db.exec(db, "INSERT INTO t VALUES (" + (k + 1).to_string() + ")")
+    }
+    return 0
+}
+fn main() {
+    var db = Db.open(":memory:")
+    Db.exec(db, "CREATE TABLE t(id INTEGER PRIMARY KEY)")
+    Db.transaction(db) {
+        Db.exec(db, "INSERT INTO t VALUES (1)")
+        Db.transaction(db) {
+            Db.exec(db, "INSERT INTO t VALUES (2)")
+            Db.exec(db, "INSERT INTO t VALUES (1)")
+        }
+        Db.exec(db, "INSERT INTO t VALUES (3)")
+    }
+    println(Db.query(db, "SELECT group_concat(id) FROM t"))
+    Db.transaction(db) {
+        Db.exec(db, "INSERT INTO t VALUES (4)")
+        Db.rollback(db)
+        Db.exec(db, "INSERT INTO t VALUES (5)")
+    }
+    Db.transaction(db) {
+        println(Db.batch(db, "INSERT INTO t VALUES (?)", [6, 7, 3]))
+    }
+    println(Db.query(db, "SELECT group_concat(id) FROM t"))
+    println(add(db, 60))
+    println(add(db, 10))
+    var tx = Db.begin(db)
+    Db.exec(db, "INSERT INTO t VALUES (20)")
+    println(Db.end(tx))
+    println(Db.end(tx))
+    var outer = Db.begin(db)
+    var inner = Db.begin(db)
+    Db.exec(db, "INSERT INTO t VALUES (30)")
+    println(Db.end(outer))
+    println(Db.end(inner))
+    println(Db.query(db, "SELECT group_concat(id) FROM t"))
+    Db.exec(db, "INSERT INTO t VALUES (40)")
+    println(Db.query_one(db, "SELECT count(*) FROM t WHERE id = 40"))
+}
+EOF
+expect "transactions" "$TMP/tx.wyn" $'1,3\n-1\n1,3\n1\n0\ntrue\nfalse\ntrue\nfalse\n1,3,10,11,20,30,60\n1'
+
+# 4. Import mode on a file database, batch from coroutines.
+cat > "$TMP/import.wyn" <<EOF
+fn load(k: int) -> int {
+    var db = Db.open("$TMP/imp.db")
+    Db.exec(db, "PRAGMA busy_timeout=10000")
+    var rows = []
+    var i = 0
+    while i < 2000 {
+        rows.push(k * 10000 + i)
+        i = i + 1
+    }
+    var n = Db.batch(db, "INSERT INTO t VALUES (?)", rows)
+    Db.close(db)
+    return n
+}
+fn main() {
+    var db = Db.open("$TMP/imp.db")
+    println(Db.set_import_mode(db, true))
+    println(Db.query_one(db, "PRAGMA journal_mode"))
+    Db.exec(db, "CREATE TABLE t(v INTEGER)")
+    var fs = []
+    var i = 0
+    while i < 4 {
+        fs.push(spawn load(i))
+        i = i + 1
+    }
+    var total = 0
+    for n in await_all(fs) {
+        total = total + n
+    }
+    println(total)
+    println(Db.query_one(db, "SELECT count(DISTINCT v) FROM t"))
+    println(Db.set_import_mode(db, false))
+    println(Db.query_one(db, "PRAGMA journal_mode"))
+}
+EOF
+expect "import mode and concurrent batches" "$TMP/import.wyn" $'true\nwal\n8000\n8000\ntrue\ndelete'
+
+echo ""; echo "db-batch: $PASS pass, $FAIL fail"; [ "$FAIL" -eq 0 ]
@@ -0,0 +1,173 @@
+#!/bin/bash
+# Db statement cache, row cursors and handle table (src/wyn_runtime.h, SQLite
+# section). Covers: more connections than the old 16-slot table held, typed
+# cursor reads (int / float / text with the old '|' separator inside / NULL),
+# a cursor and a plain query over the same SQL at once (the cached statement
+# is borrowed, so the second must prepare its own), LRU eviction with a tiny
+# WYN_DB_STMT_CACHE and with the cache off, a cached statement surviving a
+# schema change, Db.close with a cursor still open, and cached statements
+# shared by coroutines running on the blocking pool.
+#
+# Skips cleanly where a system libsqlite3 is not linkable, like
+# run_sqlite_link_order_test.sh.
+set -uo pipefail
+WYN="${WYN:-./wyn}"
+case "$WYN" in /*) ;; *) WYN="$(pwd)/$WYN" ;; esac
+PASS=0; FAIL=0
+ok(){ echo "  ok    $1"; PASS=$((PASS+1)); }
+bad(){ echo "  FAIL  $1"; FAIL=$((FAIL+1)); }
+
+if [ ! -f ./packages/sqlite/src/sqlite3.c ] && ! echo '#include <sqlite3.h>
+int main(void){return 0;}' | cc -x c - -lsqlite3 -o /dev/null 2>/dev/null; then
+    echo "db-cursor: SKIP (no sqlite3)"
+    exit 0
+fi
+TMP=$(mktemp -d)
+trap 'rm -rf "$TMP"' EXIT
+
+run() {
+    local env="$1" file="$2"
+    env $env perl -e 'alarm(60); exec @ARGV' -- "$WYN" run "$file" 2>&1 | grep -v "Compiled in"
+}
+expect() {
+    local name="$1" env="$2" file="$3" want="$4" got
+    got=$(run "$env" "$file")
+    if [ "$got" = "$want" ]; then ok "$name"; else bad "$name: got=[$got] want=[$want]"; fi
+}
+
+# 1. Forty open connections, then close one and reuse its handle.
+cat > "$TMP/handles.wyn" <<'EOF'
+fn main() {
+    var hs = []
+    var i = 0
+    while i < 40 {
+        hs.push(Db.open(":memory:"))
+        i = i + 1
+    }
+    println(hs[39] > 0)
+    Db.exec(hs[39], "CREATE TABLE t(v); INSERT INTO t VALUES (7)")
+    println(Db.query_one(hs[39], "SELECT v FROM t"))
+    Db.close(hs[5])
+    println(Db.open(":memory:") == hs[5])
+}
+EOF
+expect "handle table grows past 16 and reuses slots" "" "$TMP/handles.wyn" $'true\n7\ntrue'
+
+# 2. Typed reads through a cursor.
+cat > "$TMP/typed.wyn" <<'EOF'
+fn main() {
+    var db = Db.open(":memory:")
+    Db.exec(db, "CREATE TABLE p(id INTEGER, name TEXT, score REAL, note TEXT)")
+    Db.exec_p(db, "INSERT INTO p VALUES (?, ?, ?, NULL)", ["1", "ann", "2.5"])
+    Db.exec_p(db, "INSERT INTO p VALUES (?, ?, ?, ?)", ["2", "bob|x", "7.25", "hi"])
+    var cur = Db.cursor(db, "SELECT id, name, score, note FROM p ORDER BY id")
+    println(Db.columns(cur))
+    println(Db.column_name(cur, 2))
+    while Db.next(cur) {
+        var score = Db.get_float(cur, 2)
+        println(Db.get_int(cur, 0) * 10)
+        println(Db.get_text(cur, 1))
+        println(score * 2.0)
+        println(Db.is_null(cur, 3))
+    }
+    println(Db.next(cur))
+    println(Db.get_int(cur, 0))
+    Db.close_cursor(cur)
+    var c2 = Db.cursor_p(db, "SELECT note FROM p WHERE id = ?", ["2"])
+    while Db.next(c2) {
+        println(Db.get_text(c2, 0))
+    }
+    Db.close_cursor(c2)
+    Db.close(db)
+}
+EOF
+expect "typed cursor reads" "" "$TMP/typed.wyn" $'4\nscore\n10\nann\n5.0\ntrue\n20\nbob|x\n14.5\nfalse\nfalse\n0\nhi'
+
+# 3. The statement a cursor holds is not lent to a query over the same SQL;
+#    with a 2-slot cache, rotating through four statements evicts and
+#    re-prepares; with the cache off everything still works.
+cat > "$TMP/cache.wyn" <<'EOF'
+fn main() {
+    var db = Db.open(":memory:")
+    Db.exec(db, "CREATE TABLE n(v INTEGER); INSERT INTO n VALUES (1),(2),(3)")
+    var cur = Db.cursor(db, "SELECT v FROM n ORDER BY v")
+    Db.next(cur)
+    println(Db.query(db, "SELECT v FROM n ORDER BY v").len())
+    Db.next(cur)
+    println(Db.get_int(cur, 0))
+    Db.close_cursor(cur)
+    var total = 0
+    var i = 0
+    while i < 20 {
+        total = total + Db.query_p(db, "SELECT v FROM n WHERE v = ?", [(i % 3 + 1).to_string()]).to_int()
+        total = total + Db.query(db, "SELECT count(*) FROM n").to_int()
+        total = total + Db.query(db, "SELECT max(v) FROM n").to_int()
+        total = total + Db.query(db, "SELECT min(v) FROM n").to_int()
+        i = i + 1
+    }
+    println(total)
+    Db.exec(db, "ALTER TABLE n ADD COLUMN w TEXT DEFAULT 'z'")
+    println(Db.query(db, "SELECT * FROM n WHERE v = 1"))
+}
+EOF
+expect "cursor and query share SQL; LRU eviction" "WYN_DB_STMT_CACHE=2" "$TMP/cache.wyn" $'5\n2\n179\n1|z'
+expect "statement cache off" "WYN_DB_STMT_CACHE=0" "$TMP/cache.wyn" $'5\n2\n179\n1|z'
+expect "default cache" "" "$TMP/cache.wyn" $'5\n2\n179\n1|z'
+
+# 4. Db.close with a cursor open defers the close until the cursor is done.
+cat > "$TMP/close.wyn" <<'EOF'
+fn main() {
+    var db = Db.open(":memory:")
+    Db.exec(db, "CREATE TABLE n(v INTEGER); INSERT INTO n VALUES (4),(5)")
+    var cur = Db.cursor(db, "SELECT v FROM n ORDER BY v")
+    Db.close(db)
+    var sum = 0
+    while Db.next(cur) {
+        sum = sum + Db.get_int(cur, 0)
+    }
+    Db.close_cursor(cur)
+    println(sum)
+    println(Db.query(db, "SELECT 1"))
+}
+EOF
+expect "Db.close with an open cursor" "" "$TMP/close.wyn" "9"
+
+# 5. Coroutines on the blocking pool share one connection's cached statements.
+cat > "$TMP/conc.wyn" <<EOF
+fn count(k: int) -> int {
+    var db = Db.open("$TMP/c.db")
+    var total = 0
+    var i = 0
+    while i < 50 {
+        total = total + Db.query_p(db, "SELECT count(*) FROM t WHERE v % 5 = CAST(? AS INTEGER)", [(k % 5).to_string()]).to_int()
+        var cur = Db.cursor_p(db, "SELECT v FROM t WHERE v <= ?", ["3"])
+        while Db.next(cur) {
+            total = total + Db.get_int(cur, 0)
+        }
+        Db.close_cursor(cur)
+        i = i + 1
+    }
+    Db.close(db)
+    return total
+}
+fn main() {
+    var db = Db.open("$TMP/c.db")
+    Db.exec(db, "CREATE TABLE t(v INTEGER)")
+    Db.exec(db, "WITH RECURSIVE c(x) AS (SELECT 1 UNION ALL SELECT x+1 FROM c WHERE x<1000) INSERT INTO t SELECT x FROM c")
+    Db.close(db)
+    var fs = []
+    var i = 0
+    while i < 8 {
+        fs.push(spawn count(i))
+        i = i + 1
+    }
+    var sum = 0
+    for n in await_all(fs) {
+        sum = sum + n
+    }
+    println(sum)
+}
+EOF
+expect "cached statements across coroutines" "" "$TMP/conc.wyn" "82400"
+
+echo ""; echo "db-cursor: $PASS pass, $FAIL fail"; [ "$FAIL" -eq 0 ]
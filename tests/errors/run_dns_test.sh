@@ -0,0 +1,170 @@
+#!/bin/bash
+# DNS resolver gate (wyn_dns_resolve in src/net_advanced.c, behind Net.resolve,
+# Net.connect, Socket.connect and the HTTP client). Runs against a local UDP
+# stub nameserver that logs every query it receives, so caching is checked by
+# what reaches the wire. Covers: repeated lookups cost one query, NXDOMAIN is
+# cached negatively, an expired TTL re-queries, the hosts file wins over DNS,
+# concurrent coroutine misses coalesce onto one query, the getaddrinfo
+# fallback when no nameserver answers, and an HTTP request to a DNS name.
+set -uo pipefail
+set +m 2>/dev/null
+WYN="${WYN:-./wyn}"
+case "$WYN" in /*) ;; *) WYN="$(pwd)/$WYN" ;; esac
+TMP=$(mktemp -d)
+PORT="${PORT:-18753}"
+HTTP_PORT="${HTTP_PORT:-18754}"
+PIDS=""
+cleanup() {
+    for p in $PIDS; do kill -9 "$p" 2>/dev/null; done
+    rm -rf "$TMP"
+}
+trap cleanup EXIT INT TERM
+PASS=0; FAIL=0
+ok(){ echo "  ok    $1"; PASS=$((PASS+1)); }
+bad(){ echo "  FAIL  $1"; FAIL=$((FAIL+1)); }
+
+cat > "$TMP/dns.py" <<'PY'
+import socket, struct, sys, time
+log = open(sys.argv[2], "a", buffering=1)
+s = socket.socket(socket.AF_INET, socket.SOCK_DGRAM)
+s.bind(("127.0.0.1", int(sys.argv[1])))
+print("ready", flush=True)
+# name -> (A record, TTL). Anything else is NXDOMAIN; AAAA for these is NODATA.
+A = {"a.test": ("10.0.0.7", 300), "short.test": ("10.0.0.8", 1),
+     "slow.test": ("10.0.0.9", 300), "svc.test": ("127.0.0.1", 300)}
+def soa(minimum):
+    rdata = b"\x02ns\x00\x05admin\x00" + struct.pack(">IIIII", 1, 60, 60, 60, minimum)
+    return b"\xc0\x0c" + struct.pack(">HHIH", 6, 1, 60, len(rdata)) + rdata
+while True:
+    m, peer = s.recvfrom(512)
+    qid = struct.unpack(">H", m[:2])[0]
+    pos, labels = 12, []
+    while m[pos]:
+        labels.append(m[pos + 1:pos + 1 + m[pos]].decode())
+        pos += 1 + m[pos]
+    qtype = struct.unpack(">H", m[pos + 1:pos + 3])[0]
+    question = m[12:pos + 5]
+    name = ".".join(labels)
+    log.write("%s %d\n" % (name, qtype))
+    if name == "slow.test":
+        time.sleep(0.3)
+    if name in A and qtype == 1:
+        ip, ttl = A[name]
+        rr = b"\xc0\x0c" + struct.pack(">HHIH", 1, 1, ttl, 4) + socket.inet_aton(ip)
+        s.sendto(struct.pack(">HHHHHH", qid, 0x8180, 1, 1, 0, 0) + question + rr, peer)
+    else:
+        rcode = 0x8180 if name in A else 0x8183
+        s.sendto(struct.pack(">HHHHHH", qid, rcode, 1, 0, 1, 0) + question + soa(60), peer)
+PY
+
+start() {
+    "$@" > "$TMP/start.log" 2>&1 &
+    local pid=$!
+    PIDS="$PIDS $pid"
+    disown "$pid" 2>/dev/null
+}
+start python3 "$TMP/dns.py" "$PORT" "$TMP/queries.log"
+for _ in $(seq 50); do grep -q ready "$TMP/start.log" 2>/dev/null && break; sleep 0.1; done
+grep -q ready "$TMP/start.log" || { echo "stub nameserver did not start"; exit 1; }
+mkdir -p "$TMP/www" && echo -n "hello" > "$TMP/www/hi"
+start python3 -m http.server "$HTTP_PORT" --bind 127.0.0.1 --directory "$TMP/www"
+
+echo "nameserver 127.0.0.1#$PORT" > "$TMP/resolv.conf"
+# Nothing answers on this port: the ICMP refusal ends the query at once.
+echo "nameserver 127.0.0.1#1" > "$TMP/dead.conf"
+echo "10.9.9.9 a.test" > "$TMP/hosts"
+
+# Each case truncates the query log first, then asserts both the program's
+# output and the queries that reached the stub.
+run() {
+    local conf="$1" hosts="$2" file="$3"
+    : > "$TMP/queries.log"
+    env WYN_RESOLV_CONF="$conf" WYN_HOSTS_FILE="$hosts" \
+        perl -e 'alarm(60); exec @ARGV' -- "$WYN" run "$file" 2>&1 | grep -v "Compiled in"
+}
+expect() {
+    local name="$1" conf="$2" hosts="$3" file="$4" want="$5" want_q="$6" got q
+    got=$(run "$conf" "$hosts" "$file")
+    q=$(sort "$TMP/queries.log" | tr '\n' ',')
+    if [ "$got" = "$want" ] && [ "$q" = "$want_q" ]; then ok "$name"
+    else bad "$name: got=[$got] queries=[$q] want=[$want] queries=[$want_q]"; fi
+}
+
+# 1. A hundred lookups of one name, and a name that does not exist twice.
+cat > "$TMP/cache.wyn" <<'EOF'
+fn main() {
+    var i = 0
+    while i < 100 {
+        Net.resolve("a.test")
+        i = i + 1
+    }
+    println(Net.resolve("a.test"))
+    println(Net.resolve("nx.test").len())
+    println(Net.resolve("NX.test").len())
+}
+EOF
+expect "positive and negative answers are cached" "$TMP/resolv.conf" "/nonexistent" "$TMP/cache.wyn" \
+    $'10.0.0.7\n0\n0' "a.test 1,nx.test 1,"
+
+# 2. A record whose TTL ran out is asked for again.
+cat > "$TMP/ttl.wyn" <<'EOF'
+fn main() {
+    println(Net.resolve("short.test"))
+    println(Net.resolve("short.test"))
+    // Spin rather than sleep(): only the resolver cache is under test.
+    var until = Time.now_millis() + 1200
+    while Time.now_millis() < until {
+    }
+    println(Net.resolve("short.test"))
+}
+EOF
+expect "expired TTL re-queries" "$TMP/resolv.conf" "/nonexistent" "$TMP/ttl.wyn" \
+    $'10.0.0.8\n10.0.0.8\n10.0.0.8' "short.test 1,short.test 1,"
+
+# 3. The hosts file answers before any query is sent.
+expect "hosts file overrides DNS" "$TMP/resolv.conf" "$TMP/hosts" "$TMP/cache.wyn" \
+    $'10.9.9.9\n0\n0' "nx.test 1,"
+
+# 4. Fifty coroutines missing on the same slow name share one query.
+cat > "$TMP/coalesce.wyn" <<'EOF'
+fn look(k: int) -> int {
+    if Net.resolve("slow.test") == "10.0.0.9" {
+        return 1
+    }
+    return 0
+}
+fn main() {
+    var fs = []
+    var i = 0
+    while i < 50 {
+        fs.push(spawn look(i))
+        i = i + 1
+    }
+    var hits = 0
+    for n in await_all(fs) {
+        hits = hits + n
+    }
+    println(hits)
+}
+EOF
+expect "concurrent misses coalesce" "$TMP/resolv.conf" "/nonexistent" "$TMP/coalesce.wyn" "50" "slow.test 1,"
+
+# 5. No nameserver answers: the system resolver still resolves localhost.
+cat > "$TMP/fallback.wyn" <<'EOF'
+fn main() {
+    println(Net.resolve("localhost"))
+}
+EOF
+expect "falls back to the system resolver" "$TMP/dead.conf" "/nonexistent" "$TMP/fallback.wyn" "127.0.0.1" ""
+
+# 6. The HTTP client connects through the resolver.
+cat > "$TMP/http.wyn" <<EOF
+fn main() {
+    println(Http.get("http://svc.test:$HTTP_PORT/hi"))
+    println(Http.get("http://svc.test:$HTTP_PORT/hi"))
+}
+EOF
+expect "HTTP request to a DNS name" "$TMP/resolv.conf" "/nonexistent" "$TMP/http.wyn" \
+    $'hello\nhello' "svc.test 1,"
+
+echo ""; echo "dns: $PASS pass, $FAIL fail"; [ "$FAIL" -eq 0 ]
@@ -0,0 +1,103 @@
+#!/bin/bash
+# Iterator fusion (src/codegen_fusion.c): map/filter/take chains ending in
+# sum / reduce / any / all or an array compile to a single loop.
+# Covers: results of fused int/float/bool pipelines against the values the
+# per-stage lowering produces, take before and after a filter, empty and
+# take(0) sources, captured variables in spliced bodies, packed and boxed
+# sources, that a fused chain emits no per-stage runtime call and later
+# lambdas keep their ids, and chains that must NOT fuse (string results,
+# block-bodied lambdas) still running through the old path.
+set -uo pipefail
+WYN="${WYN:-./wyn}"
+case "$WYN" in /*) ;; *) WYN="$(pwd)/$WYN" ;; esac
+TMP=$(mktemp -d)
+trap 'rm -rf "$TMP"' EXIT
+PASS=0; FAIL=0
+ok(){ echo "  ok    $1"; PASS=$((PASS+1)); }
+bad(){ echo "  FAIL  $1"; FAIL=$((FAIL+1)); }
+
+expect() {
+    local name="$1" file="$2" want="$3" got
+    got=$(perl -e 'alarm(120); exec @ARGV' -- "$WYN" run "$file" 2>&1 | grep -v "Compiled in")
+    if [ "$got" = "$want" ]; then ok "$name"; else bad "$name: got=[$got] want=[$want]"; fi
+}
+
+# 1. Int pipelines over a boxed source, with a capture in the spliced body.
+cat > "$TMP/ints.wyn" <<'EOF2'
+fn main() {
+    var xs = []
+    var i = 0
+    while i < 1000 {
+        xs.push(i)
+        i = i + 1
+    }
+    var k = 3
+    println(xs.map((x) => x * k).filter((x) => x % 2 == 0).sum())
+    println(xs.map((x) => x * x).reduce((acc, x) => acc + x, 0))
+    println(xs.filter((x) => x > 500).reduce(0, (acc, x) => acc + 1))
+    println(xs.filter((x) => x % 7 == 3).take(4))
+    println(xs.take(4).filter((x) => x % 2 == 1))
+    println(xs.map((x) => x - 1).any((x) => x < 0))
+    println(xs.map((x) => x - 1).all((x) => x < 998))
+    println(xs.filter((x) => x > 5000).any((x) => true))
+    println(xs.filter((x) => x > 5000).all((x) => false))
+    println(xs.take(0).map((x) => x + 1))
+    println(xs.filter((x) => x % 100 == 0).map((x) => x / 100).len())
+}
+EOF2
+expect "int pipelines (sum, reduce, take, any, all)" "$TMP/ints.wyn" \
+$'748500\n332833500\n499\n[3, 10, 17, 24]\n[1, 3]\ntrue\nfalse\nfalse\ntrue\n[]\n10'
+
+# 2. Float and bool elements, and a packed literal source.
+cat > "$TMP/mixed.wyn" <<'EOF2'
+fn main() {
+    var fs = [0.5, 1.5, 2.5, 3.5]
+    println(fs.map((x) => x * 2.0).sum())
+    println(fs.map((x) => x + 0.25).filter((x) => x > 2.0))
+    println(fs.reduce((a, x) => a + x, 10.0))
+    var nums = [4, 8, 15, 16, 23, 42]
+    println(nums.map((x) => x % 2 == 0))
+    println(nums.map((x) => x.to_float() / 2.0).filter((x) => x > 10.0).sum())
+    println(nums.map((x) => x > 10).filter((b) => b).len())
+}
+EOF2
+expect "float, bool and packed sources" "$TMP/mixed.wyn" \
+$'16.0\n[2.75, 3.75]\n18.0\n[1, 1, 0, 1, 0, 1]\n32.5\n4'
+
+# 3. The fused chain is one loop - no per-stage runtime call - and lambdas
+#    emitted after it (a closure with a capture) still resolve to their own ids.
+cat > "$TMP/ids.wyn" <<'EOF2'
+fn main() {
+    var xs = [1, 2, 3, 4, 5, 6]
+    println(xs.map((x) => x * 10).filter((x) => x > 20).map((x) => x + 1).sum())
+    var base = 100
+    var bump = (n) => n + base
+    println(bump(5))
+    var add = (a, b) => a * b
+    println(add(6, 7))
+}
+EOF2
+got=$(cd "$TMP" && perl -e 'alarm(120); exec @ARGV' -- "$WYN" run --debug ids.wyn 2>&1 | grep -v "Compiled in")
+if [ "$got" = $'184\n105\n42' ] && [ -f "$TMP/ids.wyn.c" ] &&
+   ! grep -q "wyn_array_map\|wyn_array_filter\|int_array_map\|__fn(" "$TMP/ids.wyn.c"; then
+    ok "fused chain emits one loop, later lambda ids intact"
+else
+    bad "fused codegen: got=[$got] runtime-calls=[$(grep -o 'wyn_array_[a-z_]*\|__fn(' "$TMP/ids.wyn.c" 2>/dev/null | sort -u | tr '\n' ' ')]"
+fi
+
+# 4. Chains that do not fuse keep working through the per-stage path.
+cat > "$TMP/nofuse.wyn" <<'EOF2'
+fn main() {
+    var xs = [1, 2, 3, 4]
+    println(xs.map((x) => "n" + x.to_string()).filter((s) => s.len() == 2))
+    println(xs.map((x) => {
+        var y = x * 3
+        return y + 1
+    }).filter((x) => x > 5).sum())
+    var words = ["a", "bb", "ccc"]
+    println(words.map((w) => w.len()).sum())
+}
+EOF2
+expect "ineligible chains fall back" "$TMP/nofuse.wyn" $'["n1", "n2", "n3", "n4"]\n30\n6'
+
+echo ""; echo "fusion: $PASS pass, $FAIL fail"; [ "$FAIL" -eq 0 ]
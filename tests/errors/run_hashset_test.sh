@@ -0,0 +1,157 @@
+#!/bin/bash
+# Open-addressing HashSet (src/hashset.c) and the int/string element dispatch
+# in codegen (hashset_elem_is_int).
+# Covers: int sets (methods, `in`, literals) past the old fixed 128-bucket
+# table, string sets through growth and heavy add/remove churn, union /
+# intersection / difference / subset / disjoint on large sets of both kinds,
+# a set that receives both ints and strings, reserve() before the first add,
+# and the HashSet example.
+set -uo pipefail
+WYN="${WYN:-./wyn}"
+case "$WYN" in /*) ;; *) WYN="$(pwd)/$WYN" ;; esac
+TMP=$(mktemp -d)
+trap 'rm -rf "$TMP"' EXIT
+PASS=0; FAIL=0
+ok(){ echo "  ok    $1"; PASS=$((PASS+1)); }
+bad(){ echo "  FAIL  $1"; FAIL=$((FAIL+1)); }
+
+expect() {
+    local name="$1" file="$2" want="$3" got
+    got=$(perl -e 'alarm(120); exec @ARGV' -- "$WYN" run "$file" 2>&1 | grep -v "Compiled in")
+    if [ "$got" = "$want" ]; then ok "$name"; else bad "$name: got=[$got] want=[$want]"; fi
+}
+
+# 1. Int elements: dedup a large id list, then membership and removal.
+cat > "$TMP/ints.wyn" <<'EOF'
+fn main() {
+    var seen = HashSet::new()
+    var i = 0
+    while i < 400000 {
+        seen.add((i * 7919) % 100003)
+        i = i + 1
+    }
+    println(seen.len())
+    var hits = 0
+    i = 0
+    while i < 200006 {
+        if seen.contains(i) {
+            hits = hits + 1
+        }
+        i = i + 1
+    }
+    println(hits)
+    i = 0
+    while i < 100003 {
+        if i % 2 == 0 {
+            seen.remove(i)
+        }
+        i = i + 1
+    }
+    println("${seen.len()} ${seen.contains(4)} ${seen.contains(5)} ${-1 in seen}")
+    var lit = {: 3, 1, 4, 1, 5 }
+    println("${lit.len()} ${4 in lit} ${2 in lit} ${2 not in lit}")
+}
+EOF
+expect "int set dedup, membership, removal, literal" "$TMP/ints.wyn" \
+$'100003\n100003\n50001 false true false\n4 true false true'
+
+# 2. String elements through growth and churn.
+cat > "$TMP/strs.wyn" <<'EOF'
+fn main() {
+    var s = HashSet::new()
+    var i = 0
+    while i < 100000 {
+        s.add("user-" + i.to_string())
+        s.add("user-" + (i / 2).to_string())
+        i = i + 1
+    }
+    println(s.len())
+    var round = 0
+    while round < 20 {
+        i = 0
+        while i < 5000 {
+            s.add("tmp" + round.to_string() + "_" + i.to_string())
+            i = i + 1
+        }
+        i = 0
+        while i < 5000 {
+            s.remove("tmp" + round.to_string() + "_" + i.to_string())
+            i = i + 1
+        }
+        round = round + 1
+    }
+    println("${s.len()} ${s.contains("user-99999")} ${s.contains("tmp3_7")} ${"user-0" in s}")
+    s.clear()
+    println("${s.len()} ${s.is_empty()} ${s.contains("user-1")}")
+}
+EOF
+expect "string set growth and churn" "$TMP/strs.wyn" $'100000\n100000 true false true\n0 true false'
+
+# 3. Set algebra on large sets of each kind.
+cat > "$TMP/algebra.wyn" <<'EOF'
+fn main() {
+    var a = HashSet::new()
+    var b = HashSet::new()
+    var sa = HashSet::new()
+    var sb = HashSet::new()
+    var i = 0
+    while i < 60000 {
+        a.add(i)
+        sa.add("k" + i.to_string())
+        i = i + 1
+    }
+    i = 40000
+    while i < 100000 {
+        b.add(i)
+        sb.add("k" + i.to_string())
+        i = i + 1
+    }
+    var u = a.union(b)
+    var x = a.intersection(b)
+    var d = a.difference(b)
+    println("${u.len()} ${x.len()} ${d.len()}")
+    println("${x.is_subset(a)} ${a.is_subset(x)} ${a.is_superset(x)} ${d.is_disjoint(b)} ${a.is_disjoint(b)}")
+    println("${99999 in u} ${39999 in x} ${40000 in x} ${39999 in d}")
+    var su = sa.union(sb)
+    var sx = sa.intersection(sb)
+    var sd = sb.difference(sa)
+    println("${su.len()} ${sx.len()} ${sd.len()} ${sd.contains("k99999")} ${sd.contains("k40000")}")
+    var e = HashSet::new()
+    println("${a.union(e).len()} ${e.intersection(a).len()} ${a.difference(e).len()} ${e.is_subset(a)}")
+}
+EOF
+expect "union, intersection, difference, subset, disjoint" "$TMP/algebra.wyn" \
+$'100000 20000 40000\ntrue false true true false\ntrue false true true\n100000 20000 40000 true false\n60000 0 60000 true'
+
+# 4. One set given both ints and strings keeps them comparable as text, and
+#    reserve() before the first add is honoured.
+cat > "$TMP/mixed.wyn" <<'EOF'
+fn main() {
+    var m = HashSet::new()
+    m.add(5)
+    m.add(6)
+    m.add("5")
+    println(m.len())
+    m.add("x")
+    println("${m.len()} ${m.contains(6)} ${m.contains("6")} ${m.contains("x")}")
+    var r = HashSet::new()
+    r.reserve(100000)
+    var i = 0
+    while i < 100000 {
+        r.add(i)
+        i = i + 1
+    }
+    println("${r.len()} ${r.contains(99999)}")
+}
+EOF
+expect "mixed element kinds and reserve" "$TMP/mixed.wyn" $'2\n3 true true true\n100000 true'
+
+# 5. The HashSet example still runs unchanged.
+got=$(perl -e 'alarm(120); exec @ARGV' -- "$WYN" run examples/08_hashset.wyn 2>&1)
+if echo "$got" | grep -q "Banana removed successfully" && echo "$got" | grep -q "operations complete"; then
+    ok "examples/08_hashset.wyn"
+else
+    bad "examples/08_hashset.wyn: got=[$got]"
+fi
+
+echo ""; echo "hashset: $PASS pass, $FAIL fail"; [ "$FAIL" -eq 0 ]
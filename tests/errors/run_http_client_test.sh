@@ -0,0 +1,191 @@
+#!/bin/bash
+# HTTP client gate (wyn_http_fetch in src/net_advanced.c, behind Http.get/
+# Http.post). Runs against a local loopback server that counts the TCP
+# connections it accepts, so the keep-alive pool is checked by what reaches
+# the wire, not by client-side bookkeeping. Covers: connection reuse, bodies
+# past the old 64KB cap (Content-Length and chunked), POST + status, a server
+# Connection: close, a pooled socket the server dropped while idle, idle
+# eviction, the pool switched off, and many coroutines in flight at once.
+set -uo pipefail
+set +m 2>/dev/null
+WYN="${WYN:-./wyn}"
+case "$WYN" in /*) ;; *) WYN="$(pwd)/$WYN" ;; esac
+TMP=$(mktemp -d)
+PORT="${PORT:-18733}"
+SRV_PID=""
+cleanup() {
+    [ -n "$SRV_PID" ] && kill -9 "$SRV_PID" 2>/dev/null
+    rm -rf "$TMP"
+}
+trap cleanup EXIT INT TERM
+PASS=0; FAIL=0
+ok(){ echo "  ok    $1"; PASS=$((PASS+1)); }
+bad(){ echo "  FAIL  $1"; FAIL=$((FAIL+1)); }
+
+cat > "$TMP/srv.py" <<'PY'
+import socket, sys, threading
+conns = [0]
+lock = threading.Lock()
+
+def handle(c):
+    f = c.makefile("rb")
+    while True:
+        line = f.readline()
+        if not line:
+            break
+        method, path, _ = line.decode().split(" ", 2)
+        clen = 0
+        while True:
+            h = f.readline()
+            if h in (b"\r\n", b""):
+                break
+            k, v = h.decode().split(":", 1)
+            if k.lower() == "content-length":
+                clen = int(v)
+        body = f.read(clen) if clen else b""
+        def send(status, payload, extra=b""):
+            c.sendall(b"HTTP/1.1 %s\r\nContent-Length: %d\r\n%s\r\n" % (status, len(payload), extra) + payload)
+        if path == "/reset":
+            # Restart the count at the connection carrying this request.
+            with lock:
+                conns[0] = 1
+            send(b"200 OK", b"reset")
+        elif path == "/conns":
+            send(b"200 OK", str(conns[0]).encode())
+        elif path == "/big":
+            send(b"200 OK", b"x" * 1000000)
+        elif path == "/chunked":
+            c.sendall(b"HTTP/1.1 200 OK\r\nTransfer-Encoding: chunked\r\n\r\n")
+            for part in [b"hello ", b"chunked ", b"y" * 70000, b" world"]:
+                c.sendall(b"%x\r\n" % len(part) + part + b"\r\n")
+            c.sendall(b"0\r\n\r\n")
+        elif path == "/close":
+            send(b"200 OK", b"bye", b"Connection: close\r\n")
+            break
+        elif path == "/drop":
+            # Keep-alive response, then the server hangs up anyway - what an
+            # idle timeout on the server side looks like to the pool.
+            send(b"200 OK", b"dropped")
+            break
+        elif path == "/echo":
+            send(b"201 Created", body)
+        else:
+            send(b"200 OK", b"ok")
+    c.close()
+
+s = socket.socket()
+s.setsockopt(socket.SOL_SOCKET, socket.SO_REUSEADDR, 1)
+s.bind(("127.0.0.1", int(sys.argv[1])))
+s.listen(1024)
+print("ready", flush=True)
+while True:
+    c, _ = s.accept()
+    with lock:
+        conns[0] += 1
+    threading.Thread(target=handle, args=(c,), daemon=True).start()
+PY
+
+ulimit -n 4096 2>/dev/null
+python3 "$TMP/srv.py" "$PORT" > "$TMP/srv.log" 2>&1 &
+SRV_PID=$!
+disown "$SRV_PID" 2>/dev/null
+for _ in $(seq 50); do grep -q ready "$TMP/srv.log" 2>/dev/null && break; sleep 0.1; done
+grep -q ready "$TMP/srv.log" || { echo "server did not start"; exit 1; }
+
+# Each program opens with /reset and ends by printing the server's connection
+# count, so every case asserts how many sockets it took as well as what it read.
+URL="http://127.0.0.1:$PORT"
+run() {
+    local env="$1" file="$2"
+    env $env perl -e 'alarm(60); exec @ARGV' -- "$WYN" run "$file" 2>&1 | grep -v "Compiled in"
+}
+expect() {
+    local name="$1" env="$2" file="$3" want="$4" got
+    got=$(run "$env" "$file")
+    if [ "$got" = "$want" ]; then ok "$name"; else bad "$name: got=[$got] want=[$want]"; fi
+}
+
+# 1. Twenty GETs, a 1MB body, a 70KB chunked body and a POST: one connection.
+cat > "$TMP/reuse.wyn" <<EOF
+fn main() {
+    Http.get("$URL/reset")
+    var i = 0
+    var hits = 0
+    while i < 20 {
+        if Http.get("$URL/x") == "ok" {
+            hits = hits + 1
+        }
+        i = i + 1
+    }
+    println(hits)
+    println(Http.get("$URL/big").len())
+    var c = Http.get("$URL/chunked")
+    println(c.len())
+    println(c.starts_with("hello chunked ") and c.ends_with(" world"))
+    println(Http.post("$URL/echo", "a=1&b=2"))
+    println(http_status())
+    println(Http.get("$URL/conns"))
+}
+EOF
+expect "keep-alive reuse, large and chunked bodies, POST" "" "$TMP/reuse.wyn" $'20\n1000000\n70020\ntrue\na=1&b=2\n201\n1'
+
+# 2. Connection: close from the server, and a pooled socket the server
+#    dropped, both cost one reconnect and no failed request.
+cat > "$TMP/close.wyn" <<EOF
+fn main() {
+    Http.get("$URL/reset")
+    println(Http.get("$URL/close"))
+    println(Http.get("$URL/drop"))
+    sleep(50)
+    println(Http.get("$URL/x"))
+    println(Http.get("$URL/conns"))
+}
+EOF
+expect "server close and dropped idle socket reconnect" "" "$TMP/close.wyn" $'bye\ndropped\nok\n3'
+
+# 3. Idle eviction, and the pool switched off entirely.
+cat > "$TMP/idle.wyn" <<EOF
+fn main() {
+    Http.get("$URL/reset")
+    println(Http.get("$URL/x"))
+    sleep(30)
+    println(Http.get("$URL/x"))
+    println(Http.get("$URL/conns"))
+}
+EOF
+expect "idle connections are evicted" "WYN_HTTP_IDLE_MS=10" "$TMP/idle.wyn" $'ok\nok\n2'
+expect "WYN_HTTP_POOL_MAX=0 disables pooling" "WYN_HTTP_POOL_MAX=0" "$TMP/idle.wyn" $'ok\nok\n4'
+
+# 4. Many coroutines in flight at once all complete.
+cat > "$TMP/conc.wyn" <<EOF
+fn fetch(k: int) -> int {
+    if Http.get("$URL/x") == "ok" {
+        return 1
+    }
+    return 0
+}
+fn main() {
+    var fs = []
+    var i = 0
+    while i < 500 {
+        fs.push(spawn fetch(i))
+        i = i + 1
+    }
+    var hits = 0
+    for n in await_all(fs) {
+        hits = hits + n
+    }
+    println(hits)
+}
+EOF
+expect "500 concurrent coroutine requests" "" "$TMP/conc.wyn" "500"
+
+# 5. A refused connection is an error, not a hang.
+cat > "$TMP/refused.wyn" <<'EOF'
+fn main() {
+    println(Http.get("http://127.0.0.1:1/x").len())
+}
+EOF
+expect "refused connection returns empty" "" "$TMP/refused.wyn" "0"
+
+echo ""; echo "http-client: $PASS pass, $FAIL fail"; [ "$FAIL" -eq 0 ]
@@ -0,0 +1,122 @@
+#!/bin/bash
+# Typed string interpolation (EXPR_STRING_INTERP in codegen_expr.c and the
+# wyn_fmt_i64 / wyn_fmt_f64 formatters in wyn_runtime.h / wyn_runtime_slim.h).
+# Covers: int pieces across the digit-pair boundaries and the 64-bit extremes,
+# float pieces on and off the fast path compared with println's canonical
+# float text, bool and string pieces, literal runs with %, escapes and `\$`,
+# nested interpolation, pieces that still go through to_string() (arrays),
+# values whose checker type differs from their C type (bool-returning
+# builtins, Option/Result payloads), and the same program built with
+# --release (slim runtime) printing the same.
+set -uo pipefail
+WYN="${WYN:-./wyn}"
+case "$WYN" in /*) ;; *) WYN="$(pwd)/$WYN" ;; esac
+TMP=$(mktemp -d)
+trap 'rm -rf "$TMP"' EXIT
+PASS=0; FAIL=0
+ok(){ echo "  ok    $1"; PASS=$((PASS+1)); }
+bad(){ echo "  FAIL  $1"; FAIL=$((FAIL+1)); }
+
+expect() {
+    local name="$1" file="$2" want="$3" got
+    got=$(perl -e 'alarm(120); exec @ARGV' -- "$WYN" run "$file" 2>&1 | grep -v "Compiled in")
+    if [ "$got" = "$want" ]; then ok "$name"; else bad "$name: got=[$got] want=[$want]"; fi
+}
+
+# 1. Int pieces.
+cat > "$TMP/ints.wyn" <<'EOF2'
+fn main() {
+    var big = 9223372036854775807
+    var small = 0 - big - 1
+    println("${0} ${7} ${10} ${99} ${100} ${-1} ${-100} ${123456789}")
+    println("${big}|${small}|${1000000000000000000}")
+    var total = 0
+    var i = 0
+    while i < 100000 {
+        var s = "${i * 37}"
+        if s == (i * 37).to_string() {
+            total = total + 1
+        }
+        i = i + 1
+    }
+    println(total)
+}
+EOF2
+expect "int pieces" "$TMP/ints.wyn" \
+$'0 7 10 99 100 -1 -100 123456789\n9223372036854775807|-9223372036854775808|1000000000000000000\n100000'
+
+# 2. Float pieces print exactly what println prints for the same value.
+cat > "$TMP/floats.wyn" <<'EOF2'
+fn main() {
+    var vals = [0.0, -0.0, 1.0, -2.5, 0.1, 0.30000000000000004, 1.0 / 3.0, 0.0001,
+                0.00001, 123456.789, 999999999999999.0, 1e15, 1e20, 2.0e-7, 3.14159]
+    for v in vals {
+        println("${v}")
+        println(v)
+    }
+    var f = 0.0
+    var same = 0
+    var i = 0
+    while i < 20000 {
+        if "${f}" == f.to_string() {
+            same = same + 1
+        }
+        f = f + 0.37
+        i = i + 1
+    }
+    println(same)
+}
+EOF2
+got=$(perl -e 'alarm(120); exec @ARGV' -- "$WYN" run "$TMP/floats.wyn" 2>&1 | grep -v "Compiled in")
+pairs_ok=$(echo "$got" | head -30 | paste - - | awk -F'\t' '$1 != $2 {bad=1} END {print bad ? "no" : "yes"}')
+if [ "$pairs_ok" = "yes" ] && [ "$(echo "$got" | tail -1)" = "20000" ] &&
+   echo "$got" | head -14 | tr '\n' ' ' | grep -q "^0.0 0.0 -0.0 -0.0 1.0 1.0 -2.5 -2.5 0.1 0.1 0.30000000000000004 0.30000000000000004 0.3333333333333333 0.3333333333333333"; then
+    ok "float pieces match println"
+else
+    bad "float pieces: got=[$got]"
+fi
+
+# 3. Bool, string, literal runs, nesting and a to_string() fallback piece.
+cat > "$TMP/mixed.wyn" <<'EOF2'
+fn main() {
+    var name = "wyn"
+    var n = 3
+    var xs = [1, 2, 3]
+    println("${n > 2} ${n > 5} [${name}] [${""}] ${name.upper()}")
+    println("100% of ${n}%s \${kept} tab\tend \"q\"")
+    println("a${"b${n}c"}d ${xs} ${xs.len()}")
+    println("${name}")
+    println("")
+}
+EOF2
+expect "bool, string, literals, nesting, fallback" "$TMP/mixed.wyn" \
+$'true false [wyn] [] WYN\n100% of 3%s ${kept} tab\tend "q"\nab3cd [1, 2, 3] 3\nwyn'
+
+# 4. Pieces are formatted by their C type, not the checker's: bool-returning
+#    map methods, float builtins and bound Result/Option payloads.
+cat > "$TMP/ctype.wyn" <<'EOF2'
+fn lookup(k: string) -> Result<string, string> {
+    if k == "" { return Err("empty") }
+    return Ok("value:${k}")
+}
+fn find(x: int) -> int? { if x > 0 { return Some(x * 10) } return None }
+fn main() {
+    var m = {"a": 0}
+    println("${m.has("a")} ${m.has("zz")} ${Math.abs(-5)}")
+    if let Ok(s) = lookup("a") { println("ok ${s}") }
+    if let Some(v) = find(4) { println("got ${v}") }
+}
+EOF2
+expect "pieces dispatch on the C type" "$TMP/ctype.wyn" $'true false 5\nok value:a\ngot 40'
+
+# 5. The slim --release runtime formats the same.
+if "$WYN" build "$TMP/mixed.wyn" -o "$TMP/mixed_rel" --release > "$TMP/rel.log" 2>&1 &&
+   "$WYN" build "$TMP/ints.wyn" -o "$TMP/ints_rel" --release >> "$TMP/rel.log" 2>&1; then
+    got=$("$TMP/mixed_rel"; "$TMP/ints_rel")
+    want=$'true false [wyn] [] WYN\n100% of 3%s ${kept} tab\tend "q"\nab3cd [1, 2, 3] 3\nwyn\n\n0 7 10 99 100 -1 -100 123456789\n9223372036854775807|-9223372036854775808|1000000000000000000\n100000'
+    if [ "$got" = "$want" ]; then ok "--release output identical"; else bad "--release: got=[$got]"; fi
+else
+    bad "--release build failed: $(head -5 "$TMP/rel.log")"
+fi
+
+echo ""; echo "interp: $PASS pass, $FAIL fail"; [ "$FAIL" -eq 0 ]
@@ -0,0 +1,174 @@
+#!/bin/bash
+# AST optimizer (src/optimize.c) soundness gate. Every program here runs at
+# -O0, -O1 and -O2 and must print the same thing at each level - the passes
+# are only allowed to change HOW a result is computed. The programs target the
+# cases where an AST optimizer goes wrong:
+#   - names bound more than once (shadowing across fns, reassignment)
+#   - values changed behind its back (mut params, closures, bare assigns)
+#   - operations that must stay runtime traps or wraparounds (/0, overflow)
+#   - inlining an argument with side effects (must still run exactly once)
+# plus checks on the generated C that the passes actually fire.
+set -uo pipefail
+WYN="${WYN:-./wyn}"
+case "$WYN" in /*) ;; *) WYN="$(pwd)/$WYN" ;; esac
+TMP=$(mktemp -d); trap 'rm -rf "$TMP"' EXIT
+PASS=0; FAIL=0
+ok(){ echo "  ok    $1"; PASS=$((PASS+1)); }
+bad(){ echo "  FAIL  $1"; FAIL=$((FAIL+1)); }
+
+run_at() {
+    perl -e 'alarm(60); exec @ARGV' -- "$WYN" run "$1" "$2" 2>&1 | grep -v "Compiled in"
+}
+
+# Same output at every level, and equal to the expected text.
+expect_same() {
+    local name="$1" file="$2" want="$3" o0 o1 o2
+    o0=$(run_at "$file" -O0); o1=$(run_at "$file" -O1); o2=$(run_at "$file" -O2)
+    if [ "$o0" = "$want" ] && [ "$o1" = "$want" ] && [ "$o2" = "$want" ]; then ok "$name"
+    else bad "$name: -O0=[$o0] -O1=[$o1] -O2=[$o2] want=[$want]"; fi
+}
+
+# 1. Same name bound in several fns, one of them reassigned.
+cat > "$TMP/shadow.wyn" <<'EOF'
+fn a() -> int {
+    var x = 1
+    return x + 1
+}
+fn b() -> int {
+    var x = 2
+    x = x * 10
+    return x + 1
+}
+fn main() {
+    println(a())
+    println(b())
+}
+EOF
+expect_same "multiply-bound names are not propagated" "$TMP/shadow.wyn" $'2\n21'
+
+# 2. A mut param (`&c` at the call site) writes with no assignment in sight.
+cat > "$TMP/mut.wyn" <<'EOF'
+fn bump(mut n: int) {
+    n = n + 1
+}
+fn main() {
+    var c = 5
+    bump(&c)
+    println(c + 1)
+    var d = 5
+    println(d + 1)
+}
+EOF
+expect_same "var passed to a mut param is not a constant" "$TMP/mut.wyn" $'7\n6'
+
+# 3. Bare assignment inside a constant-false branch: the branch stays (codegen
+#    hoists the declaration to function scope).
+cat > "$TMP/bare.wyn" <<'EOF'
+fn main() {
+    var on = false
+    if on {
+        y = 1
+    } else {
+        y = 2
+    }
+    println(y)
+}
+EOF
+expect_same "bare-assign branches survive dead-branch elimination" "$TMP/bare.wyn" "2"
+
+# 4. Division by a zero that only becomes visible after propagation must still
+#    panic at runtime, not be folded or rejected at compile time.
+printf 'fn main() {\n    var z = 0\n    println(10 / z)\n}\n' > "$TMP/divz.wyn"
+for lvl in -O0 -O2; do
+    out=$(run_at "$TMP/divz.wyn" "$lvl"); rc=$?
+    if echo "$out" | grep -q "division by zero"; then ok "x / 0 still panics at $lvl"
+    else bad "x / 0 still panics at $lvl [$out]"; fi
+done
+
+# 5. Overflow is not folded: the runtime result (wraparound) is kept.
+cat > "$TMP/ovf.wyn" <<'EOF'
+fn main() {
+    var big = 9223372036854775807
+    var one = 1
+    var r = big + one
+    println(r < 0)
+}
+EOF
+expect_same "signed overflow is left to the runtime" "$TMP/ovf.wyn" "true"
+
+# 6. An argument with side effects is not inlined (would run 0 or 2 times).
+cat > "$TMP/sidefx.wyn" <<'EOF'
+fn sq(x: int) -> int => x * x
+fn next(mut c: int) -> int {
+    c = c + 1
+    return c
+}
+fn main() {
+    var calls = 0
+    println(sq(next(&calls)))
+    println(calls)
+    println(sq(3) + sq(calls))
+}
+EOF
+expect_same "impure arguments are evaluated exactly once" "$TMP/sidefx.wyn" $'1\n1\n10'
+
+# 7. A loop var whose inputs change inside the loop is not hoisted.
+cat > "$TMP/licm.wyn" <<'EOF'
+fn run(n: int) -> int {
+    var total = 0
+    var i = 0
+    var base = 1
+    while i < n {
+        var inv = n * 3
+        var dep = base * 2
+        total = total + inv + dep
+        base = base + 1
+        i = i + 1
+    }
+    return total
+}
+fn main() {
+    println(run(4))
+}
+EOF
+expect_same "only invariant loop vars are hoisted" "$TMP/licm.wyn" "68"
+
+# 8. Closure capturing a constant, and a const used from another fn.
+cat > "$TMP/closure.wyn" <<'EOF'
+const LIMIT = 3
+fn over(v: int) -> bool => v > LIMIT
+fn main() {
+    var base = 100
+    var add = (n: int) => n + base
+    println(add(1))
+    println(over(5))
+}
+EOF
+expect_same "constants reach closures and other fns" "$TMP/closure.wyn" $'101\ntrue'
+
+# --- the passes fire: inspect the generated C ---
+cp "$TMP/licm.wyn" "$TMP/gen.wyn"
+cat >> "$TMP/gen.wyn" <<'EOF'
+fn sq(x: int) -> int => x * x
+fn folded() -> int {
+    var w = 8
+    if w > 100 {
+        println("dead")
+    }
+    return w * 4 + sq(3)
+}
+EOF
+( cd "$TMP" && "$WYN" build gen.wyn --debug -O2 >/dev/null 2>&1 )
+if grep -q "return 41;" "$TMP/gen.wyn.c"; then ok "-O2 folds, propagates and inlines to a constant"
+else bad "-O2 folds, propagates and inlines to a constant [$(grep -A6 'long long folded' "$TMP/gen.wyn.c" | tr '\n' ' ')]"; fi
+if ! grep -q '"dead"' "$TMP/gen.wyn.c"; then ok "-O2 drops the constant-false branch"
+else bad "-O2 drops the constant-false branch"; fi
+# `var inv` is declared before the while; `var dep` stays inside it.
+if awk '/long long run\(/{f=1} f&&/long long inv/{inv=NR} f&&/while/{if(!w)w=NR} f&&/long long dep/{dep=NR} END{exit !(inv && w && inv<w && dep>w)}' "$TMP/gen.wyn.c"
+then ok "-O2 hoists the invariant var and keeps the variant one"
+else bad "-O2 hoists the invariant var and keeps the variant one"; fi
+( cd "$TMP" && "$WYN" build gen.wyn --debug -O0 >/dev/null 2>&1 )
+if grep -q "return 41;" "$TMP/gen.wyn.c"; then bad "-O0 leaves the AST alone"
+else ok "-O0 leaves the AST alone"; fi
+
+echo ""; echo "optimize: $PASS pass, $FAIL fail"; [ "$FAIL" -eq 0 ]
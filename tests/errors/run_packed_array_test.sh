@@ -0,0 +1,208 @@
+#!/bin/bash
+# Packed (unboxed) array gate. Array locals whose element type is known
+# statically - [int], [float], [bool] and [Struct] - are emitted as contiguous
+# WynIntArray / WynFloatArray / WynBoolArray / WynStructArray buffers instead of
+# WynArray's 16-byte tagged WynValues (see the packed-array block in codegen.c).
+# Switching layouts must never change what a program prints, so each program
+# here exercises every op with a packed lowering (push, index get/set, compound
+# assign, negative index, sort, sum, len, for-in, map/filter/reduce) and checks
+# the exact output, plus the cases that must stay boxed (the veto) and checks
+# on the generated C that the packed layouts are really chosen.
+set -uo pipefail
+WYN="${WYN:-./wyn}"
+case "$WYN" in /*) ;; *) WYN="$(pwd)/$WYN" ;; esac
+TMP=$(mktemp -d); trap 'rm -rf "$TMP"' EXIT
+PASS=0; FAIL=0
+ok(){ echo "  ok    $1"; PASS=$((PASS+1)); }
+bad(){ echo "  FAIL  $1"; FAIL=$((FAIL+1)); }
+
+run() {
+    perl -e 'alarm(60); exec @ARGV' -- "$WYN" run "$1" 2>&1 | grep -v "Compiled in"
+}
+expect() {
+    local name="$1" file="$2" want="$3" got
+    got=$(run "$file")
+    if [ "$got" = "$want" ]; then ok "$name"; else bad "$name: got=[$got] want=[$want]"; fi
+}
+
+# 1. [int]: every packed op, annotated and inferred spellings.
+cat > "$TMP/ints.wyn" <<'EOF'
+fn main() {
+    var xs: [int] = [3, 1, 2]
+    xs.push(7)
+    xs.sort()
+    xs[0] = xs[0] + 10
+    xs[1] += 5
+    var t = 0
+    for v in xs {
+        t = t + v
+    }
+    println(t)
+    println(xs.sum())
+    println(xs.len())
+    println(xs[-1])
+    var ys = [5, 6]
+    ys[1] = 60
+    println(ys[0] + ys[1])
+}
+EOF
+expect "[int] push/sort/index/set/sum/len/for" "$TMP/ints.wyn" $'28\n28\n4\n7\n65'
+
+# 2. [float]: negative values sort as doubles, int literals widen.
+cat > "$TMP/floats.wyn" <<'EOF'
+fn main() {
+    var fs = [1.5, -2.5, 0.5]
+    fs.push(4.0)
+    fs.sort()
+    fs[0] = fs[0] * 2.0
+    println(fs[0])
+    println(fs.sum())
+    for f in fs {
+        println(f)
+    }
+    var ws: [float] = [1, 2]
+    println(ws[1] / 4.0)
+}
+EOF
+expect "[float] push/sort/index/set/sum/for" "$TMP/floats.wyn" $'-5.0\n1.0\n-5.0\n0.5\n1.5\n4.0\n0.5'
+
+# 3. [bool] prints true/false, not 1/0.
+cat > "$TMP/bools.wyn" <<'EOF'
+fn main() {
+    var bs = [true, false]
+    bs.push(false)
+    bs[2] = true
+    println(bs[1])
+    println(bs.len())
+    for b in bs {
+        println(b)
+    }
+}
+EOF
+expect "[bool] push/index/set/for" "$TMP/bools.wyn" $'false\n3\ntrue\nfalse\ntrue'
+
+# 4. [Struct] by value; a field store through xs[i] writes the element.
+cat > "$TMP/structs.wyn" <<'EOF'
+struct P {
+    x: int
+    hp: int
+}
+fn main() {
+    var ps = [P{x: 1, hp: 10}, P{x: 2, hp: 20}]
+    ps.push(P{x: 3, hp: 30})
+    ps[0] = P{x: 9, hp: 90}
+    ps[1].hp = 25
+    var tot = 0
+    for p in ps {
+        tot = tot + p.hp
+    }
+    println(ps[0].x)
+    println(ps[-1].hp)
+    println(tot)
+}
+EOF
+expect "[Struct] push/index/set/field-store/for" "$TMP/structs.wyn" $'9\n30\n145'
+
+# 5. map/filter/reduce read the packed buffer and hand back a boxed array.
+cat > "$TMP/hof.wyn" <<'EOF'
+fn main() {
+    var ns = [1, 2, 3, 4]
+    var dbl = ns.map((n: int) => n * 2)
+    var ev = ns.filter((n: int) => n % 2 == 0)
+    var r = ns.reduce((acc: int, n: int) => acc + n, 0)
+    var names = ns.map((n: int) => "n${n}")
+    println(dbl[3])
+    println(ev.len())
+    println(r)
+    println(names[2])
+    var fs = [0.5, 1.5]
+    var tens = fs.map((f: float) => f * 10.0)
+    println(tens[1])
+}
+EOF
+expect "map/filter/reduce over packed receivers" "$TMP/hof.wyn" $'8\n2\n10\nn3\n15.0'
+
+# 6. The same name packed in one fn and boxed in another, an array from a
+#    call, and a packed temp in a loop body (freed at block exit).
+cat > "$TMP/scopes.wyn" <<'EOF'
+fn mk() -> [int] {
+    return [4, 5, 6]
+}
+fn a() -> int {
+    var xs: [int] = [1, 2, 3]
+    xs.push(4)
+    return xs.len()
+}
+fn b() -> int {
+    var xs = mk()
+    return xs[1]
+}
+fn main() {
+    var ys: [int] = mk()
+    println(a())
+    println(b())
+    println(ys[2])
+    var total = 0.0
+    var i = 0
+    while i < 3 {
+        var tmp = [1.0, 2.0]
+        tmp.push(3.0)
+        total = total + tmp.sum()
+        i = i + 1
+    }
+    println(total)
+}
+EOF
+expect "per-fn registry, call-initialised arrays, loop temps" "$TMP/scopes.wyn" $'4\n5\n6\n18.0'
+
+# 7. Vetoed uses stay boxed and still work: passing to a fn, copying,
+#    returning, passing as a method argument.
+cat > "$TMP/veto.wyn" <<'EOF'
+fn total(v: [float]) -> float {
+    var s = 0.0
+    for x in v {
+        s = s + x
+    }
+    return s
+}
+fn evens() -> [int] {
+    var es = [2, 4]
+    es.push(6)
+    return es
+}
+fn main() {
+    var gs = [1.0, 2.0]
+    gs.push(3.0)
+    println(total(gs))
+    var hs = [1, 2]
+    var copy = hs
+    println(copy[1])
+    println(evens().len())
+    var a2 = [1, 2]
+    var b2 = [3]
+    var c2 = a2.concat(b2)
+    println(c2.len())
+}
+EOF
+expect "vetoed uses stay boxed" "$TMP/veto.wyn" $'6.0\n2\n3\n3'
+
+# 8. Out-of-range reads still panic with the boxed message.
+printf 'fn main() {\n    var fs = [1.5, 2.5]\n    println(fs[5])\n}\n' > "$TMP/oob.wyn"
+out=$(run "$TMP/oob.wyn")
+if echo "$out" | grep -q "array index out of bounds: index 5, length 2"; then ok "packed out-of-range read panics"
+else bad "packed out-of-range read panics [$out]"; fi
+
+# --- the layouts are really chosen: inspect the generated C ---
+cat "$TMP/floats.wyn" > "$TMP/gen.wyn"
+sed -e 's/fn main()/fn bools()/' "$TMP/bools.wyn" >> "$TMP/gen.wyn"
+sed -e 's/fn main()/fn structs()/' "$TMP/structs.wyn" >> "$TMP/gen.wyn"
+sed -e 's/fn main()/fn ints()/' "$TMP/ints.wyn" >> "$TMP/gen.wyn"
+( cd "$TMP" && "$WYN" build gen.wyn --debug >/dev/null 2>&1 )
+for t in "WynFloatArray fs" "WynBoolArray bs" "WynStructArray ps" "WynIntArray xs"; do
+    if grep -q "^$t = " "$TMP/gen.wyn.c"; then ok "emits $t"; else bad "emits $t"; fi
+done
+( cd "$TMP" && "$WYN" build veto.wyn --debug >/dev/null 2>&1 )
+if grep -q "^WynArray gs = " "$TMP/veto.wyn.c" && grep -q "^WynArray hs = " "$TMP/veto.wyn.c"
+then ok "vetoed arrays are WynArray"; else bad "vetoed arrays are WynArray"; fi
+
+echo ""; echo "packed-array: $PASS pass, $FAIL fail"; [ "$FAIL" -eq 0 ]
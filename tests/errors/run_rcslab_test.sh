@@ -0,0 +1,181 @@
+#!/bin/bash
+# Slab allocator for RC blocks (src/wyn_rc.c, WYN_RC_SLAB).
+# Covers: strings in every size class and past the 4KB slab limit keep their
+# contents through churn, strings handed across spawned tasks in both
+# directions (frees by a thread that does not own the page, pages of exited
+# workers adopted later), identical output with WYN_RC_SLAB=0 and under
+# --release, and a C harness against wyn_rc.c itself: literals, interior
+# pointers and freed blocks are never "heap", and threads freeing each
+# other's blocks at random never see a block handed out twice.
+set -uo pipefail
+WYN="${WYN:-./wyn}"
+case "$WYN" in /*) ;; *) WYN="$(pwd)/$WYN" ;; esac
+SRC="$(cd "$(dirname "$0")/../../src" && pwd)"
+TMP=$(mktemp -d)
+trap 'rm -rf "$TMP"' EXIT
+PASS=0; FAIL=0
+ok(){ echo "  ok    $1"; PASS=$((PASS+1)); }
+bad(){ echo "  FAIL  $1"; FAIL=$((FAIL+1)); }
+
+expect() {
+    local name="$1" file="$2" want="$3" got
+    got=$(perl -e 'alarm(120); exec @ARGV' -- "$WYN" run "$file" 2>&1 | grep -v "Compiled in")
+    if [ "$got" = "$want" ]; then ok "$name"; else bad "$name: got=[$got] want=[$want]"; fi
+}
+
+# 1. Every size class, and blocks too big for the slab, survive churn.
+cat > "$TMP/churn.wyn" <<'WYN'
+fn main() {
+    var pad = "abcdefghij".repeat(600)
+    var keep = []
+    var i = 0
+    var total = 0
+    while i < 60000 {
+        var n = 1 + (i * 97) % 6000
+        var s = pad.substring(0, n)
+        if i % 50 == 0 {
+            keep.push(s)
+        }
+        total = total + s.len()
+        i = i + 1
+    }
+    var same = 0
+    for k in keep {
+        if k == pad.substring(0, k.len()) {
+            same = same + 1
+        }
+    }
+    println(total)
+    println("${same}/${keep.len()}")
+}
+WYN
+CHURN_WANT=$'180030000\n1200/1200'
+expect "size classes and large blocks" "$TMP/churn.wyn" "$CHURN_WANT"
+
+# 2. Strings cross threads both ways: workers build strings main frees, and
+#    release strings main built.
+cat > "$TMP/threads.wyn" <<'WYN'
+fn build(id: int, n: int) -> string {
+    var out = ""
+    var i = 0
+    while i < n {
+        var piece = "w${id}-${i};"
+        out = out + piece.substring(0, 2)
+        i = i + 1
+    }
+    return out
+}
+fn measure(s: string) -> int {
+    var t = s + "!"
+    return t.len()
+}
+fn main() {
+    var round = 0
+    var total = 0
+    while round < 4 {
+        var fs = []
+        var w = 0
+        while w < 8 {
+            fs.push(spawn build(w, 2000 + w))
+            w = w + 1
+        }
+        for r in await_all(fs) {
+            total = total + r.len()
+        }
+        var gs = []
+        w = 0
+        while w < 8 {
+            gs.push(spawn measure("main-" + w.to_string() + "-" + round.to_string()))
+            w = w + 1
+        }
+        for n in await_all(gs) {
+            total = total + n
+        }
+        round = round + 1
+    }
+    println(total)
+}
+WYN
+THREADS_WANT="128512"
+expect "strings freed by other threads" "$TMP/threads.wyn" "$THREADS_WANT"
+
+# 3. WYN_RC_SLAB=0 (every block from malloc) and --release print the same.
+if "$WYN" build "$TMP/churn.wyn" -o "$TMP/churn_rel" --release > "$TMP/rel.log" 2>&1 &&
+   "$WYN" build "$TMP/threads.wyn" -o "$TMP/threads_rel" --release >> "$TMP/rel.log" 2>&1; then
+    want="$CHURN_WANT"$'\n'"$THREADS_WANT"
+    got=$("$TMP/churn_rel"; "$TMP/threads_rel")
+    if [ "$got" = "$want" ]; then ok "--release output identical"; else bad "--release: got=[$got]"; fi
+    got=$(WYN_RC_SLAB=0 "$TMP/churn_rel"; WYN_RC_SLAB=0 "$TMP/threads_rel")
+    if [ "$got" = "$want" ]; then ok "WYN_RC_SLAB=0 output identical"; else bad "WYN_RC_SLAB=0: got=[$got]"; fi
+else
+    bad "--release build failed: $(head -5 "$TMP/rel.log")"
+fi
+
+# 4. The allocator itself.
+if ! echo 'int main(void){return 0;}' | cc -x c - -o /dev/null 2>/dev/null; then
+    echo "  skip  allocator harness (no C compiler)"
+else
+cat > "$TMP/slab.c" <<'EOF'
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+void* wyn_rc_alloc(size_t);
+void wyn_rc_retain(const void*);
+void wyn_rc_release(const void*);
+int wyn_rc_is_heap(const void*);
+void wyn_rc_set_length(const void*, uint32_t);
+uint32_t wyn_rc_get_length(const void*);
+#define SLOTS 2048
+static void* _Atomic slot[SLOTS];
+static atomic_int bad;
+static void* worker(void* arg) {
+    unsigned seed = (unsigned)(size_t)arg;
+    for (int it = 0; it < 100000; it++) {
+        seed = seed * 1103515245 + 12345;
+        size_t n = 1 + (seed >> 8) % 5000;
+        unsigned char* p = wyn_rc_alloc(n);
+        if (!wyn_rc_is_heap(p) || (n < 4000 && wyn_rc_is_heap(p + 1))) atomic_store(&bad, 1);
+        memset(p, (int)(seed >> 24), n);
+        wyn_rc_set_length(p, (uint32_t)n);
+        // Swap into a shared slot; the previous occupant (often another
+        // thread's block) must still hold the one byte it was filled with.
+        unsigned char* old = atomic_exchange(&slot[(seed >> 4) % SLOTS], p);
+        if (old) {
+            uint32_t len = wyn_rc_get_length(old);
+            for (uint32_t k = 1; k < len; k++)
+                if (old[k] != old[0]) { atomic_store(&bad, 2); break; }
+            wyn_rc_release(old);
+        }
+    }
+    return NULL;
+}
+int main(void) {
+    static const char lit[] = "literal";
+    if (wyn_rc_is_heap(lit) || wyn_rc_is_heap("x")) { puts("literal is heap"); return 1; }
+    char* s = wyn_rc_alloc(40);
+    wyn_rc_retain(s);
+    wyn_rc_release(s);
+    if (!wyn_rc_is_heap(s)) { puts("retained block lost"); return 1; }
+    wyn_rc_release(s);
+    if (wyn_rc_is_heap(s)) { puts("freed block is heap"); return 1; }
+    for (int round = 0; round < 3; round++) {
+        pthread_t t[6];
+        for (int i = 0; i < 6; i++) pthread_create(&t[i], NULL, worker, (void*)(size_t)(round * 6 + i + 1));
+        for (int i = 0; i < 6; i++) pthread_join(t[i], NULL);
+    }
+    for (int i = 0; i < SLOTS; i++) if (slot[i]) wyn_rc_release(slot[i]);
+    printf("%s\n", atomic_load(&bad) ? "corrupt" : "ok");
+    return 0;
+}
+EOF
+    if ! cc -O1 -std=c11 -D_GNU_SOURCE -I "$SRC" "$TMP/slab.c" "$SRC/wyn_rc.c" -o "$TMP/slab" -lpthread 2>"$TMP/cc.txt"; then
+        bad "allocator harness does not compile: $(head -5 "$TMP/cc.txt")"
+    else
+        got=$(perl -e 'alarm(120); exec @ARGV' -- "$TMP/slab" 2>&1)
+        if [ "$got" = "ok" ]; then ok "allocator harness"; else bad "allocator harness: $got"; fi
+    fi
+fi
+
+echo ""; echo "rcslab: $PASS pass, $FAIL fail"; [ "$FAIL" -eq 0 ]
@@ -0,0 +1,246 @@
+#!/bin/bash
+# Regex module: the pattern cache, Regex.compile handles and the lazy-DFA engine
+# (src/wyn_regex.h, driven from the Regex section of src/wyn_runtime.h).
+# Covers: the string API and its empty-match / continuation edge cases, handles
+# (valid, invalid, freed), results with the cache off, at size 1 and with
+# eviction, and a differential check of the engine against glibc regcomp.
+# The differential check runs a pattern corpus plus random patterns, in both the
+# strict POSIX mode and the line mode Windows uses (vs REG_NEWLINE), with a
+# pattern big enough to overflow the DFA cache into NFA simulation. Worker
+# threads share one compiled program to exercise the lock-free transition table.
+set -uo pipefail
+WYN="${WYN:-./wyn}"
+case "$WYN" in /*) ;; *) WYN="$(pwd)/$WYN" ;; esac
+SRC="$(cd "$(dirname "$0")/../../src" && pwd)"
+PASS=0; FAIL=0
+ok(){ echo "  ok    $1"; PASS=$((PASS+1)); }
+bad(){ echo "  FAIL  $1"; FAIL=$((FAIL+1)); }
+TMP=$(mktemp -d)
+trap 'rm -rf "$TMP"' EXIT
+
+expect() {
+    local name="$1" file="$2" want="$3" got
+    got=$(perl -e 'alarm(60); exec @ARGV' -- "$WYN" run "$file" 2>&1 | grep -v "Compiled in")
+    if [ "$got" = "$want" ]; then ok "$name"; else bad "$name: got=[$got] want=[$want]"; fi
+}
+
+# 1. String API. Empty matches used to spin forever in replace/find_all/split,
+#    and ^ matched again at every continuation point.
+cat > "$TMP/api.wyn" <<'EOF'
+fn main() {
+    println(Regex.match("GET /index.html HTTP/1.1", "^(GET|POST) /[a-z.]+"))
+    println(Regex.match("x", "a("))
+    println(Regex.replace("baaac", "a*", "-"))
+    println(Regex.replace("aaa", "^a", "b"))
+    println(Regex.replace("one two  three", " +", "_"))
+    println(Regex.find("id=42;", "[0-9]+"))
+    println(Regex.find("abc", "z"))
+    println(Regex.find_all("a1 b22 c333", "[0-9]*"))
+    println(Regex.split("k1=v1, k2=v2,k3", ", *"))
+    println(Regex.split("abc", "x*"))
+    println(Regex.match("tab\there", "[[:space:]]"))
+    println(Regex.match("word", "\\w+$"))
+    println(Regex.replace("a.b.c", "\\.", "/"))
+    println(Regex.match("ab", "a\\b"))
+    println(Regex.match("xaaay", "xa{2,3}y"))
+    println(Regex.match("xaaaay", "^xa{2,3}y$"))
+}
+EOF
+expect "string API" "$TMP/api.wyn" $'true\nfalse\n-b-c-\nbaa\none_two_three\n3\n-1\n1\n22\n333\n\nk1=v1\nk2=v2\nk3\nabc\ntrue\ntrue\na/b/c\nfalse\ntrue\nfalse'
+
+# 2. Compiled handles.
+cat > "$TMP/handles.wyn" <<'EOF'
+fn main() {
+    var re = Regex.compile("([0-9]+)\\.([0-9]+)")
+    println(re > 0)
+    println(Regex.is_match(re, "v1.20"))
+    println(Regex.is_match(re, "v1"))
+    println(Regex.find_in(re, "ver 3.14 ok"))
+    println(Regex.replace_in(re, "1.5 and 2.75", "N"))
+    println(Regex.find_all_in(re, "1.5 x 2.75 y 3"))
+    println(Regex.split_in(re, "a1.1b2.2c"))
+    println(Regex.compile("(unclosed"))
+    var words = Regex.compile("[a-z]+")
+    var hits = 0
+    var i = 0
+    while i < 20000 {
+        if Regex.is_match(words, "line " + i.to_string()) {
+            hits = hits + 1
+        }
+        i = i + 1
+    }
+    println(hits)
+    Regex.free(re)
+    println(Regex.is_match(re, "1.5"))
+    println(Regex.find_in(re, "1.5"))
+    println(Regex.replace_in(re, "1.5", "N"))
+    Regex.free(re)
+    Regex.free(words)
+}
+EOF
+expect "compiled handles" "$TMP/handles.wyn" $'true\ntrue\nfalse\n4\nN and N\n1.5\n2.75\n\na\nb\nc\n-1\n20000\nfalse\n-1\n1.5'
+
+# 3. The cache never changes results: off, size 1 (every call evicts), and the
+#    default with more distinct patterns than entries.
+cat > "$TMP/cache.wyn" <<'EOF'
+fn main() {
+    var n = 0
+    var i = 0
+    while i < 300 {
+        var pat = "^k" + (i % 100).to_string() + "="
+        if Regex.match("k" + (i % 100).to_string() + "=v", pat) {
+            n = n + 1
+        }
+        if Regex.match("k" + i.to_string() + "=v", "^x") {
+            n = n + 1000
+        }
+        i = i + 1
+    }
+    println(n)
+    println(Regex.replace("a-b-c", "-", "+"))
+    var h = Regex.compile("b+")
+    var j = 0
+    while j < 100 {
+        Regex.match("x", "p" + j.to_string())
+        j = j + 1
+    }
+    println(Regex.replace_in(h, "abbbc", "B"))
+}
+EOF
+for size in 0 1 64; do
+    got=$(WYN_REGEX_CACHE=$size perl -e 'alarm(60); exec @ARGV' -- "$WYN" run "$TMP/cache.wyn" 2>&1 | grep -v "Compiled in")
+    if [ "$got" = $'300\na+b+c\naBc' ]; then ok "cache size $size"; else bad "cache size $size: got=[$got]"; fi
+done
+
+# 4. Differential check of the engine against glibc.
+if ! echo 'int main(void){return 0;}' | cc -x c - -o /dev/null 2>/dev/null; then
+    echo "  skip  differential check (no C compiler)"
+else
+cat > "$TMP/diff.c" <<'EOF'
+#include <stdio.h>
+#include <pthread.h>
+#include <regex.h>
+#include "wyn_regex.h"
+static int bad = 0;
+static const char* corpus[] = {
+    "a", "abc", "a*", "a+", "a?", "a|b", "ab|cd", "(a|b)*c", "^abc", "abc$", "^$", "^", "$", "a$|b",
+    "[abc]", "[^abc]", "[a-z]+", "[]a]", "[^]a]", "[a-]", "x[0-9]{2,4}y", "a{3}", "a{2,}", "a{,3}",
+    "a{0}", "a{2}{3}", "(ab){2,3}", "(a|)b", "a+?", "()", "a|", "a**", "\\.", "\\w+", "\\W", "\\s+\\S",
+    "[[:alpha:]]+", "[[:digit:][:space:]]+", "[[:punct:]]", "[[:xdigit:]]+", "(foo|foobar)(bar)?",
+    "(a*)*b", "(a|ab)(c|bcd)(d*)", "x*", "ERROR|WARN", "GET /[a-z/]+ HTTP", "(.*)x", "(a|b)*abb",
+    "[0-9]+\\.[0-9]+\\.[0-9]+\\.[0-9]+", "\\d", "\\b", "[.]", "[\\]]", "[\\d]", "\\(", "a\\|b",
+    "*a", "x{", "a{1,2", "[z-a]", "^*a", "(a", "a)", "[abc", "[[.a.]]", "a{300}", "\\", "a{2,1}",
+    "{1}", "a|*b", "[a-c-e]", "(^a|b)c", "a$b", ".", ".*", ".+", "(x|y|z){1,5}w", "((a)|b)+c",
+    "[ab]{5}", "(aa|a)(ab|b)", "y*$", "^y*", "", "a||b", "[--z]", "a{,}", NULL};
+static const char* inputs[] = {
+    "", "a", "b", "abc", "xabcx", "aaa", "baaac", "ab\ncd", "abb abb", "x12y x1234y x123456y",
+    "foo foobar foobarbar", "hello, world! 123", "GET /a/b HTTP/1.1", "ERROR: x WARN", "10.0.0.1 ok",
+    "aab ab abcd abcbcd", "  \t x", "d.n b\\", "]a[", "a-c-e", "xxxxyyy", "a\nb\n", "aaaaaax", NULL};
+static const char* toks[] = {"a", "b", "c", ".", "*", "+", "?", "|", "(", ")", "[ab]", "[^a]", "^", "$",
+    "{1,2}", "{2}", "{0,1}", "\\w", "x", NULL};
+
+// Every match from every offset must agree with regexec. Offsets use
+// REG_NOTBOL, which only matches the engine's whole-string view without
+// REG_NEWLINE, so line mode compares from offset 0 only.
+static void check(const char* pat, int flags, const char* in, int verbose) {
+    regex_t re;
+    int pc = regcomp(&re, pat, REG_EXTENDED | ((flags & WRE_NEWLINE) ? REG_NEWLINE : 0));
+    struct wre_prog* p = wre_compile(pat, flags);
+    if (!p) { if (pc == 0) regfree(&re); return; }
+    if (pc != 0) { if (verbose) printf("accepted invalid /%s/\n", pat); bad++; wre_free(p); return; }
+    long len = (long)strlen(in), last = (flags & WRE_NEWLINE) ? 0 : len;
+    for (long from = 0; from <= last; from++) {
+        regmatch_t m;
+        int r = regexec(&re, in + from, 1, &m, from ? REG_NOTBOL : 0);
+        long ms = -1, me = -1;
+        bool hit = wre_search(p, in, len, from, &ms, &me);
+        if ((r == 0) != hit || (hit && (ms != from + m.rm_so || me != from + m.rm_eo))) {
+            if (verbose) printf("/%s/ on \"%s\" from %ld: regexec %d, wre %d %ld-%ld\n", pat, in, from, r == 0, hit, ms, me);
+            bad++;
+            break;
+        }
+        if (from == 0 && wre_test(p, in, len) != (r == 0)) { bad++; break; }
+    }
+    regfree(&re);
+    wre_free(p);
+}
+
+// Long inputs: walk the matches left to right, as Regex.find_all does.
+static void walk(const char* pat, const char* in) {
+    regex_t re;
+    regcomp(&re, pat, REG_EXTENDED);
+    struct wre_prog* p = wre_compile(pat, WRE_STRICT);
+    long len = (long)strlen(in), pos = 0, ms, me;
+    while (p && pos <= len) {
+        regmatch_t m;
+        int r = regexec(&re, in + pos, 1, &m, pos ? REG_NOTBOL : 0);
+        bool hit = wre_search(p, in, len, pos, &ms, &me);
+        if ((r == 0) != hit || (hit && (ms != pos + m.rm_so || me != pos + m.rm_eo))) {
+            printf("/%s/ at %ld: regexec %d, wre %d\n", pat, pos, r == 0, hit);
+            bad++;
+            break;
+        }
+        if (!hit) break;
+        pos = me > ms ? me : ms + 1;
+    }
+    regfree(&re);
+    wre_free(p);
+}
+
+static struct wre_prog* shared;
+static const char* text;
+static void* worker(void* arg) {
+    long n = 0, pos = 0, ms, me, len = (long)strlen(text);
+    (void)arg;
+    while (pos <= len && wre_search(shared, text, len, pos, &ms, &me)) { n++; pos = me > ms ? me : ms + 1; }
+    return (void*)n;
+}
+
+int main(void) {
+    for (int i = 0; corpus[i]; i++)
+        for (int j = 0; inputs[j]; j++) {
+            check(corpus[i], WRE_STRICT, inputs[j], 1);
+            check(corpus[i], WRE_STRICT | WRE_NEWLINE, inputs[j], 1);
+        }
+    printf("corpus %d\n", bad);
+    srand(1);
+    int nt = 0;
+    while (toks[nt]) nt++;
+    for (int it = 0; it < 20000; it++) {
+        char pat[128] = "", in[16];
+        int k = 1 + rand() % 8, L = rand() % 12;
+        for (int i = 0; i < k; i++) strcat(pat, toks[rand() % nt]);
+        for (int i = 0; i < L; i++) in[i] = "abcx\n"[rand() % 5];
+        in[L] = 0;
+        check(pat, (it & 1) ? WRE_STRICT | WRE_NEWLINE : WRE_STRICT, in, bad < 5);
+    }
+    printf("random %d\n", bad);
+    static char big[200001];
+    for (int i = 0; i < 200000; i++) big[i] = "ab"[rand() % 2];
+    walk("(a|b)*a(a|b){12}", big);    // more than WRE_DFA_MAX states: NFA fallback
+    walk("abbabba", big);             // literal prefix prefilter
+    walk("ba{3,5}b|ab{4}", big);
+    printf("large %d\n", bad);
+    for (int i = 0; i < 200000; i++) big[i] = "abcdefxyz0123 \n"[rand() % 15];
+    text = big;
+    shared = wre_compile("[a-f]+[0-9]{2,3}", WRE_STRICT);
+    long want = (long)worker(NULL);
+    wre_free(shared);
+    shared = wre_compile("[a-f]+[0-9]{2,3}", WRE_STRICT);
+    pthread_t t[4];
+    for (int i = 0; i < 4; i++) pthread_create(&t[i], NULL, worker, NULL);
+    for (int i = 0; i < 4; i++) { void* v; pthread_join(t[i], &v); if ((long)v != want) bad++; }
+    wre_free(shared);
+    printf("threads %d\n", bad);
+    return bad != 0;
+}
+EOF
+    if ! cc -O2 -I "$SRC" "$TMP/diff.c" -o "$TMP/diff" -lpthread 2>"$TMP/cc.txt"; then
+        bad "differential harness does not compile: $(head -5 "$TMP/cc.txt")"
+    else
+        got=$(perl -e 'alarm(120); exec @ARGV' -- "$TMP/diff" 2>&1)
+        if [ "$got" = $'corpus 0\nrandom 0\nlarge 0\nthreads 0' ]; then ok "engine agrees with regcomp"; else bad "engine vs regcomp: $got"; fi
+    fi
+fi
+
+echo ""; echo "regex: $PASS pass, $FAIL fail"; [ "$FAIL" -eq 0 ]
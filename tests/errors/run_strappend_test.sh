@@ -0,0 +1,139 @@
+#!/bin/bash
+# In-place string append (`s = s + x` / `s += x` -> wyn_string_append_owned in
+# wyn_runtime.h, selected by string_append_pieces in codegen_expr.c).
+# Covers: a long build-up loop with string and int pieces, chained pieces,
+# every way another reference to the buffer can exist before an append (alias
+# var, array element, map value, return value, struct field, parameter) -
+# each must keep its old contents - a piece that mentions the target
+# (`s = s + s`, `s = s + s.upper()`), appends inside a function that returns
+# the result, and the same program under --release (slim runtime).
+set -uo pipefail
+WYN="${WYN:-./wyn}"
+case "$WYN" in /*) ;; *) WYN="$(pwd)/$WYN" ;; esac
+TMP=$(mktemp -d)
+trap 'rm -rf "$TMP"' EXIT
+PASS=0; FAIL=0
+ok(){ echo "  ok    $1"; PASS=$((PASS+1)); }
+bad(){ echo "  FAIL  $1"; FAIL=$((FAIL+1)); }
+
+expect() {
+    local name="$1" file="$2" want="$3" got
+    got=$(perl -e 'alarm(120); exec @ARGV' -- "$WYN" run "$file" 2>&1 | grep -v "Compiled in")
+    if [ "$got" = "$want" ]; then ok "$name"; else bad "$name: got=[$got] want=[$want]"; fi
+}
+
+# 1. Build-up loops.
+cat > "$TMP/loop.wyn" <<'EOF'
+fn main() {
+    var s = ""
+    var i = 0
+    while i < 200000 {
+        s = s + "ab"
+        s += i % 10
+        i = i + 1
+    }
+    println(s.len())
+    println(s.slice(0, 12))
+    var t = "x"
+    t = t + "-" + 42 + "-" + "y".upper() + "-" + "${i}"
+    println(t)
+}
+EOF
+expect "build-up loop and chained pieces" "$TMP/loop.wyn" $'600000\nab0ab1ab2ab3\nx-42-Y-200000'
+
+# 2. Every other holder of the buffer keeps the old contents.
+cat > "$TMP/alias.wyn" <<'EOF'
+struct Box {
+    name: string
+}
+fn keep(x: string) -> string {
+    return x
+}
+fn grow(x: string) -> string {
+    x = x + "?"
+    x += "!"
+    return x
+}
+fn main() {
+    var s = "ab"
+    s = s + "cd"
+    var a = s
+    s = s + "1"
+    var arr = []
+    arr.push(s)
+    s = s + "2"
+    var m = {"k": s}
+    s = s + "3"
+    var k = keep(s)
+    s = s + "4"
+    var b = Box { name: s }
+    println(b.name)
+    s = s + "5"
+    var g = grow(s)
+    s += "6"
+    println(s)
+    println(a)
+    println(arr[0])
+    println(m["k"])
+    println(k)
+    println(g)
+}
+EOF
+expect "aliases are never mutated" "$TMP/alias.wyn" \
+$'abcd1234\nabcd123456\nabcd\nabcd1\nabcd12\nabcd123\nabcd12345?!'
+
+# 3. Pieces that read the target.
+cat > "$TMP/self.wyn" <<'EOF'
+fn main() {
+    var s = "ab"
+    var i = 0
+    while i < 12 {
+        s = s + s
+        i = i + 1
+    }
+    println(s.len())
+    var u = "x"
+    u = u + "y"
+    u = u + u.upper() + u
+    println(u)
+}
+EOF
+expect "pieces that mention the target" "$TMP/self.wyn" $'8192\nxyXYxy'
+
+# 4. Appending inside a function that returns the result, called repeatedly.
+cat > "$TMP/fn.wyn" <<'EOF'
+fn render(n: int) -> string {
+    var out = "<ul>"
+    var i = 0
+    while i < n {
+        out += "<li>" + i.to_string() + "</li>"
+        i = i + 1
+    }
+    out = out + "</ul>"
+    return out
+}
+fn main() {
+    var total = 0
+    var r = 0
+    while r < 2000 {
+        var html = render(50)
+        total = total + html.len()
+        r = r + 1
+    }
+    println(total)
+    println(render(3))
+}
+EOF
+expect "append in a returning function" "$TMP/fn.wyn" $'1098000\n<ul><li>0</li><li>1</li><li>2</li></ul>'
+
+# 5. The slim --release runtime behaves the same.
+if "$WYN" build "$TMP/alias.wyn" -o "$TMP/alias_rel" --release > "$TMP/rel.log" 2>&1 &&
+   "$WYN" build "$TMP/loop.wyn" -o "$TMP/loop_rel" --release >> "$TMP/rel.log" 2>&1; then
+    got=$("$TMP/alias_rel"; "$TMP/loop_rel")
+    want=$'abcd1234\nabcd123456\nabcd\nabcd1\nabcd12\nabcd123\nabcd12345?!\n600000\nab0ab1ab2ab3\nx-42-Y-200000'
+    if [ "$got" = "$want" ]; then ok "--release output identical"; else bad "--release: got=[$got]"; fi
+else
+    bad "--release build failed: $(head -5 "$TMP/rel.log")"
+fi
+
+echo ""; echo "strappend: $PASS pass, $FAIL fail"; [ "$FAIL" -eq 0 ]
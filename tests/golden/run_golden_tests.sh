@@ -1,7 +1,7 @@
 #!/bin/bash
 # Golden-C snapshot tests.
 #
-# Each tests/golden/<name>.wyn is compiled with `wyn build <file> --debug`,
+# Each tests/golden/<name>.wyn is compiled with `wyn build <file> --debug -O0`,
 # which emits the generated C next to the source as <name>.wyn.c. That C is
 # normalized and diffed against the checked-in snapshot <name>.c.golden.
 # Purpose: catch ANY unintended change to emitted C during codegen refactors
@@ -20,6 +20,13 @@
 # bare basename (and strips CR for portability). Nothing else is touched:
 # snapshots are whole-file.
 #
+# Optimizer: snapshots are taken at -O0 so they pin what CODEGEN emits for
+# each construct - at the default -O1 the AST optimizer (src/optimize.c) would
+# fold most of these small programs away. A test that snapshots optimizer
+# output says so on its first line:
+#   // golden-flags: -O2
+# and those flags replace the -O0.
+#
 # Usage:
 #   WYN=./wyn bash tests/golden/run_golden_tests.sh            # verify
 #   WYN=./wyn bash tests/golden/run_golden_tests.sh --update   # regenerate
@@ -59,7 +66,8 @@ for wyn_src in "$DIR"/*.wyn; do
     # on windows-latest, the first time this suite was gated there) reported only
     # "wyn build failed" with no cause - undiagnosable from a CI log, which is
     # the one place you cannot attach a debugger.
-    if ! "$WYN" build "$work" --debug > "$TMP/$base.build.log" 2>&1 || [ ! -f "$work.c" ]; then
+    flags=$(sed -n '1s|^// golden-flags:||p' "$wyn_src")
+    if ! "$WYN" build "$work" --debug ${flags:--O0} > "$TMP/$base.build.log" 2>&1 || [ ! -f "$work.c" ]; then
         echo "  FAIL  $base - wyn build failed:"
         sed 's/^/          /' "$TMP/$base.build.log" | head -25
         FAIL=$((FAIL + 1))
@@ -157,8 +157,9 @@ fi
 # --- 4. eligibility gate: ineligible lambdas => 0 sites, still correct on CPU ---
 set_toml '[gpu]\nenabled = true\nfloat32 = true\n'
 
-# 4a. captured free variable
-printf 'fn main() {\n  var k = 10.0\n  var a = [1.0, 2.0, 3.0]\n  println(a.map((x) => x + k))\n}\n' > "$TMP/p.wyn"
+# 4a. captured free variable (computed at runtime: a literal `var k = 10.0`
+# is propagated into the lambda by the -O1 optimizer, leaving nothing captured)
+printf 'fn main() {\n  var a = [1.0, 2.0, 3.0]\n  var k = a[0] + 9.0\n  println(a.map((x) => x + k))\n}\n' > "$TMP/p.wyn"
 sites=$(build_sites); out=$( cd "$TMP" && ./p 2>/dev/null )
 { [ "$sites" = "0" ] && [ "$out" = "[11.0, 12.0, 13.0]" ]; } \
     && ok "captured variable => CPU fallback, correct ($out)" \